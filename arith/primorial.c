@@ -30,6 +30,7 @@
 #include "fmpz.h"
 #include "arith.h"
 #include "ulong_extras.h"
+#include "mpn_extras.h"
 
 #if FLINT64
 #define LARGEST_ULONG_PRIMORIAL 52
@@ -93,9 +94,9 @@ mp_size_t mpn_prod_limbs_balanced(mp_limb_t * result, mp_limb_t * scratch,
     len = alen + blen;
 
     if (alen <= blen)
-        top = mpn_mul(result, scratch + alen, blen, scratch, alen);
+        top = flint_mpn_mul(result, scratch + alen, blen, scratch, alen);
     else
-        top = mpn_mul(result, scratch, alen, scratch + alen, blen);
+        top = flint_mpn_mul(result, scratch, alen, scratch + alen, blen);
 
     if (!top)
         len--;
@@ -132,6 +133,7 @@ void arith_primorial(fmpz_t res, long n)
     mp_size_t len, pi;
     ulong bits;
     __mpz_struct * mpz_ptr;
+    const mp_limb_t * primes;
 
     if (n <= LARGEST_ULONG_PRIMORIAL)
     {
@@ -144,12 +146,12 @@ void arith_primorial(fmpz_t res, long n)
 
     pi = n_prime_pi(n);
     
-    n_compute_primes(pi);
-    bits = FLINT_BIT_COUNT(flint_primes[pi - 1]);
+    primes = n_primes_arr_readonly(pi);
+    bits = FLINT_BIT_COUNT(primes[pi - 1]);
     
     mpz_ptr = _fmpz_promote(res);
     mpz_realloc2(mpz_ptr, pi*bits);
     
-    len = mpn_prod_limbs(mpz_ptr->_mp_d, flint_primes, pi, bits);
+    len = mpn_prod_limbs(mpz_ptr->_mp_d, primes, pi, bits);
     mpz_ptr->_mp_size = len;
 }
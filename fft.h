@@ -255,6 +255,28 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n,
                         mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
                                 mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc);
 
+void fft_mfa_truncate_sqrt2_outer_threaded(mp_limb_t ** ii, mp_size_t n, 
+                      mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, int num_threads);
+
+void fft_mfa_truncate_sqrt2_inner_threaded(mp_limb_t ** ii, mp_limb_t ** jj, 
+            mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                    mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, 
+                                             mp_limb_t ** tt, int num_threads);
+
+void ifft_mfa_truncate_sqrt2_outer_threaded(mp_limb_t ** ii, mp_size_t n, 
+                        mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, int num_threads);
+
+void fft_mfa_truncate_sqrt2_inner_precache(mp_limb_t ** ii, mp_limb_t ** jj, 
+            mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                    mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, 
+                                             mp_limb_t ** tt, int num_threads);
+
+void fft_set_thread_cutoff(mp_size_t limbs);
+
+mp_size_t fft_get_thread_cutoff(void);
+
 void fft_negacyclic(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w, 
                              mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp);
 
@@ -272,9 +294,46 @@ long fft_adjust_limbs(mp_size_t limbs);
 void fft_mulmod_2expp1(mp_limb_t * r, mp_limb_t * i1, mp_limb_t * i2, 
                                         mp_size_t n, mp_size_t w, mp_limb_t * tt);
 
+void _flint_mpn_mul_fft_params(mp_bitcnt_t * depth, mp_bitcnt_t * w, 
+                                   int * mfa, mp_size_t n1, mp_size_t n2);
+
 void flint_mpn_mul_fft_main(mp_limb_t * r1, mp_limb_t * i1, mp_size_t n1, 
                                                     mp_limb_t * i2, mp_size_t n2);
 
+typedef struct
+{
+   mp_limb_t ** jj;    /* transformed coefficients of the fixed operand */
+   mp_size_t n2;       /* length in limbs of the fixed operand */
+   mp_size_t j2;       /* number of coefficients it was split into */
+   mp_size_t n1_max;   /* maximum length of the other operand */
+   mp_size_t trunc;    /* length the transform was truncated to */
+   mp_bitcnt_t depth;
+   mp_bitcnt_t w;
+   int mfa;            /* set if laid out for the matrix Fourier algorithm */
+} fft_precache_struct;
+
+typedef fft_precache_struct fft_precache_t[1];
+
+void mul_truncate_sqrt2_precache_init(fft_precache_t pre, mp_limb_t * i2, 
+   mp_size_t n2, mp_size_t n1_max, mp_bitcnt_t depth, mp_bitcnt_t w);
+
+void mul_truncate_sqrt2_precache(mp_limb_t * r1, mp_limb_t * i1, 
+                                      mp_size_t n1, const fft_precache_t pre);
+
+void mul_mfa_truncate_sqrt2_precache_init(fft_precache_t pre, mp_limb_t * i2, 
+   mp_size_t n2, mp_size_t n1_max, mp_bitcnt_t depth, mp_bitcnt_t w);
+
+void mul_mfa_truncate_sqrt2_precache(mp_limb_t * r1, mp_limb_t * i1, 
+                                      mp_size_t n1, const fft_precache_t pre);
+
+void fft_precache_clear(fft_precache_t pre);
+
+void flint_mpn_mul_fft_main_precache_init(fft_precache_t pre, 
+                             mp_limb_t * i2, mp_size_t n2, mp_size_t n1_max);
+
+void flint_mpn_mul_fft_main_precache(mp_limb_t * r1, mp_limb_t * i1, 
+                                      mp_size_t n1, const fft_precache_t pre);
+
 void fft_convolution(mp_limb_t ** ii, mp_limb_t ** jj, long depth, 
                                  long limbs, long trunc, mp_limb_t ** t1, 
                                 mp_limb_t ** t2, mp_limb_t ** s1, mp_limb_t * tt);
@@ -57,6 +57,7 @@ void fft_combine_bits(mp_limb_t * res, mp_limb_t ** poly, long length,
    mp_bitcnt_t shift_bits, top_bits = ((FLINT_BITS - 1) & bits);
    mp_size_t coeff_limbs, i;
    mp_limb_t * temp, * limb_ptr, * end;
+   TMP_INIT;
    
    if (top_bits == 0)
    {
@@ -65,7 +66,8 @@ void fft_combine_bits(mp_limb_t * res, mp_limb_t ** poly, long length,
    }
    
    coeff_limbs = (bits/FLINT_BITS) + 1;
-   temp = flint_malloc((output_limbs + 1)*sizeof(mp_limb_t));
+   TMP_START;
+   temp = TMP_ALLOC((output_limbs + 1)*sizeof(mp_limb_t));
    shift_bits = 0;
    limb_ptr = res;
    end = res + total_limbs;
@@ -110,5 +112,5 @@ void fft_combine_bits(mp_limb_t * res, mp_limb_t ** poly, long length,
       i++;    
    }
    
-   flint_free(temp);     
+   TMP_END;
 }
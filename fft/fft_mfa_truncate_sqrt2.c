@@ -28,6 +28,9 @@ or implied, of William Hart.
 
 */
 
+#undef ulong /* prevent clash with standard library */
+#include <pthread.h>
+#define ulong unsigned long
 #include "gmp.h"
 #include "flint.h"
 #include "ulong_extras.h"
@@ -237,24 +240,48 @@ void fft_mfa_truncate_sqrt2(mp_limb_t ** ii, mp_size_t n,
    }
 }
 
-void fft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, 
-                   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
-                             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+typedef struct
+{
+   mp_limb_t ** ii;
+   mp_size_t n;
+   mp_bitcnt_t w;
+   mp_limb_t ** t1;
+   mp_limb_t ** t2;
+   mp_limb_t ** temp;
+   mp_size_t n1;
+   mp_size_t trunc;
+   mp_size_t start;
+   mp_size_t stop;
+} fft_outer_arg_t;
+
+/* 
+   Column FFTs of the outer layers for columns start <= i < stop. Each column
+   of both halves is touched only by the worker owning that column, so workers
+   on disjoint column ranges may run concurrently.
+*/
+static void * _fft_mfa_truncate_sqrt2_outer_worker(void * arg_ptr)
 {
+   fft_outer_arg_t arg = *((fft_outer_arg_t *) arg_ptr);
+   mp_limb_t ** ii = arg.ii;
+   mp_limb_t ** t1 = arg.t1;
+   mp_limb_t ** t2 = arg.t2;
+   mp_limb_t ** temp = arg.temp;
+   mp_size_t n = arg.n;
+   mp_bitcnt_t w = arg.w;
+   mp_size_t n1 = arg.n1;
+   mp_size_t trunc = arg.trunc;
    mp_size_t i, j;
    mp_size_t n2 = (2*n)/n1;
    mp_size_t trunc2 = (trunc - 2*n)/n1;
    mp_size_t limbs = (n*w)/FLINT_BITS;
    mp_bitcnt_t depth = 0;
-   mp_bitcnt_t depth2 = 0;
    
    while ((1UL<<depth) < n2) depth++;
-   while ((1UL<<depth2) < n1) depth2++;
 
    /* first half matrix fourier FFT : n2 rows, n1 cols */
    
    /* FFTs on columns */
-   for (i = 0; i < n1; i++)
+   for (i = arg.start; i < arg.stop; i++)
    {   
       /* relevant part of first layer of full sqrt2 FFT */
       if (w & 1)
@@ -308,7 +335,7 @@ void fft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n,
    ii += 2*n;
 
    /* FFTs on columns */
-   for (i = 0; i < n1; i++)
+   for (i = arg.start; i < arg.stop; i++)
    {   
       /*
          FFT of length n2 on column i, applying z^{r*i} for rows going up in steps 
@@ -322,4 +349,59 @@ void fft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n,
          if (j < s) SWAP_PTRS(ii[i+j*n1], ii[i+s*n1]);
       }
    }
+
+   return NULL;
+}
+
+void fft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, 
+                   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+{
+   fft_mfa_truncate_sqrt2_outer_threaded(ii, n, w, t1, t2, temp, n1, trunc, 1);
+}
+
+void fft_mfa_truncate_sqrt2_outer_threaded(mp_limb_t ** ii, mp_size_t n, 
+                   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, int num_threads)
+{
+   fft_outer_arg_t * args;
+   pthread_t * threads;
+   long j, k;
+
+   if (num_threads > n1) num_threads = n1;
+   if (num_threads < 1) num_threads = 1;
+
+   args = flint_malloc(num_threads*sizeof(fft_outer_arg_t));
+   threads = flint_malloc(num_threads*sizeof(pthread_t));
+
+   for (k = 0; k < num_threads; k++)
+   {
+      args[k].ii = ii;
+      args[k].n = n;
+      args[k].w = w;
+      args[k].t1 = t1 + k;
+      args[k].t2 = t2 + k;
+      args[k].temp = temp + k;
+      args[k].n1 = n1;
+      args[k].trunc = trunc;
+      args[k].start = (k*n1)/num_threads;
+      args[k].stop = ((k + 1)*n1)/num_threads;
+   }
+
+   for (k = 1; k < num_threads; k++)
+      if (pthread_create(threads + k, NULL, 
+                         _fft_mfa_truncate_sqrt2_outer_worker, args + k))
+         break;
+
+   _fft_mfa_truncate_sqrt2_outer_worker(args);
+
+   /* the ranges for which no thread could be created are done here */
+   for (j = k; j < num_threads; j++)
+      _fft_mfa_truncate_sqrt2_outer_worker(args + j);
+
+   for (j = 1; j < k; j++)
+      pthread_join(threads[j], NULL);
+
+   flint_free(threads);
+   flint_free(args);
 }
@@ -28,64 +28,157 @@ or implied, of William Hart.
 
 */
 
+#undef ulong /* prevent clash with standard library */
+#include <pthread.h>
+#define ulong unsigned long
 #include "gmp.h"
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fft.h"
 
-void fft_mfa_truncate_sqrt2_inner(mp_limb_t ** ii, mp_limb_t ** jj, mp_size_t n, 
-                   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
-                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, mp_limb_t * tt)
+typedef struct
 {
-   mp_size_t i, j, s;
+   mp_limb_t ** ii;
+   mp_limb_t ** jj;
+   mp_size_t n;
+   mp_bitcnt_t w;
+   mp_limb_t ** t1;
+   mp_limb_t ** t2;
+   mp_size_t n1;
+   mp_size_t trunc;
+   mp_limb_t * tt;
+   mp_size_t start;
+   mp_size_t stop;
+   int precached;
+} fft_inner_arg_t;
+
+/* 
+   Row convolutions for rows start <= r < stop, where the first trunc2 rows
+   are the relevant rows of the second half and the remaining n2 rows are 
+   those of the first half. Rows are independent of one another.
+*/
+static void * _fft_mfa_truncate_sqrt2_inner_worker(void * arg_ptr)
+{
+   fft_inner_arg_t arg = *((fft_inner_arg_t *) arg_ptr);
+   mp_limb_t ** ii, ** jj;
+   mp_limb_t ** t1 = arg.t1;
+   mp_limb_t ** t2 = arg.t2;
+   mp_limb_t * tt = arg.tt;
+   mp_size_t n = arg.n;
+   mp_bitcnt_t w = arg.w;
+   mp_size_t n1 = arg.n1;
+   mp_size_t i, j, r;
    mp_size_t n2 = (2*n)/n1;
-   mp_size_t trunc2 = (trunc - 2*n)/n1;
+   mp_size_t trunc2 = (arg.trunc - 2*n)/n1;
    mp_size_t limbs = (n*w)/FLINT_BITS;
    mp_bitcnt_t depth = 0;
-   mp_bitcnt_t depth2 = 0;
    
    while ((1UL<<depth) < n2) depth++;
-   while ((1UL<<depth2) < n1) depth2++;
-
-   ii += 2*n;
-   jj += 2*n;
 
-   /* convolutions on relevant rows */
-   for (s = 0; s < trunc2; s++)
+   for (r = arg.start; r < arg.stop; r++)
    {
-      i = n_revbin(s, depth);
+      if (r < trunc2) /* convolutions on relevant rows */
+      {
+         ii = arg.ii + 2*n;
+         jj = arg.jj + 2*n;
+         i = n_revbin(r, depth);
+      } else /* convolutions on rows */
+      {
+         ii = arg.ii;
+         jj = arg.jj;
+         i = r - trunc2;
+      }
+
       fft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
-      if (ii != jj) fft_radix2(jj + i*n1, n1/2, w*n2, t1, t2);
+      if (ii != jj && !arg.precached) 
+         fft_radix2(jj + i*n1, n1/2, w*n2, t1, t2);
       
       for (j = 0; j < n1; j++)
       {
          mp_size_t t = i*n1 + j;
          mpn_normmod_2expp1(ii[t], limbs);
-         if (ii != jj) mpn_normmod_2expp1(jj[t], limbs);
+         if (ii != jj && !arg.precached) mpn_normmod_2expp1(jj[t], limbs);
          fft_mulmod_2expp1(ii[t], ii[t], jj[t], n, w, tt);
       }      
       
       ifft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
    }
 
-   ii -= 2*n;
-   jj -= 2*n;
+   return NULL;
+}
 
-   /* convolutions on rows */
-   for (i = 0; i < n2; i++)
-   {
-      fft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
-      if (ii != jj) fft_radix2(jj + i*n1, n1/2, w*n2, t1, t2);
+void fft_mfa_truncate_sqrt2_inner(mp_limb_t ** ii, mp_limb_t ** jj, mp_size_t n, 
+                   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, mp_limb_t * tt)
+{
+   fft_mfa_truncate_sqrt2_inner_threaded(ii, jj, n, w, t1, t2, 
+                                                temp, n1, trunc, &tt, 1);
+}
 
-      for (j = 0; j < n1; j++)
-      {
-         mp_size_t t = i*n1 + j;
-         mpn_normmod_2expp1(ii[t], limbs);
-         if (ii != jj) mpn_normmod_2expp1(jj[t], limbs);
-         fft_mulmod_2expp1(ii[t], ii[t], jj[t], n, w, tt);
-      }      
-      
-      ifft_radix2(ii + i*n1, n1/2, w*n2, t1, t2);
+static void _fft_mfa_truncate_sqrt2_inner(mp_limb_t ** ii, mp_limb_t ** jj, 
+       mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, 
+                           mp_limb_t ** tt, int num_threads, int precached)
+{
+   fft_inner_arg_t * args;
+   pthread_t * threads;
+   mp_size_t rows = (trunc - 2*n)/n1 + (2*n)/n1;
+   long j, k;
+
+   if (num_threads > rows) num_threads = rows;
+   if (num_threads < 1) num_threads = 1;
+
+   args = flint_malloc(num_threads*sizeof(fft_inner_arg_t));
+   threads = flint_malloc(num_threads*sizeof(pthread_t));
+
+   for (k = 0; k < num_threads; k++)
+   {
+      args[k].ii = ii;
+      args[k].jj = jj;
+      args[k].n = n;
+      args[k].w = w;
+      args[k].t1 = t1 + k;
+      args[k].t2 = t2 + k;
+      args[k].n1 = n1;
+      args[k].trunc = trunc;
+      args[k].tt = tt[k];
+      args[k].start = (k*rows)/num_threads;
+      args[k].stop = ((k + 1)*rows)/num_threads;
+      args[k].precached = precached;
    }
+
+   for (k = 1; k < num_threads; k++)
+      if (pthread_create(threads + k, NULL, 
+                         _fft_mfa_truncate_sqrt2_inner_worker, args + k))
+         break;
+
+   _fft_mfa_truncate_sqrt2_inner_worker(args);
+
+   /* the ranges for which no thread could be created are done here */
+   for (j = k; j < num_threads; j++)
+      _fft_mfa_truncate_sqrt2_inner_worker(args + j);
+
+   for (j = 1; j < k; j++)
+      pthread_join(threads[j], NULL);
+
+   flint_free(threads);
+   flint_free(args);
 }
 
+void fft_mfa_truncate_sqrt2_inner_threaded(mp_limb_t ** ii, mp_limb_t ** jj, 
+       mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, 
+                                             mp_limb_t ** tt, int num_threads)
+{
+   _fft_mfa_truncate_sqrt2_inner(ii, jj, n, w, t1, t2, 
+                                 temp, n1, trunc, tt, num_threads, 0);
+}
+
+void fft_mfa_truncate_sqrt2_inner_precache(mp_limb_t ** ii, mp_limb_t ** jj, 
+       mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+                  mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, 
+                                             mp_limb_t ** tt, int num_threads)
+{
+   _fft_mfa_truncate_sqrt2_inner(ii, jj, n, w, t1, t2, 
+                                 temp, n1, trunc, tt, num_threads, 1);
+}
@@ -28,6 +28,9 @@ or implied, of William Hart.
 
 */
 
+#undef ulong /* prevent clash with standard library */
+#include <pthread.h>
+#define ulong unsigned long
 #include "gmp.h"
 #include "flint.h"
 #include "ulong_extras.h"
@@ -264,9 +267,35 @@ void ifft_mfa_truncate_sqrt2(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w,
    }
 }
 
-void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w, 
-   mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+typedef struct
 {
+   mp_limb_t ** ii;
+   mp_size_t n;
+   mp_bitcnt_t w;
+   mp_limb_t ** t1;
+   mp_limb_t ** t2;
+   mp_limb_t ** temp;
+   mp_size_t n1;
+   mp_size_t trunc;
+   mp_size_t start;
+   mp_size_t stop;
+} ifft_outer_arg_t;
+
+/* 
+   Column IFFTs of the outer layers, with normalisation, for columns
+   start <= i < stop. Workers on disjoint column ranges may run concurrently.
+*/
+static void * _ifft_mfa_truncate_sqrt2_outer_worker(void * arg_ptr)
+{
+   ifft_outer_arg_t arg = *((ifft_outer_arg_t *) arg_ptr);
+   mp_limb_t ** ii = arg.ii;
+   mp_limb_t ** t1 = arg.t1;
+   mp_limb_t ** t2 = arg.t2;
+   mp_limb_t ** temp = arg.temp;
+   mp_size_t n = arg.n;
+   mp_bitcnt_t w = arg.w;
+   mp_size_t n1 = arg.n1;
+   mp_size_t trunc = arg.trunc;
    mp_size_t i, j;
    mp_size_t n2 = (2*n)/n1;
    mp_size_t trunc2 = (trunc - 2*n)/n1;
@@ -280,7 +309,7 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w,
    /* first half mfa IFFT : n2 rows, n1 cols */
    
    /* column IFFTs */
-   for (i = 0; i < n1; i++)
+   for (i = arg.start; i < arg.stop; i++)
    {   
       for (j = 0; j < n2; j++)
       {
@@ -299,7 +328,7 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w,
    ii += 2*n;
 
    /* column IFFTs with relevant sqrt2 layer butterflies combined */
-   for (i = 0; i < n1; i++)
+   for (i = arg.start; i < arg.stop; i++)
    {   
       for (j = 0; j < trunc2; j++)
       {
@@ -367,4 +396,58 @@ void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w,
          mpn_normmod_2expp1(ii[t], limbs);
       }
    }
+
+   return NULL;
+}
+
+void ifft_mfa_truncate_sqrt2_outer(mp_limb_t ** ii, mp_size_t n, mp_bitcnt_t w, 
+   mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc)
+{
+   ifft_mfa_truncate_sqrt2_outer_threaded(ii, n, w, t1, t2, temp, n1, trunc, 1);
+}
+
+void ifft_mfa_truncate_sqrt2_outer_threaded(mp_limb_t ** ii, mp_size_t n, 
+                   mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2, 
+             mp_limb_t ** temp, mp_size_t n1, mp_size_t trunc, int num_threads)
+{
+   ifft_outer_arg_t * args;
+   pthread_t * threads;
+   long j, k;
+
+   if (num_threads > n1) num_threads = n1;
+   if (num_threads < 1) num_threads = 1;
+
+   args = flint_malloc(num_threads*sizeof(ifft_outer_arg_t));
+   threads = flint_malloc(num_threads*sizeof(pthread_t));
+
+   for (k = 0; k < num_threads; k++)
+   {
+      args[k].ii = ii;
+      args[k].n = n;
+      args[k].w = w;
+      args[k].t1 = t1 + k;
+      args[k].t2 = t2 + k;
+      args[k].temp = temp + k;
+      args[k].n1 = n1;
+      args[k].trunc = trunc;
+      args[k].start = (k*n1)/num_threads;
+      args[k].stop = ((k + 1)*n1)/num_threads;
+   }
+
+   for (k = 1; k < num_threads; k++)
+      if (pthread_create(threads + k, NULL, 
+                         _ifft_mfa_truncate_sqrt2_outer_worker, args + k))
+         break;
+
+   _ifft_mfa_truncate_sqrt2_outer_worker(args);
+
+   /* the ranges for which no thread could be created are done here */
+   for (j = k; j < num_threads; j++)
+      _ifft_mfa_truncate_sqrt2_outer_worker(args + j);
+
+   for (j = 1; j < k; j++)
+      pthread_join(threads[j], NULL);
+
+   flint_free(threads);
+   flint_free(args);
 }
@@ -36,8 +36,12 @@ or implied, of William Hart.
 
 static int fft_tuning_table[5][2] = FFT_TAB;
 
-void flint_mpn_mul_fft_main(mp_limb_t * r1, mp_limb_t * i1, mp_size_t n1, 
-                        mp_limb_t * i2, mp_size_t n2)
+/*
+   Chooses depth and w for a product of n1 and n2 limbs and sets mfa to 1 
+   if the matrix Fourier algorithm should be used, otherwise to 0.
+*/
+void _flint_mpn_mul_fft_params(mp_bitcnt_t * depth_out, mp_bitcnt_t * w_out, 
+                                   int * mfa, mp_size_t n1, mp_size_t n2)
 {
    mp_size_t off, depth = 6;
    mp_size_t w = 1;
@@ -91,7 +95,7 @@ void flint_mpn_mul_fft_main(mp_limb_t * r1, mp_limb_t * i1, mp_size_t n1,
          w += wadj;
       }
 
-      mul_truncate_sqrt2(r1, i1, n1, i2, n2, depth, w);
+      *mfa = 0;
    } else
    {
       if (j1 + j2 - 1 <= 3*n)
@@ -99,7 +103,24 @@ void flint_mpn_mul_fft_main(mp_limb_t * r1, mp_limb_t * i1, mp_size_t n1,
          depth--;
          w *= 3;
       }
-      mul_mfa_truncate_sqrt2(r1, i1, n1, i2, n2, depth, w);
+
+      *mfa = 1;
    }
+
+   *depth_out = depth;
+   *w_out = w;
 }
 
+void flint_mpn_mul_fft_main(mp_limb_t * r1, mp_limb_t * i1, mp_size_t n1, 
+                        mp_limb_t * i2, mp_size_t n2)
+{
+   mp_bitcnt_t depth, w;
+   int mfa;
+
+   _flint_mpn_mul_fft_params(&depth, &w, &mfa, n1, n2);
+
+   if (mfa)
+      mul_mfa_truncate_sqrt2(r1, i1, n1, i2, n2, depth, w);
+   else
+      mul_truncate_sqrt2(r1, i1, n1, i2, n2, depth, w);
+}
@@ -0,0 +1,56 @@
+/* 
+
+Copyright 2009, 2011 William Hart. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY William Hart ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL William Hart OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of William Hart.
+
+*/
+
+#include "gmp.h"
+#include "flint.h"
+#include "fft.h"
+
+void flint_mpn_mul_fft_main_precache_init(fft_precache_t pre, 
+                              mp_limb_t * i2, mp_size_t n2, mp_size_t n1_max)
+{
+   mp_bitcnt_t depth, w;
+   int mfa;
+
+   _flint_mpn_mul_fft_params(&depth, &w, &mfa, n1_max, n2);
+
+   if (mfa)
+      mul_mfa_truncate_sqrt2_precache_init(pre, i2, n2, n1_max, depth, w);
+   else
+      mul_truncate_sqrt2_precache_init(pre, i2, n2, n1_max, depth, w);
+}
+
+void flint_mpn_mul_fft_main_precache(mp_limb_t * r1, mp_limb_t * i1, 
+                                      mp_size_t n1, const fft_precache_t pre)
+{
+   if (pre->mfa)
+      mul_mfa_truncate_sqrt2_precache(r1, i1, n1, pre);
+   else
+      mul_truncate_sqrt2_precache(r1, i1, n1, pre);
+}
@@ -49,18 +49,34 @@ void mul_mfa_truncate_sqrt2(mp_limb_t * r1, mp_limb_t * i1, mp_size_t n1,
    
    mp_size_t i, j, trunc;
 
-   mp_limb_t ** ii, ** jj, * t1, * t2, * s1, * ptr;
-   mp_limb_t * tt;
+   mp_limb_t ** ii, ** jj, ** t1, ** t2, ** s1, ** tt, * ptr;
+   int num_threads = flint_get_num_threads();
+
+   if (r_limbs < fft_get_thread_cutoff())
+      num_threads = 1;
    
-   ii = flint_malloc((4*(n + n*size) + 5*size)*sizeof(mp_limb_t));
+   /* 
+      each thread needs scratch t1, t2, s1 of size limbs + 1 and tt of twice
+      that; as the transforms swap scratch with coefficients, all of it must
+      live in the same block as ii
+   */
+   ii = flint_malloc((4*(n + n*size) + 5*size*num_threads)*sizeof(mp_limb_t));
    for (i = 0, ptr = (mp_limb_t *) ii + 4*n; i < 4*n; i++, ptr += size) 
    {
       ii[i] = ptr;
    }
-   t1 = ptr;
-   t2 = t1 + size;
-   s1 = t2 + size;
-   tt = s1 + size;
+
+   t1 = flint_malloc(4*num_threads*sizeof(mp_limb_t *));
+   t2 = t1 + num_threads;
+   s1 = t2 + num_threads;
+   tt = s1 + num_threads;
+   for (i = 0; i < num_threads; i++, ptr += 5*size)
+   {
+      t1[i] = ptr;
+      t2[i] = t1[i] + size;
+      s1[i] = t2[i] + size;
+      tt[i] = s1[i] + size;
+   }
    
    if (i1 != i2)
    {
@@ -79,7 +95,8 @@ void mul_mfa_truncate_sqrt2(mp_limb_t * r1, mp_limb_t * i1, mp_size_t n1,
    for (j = j1 ; j < 4*n; j++)
       flint_mpn_zero(ii[j], limbs + 1);
    
-   fft_mfa_truncate_sqrt2_outer(ii, n, w, &t1, &t2, &s1, sqrt, trunc);
+   fft_mfa_truncate_sqrt2_outer_threaded(ii, n, w, t1, t2, s1, 
+                                                    sqrt, trunc, num_threads);
    
    if (i1 != i2)
    {
@@ -87,15 +104,19 @@ void mul_mfa_truncate_sqrt2(mp_limb_t * r1, mp_limb_t * i1, mp_size_t n1,
       for (j = j2 ; j < 4*n; j++)
          flint_mpn_zero(jj[j], limbs + 1);
 
-      fft_mfa_truncate_sqrt2_outer(jj, n, w, &t1, &t2, &s1, sqrt, trunc);
+      fft_mfa_truncate_sqrt2_outer_threaded(jj, n, w, t1, t2, s1, 
+                                                    sqrt, trunc, num_threads);
    } else j2 = j1;
    
-   fft_mfa_truncate_sqrt2_inner(ii, jj, n, w, &t1, &t2, &s1, sqrt, trunc, tt);
-   ifft_mfa_truncate_sqrt2_outer(ii, n, w, &t1, &t2, &s1, sqrt, trunc);
+   fft_mfa_truncate_sqrt2_inner_threaded(ii, jj, n, w, t1, t2, s1, 
+                                                sqrt, trunc, tt, num_threads);
+   ifft_mfa_truncate_sqrt2_outer_threaded(ii, n, w, t1, t2, s1, 
+                                                    sqrt, trunc, num_threads);
        
    flint_mpn_zero(r1, r_limbs);
    fft_combine_bits(r1, ii, j1 + j2 - 1, bits1, limbs, r_limbs);
      
+   flint_free(t1);
    flint_free(ii);
    if (i1 != i2)
       flint_free(jj);
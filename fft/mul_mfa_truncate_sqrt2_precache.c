@@ -0,0 +1,171 @@
+/* 
+
+Copyright 2009, 2011 William Hart. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, are
+permitted provided that the following conditions are met:
+
+   1. Redistributions of source code must retain the above copyright notice, this list of
+      conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright notice, this list
+      of conditions and the following disclaimer in the documentation and/or other materials
+      provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY William Hart ``AS IS'' AND ANY EXPRESS OR IMPLIED
+WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL William Hart OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those of the
+authors and should not be interpreted as representing official policies, either expressed
+or implied, of William Hart.
+
+*/
+
+#include "gmp.h"
+#include "flint.h"
+#include "fft.h"
+#include "ulong_extras.h"
+
+void mul_mfa_truncate_sqrt2_precache_init(fft_precache_t pre, mp_limb_t * i2, 
+    mp_size_t n2, mp_size_t n1_max, mp_bitcnt_t depth, mp_bitcnt_t w)
+{
+   mp_size_t n = (1UL<<depth);
+   mp_bitcnt_t bits1 = (n*w - (depth+1))/2; 
+   mp_size_t sqrt = (1UL<<(depth/2));
+   mp_size_t rows = (2*n)/sqrt;
+
+   mp_size_t limbs = (n*w)/FLINT_BITS;
+   mp_size_t size = limbs + 1;
+
+   mp_size_t j1 = (n1_max*FLINT_BITS - 1)/bits1 + 1;
+   mp_size_t j2 = (n2*FLINT_BITS - 1)/bits1 + 1;
+   
+   mp_size_t i, j, s, trunc, trunc2;
+   mp_bitcnt_t rdepth = 0;
+
+   mp_limb_t ** jj, ** rr, * t1, * t2, * s1, * ptr;
+   
+   FLINT_ASSERT(j1 + j2 - 1 <= 4*n);
+
+   while ((1UL<<rdepth) < rows) rdepth++;
+
+   jj = flint_malloc((4*(n + n*size) + 3*size)*sizeof(mp_limb_t));
+   for (i = 0, ptr = (mp_limb_t *) jj + 4*n; i < 4*n; i++, ptr += size) 
+   {
+      jj[i] = ptr;
+   }
+   t1 = ptr;
+   t2 = t1 + size;
+   s1 = t2 + size;
+   
+   trunc = j1 + j2 - 1;
+   if (trunc <= 2*n) trunc = 2*n + 1;
+   trunc = 2*sqrt*((trunc + 2*sqrt - 1)/(2*sqrt)); /* trunc must be divisible by 2*sqrt */
+   trunc2 = (trunc - 2*n)/sqrt;
+
+   j2 = fft_split_bits(jj, i2, n2, bits1, limbs);
+   for (j = j2 ; j < 4*n; j++)
+      flint_mpn_zero(jj[j], limbs + 1);
+
+   fft_mfa_truncate_sqrt2_outer(jj, n, w, &t1, &t2, &s1, sqrt, trunc);
+   
+   /* 
+      row FFTs which fft_mfa_truncate_sqrt2_inner would otherwise apply to 
+      this operand on every multiplication: all rows of the first half and
+      the relevant rows of the second half
+   */
+   for (s = 0; s < rows + trunc2; s++)
+   {
+      if (s < trunc2)
+         rr = jj + 2*n + n_revbin(s, rdepth)*sqrt;
+      else
+         rr = jj + (s - trunc2)*sqrt;
+
+      fft_radix2(rr, sqrt/2, w*rows, &t1, &t2);
+      for (j = 0; j < sqrt; j++)
+         mpn_normmod_2expp1(rr[j], limbs);
+   }
+
+   pre->jj = jj;
+   pre->n2 = n2;
+   pre->j2 = j2;
+   pre->n1_max = n1_max;
+   pre->trunc = trunc;
+   pre->depth = depth;
+   pre->w = w;
+   pre->mfa = 1;
+}
+
+void mul_mfa_truncate_sqrt2_precache(mp_limb_t * r1, mp_limb_t * i1, 
+                                      mp_size_t n1, const fft_precache_t pre)
+{
+   mp_bitcnt_t depth = pre->depth, w = pre->w;
+   mp_size_t n = (1UL<<depth);
+   mp_bitcnt_t bits1 = (n*w - (depth+1))/2; 
+   mp_size_t sqrt = (1UL<<(depth/2));
+
+   mp_size_t r_limbs = n1 + pre->n2;
+   mp_size_t limbs = (n*w)/FLINT_BITS;
+   mp_size_t size = limbs + 1;
+
+   mp_size_t j1 = (n1*FLINT_BITS - 1)/bits1 + 1;
+   mp_size_t j2 = pre->j2;
+   
+   mp_size_t i, j, trunc;
+
+   mp_limb_t ** ii, ** t1, ** t2, ** s1, ** tt, * ptr;
+   int num_threads = flint_get_num_threads();
+
+   FLINT_ASSERT(pre->mfa);
+   FLINT_ASSERT(n1 <= pre->n1_max);
+
+   if (r_limbs < fft_get_thread_cutoff())
+      num_threads = 1;
+   
+   ii = flint_malloc((4*(n + n*size) + 5*size*num_threads)*sizeof(mp_limb_t));
+   for (i = 0, ptr = (mp_limb_t *) ii + 4*n; i < 4*n; i++, ptr += size) 
+   {
+      ii[i] = ptr;
+   }
+
+   t1 = flint_malloc(4*num_threads*sizeof(mp_limb_t *));
+   t2 = t1 + num_threads;
+   s1 = t2 + num_threads;
+   tt = s1 + num_threads;
+   for (i = 0; i < num_threads; i++, ptr += 5*size)
+   {
+      t1[i] = ptr;
+      t2[i] = t1[i] + size;
+      s1[i] = t2[i] + size;
+      tt[i] = s1[i] + size;
+   }
+   
+   trunc = j1 + j2 - 1;
+   if (trunc <= 2*n) trunc = 2*n + 1;
+   trunc = 2*sqrt*((trunc + 2*sqrt - 1)/(2*sqrt)); /* trunc must be divisible by 2*sqrt */
+
+   j1 = fft_split_bits(ii, i1, n1, bits1, limbs);
+   for (j = j1 ; j < 4*n; j++)
+      flint_mpn_zero(ii[j], limbs + 1);
+   
+   fft_mfa_truncate_sqrt2_outer_threaded(ii, n, w, t1, t2, s1, 
+                                                    sqrt, trunc, num_threads);
+   
+   fft_mfa_truncate_sqrt2_inner_precache(ii, pre->jj, n, w, t1, t2, s1, 
+                                                sqrt, trunc, tt, num_threads);
+   ifft_mfa_truncate_sqrt2_outer_threaded(ii, n, w, t1, t2, s1, 
+                                                    sqrt, trunc, num_threads);
+       
+   flint_mpn_zero(r1, r_limbs);
+   fft_combine_bits(r1, ii, j1 + j2 - 1, bits1, limbs, r_limbs);
+     
+   flint_free(t1);
+   flint_free(ii);
+}
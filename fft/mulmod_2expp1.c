@@ -68,8 +68,10 @@ void _fft_mulmod_2expp1(mp_limb_t * r1, mp_limb_t * i1, mp_limb_t * i2,
    mp_limb_t * ptr;
    mp_limb_t ** ii, ** jj, *tt, *t1, *t2, *s1, *r, *ii0, *jj0;
    mp_limb_t c;
-   
-   ii = flint_malloc((2*(n + n*size) + 4*n + 5*size)*sizeof(mp_limb_t));
+   TMP_INIT;
+
+   TMP_START;
+   ii = TMP_ALLOC((2*(n + n*size) + 4*n + 5*size)*sizeof(mp_limb_t));
    for (i = 0, ptr = (mp_limb_t *) ii + 2*n; i < 2*n; i++, ptr += size) 
    {
       ii[i] = ptr;
@@ -83,7 +85,7 @@ void _fft_mulmod_2expp1(mp_limb_t * r1, mp_limb_t * i1, mp_limb_t * i2,
    
    if (i1 != i2)
    {
-      jj = flint_malloc((2*(n + n*size) + 2*n)*sizeof(mp_limb_t));
+      jj = TMP_ALLOC((2*(n + n*size) + 2*n)*sizeof(mp_limb_t));
       for (i = 0, ptr = (mp_limb_t *) jj + 2*n; i < 2*n; i++, ptr += size) 
       {
          jj[i] = ptr;
@@ -175,8 +177,7 @@ void _fft_mulmod_2expp1(mp_limb_t * r1, mp_limb_t * i1, mp_limb_t * i2,
    mpn_addmod_2expp1_1(r1 + limbs + 1 - limb_add, r_limbs - limbs - 1 + limb_add, -c);
    mpn_normmod_2expp1(r1, r_limbs);
    
-   flint_free(ii);
-   if (i1 != i2) flint_free(jj);
+   TMP_END;
 }
 
 void fft_mulmod_2expp1(mp_limb_t * r, mp_limb_t * i1, mp_limb_t * i2, 
@@ -34,6 +34,7 @@ or implied, of William Hart.
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fft.h"
+#include "fft_tuning.h"
 
 int
 main(void)
@@ -119,6 +120,54 @@ main(void)
         }
     }
 
+    /* test threaded multiplication */
+    fft_set_thread_cutoff(0);
+
+    for (depth = 6; depth <= 12; depth++)
+    {
+        for (w = 1; w <= 3 - (depth >= 12); w++)
+        {
+            mp_size_t n = (1UL<<depth);
+            mp_bitcnt_t bits1 = (n*w - (depth + 1))/2; 
+            mp_size_t trunc = 2*n + 2*n_randint(state, n) + 2; /* trunc is even */
+            mp_bitcnt_t bits = (trunc/2)*bits1;
+            mp_size_t int_limbs = (bits - 1)/FLINT_BITS + 1;
+            mp_size_t j;
+            mp_limb_t * i1, *i2, *r1, *r2;
+        
+            i1 = flint_malloc(6*int_limbs*sizeof(mp_limb_t));
+            i2 = i1 + int_limbs;
+            r1 = i2 + int_limbs;
+            r2 = r1 + 2*int_limbs;
+   
+            random_fermat(i1, state, int_limbs);
+            if (n_randint(state, 2))
+                random_fermat(i2, state, int_limbs);
+            else
+                i2 = i1;
+            
+            flint_set_num_threads(2 + n_randint(state, 7));
+
+            mpn_mul(r2, i1, int_limbs, i2, int_limbs);
+            mul_mfa_truncate_sqrt2(r1, i1, int_limbs, i2, int_limbs, depth, w);
+            
+            for (j = 0; j < 2*int_limbs; j++)
+            {
+                if (r1[j] != r2[j]) 
+                {
+                    printf("error in limb %ld, %lx != %lx\n", j, r1[j], r2[j]);
+                    printf("num_threads = %d\n", flint_get_num_threads());
+                    abort();
+                }
+            }
+
+            flint_free(i1);
+        }
+    }
+
+    flint_set_num_threads(1);
+    fft_set_thread_cutoff(FFT_MFA_THREAD_CUTOFF);
+
     flint_randclear(state);
     
     printf("PASS\n");
@@ -195,6 +195,68 @@ main(void)
     
     printf("#define FFT_MULMOD_2EXPP1_CUTOFF %ld\n\n", ((mp_limb_t) 1 << best_d)*best_w/(2*FLINT_BITS));
     
+    /* 
+       find the crossover with GMP for multiplication and squaring, taking
+       the first size from which the FFT wins twice in a row
+    */
+    for (w = 0; w <= 1; w++)
+    {
+        mp_size_t n, first = 0, cutoff = 0, wins = 0;
+
+        for (n = 512; cutoff == 0 && n <= (8192L*FLINT_BITS); n = (5*n)/4)
+        {
+            int iters = FLINT_MAX(8000000/n, 1), i;
+            mp_limb_t * i1, * i2, * r1;
+            double gmp_time;
+
+            i1 = flint_malloc(4*n*sizeof(mp_limb_t));
+            i2 = (w == 0) ? i1 + n : i1;
+            r1 = i1 + 2*n;
+
+            flint_mpn_urandomb(i1, state->gmp_state, n*FLINT_BITS);
+            flint_mpn_urandomb(i1 + n, state->gmp_state, n*FLINT_BITS);
+
+            start = clock();
+            for (i = 0; i < iters; i++)
+            {
+               if (w == 0)
+                  mpn_mul_n(r1, i1, i2, n);
+               else
+                  mpn_sqr(r1, i1, n);
+            }
+            end = clock();
+            gmp_time = ((double) (end - start)) / CLOCKS_PER_SEC;
+
+            start = clock();
+            for (i = 0; i < iters; i++)
+               flint_mpn_mul_fft_main(r1, i1, n, i2, n);
+            end = clock();
+            elapsed = ((double) (end - start)) / CLOCKS_PER_SEC;
+
+            if (elapsed < gmp_time)
+            {
+               if (wins++ == 0)
+                  first = n;
+               if (wins == 2)
+                  cutoff = first;
+            } else
+               wins = 0;
+
+            flint_free(i1);
+        }
+
+        if (cutoff == 0)
+           cutoff = n;
+
+        if (w == 0)
+           printf("#define FFT_MUL_CUTOFF %ld\n\n", cutoff);
+        else
+           printf("#define FFT_SQR_CUTOFF %ld\n\n", cutoff);
+        fflush(stdout);
+    }
+
+    printf("#define FFT_MFA_THREAD_CUTOFF %ld\n\n", (32768L*64)/FLINT_BITS);
+    
     flint_randclear(state);
     
     printf("#endif\n");
@@ -53,6 +53,43 @@ void * flint_realloc(void * ptr, size_t size);
 void * flint_calloc(size_t num, size_t size);
 void flint_free(void * ptr);
 
+void __flint_set_memory_functions(void * (*alloc_func)(size_t),
+     void * (*calloc_func)(size_t, size_t),
+     void * (*realloc_func)(void *, size_t), void (*free_func)(void *));
+
+void __flint_get_memory_functions(void * (**alloc_func)(size_t),
+     void * (**calloc_func)(size_t, size_t),
+     void * (**realloc_func)(void *, size_t), void (**free_func)(void *));
+
+void _flint_gmp_memory_init(void);
+
+typedef struct
+{
+    void * block;
+    size_t used;
+} flint_tmp_mark_struct;
+
+typedef flint_tmp_mark_struct flint_tmp_mark_t[1];
+
+void flint_tmp_start(flint_tmp_mark_t mark);
+
+void * flint_tmp_alloc(size_t size);
+
+void flint_tmp_end(const flint_tmp_mark_t mark);
+
+void flint_tmp_cleanup(void);
+
+#define TMP_INIT flint_tmp_mark_t __flint_tmp_mark
+
+#define TMP_START flint_tmp_start(__flint_tmp_mark)
+
+#define TMP_ALLOC(size) flint_tmp_alloc(size)
+
+#define TMP_END flint_tmp_end(__flint_tmp_mark)
+
+int flint_get_num_threads(void);
+void flint_set_num_threads(int num_threads);
+
 #if __GMP_BITS_PER_MP_LIMB == 64
     #define FLINT_BITS 64
     #define FLINT_D_BITS 53
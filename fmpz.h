@@ -57,8 +57,36 @@ extern gmp_randstate_t fmpz_randstate;
 
 #define COEFF_IS_MPZ(x) (((x) >> (FLINT_BITS - 2)) == 1L)  /* is x a pointer not an integer */
 
+/* number of limbs allocated for the mpz of a newly promoted fmpz */
+#define FMPZ_MIN_LIMBS 8
+
+/* default number of limbs the cache of unused mpz's may hold per thread */
+#define FMPZ_CACHE_DEFAULT_LIMIT (1UL << 20)
+
+typedef struct
+{
+    ulong hits;         /* mpz's handed out from the cache */
+    ulong misses;       /* mpz's newly allocated */
+    ulong released;     /* mpz's freed to keep the cache below its limit */
+    ulong num;          /* mpz's currently in the cache */
+    ulong limbs;        /* limbs of memory currently held by the cache */
+}
+fmpz_cache_stats_struct;
+
+typedef fmpz_cache_stats_struct fmpz_cache_stats_t[1];
+
+void fmpz_cache_set_limit(ulong limbs);
+
+ulong fmpz_cache_get_limit(void);
+
+void fmpz_cache_trim(ulong limbs);
+
+void fmpz_cache_get_stats(fmpz_cache_stats_t stats);
+
 __mpz_struct * _fmpz_new_mpz(void);
 
+__mpz_struct * _fmpz_new_mpz2(ulong limbs);
+
 void _fmpz_clear_mpz(fmpz f);
 
 void _fmpz_cleanup_mpz_content(void);
@@ -452,6 +480,26 @@ ulong fmpz_mod_ui(fmpz_t f, const fmpz_t g, ulong h);
 
 void fmpz_mod(fmpz_t f, const fmpz_t g, const fmpz_t h);
 
+/* Moduli of fewer limbs are reduced by GMP's division */
+#define FMPZ_MOD_PREINVN_CUTOFF 400
+
+typedef struct
+{
+    mp_ptr dinv;
+    long n;
+    mp_bitcnt_t norm;
+}
+fmpz_preinvn_struct;
+
+typedef fmpz_preinvn_struct fmpz_preinvn_t[1];
+
+void fmpz_preinvn_init(fmpz_preinvn_t inv, const fmpz_t f);
+
+void fmpz_preinvn_clear(fmpz_preinvn_t inv);
+
+void fmpz_mod_preinvn(fmpz_t f, const fmpz_t g, const fmpz_t h, 
+                      const fmpz_preinvn_t hinv);
+
 static __inline__ void
 fmpz_negmod(fmpz_t r, const fmpz_t a, const fmpz_t mod)
 {
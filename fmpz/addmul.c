@@ -27,6 +27,7 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fmpz.h"
+#include "mpn_extras.h"
 
 void fmpz_addmul(fmpz_t f, const fmpz_t g, const fmpz_t h)
 {
@@ -53,6 +54,6 @@ void fmpz_addmul(fmpz_t f, const fmpz_t g, const fmpz_t h)
 
 	/* both g and h are large */
     mpz_ptr = _fmpz_promote_val(f);
-    mpz_addmul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
+    flint_mpz_addmul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
     _fmpz_demote_val(f);  /* cancellation may have occurred	*/
 }
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2009 William Hart
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
@@ -28,67 +29,255 @@
 #include "flint.h"
 #include "fmpz.h"
 
-/* Always free larger mpz's to avoid wasting too much heap space */
-#define FLINT_MPZ_MAX_CACHE_LIMBS 64
-
-/* The number of new mpz's allocated at a time */
-#define MPZ_BLOCK 64 
-
 #if HAVE_TLS
 #define TLS_PREFIX __thread
 #else
 #define TLS_PREFIX
 #endif
 
-TLS_PREFIX __mpz_struct ** mpz_free_arr = NULL;
-TLS_PREFIX ulong mpz_free_num = 0;
-TLS_PREFIX ulong mpz_free_alloc = 0;
+/*
+   Unused mpz's are cached by capacity. Class 0 holds those with 
+   FMPZ_MIN_LIMBS limbs, and class k > 0 those with more than 
+   FMPZ_MIN_LIMBS << (k - 1) and at most FMPZ_MIN_LIMBS << k limbs. 
+   Larger limb arrays are shrunk to FMPZ_MIN_LIMBS limbs before the mpz 
+   is cached. Each class is a list linked through a pointer allocated 
+   just after the __mpz_struct, so that the limbs are never touched 
+   while an mpz is in the cache.
+
+   The cache is per thread if HAVE_TLS is set. Whenever it would hold 
+   more than fmpz_cache_get_limit() limbs, including those of the mpz 
+   structs themselves, it is trimmed to half of the limit, freeing mpz's 
+   of the largest capacities first.
+*/
+
+#define MPZ_CACHE_CLASSES 8
+
+#define MPZ_STRUCT_SIZE (sizeof(__mpz_struct) + sizeof(__mpz_struct *))
+
+#define MPZ_STRUCT_LIMBS \
+   ((MPZ_STRUCT_SIZE + sizeof(mp_limb_t) - 1) / sizeof(mp_limb_t))
+
+#define MPZ_NEXT(z) (*(__mpz_struct **) ((z) + 1))
+
+typedef struct
+{
+    __mpz_struct * head[MPZ_CACHE_CLASSES];
+    ulong num[MPZ_CACHE_CLASSES];
+    ulong limbs;
+    ulong hits;
+    ulong misses;
+    ulong released;
+}
+mpz_cache_struct;
+
+static TLS_PREFIX mpz_cache_struct mpz_cache;
+
+static ulong _fmpz_cache_limit = FMPZ_CACHE_DEFAULT_LIMIT;
+
+static int
+_mpz_class(long alloc)
+{
+    int k = 0;
+
+    while (alloc > (FMPZ_MIN_LIMBS << k))
+        k++;
+
+    return k;
+}
+
+/* limbs of memory held by an unused mpz */
+static ulong
+_mpz_limbs(const __mpz_struct * z)
+{
+    return MPZ_STRUCT_LIMBS + z->_mp_alloc;
+}
+
+static __mpz_struct *
+_mpz_cache_pop(int k)
+{
+    __mpz_struct * z = mpz_cache.head[k];
+
+    mpz_cache.head[k] = MPZ_NEXT(z);
+    mpz_cache.num[k]--;
+    mpz_cache.limbs -= _mpz_limbs(z);
+    mpz_cache.hits++;
+
+    return z;
+}
+
+static void
+_mpz_free(__mpz_struct * z)
+{
+    mpz_clear(z);
+    flint_free(z);
+}
+
+void
+fmpz_cache_trim(ulong limbs)
+{
+    int k;
+
+    for (k = MPZ_CACHE_CLASSES - 1; k >= 0; k--)
+    {
+        while (mpz_cache.limbs > limbs && mpz_cache.head[k] != NULL)
+        {
+            __mpz_struct * z = mpz_cache.head[k];
+
+            mpz_cache.head[k] = MPZ_NEXT(z);
+            mpz_cache.num[k]--;
+            mpz_cache.limbs -= _mpz_limbs(z);
+            mpz_cache.released++;
+
+            _mpz_free(z);
+        }
+    }
+}
+
+void
+fmpz_cache_set_limit(ulong limbs)
+{
+    _fmpz_cache_limit = limbs;
+
+    fmpz_cache_trim(limbs);
+}
+
+ulong
+fmpz_cache_get_limit(void)
+{
+    return _fmpz_cache_limit;
+}
+
+void
+fmpz_cache_get_stats(fmpz_cache_stats_t stats)
+{
+    int k;
+
+    stats->hits = mpz_cache.hits;
+    stats->misses = mpz_cache.misses;
+    stats->released = mpz_cache.released;
+    stats->limbs = mpz_cache.limbs;
+    stats->num = 0;
+
+    for (k = 0; k < MPZ_CACHE_CLASSES; k++)
+        stats->num += mpz_cache.num[k];
+}
 
 __mpz_struct * _fmpz_new_mpz(void)
 {
-    if (mpz_free_num != 0)
+    __mpz_struct * z;
+    int k;
+
+    /* the smallest one will do */
+    for (k = 0; k < MPZ_CACHE_CLASSES; k++)
     {
-        return mpz_free_arr[--mpz_free_num];
+        if (mpz_cache.head[k] != NULL)
+            return _mpz_cache_pop(k);
     }
+
+    mpz_cache.misses++;
+
+    z = flint_malloc(MPZ_STRUCT_SIZE);
+    mpz_init2(z, FMPZ_MIN_LIMBS * FLINT_BITS);
+
+    return z;
+}
+
+__mpz_struct * _fmpz_new_mpz2(ulong limbs)
+{
+    __mpz_struct * z = NULL;
+    int k;
+
+    if (limbs > (FMPZ_MIN_LIMBS << (MPZ_CACHE_CLASSES - 1)))
+        z = _fmpz_new_mpz();
     else
     {
-        __mpz_struct * z = flint_malloc(sizeof(__mpz_struct));
-        mpz_init(z);
-        return z;
+        for (k = _mpz_class(limbs); k < MPZ_CACHE_CLASSES && z == NULL; k++)
+        {
+            if (mpz_cache.head[k] != NULL)
+                z = _mpz_cache_pop(k);
+        }
+
+        if (z == NULL)
+            z = _fmpz_new_mpz();
     }
+
+    if (z->_mp_alloc < (long) limbs)
+        _mpz_realloc(z, limbs);
+
+    return z;
 }
 
 void _fmpz_clear_mpz(fmpz f)
 {
     __mpz_struct * ptr = COEFF_TO_PTR(f);
+    ulong limbs;
+    int k;
+
+    if (ptr->_mp_alloc < FMPZ_MIN_LIMBS
+        || ptr->_mp_alloc > (FMPZ_MIN_LIMBS << (MPZ_CACHE_CLASSES - 1)))
+    {
+        _mpz_realloc(ptr, FMPZ_MIN_LIMBS);
+    }
 
-    if (ptr->_mp_alloc > FLINT_MPZ_MAX_CACHE_LIMBS)
-        mpz_realloc2(ptr, 1);
+    limbs = _mpz_limbs(ptr);
 
-    if (mpz_free_num == mpz_free_alloc)
+    if (mpz_cache.limbs + limbs > _fmpz_cache_limit)
     {
-        mpz_free_alloc = FLINT_MAX(64, mpz_free_alloc * 2);
-        mpz_free_arr = flint_realloc(mpz_free_arr, mpz_free_alloc * sizeof(__mpz_struct *));
+        fmpz_cache_trim(_fmpz_cache_limit / 2);
+
+        if (mpz_cache.limbs + limbs > _fmpz_cache_limit)
+        {
+            mpz_cache.released++;
+            _mpz_free(ptr);
+            return;
+        }
     }
 
-    mpz_free_arr[mpz_free_num++] = ptr;
+    k = _mpz_class(ptr->_mp_alloc);
+
+    MPZ_NEXT(ptr) = mpz_cache.head[k];
+    mpz_cache.head[k] = ptr;
+    mpz_cache.num[k]++;
+    mpz_cache.limbs += limbs;
 }
 
 void _fmpz_cleanup_mpz_content(void)
 {
-    ulong i;
+    __mpz_struct * list = NULL, * z;
+    int k;
 
-    for (i = 0; i < mpz_free_num; i++)
+    /* shrink the limbs of all cached mpz's, keeping the mpz's */
+    for (k = 1; k < MPZ_CACHE_CLASSES; k++)
     {
-        mpz_clear(mpz_free_arr[i]);
-        flint_free(mpz_free_arr[i]);
+        while (mpz_cache.head[k] != NULL)
+        {
+            z = mpz_cache.head[k];
+            mpz_cache.head[k] = MPZ_NEXT(z);
+            mpz_cache.num[k]--;
+            mpz_cache.limbs -= _mpz_limbs(z);
+
+            _mpz_realloc(z, FMPZ_MIN_LIMBS);
+
+            MPZ_NEXT(z) = list;
+            list = z;
+        }
+    }
+
+    while (list != NULL)
+    {
+        z = list;
+        list = MPZ_NEXT(z);
+
+        MPZ_NEXT(z) = mpz_cache.head[0];
+        mpz_cache.head[0] = z;
+        mpz_cache.num[0]++;
+        mpz_cache.limbs += _mpz_limbs(z);
     }
 }
 
 void _fmpz_cleanup(void)
 {
-    _fmpz_cleanup_mpz_content();
-    flint_free(mpz_free_arr);
+    fmpz_cache_trim(0);
 }
 
 __mpz_struct * _fmpz_promote(fmpz_t f)
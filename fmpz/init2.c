@@ -33,9 +33,8 @@ fmpz_init2(fmpz_t f, ulong limbs)
 {
     if (limbs)
     {
-        __mpz_struct *mpz_ptr = _fmpz_new_mpz();
+        __mpz_struct *mpz_ptr = _fmpz_new_mpz2(limbs);
         *f = PTR_TO_COEFF(mpz_ptr);
-        _mpz_realloc(mpz_ptr, limbs);
     }
     else
     {
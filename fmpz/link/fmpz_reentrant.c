@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2009 William Hart
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
@@ -28,6 +29,27 @@
 #include "flint.h"
 #include "fmpz.h"
 
+/* there is no cache of unused mpz's in the reentrant version */
+
+void fmpz_cache_set_limit(ulong limbs)
+{
+}
+
+ulong fmpz_cache_get_limit(void)
+{
+    return 0;
+}
+
+void fmpz_cache_trim(ulong limbs)
+{
+}
+
+void fmpz_cache_get_stats(fmpz_cache_stats_t stats)
+{
+    stats->hits = stats->misses = stats->released = 0;
+    stats->num = stats->limbs = 0;
+}
+
 __mpz_struct * _fmpz_new_mpz(void)
 {
     __mpz_struct * mpz_ptr = (__mpz_struct *) flint_malloc(sizeof(__mpz_struct));
@@ -35,6 +57,13 @@ __mpz_struct * _fmpz_new_mpz(void)
     return mpz_ptr;
 }
 
+__mpz_struct * _fmpz_new_mpz2(ulong limbs)
+{
+    __mpz_struct * mpz_ptr = (__mpz_struct *) flint_malloc(sizeof(__mpz_struct));
+    mpz_init2(mpz_ptr, limbs * FLINT_BITS);
+    return mpz_ptr;
+}
+
 void _fmpz_clear_mpz(fmpz f)
 {
     mpz_clear(COEFF_TO_PTR(f));
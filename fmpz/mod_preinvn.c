@@ -0,0 +1,124 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "mpn_extras.h"
+#include "fmpz.h"
+
+void fmpz_mod_preinvn(fmpz_t f, const fmpz_t g, const fmpz_t h, 
+                      const fmpz_preinvn_t hinv)
+{
+    fmpz c1 = *g;
+    fmpz c2 = *h;
+
+    if (!COEFF_IS_MPZ(c2))      /* h is small */
+    {
+        const mp_limb_t d = FLINT_ABS(c2), dinv = hinv->dinv[0];
+        mp_limb_t r;
+        int neg;
+
+        if (!COEFF_IS_MPZ(c1))  /* g is also small */
+        {
+            r   = n_mod2_preinv(FLINT_ABS(c1), d, dinv);
+            neg = (c1 < 0L);
+        }
+        else
+        {
+            __mpz_struct *mg = COEFF_TO_PTR(c1);
+            long i = FLINT_ABS(mg->_mp_size) - 1;
+
+            r = n_mod2_preinv(mg->_mp_d[i], d, dinv);
+            for (i--; i >= 0; i--)
+                r = n_ll_mod_preinv(r, mg->_mp_d[i], d, dinv);
+            neg = (mg->_mp_size < 0);
+        }
+
+        if (neg && r != 0)
+            r = d - r;
+
+        fmpz_set_ui(f, r);
+    }
+    else if (!COEFF_IS_MPZ(c1) 
+             || FLINT_ABS(COEFF_TO_PTR(c1)->_mp_size) < hinv->n 
+             || hinv->n < FMPZ_MOD_PREINVN_CUTOFF)
+    {
+        fmpz_mod(f, g, h);
+    }
+    else                        /* both are large */
+    {
+        __mpz_struct *mg = COEFF_TO_PTR(c1);
+        mp_srcptr hp = COEFF_TO_PTR(c2)->_mp_d;
+        long m = FLINT_ABS(mg->_mp_size), n = hinv->n;
+        const int neg = (mg->_mp_size < 0);
+        mp_ptr a, d, r;
+
+        /* Shift g and h so that h is normalised */
+        a = flint_malloc((m + 1 + 2 * n) * sizeof(mp_limb_t));
+        d = a + (m + 1);
+        r = d + n;
+
+        if (hinv->norm)
+        {
+            a[m] = mpn_lshift(a, mg->_mp_d, m, hinv->norm);
+            mpn_lshift(d, hp, n, hinv->norm);
+            m += (a[m] != 0);
+        }
+        else
+        {
+            flint_mpn_copyi(a, mg->_mp_d, m);
+            flint_mpn_copyi(d, hp, n);
+        }
+
+        flint_mpn_mod_preinvn(r, a, m, d, n, hinv->dinv);
+
+        if (hinv->norm)
+            mpn_rshift(r, r, n, hinv->norm);
+
+        if (neg && !flint_mpn_zero_p(r, n))
+            mpn_sub_n(r, hp, r, n);
+
+        while (n > 0 && r[n - 1] == 0)
+            n--;
+
+        if (n <= 1)
+        {
+            fmpz_set_ui(f, (n == 0) ? 0 : r[0]);
+        }
+        else
+        {
+            __mpz_struct *mf = _fmpz_promote(f);
+
+            if (mf->_mp_alloc < n)
+                mpz_realloc(mf, n);
+            flint_mpn_copyi(mf->_mp_d, r, n);
+            mf->_mp_size = n;
+        }
+
+        flint_free(a);
+    }
+}
+
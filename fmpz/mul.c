@@ -27,6 +27,7 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fmpz.h"
+#include "mpn_extras.h"
 
 void
 fmpz_mul(fmpz_t f, const fmpz_t g, const fmpz_t h)
@@ -55,5 +56,5 @@ fmpz_mul(fmpz_t f, const fmpz_t g, const fmpz_t h)
     if (!COEFF_IS_MPZ(c2))      /* g is large, h is small */
         mpz_mul_si(mpz_ptr, COEFF_TO_PTR(c1), c2);
     else                        /* c1 and c2 are large */
-        mpz_mul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
+        flint_mpz_mul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
 }
@@ -28,6 +28,7 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fmpz.h"
+#include "mpn_extras.h"
 
 void
 fmpz_mul_tdiv_q_2exp(fmpz_t f, const fmpz_t g, const fmpz_t h, ulong exp)
@@ -56,7 +57,7 @@ fmpz_mul_tdiv_q_2exp(fmpz_t f, const fmpz_t g, const fmpz_t h, ulong exp)
     if (!COEFF_IS_MPZ(c2))      /* g is large, h is small */
         mpz_mul_si(mpz_ptr, COEFF_TO_PTR(c1), c2);
     else                        /* c1 and c2 are large */
-        mpz_mul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
+        flint_mpz_mul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
 
     mpz_tdiv_q_2exp(mpz_ptr, mpz_ptr, exp);
     _fmpz_demote_val(f);  /* division may make value small */
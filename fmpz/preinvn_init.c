@@ -0,0 +1,79 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+#include "mpn_extras.h"
+#include "fmpz.h"
+
+void fmpz_preinvn_init(fmpz_preinvn_t inv, const fmpz_t f)
+{
+    fmpz c = *f;
+    mp_ptr t;
+
+    if (c == 0L)
+    {
+        printf("Exception (fmpz_preinvn_init).  Division by zero.\n");
+        abort();
+    }
+
+    if (!COEFF_IS_MPZ(c))
+    {
+        mp_limb_t d = FLINT_ABS(c);
+
+        count_leading_zeros(inv->norm, d);
+
+        inv->n    = 1;
+        inv->dinv = flint_malloc(sizeof(mp_limb_t));
+        inv->dinv[0] = n_preinvert_limb(d);
+    }
+    else
+    {
+        __mpz_struct *m = COEFF_TO_PTR(c);
+        const long n = FLINT_ABS(m->_mp_size);
+
+        count_leading_zeros(inv->norm, m->_mp_d[n - 1]);
+
+        inv->n    = n;
+        inv->dinv = flint_malloc(n * sizeof(mp_limb_t));
+
+        if (inv->norm)
+        {
+            t = flint_malloc(n * sizeof(mp_limb_t));
+            mpn_lshift(t, m->_mp_d, n, inv->norm);
+            flint_mpn_preinvn(inv->dinv, t, n);
+            flint_free(t);
+        }
+        else
+        {
+            flint_mpn_preinvn(inv->dinv, m->_mp_d, n);
+        }
+    }
+}
+
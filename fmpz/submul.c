@@ -27,6 +27,7 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "fmpz.h"
+#include "mpn_extras.h"
 
 void
 fmpz_submul(fmpz_t f, const fmpz_t g, const fmpz_t h)
@@ -52,7 +53,7 @@ fmpz_submul(fmpz_t f, const fmpz_t g, const fmpz_t h)
         else                    /* both g and h are large */
         {
             __mpz_struct *mpz_ptr = _fmpz_promote_val(f);
-            mpz_submul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
+            flint_mpz_submul(mpz_ptr, COEFF_TO_PTR(c1), COEFF_TO_PTR(c2));
             _fmpz_demote_val(f);    /* cancellation may have occurred */
         }
     }
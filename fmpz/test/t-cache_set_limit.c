@@ -0,0 +1,201 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong /* prevent clash with standard library */
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#define ulong unsigned long
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+#define NUM 200
+
+/* sets f to a random integer of exactly the given number of bits */
+void randbits_exact(fmpz_t f, flint_rand_t state, mp_bitcnt_t bits)
+{
+    fmpz_randbits(f, state, bits - 1);
+    fmpz_abs(f, f);
+    fmpz_setbit(f, bits - 1);
+}
+
+void * thread_stats(void * arg)
+{
+    fmpz_cache_stats_t stats;
+    fmpz_t a;
+
+    fmpz_init(a);
+    fmpz_cache_get_stats(stats);
+    *((int *) arg) = (stats->hits == 0 && stats->misses == 0);
+    fmpz_clear(a);
+
+    _fmpz_cleanup();
+
+    return NULL;
+}
+
+int
+main(void)
+{
+    int i, j, result;
+    flint_rand_t state;
+    fmpz_cache_stats_t s1, s2;
+    fmpz * v;
+
+    printf("cache_set_limit....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    v = _fmpz_vec_init(NUM);
+
+    /* cleared mpz's are handed out again */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        _fmpz_cleanup();
+        fmpz_cache_get_stats(s1);
+
+        result = (s1->num == 0 && s1->limbs == 0);
+
+        for (j = 0; j < NUM; j++)
+            randbits_exact(v + j, state, 
+                FLINT_BITS + n_randint(state, 10 * FLINT_BITS));
+        for (j = 0; j < NUM; j++)
+            fmpz_zero(v + j);
+
+        fmpz_cache_get_stats(s2);
+        result = result && (s2->num == NUM);
+
+        for (j = 0; j < NUM; j++)
+            randbits_exact(v + j, state, 
+                FLINT_BITS + n_randint(state, 10 * FLINT_BITS));
+
+        fmpz_cache_get_stats(s1);
+        result = result && (s1->num == 0 && s1->hits >= s2->hits + NUM);
+
+        if (!result)
+        {
+            printf("FAIL (reuse)\n");
+            printf("num = %lu, hits = %lu\n", s1->num, s1->hits);
+            abort();
+        }
+
+        for (j = 0; j < NUM; j++)
+            fmpz_zero(v + j);
+    }
+
+    /* the cache hands out an mpz with enough limbs if it has one */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a;
+        ulong limbs = 1 + n_randint(state, 200);
+        __mpz_struct * z;
+
+        _fmpz_cleanup();
+
+        fmpz_init2(a, limbs);
+        z = COEFF_TO_PTR(*a);
+        result = (z->_mp_alloc >= limbs);
+        fmpz_clear(a);
+
+        for (j = 0; j < 10; j++)
+        {
+            fmpz_init(v + j);
+            fmpz_randtest_not_zero(v + j, state, FLINT_BITS + 1);
+            fmpz_zero(v + j);
+        }
+
+        fmpz_init2(a, limbs);
+        z = COEFF_TO_PTR(*a);
+        result = result && (z->_mp_alloc >= limbs);
+        fmpz_clear(a);
+
+        if (!result)
+        {
+            printf("FAIL (size)\n");
+            printf("limbs = %lu, alloc = %d\n", limbs, z->_mp_alloc);
+            abort();
+        }
+    }
+
+    /* the cache stays below its limit */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        ulong limit = n_randint(state, 2000);
+
+        for (j = 0; j < NUM; j++)
+            randbits_exact(v + j, state, 
+                FLINT_BITS + n_randint(state, 100 * FLINT_BITS));
+        for (j = 0; j < NUM / 2; j++)
+            fmpz_zero(v + j);
+
+        fmpz_cache_set_limit(limit);
+        fmpz_cache_get_stats(s1);
+        result = (s1->limbs <= limit && fmpz_cache_get_limit() == limit);
+
+        for (j = NUM / 2; j < NUM; j++)
+            fmpz_zero(v + j);
+
+        fmpz_cache_get_stats(s2);
+        result = result && (s2->limbs <= limit);
+
+        if (!result)
+        {
+            printf("FAIL (limit)\n");
+            printf("limit = %lu, limbs = %lu, %lu\n", limit, 
+                s1->limbs, s2->limbs);
+            abort();
+        }
+
+        fmpz_cache_set_limit(FMPZ_CACHE_DEFAULT_LIMIT);
+    }
+
+#if HAVE_TLS
+    /* each thread has its own cache */
+    {
+        pthread_t t;
+
+        result = 0;
+        pthread_create(&t, NULL, thread_stats, &result);
+        pthread_join(t, NULL);
+
+        if (!result)
+        {
+            printf("FAIL (threads)\n");
+            abort();
+        }
+    }
+#endif
+
+    _fmpz_vec_clear(v, NUM);
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
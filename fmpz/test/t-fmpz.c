@@ -30,6 +30,26 @@
 #include "ulong_extras.h"
 #include "fmpz.h"
 
+static ulong gmp_calls = 0;
+
+static void * gmp_alloc(size_t size)
+{
+    gmp_calls++;
+    return malloc(size);
+}
+
+static void * gmp_realloc(void * ptr, size_t old_size, size_t new_size)
+{
+    gmp_calls++;
+    return realloc(ptr, new_size);
+}
+
+static void gmp_free(void * ptr, size_t size)
+{
+    gmp_calls++;
+    free(ptr);
+}
+
 int
 main(void)
 {
@@ -63,6 +83,131 @@ main(void)
         }
     }
 
+    /* 
+       values grown beyond the initial limbs of the mpz by GMP and shrunk 
+       again, with the mpz recycled in between
+    */
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b;
+        mpz_t c, d;
+        __mpz_struct * z;
+        long j, k;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        mpz_init(c);
+        mpz_init(d);
+
+        fmpz_randtest(a, state, 1 + n_randint(state, 
+            2 * FMPZ_MIN_LIMBS * FLINT_BITS));
+        fmpz_get_mpz(c, a);
+
+        for (j = 0; j < 4; j++)
+        {
+            z = _fmpz_promote_val(a);
+            fmpz_randtest_not_zero(b, state, 1 + n_randint(state, 
+                FMPZ_MIN_LIMBS * FLINT_BITS));
+            fmpz_get_mpz(d, b);
+
+            switch (n_randint(state, 4))
+            {
+                case 0:
+                    mpz_mul(z, z, d);
+                    mpz_mul(c, c, d);
+                    break;
+                case 1:
+                    mpz_tdiv_q(z, z, d);
+                    mpz_tdiv_q(c, c, d);
+                    break;
+                case 2:
+                    mpz_realloc2(z, n_randint(state, 
+                        2 * FMPZ_MIN_LIMBS * FLINT_BITS) + 1);
+                    mpz_realloc2(c, mpz_sizeinbase(z, 2) + 1);
+                    mpz_set(c, z);
+                    break;
+                default:
+                    k = n_randint(state, FMPZ_MIN_LIMBS * FLINT_BITS);
+                    mpz_mul_2exp(z, z, k);
+                    mpz_mul_2exp(c, c, k);
+            }
+
+            _fmpz_demote_val(a);
+            fmpz_get_mpz(d, a);
+
+            result = (mpz_cmp(c, d) == 0);
+            if (!result)
+            {
+                printf("FAIL (recycled mpz)\n");
+                gmp_printf("c = %Zd\nd = %Zd\n", c, d);
+                abort();
+            }
+        }
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        mpz_clear(c);
+        mpz_clear(d);
+    }
+
+    /* 
+       large values created before the GMP memory functions are replaced 
+       and grown afterwards
+    */
+    {
+        void * (*alloc_func) (size_t);
+        void * (*realloc_func) (void *, size_t, size_t);
+        void (*free_func) (void *, size_t);
+        fmpz_t a[100];
+        mpz_t c, d;
+
+        mp_get_memory_functions(&alloc_func, &realloc_func, &free_func);
+
+        mpz_init(c);
+        mpz_init(d);
+
+        for (i = 0; i < 100; i++)
+        {
+            fmpz_init(a[i]);
+            fmpz_randtest_not_zero(a[i], state, 
+                FLINT_BITS + n_randint(state, FMPZ_MIN_LIMBS * FLINT_BITS));
+        }
+
+        mp_set_memory_functions(gmp_alloc, gmp_realloc, gmp_free);
+
+        for (i = 0; i < 100; i++)
+        {
+            fmpz_get_mpz(c, a[i]);
+
+            fmpz_mul_2exp(a[i], a[i], 2 * FMPZ_MIN_LIMBS * FLINT_BITS);
+            mpz_mul_2exp(c, c, 2 * FMPZ_MIN_LIMBS * FLINT_BITS);
+
+            fmpz_get_mpz(d, a[i]);
+
+            result = (mpz_cmp(c, d) == 0);
+            if (!result)
+            {
+                printf("FAIL (memory functions)\n");
+                abort();
+            }
+
+            fmpz_clear(a[i]);
+        }
+
+        mpz_clear(c);
+        mpz_clear(d);
+
+        _fmpz_cleanup();
+
+        mp_set_memory_functions(alloc_func, realloc_func, free_func);
+
+        if (gmp_calls == 0)
+        {
+            printf("FAIL (memory functions not used)\n");
+            abort();
+        }
+    }
+
     flint_randclear(state);
     _fmpz_cleanup();
     printf("PASS\n");
@@ -0,0 +1,250 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    printf("mod_preinvn....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* Check against mpz_mod for random inputs */
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b, c;
+        fmpz_preinvn_t inv;
+        mpz_t d, e, f, g;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+
+        mpz_init(d);
+        mpz_init(e);
+        mpz_init(f);
+        mpz_init(g);
+
+        fmpz_randtest(a, state, 2000);
+        fmpz_randtest_not_zero(b, state, 1000);
+
+        fmpz_get_mpz(d, a);
+        fmpz_get_mpz(e, b);
+
+        fmpz_preinvn_init(inv, b);
+
+        fmpz_mod_preinvn(c, a, b, inv);
+        mpz_mod(f, d, e);
+
+        fmpz_get_mpz(g, c);
+
+        result = (mpz_cmp(f, g) == 0);
+        if (!result)
+        {
+            printf("FAIL:\n");
+            gmp_printf("d = %Zd, e = %Zd, f = %Zd, g = %Zd\n", d, e, f, g);
+            abort();
+        }
+
+        fmpz_preinvn_clear(inv);
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+
+        mpz_clear(d);
+        mpz_clear(e);
+        mpz_clear(f);
+        mpz_clear(g);
+    }
+
+    /* Check products of reduced residues, as in modular arithmetic */
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b, c;
+        fmpz_preinvn_t inv;
+        mpz_t d, e, f, g;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+
+        mpz_init(d);
+        mpz_init(e);
+        mpz_init(f);
+        mpz_init(g);
+
+        fmpz_randtest_not_zero(b, state, 1000);
+        fmpz_randtest(a, state, 1000);
+        fmpz_randtest(c, state, 1000);
+        fmpz_mod(a, a, b);
+        fmpz_mod(c, c, b);
+        fmpz_mul(a, a, c);
+        if (n_randint(state, 2))
+            fmpz_neg(a, a);
+
+        fmpz_get_mpz(d, a);
+        fmpz_get_mpz(e, b);
+
+        fmpz_preinvn_init(inv, b);
+
+        fmpz_mod_preinvn(c, a, b, inv);
+        mpz_mod(f, d, e);
+
+        fmpz_get_mpz(g, c);
+
+        result = (mpz_cmp(f, g) == 0);
+        if (!result)
+        {
+            printf("FAIL:\n");
+            gmp_printf("d = %Zd, e = %Zd, f = %Zd, g = %Zd\n", d, e, f, g);
+            abort();
+        }
+
+        fmpz_preinvn_clear(inv);
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+
+        mpz_clear(d);
+        mpz_clear(e);
+        mpz_clear(f);
+        mpz_clear(g);
+    }
+
+    /* Check aliasing of a and c */
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b, c;
+        fmpz_preinvn_t inv;
+        mpz_t d, e, f, g;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+
+        mpz_init(d);
+        mpz_init(e);
+        mpz_init(f);
+        mpz_init(g);
+
+        fmpz_randtest(a, state, 2000);
+        fmpz_randtest_not_zero(b, state, 1000);
+
+        fmpz_get_mpz(d, a);
+        fmpz_get_mpz(e, b);
+
+        fmpz_preinvn_init(inv, b);
+
+        fmpz_mod_preinvn(a, a, b, inv);
+        mpz_mod(f, d, e);
+
+        fmpz_get_mpz(g, a);
+
+        result = (mpz_cmp(f, g) == 0);
+        if (!result)
+        {
+            printf("FAIL:\n");
+            gmp_printf("d = %Zd, e = %Zd, f = %Zd, g = %Zd\n", d, e, f, g);
+            abort();
+        }
+
+        fmpz_preinvn_clear(inv);
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+
+        mpz_clear(d);
+        mpz_clear(e);
+        mpz_clear(f);
+        mpz_clear(g);
+    }
+
+    /* Check aliasing of b and c */
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b, c;
+        fmpz_preinvn_t inv;
+        mpz_t d, e, f, g;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+
+        mpz_init(d);
+        mpz_init(e);
+        mpz_init(f);
+        mpz_init(g);
+
+        fmpz_randtest(a, state, 2000);
+        fmpz_randtest_not_zero(b, state, 1000);
+
+        fmpz_get_mpz(d, a);
+        fmpz_get_mpz(e, b);
+
+        fmpz_preinvn_init(inv, b);
+
+        fmpz_mod_preinvn(b, a, b, inv);
+        mpz_mod(f, d, e);
+
+        fmpz_get_mpz(g, b);
+
+        result = (mpz_cmp(f, g) == 0);
+        if (!result)
+        {
+            printf("FAIL:\n");
+            gmp_printf("d = %Zd, e = %Zd, f = %Zd, g = %Zd\n", d, e, f, g);
+            abort();
+        }
+
+        fmpz_preinvn_clear(inv);
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+
+        mpz_clear(d);
+        mpz_clear(e);
+        mpz_clear(f);
+        mpz_clear(g);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
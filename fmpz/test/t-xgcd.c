@@ -287,6 +287,50 @@ main(void)
         fmpz_clear(t2);
     }
 
+    /* Test a f + b g == d == gcd(f, g) with signed inputs */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t d, a, b, f, g, t1, t2;
+
+        fmpz_init(d);
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(f);
+        fmpz_init(g);
+        fmpz_init(t1);
+        fmpz_init(t2);
+
+        fmpz_randtest(f, state, 200);
+        fmpz_randtest(g, state, 200);
+
+        fmpz_xgcd(d, a, b, f, g);
+
+        fmpz_mul(t1, a, f);
+        fmpz_mul(t2, b, g);
+        fmpz_add(t1, t1, t2);
+        fmpz_gcd(t2, f, g);
+
+        result = (fmpz_equal(t1, d) && fmpz_equal(t2, d));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("d = "), fmpz_print(d), printf("\n");
+            printf("a = "), fmpz_print(a), printf("\n");
+            printf("b = "), fmpz_print(b), printf("\n");
+            printf("f = "), fmpz_print(f), printf("\n");
+            printf("g = "), fmpz_print(g), printf("\n");
+            abort();
+        }
+
+        fmpz_clear(d);
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(f);
+        fmpz_clear(g);
+        fmpz_clear(t1);
+        fmpz_clear(t2);
+    }
+
     flint_randclear(state);
     _fmpz_cleanup();
     printf("PASS\n");
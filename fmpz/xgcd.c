@@ -33,6 +33,26 @@ void fmpz_xgcd(fmpz_t d, fmpz_t a, fmpz_t b, const fmpz_t f, const fmpz_t g)
    fmpz_t t1, t2;
    fmpz * f1, * g1;
 
+   if (fmpz_sgn(f) < 0 || fmpz_sgn(g) < 0)
+   {
+      int sf = fmpz_sgn(f), sg = fmpz_sgn(g);
+
+      fmpz_init(t1);
+      fmpz_init(t2);
+      fmpz_abs(t1, f);
+      fmpz_abs(t2, g);
+
+      fmpz_xgcd(d, a, b, t1, t2);
+      if (sf < 0)
+         fmpz_neg(a, a);
+      if (sg < 0)
+         fmpz_neg(b, b);
+
+      fmpz_clear(t1);
+      fmpz_clear(t2);
+      return;
+   }
+
    fmpz_init(t1);
    fmpz_init(t2);
 
@@ -45,6 +45,19 @@ typedef struct
 
 typedef fmpz_factor_struct fmpz_factor_t[1];
 
+/* number of primes to trial divide by before using the quadratic sieve */
+#define FMPZ_FACTOR_TRIAL_PRIMES 3000
+
+/* 
+   ECM is run on cofactors of at least FMPZ_FACTOR_ECM_MIN_BITS bits 
+   before the quadratic sieve, with FMPZ_FACTOR_ECM_CURVES curves for 
+   each stage 1 bound FMPZ_FACTOR_ECM_B1, 5 FMPZ_FACTOR_ECM_B1, ... 
+   one more bound for every further 50 bits
+*/
+#define FMPZ_FACTOR_ECM_MIN_BITS 150
+#define FMPZ_FACTOR_ECM_CURVES 15
+#define FMPZ_FACTOR_ECM_B1 2000
+
 
 /* Utility functions *********************************************************/
 
@@ -58,6 +71,8 @@ void _fmpz_factor_fit_length(fmpz_factor_t factor, long len);
 
 void _fmpz_factor_append_ui(fmpz_factor_t factor, mp_limb_t p, ulong exp);
 
+void _fmpz_factor_append(fmpz_factor_t factor, const fmpz_t p, ulong exp);
+
 void _fmpz_factor_set_length(fmpz_factor_t factor, long newlen);
 
 /* Factoring *****************************************************************/
@@ -73,6 +88,18 @@ void fmpz_factor_si(fmpz_factor_t factor, long n);
 
 int fmpz_factor_pp1(fmpz_t factor, const fmpz_t n, ulong B1, ulong c);
 
+int fmpz_factor_ecm(fmpz_t f, const fmpz_t n, ulong curves, 
+                    ulong B1, ulong B2, flint_rand_t state);
+
+void _fmpz_factor_smooth_parts(fmpz * s, const fmpz * x, long len, 
+                               const fmpz_t P);
+
+void fmpz_factor_smooth_parts(fmpz * s, const fmpz * x, long len, 
+                              mp_limb_t bound);
+
+void fmpz_factor_smooth_batch(fmpz_factor_struct * factors, const fmpz * x, 
+                              long len, mp_limb_t bound);
+
 /* Expansion *****************************************************************/
 
 void fmpz_factor_expand_iterative(fmpz_t n, const fmpz_factor_t factor);
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
@@ -30,12 +31,93 @@
 #include "fmpz_factor.h"
 #include "mpn_extras.h"
 #include "ulong_extras.h"
+#include "qsieve.h"
+
+/*
+   Append the factorisation of n^exp to factor, where n > 1 has no 
+   prime factors found by trial division.
+*/
+static void
+_fmpz_factor_cofactor(fmpz_factor_t factor, const fmpz_t n, ulong exp)
+{
+    fmpz_t f, g;
+    ulong k, max_k, bits;
+    long i;
+    int found = 0;
+
+    if (fmpz_abs_fits_ui(n))
+    {
+        n_factor_t nfac;
+
+        n_factor_init(&nfac);
+        n_factor(&nfac, fmpz_get_ui(n), 0);
+
+        for (i = 0; i < nfac.num; i++)
+            _fmpz_factor_append_ui(factor, nfac.p[i], nfac.exp[i]*exp);
+
+        return;
+    }
+
+    if (fmpz_is_probabprime(n))
+    {
+        _fmpz_factor_append(factor, n, exp);
+        return;
+    }
+
+    fmpz_init(f);
+    fmpz_init(g);
+
+    /* perfect powers; the prime factors of n have at least 14 bits */
+    bits = fmpz_bits(n);
+    max_k = bits/14;
+    for (k = 2; k <= max_k; k = n_nextprime(k, 0))
+    {
+        fmpz_root(f, (fmpz *) n, k);
+        fmpz_pow_ui(g, f, k);
+
+        if (fmpz_equal(g, n))
+        {
+            _fmpz_factor_cofactor(factor, f, exp*k);
+            goto cleanup;
+        }
+    }
+
+    /* look for small factors with ECM, with more effort for larger n */
+    if (bits >= FMPZ_FACTOR_ECM_MIN_BITS)
+    {
+        flint_rand_t state;
+        ulong B1 = FMPZ_FACTOR_ECM_B1;
+
+        flint_randinit(state);
+        for (k = FMPZ_FACTOR_ECM_MIN_BITS; k <= bits && !found; k += 50)
+        {
+            found = fmpz_factor_ecm(f, n, FMPZ_FACTOR_ECM_CURVES, 
+                                    B1, 50*B1, state);
+            B1 *= 5;
+        }
+        flint_randclear(state);
+    }
+
+    if (found || qsieve_factor(f, n))
+    {
+        fmpz_divexact(g, n, f);
+        _fmpz_factor_cofactor(factor, f, exp);
+        _fmpz_factor_cofactor(factor, g, exp);
+    }
+    else
+        _fmpz_factor_append(factor, n, exp);
+
+cleanup:
+    fmpz_clear(f);
+    fmpz_clear(g);
+}
 
 void
 fmpz_factor(fmpz_factor_t factor, const fmpz_t n)
 {
     ulong exp;
     mp_limb_t p;
+    const mp_limb_t * primes;
     mpz_t x;
     mp_ptr xd;
     mp_size_t xsize;
@@ -80,7 +162,8 @@ fmpz_factor(fmpz_factor_t factor, const fmpz_t n)
 
         if (found)
         {
-            p = flint_primes[found];
+            primes = n_primes_arr_readonly(found + 1);
+            p = primes[found];
             exp = 1;
             xsize = flint_mpn_divexact_1(xd, xsize, p);
 
@@ -101,8 +184,8 @@ fmpz_factor(fmpz_factor_t factor, const fmpz_t n)
                 exp += 3;
             }
 
-            _fmpz_factor_append_ui(factor, flint_primes[found], exp);
-            /* printf("added %lu %lu\n", flint_primes[found], exp); */
+            _fmpz_factor_append_ui(factor, primes[found], exp);
+            /* printf("added %lu %lu\n", primes[found], exp); */
 
             /* Continue using only trial division as long as it is successful.
                This allows quickly factoring huge highly composite numbers
@@ -113,15 +196,53 @@ fmpz_factor(fmpz_factor_t factor, const fmpz_t n)
         }
         else
         {
-            /* Insert primality test, perfect power test, other factoring
-               algorithms here... */
+            if (trial_stop >= FMPZ_FACTOR_TRIAL_PRIMES)
+                break;
+
             trial_start = trial_stop;
-            trial_stop = trial_start + 1000;
+            trial_stop = FLINT_MIN(trial_start + 1000, FMPZ_FACTOR_TRIAL_PRIMES);
         }
     }
 
-    /* Any single-limb factor left? */
-    if (xd[0] != 1)
+    if (xsize > 1) /* factor the cofactor with ECM and the quadratic sieve */
+    {
+        fmpz_t c;
+        long i, j, start = factor->num;
+
+        fmpz_init(c);
+        x->_mp_size = xsize;
+        fmpz_set_mpz(c, x);
+
+        _fmpz_factor_cofactor(factor, c, 1);
+
+        /* sort the new factors and merge repeated ones */
+        for (i = start + 1; i < factor->num; i++)
+        {
+            for (j = i; j > start && fmpz_cmp(factor->p + j - 1, factor->p + j) > 0; j--)
+            {
+                ulong t = factor->exp[j];
+                factor->exp[j] = factor->exp[j - 1];
+                factor->exp[j - 1] = t;
+                fmpz_swap(factor->p + j, factor->p + j - 1);
+            }
+        }
+
+        for (i = j = start; i < factor->num; i++)
+        {
+            if (j > start && fmpz_equal(factor->p + j - 1, factor->p + i))
+                factor->exp[j - 1] += factor->exp[i];
+            else
+            {
+                fmpz_swap(factor->p + j, factor->p + i);
+                factor->exp[j] = factor->exp[i];
+                j++;
+            }
+        }
+        _fmpz_factor_set_length(factor, j);
+
+        fmpz_clear(c);
+    }
+    else if (xd[0] != 1) /* Any single-limb factor left? */
         _fmpz_factor_extend_factor_ui(factor, xd[0]);
 
     mpz_clear(x);
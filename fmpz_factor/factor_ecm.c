@@ -0,0 +1,435 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_factor.h"
+#include "mpn_extras.h"
+#include "ulong_extras.h"
+
+/*
+   Arithmetic on the Montgomery curve b y^2 = x^3 + a x^2 + x using 
+   the coordinates (x : z). As in fmpz_factor_pp1, residues are 
+   nn-limb integers shifted left by norm bits, as are n and the 
+   constant a24 = (a + 2)/4. Each curve operation requires 5*nn limbs 
+   of scratch space t.
+*/
+
+#define ECM_D 2310 /* giant step of stage 2 */
+
+#define ECM_BABY 240 /* number of odd 0 < j < D/2 coprime to D */
+
+static __inline__ void
+ecm_addmod(mp_ptr r, mp_srcptr a, mp_srcptr b, mp_srcptr n, mp_size_t nn)
+{
+   if (mpn_add_n(r, a, b, nn) || mpn_cmp(r, n, nn) >= 0)
+      mpn_sub_n(r, r, n, nn);
+}
+
+static __inline__ void
+ecm_submod(mp_ptr r, mp_srcptr a, mp_srcptr b, mp_srcptr n, mp_size_t nn)
+{
+   if (mpn_sub_n(r, a, b, nn))
+      mpn_add_n(r, r, n, nn);
+}
+
+/* (x : z) = 2 (x0 : z0), aliasing allowed */
+static void ecm_double(mp_ptr x, mp_ptr z, mp_srcptr x0, mp_srcptr z0, 
+                       mp_srcptr a24, mp_srcptr n, mp_srcptr ninv, 
+                       mp_size_t nn, ulong norm, mp_ptr t)
+{
+   mp_ptr u = t, v = t + nn, w = t + 2*nn;
+
+   ecm_addmod(u, x0, z0, n, nn);
+   flint_mpn_mulmod_preinvn(u, u, u, nn, n, ninv, norm);
+   ecm_submod(v, x0, z0, n, nn);
+   flint_mpn_mulmod_preinvn(v, v, v, nn, n, ninv, norm);
+   flint_mpn_mulmod_preinvn(x, u, v, nn, n, ninv, norm);
+   ecm_submod(w, u, v, n, nn);
+   flint_mpn_mulmod_preinvn(u, a24, w, nn, n, ninv, norm);
+   ecm_addmod(u, u, v, n, nn);
+   flint_mpn_mulmod_preinvn(z, w, u, nn, n, ninv, norm);
+}
+
+/* 
+   (x : z) = (x1 : z1) + (x2 : z2), given their difference (xd : zd),
+   which may not be aliased with (x : z)
+*/
+static void ecm_add(mp_ptr x, mp_ptr z, mp_srcptr x1, mp_srcptr z1, 
+                    mp_srcptr x2, mp_srcptr z2, mp_srcptr xd, mp_srcptr zd,
+                    mp_srcptr n, mp_srcptr ninv, mp_size_t nn, ulong norm,
+                    mp_ptr t)
+{
+   mp_ptr u = t, v = t + nn, w = t + 2*nn, s1 = t + 3*nn, s2 = t + 4*nn;
+
+   ecm_submod(s1, x1, z1, n, nn);
+   ecm_addmod(s2, x2, z2, n, nn);
+   flint_mpn_mulmod_preinvn(u, s1, s2, nn, n, ninv, norm);
+   ecm_addmod(s1, x1, z1, n, nn);
+   ecm_submod(s2, x2, z2, n, nn);
+   flint_mpn_mulmod_preinvn(v, s1, s2, nn, n, ninv, norm);
+   ecm_addmod(w, u, v, n, nn);
+   flint_mpn_mulmod_preinvn(w, w, w, nn, n, ninv, norm);
+   ecm_submod(u, u, v, n, nn);
+   flint_mpn_mulmod_preinvn(u, u, u, nn, n, ninv, norm);
+   flint_mpn_mulmod_preinvn(x, zd, w, nn, n, ninv, norm);
+   flint_mpn_mulmod_preinvn(z, xd, u, nn, n, ninv, norm);
+}
+
+/* 
+   (x : z) = k (x : z) by the Montgomery ladder, k > 0, using 11*nn
+   limbs of scratch space t
+*/
+static void ecm_mul(mp_ptr x, mp_ptr z, mp_limb_t k, mp_srcptr a24, 
+                    mp_srcptr n, mp_srcptr ninv, mp_size_t nn, ulong norm,
+                    mp_ptr t)
+{
+   mp_ptr x0 = t + 5*nn, z0 = t + 6*nn;
+   mp_ptr x1 = x, z1 = z, x2 = t + 7*nn, z2 = t + 8*nn;
+   mp_limb_t bit;
+
+   if (k == 1)
+      return;
+
+   bit = ((1UL << (FLINT_BIT_COUNT(k) - 1)) >> 1);
+
+   mpn_copyi(x0, x, nn);
+   mpn_copyi(z0, z, nn);
+   ecm_double(x2, z2, x0, z0, a24, n, ninv, nn, norm, t);
+
+   for ( ; bit; bit >>= 1)
+   {
+      if (k & bit)
+      {
+         ecm_add(x1, z1, x1, z1, x2, z2, x0, z0, n, ninv, nn, norm, t);
+         ecm_double(x2, z2, x2, z2, a24, n, ninv, nn, norm, t);
+      } else
+      {
+         ecm_add(x2, z2, x1, z1, x2, z2, x0, z0, n, ninv, nn, norm, t);
+         ecm_double(x1, z1, x1, z1, a24, n, ninv, nn, norm, t);
+      }
+   }
+}
+
+/* set r to the nn-limb representation of 0 <= a < n shifted by norm */
+static void ecm_set_fmpz(mp_ptr r, const fmpz_t a, mp_size_t nn, ulong norm)
+{
+   mpn_zero(r, nn);
+
+   if (!COEFF_IS_MPZ(*a))
+      r[0] = *a;
+   else
+   {
+      __mpz_struct * m = COEFF_TO_PTR(*a);
+      mpn_copyi(r, m->_mp_d, m->_mp_size);
+   }
+
+   if (norm)
+      mpn_lshift(r, r, nn, norm);
+}
+
+/*
+   Sets f to gcd(x, n) where x is given in shifted representation and 
+   n unshifted, using 2*nn limbs of scratch space t. Returns 0 if x = 0.
+*/
+static int ecm_gcd(fmpz_t f, mp_srcptr x, mp_srcptr n, mp_size_t nn, 
+                   ulong norm, mp_ptr t)
+{
+   __mpz_struct * m;
+   mp_size_t xn = nn, r;
+
+   if (norm)
+      mpn_rshift(t, x, nn, norm);
+   else
+      mpn_copyi(t, x, nn);
+
+   MPN_NORM(t, xn);
+
+   if (xn == 0)
+      return 0;
+
+   mpn_copyi(t + nn, n, nn); /* destroyed by the gcd */
+
+   m = _fmpz_promote(f);
+   mpz_realloc(m, nn);
+   r = flint_mpn_gcd_full(m->_mp_d, t + nn, nn, t, xn);
+   m->_mp_size = r;
+   _fmpz_demote_val(f);
+
+   return 1;
+}
+
+/*
+   Selects a random curve and point using Suyama's parametrisation, 
+   setting x, z, a24 to their shifted representations. Returns 1 if 
+   successful. Otherwise f is set to gcd(d, n) for a denominator d which 
+   is not invertible modulo n and 0 is returned.
+*/
+static int ecm_select_curve(mp_ptr x, mp_ptr z, mp_ptr a24, fmpz_t f, 
+                            const fmpz_t n, mp_size_t nn, ulong norm, 
+                            flint_rand_t state)
+{
+   fmpz_t sigma, u, v, w, t;
+   int ret = 1;
+
+   fmpz_init(sigma);
+   fmpz_init(u);
+   fmpz_init(v);
+   fmpz_init(w);
+   fmpz_init(t);
+
+   fmpz_sub_ui(t, n, 6);
+   fmpz_randm(sigma, state, t);
+   fmpz_add_ui(sigma, sigma, 6);
+
+   fmpz_mul(u, sigma, sigma);
+   fmpz_sub_ui(u, u, 5);
+   fmpz_mod(u, u, n);
+   fmpz_mul_2exp(v, sigma, 2);
+   fmpz_mod(v, v, n);
+
+   fmpz_powm_ui(t, u, 3, n);
+   ecm_set_fmpz(x, t, nn, norm); /* u^3 */
+   fmpz_mul(w, t, v); 
+   fmpz_mul_2exp(w, w, 4);
+   fmpz_mod(w, w, n); /* 16 u^3 v */
+   fmpz_powm_ui(t, v, 3, n);
+   ecm_set_fmpz(z, t, nn, norm); /* v^3 */
+
+   if (!fmpz_invmod(w, w, n))
+   {
+      fmpz_gcd(f, w, n);
+      ret = 0;
+      goto cleanup;
+   }
+
+   /* a24 = (v - u)^3 (3u + v) / (16 u^3 v) */
+   fmpz_sub(t, v, u);
+   fmpz_powm_ui(t, t, 3, n);
+   fmpz_mul(w, w, t);
+   fmpz_mul_ui(t, u, 3);
+   fmpz_add(t, t, v);
+   fmpz_mul(w, w, t);
+   fmpz_mod(w, w, n);
+   ecm_set_fmpz(a24, w, nn, norm);
+
+cleanup:
+   fmpz_clear(sigma);
+   fmpz_clear(u);
+   fmpz_clear(v);
+   fmpz_clear(w);
+   fmpz_clear(t);
+
+   return ret;
+}
+
+int fmpz_factor_ecm(fmpz_t f, const fmpz_t n_in, ulong curves, 
+                    ulong B1, ulong B2, flint_rand_t state)
+{
+   mp_size_t nn = fmpz_size(n_in);
+   mp_ptr n, nr, ninv, x, z, a24, t, xj, zj;
+   mp_ptr xs, zs, xm, zm, xm1, zm1, xt, zt, acc;
+   int jind[ECM_D/4 + 1]; /* position of j among the baby steps */
+   mp_limb_t k, p, pe;
+   long i, j, c, m;
+   ulong norm;
+   int ret = 0;
+   n_primes_t iter;
+
+   if (fmpz_is_even(n_in))
+   {
+      fmpz_set_ui(f, 2);
+      return 1;
+   }
+
+   if (fmpz_cmp_ui(n_in, 9) < 0)
+      return 0;
+
+   /* stage 2 requires all primes up to D/2 to be done in stage 1 */
+   B1 = FLINT_MAX(B1, ECM_D/2);
+
+   n    = flint_malloc(nn*sizeof(mp_limb_t));
+   nr   = flint_malloc(nn*sizeof(mp_limb_t));
+   ninv = flint_malloc(nn*sizeof(mp_limb_t));
+   t    = flint_malloc(20*nn*sizeof(mp_limb_t));
+   xj   = flint_malloc(2*ECM_BABY*nn*sizeof(mp_limb_t));
+   zj   = xj + ECM_BABY*nn;
+   x    = t + 11*nn;
+   z    = t + 12*nn;
+   a24  = t + 13*nn;
+   xs   = t + 14*nn;
+   zs   = t + 15*nn;
+   xm   = t + 16*nn;
+   zm   = t + 17*nn;
+   acc  = t + 18*nn;
+   xm1  = flint_malloc(4*nn*sizeof(mp_limb_t));
+   zm1  = xm1 + nn;
+   xt   = xm1 + 2*nn;
+   zt   = xm1 + 3*nn;
+
+   if (nn == 1)
+      nr[0] = fmpz_get_ui(n_in);
+   else
+      mpn_copyi(nr, COEFF_TO_PTR(*n_in)->_mp_d, nn);
+
+   count_leading_zeros(norm, nr[nn - 1]);
+   if (norm)
+      mpn_lshift(n, nr, nn, norm);
+   else
+      mpn_copyi(n, nr, nn);
+
+   flint_mpn_preinvn(ninv, n, nn);
+
+   for (c = 0; c < curves && !ret; c++)
+   {
+      if (!ecm_select_curve(x, z, a24, f, n_in, nn, norm, state))
+      {
+         if (fmpz_equal(f, n_in))
+            continue;
+         ret = 1;
+         break;
+      }
+
+      /* stage 1: multiply by the prime powers up to B1, several at once */
+      n_primes_init(iter);
+
+      for (k = 1, p = n_primes_next(iter); p <= B1; p = n_primes_next(iter))
+      {
+         for (pe = p; pe <= B1/p; pe *= p) ;
+
+         if (k > (~0UL)/pe)
+         {
+            ecm_mul(x, z, k, a24, n, ninv, nn, norm, t);
+            k = 1;
+         }
+
+         k *= pe;
+      }
+
+      ecm_mul(x, z, k, a24, n, ninv, nn, norm, t);
+
+      if (ecm_gcd(f, z, nr, nn, norm, t) && !fmpz_is_one(f))
+      {
+         n_primes_clear(iter);
+         if (fmpz_equal(f, n_in))
+            continue;
+         ret = 1;
+         break;
+      }
+
+      /* stage 2: primes p = mD +/- j in (B1, B2], j < D/2 */
+      if (B2 <= B1)
+      {
+         n_primes_clear(iter);
+         continue;
+      }
+
+      /* baby steps j (x : z) for j odd and coprime to D */
+      ecm_double(xt, zt, x, z, a24, n, ninv, nn, norm, t); /* 2Q */
+      mpn_copyi(xs, x, nn); /* (j - 2) Q */
+      mpn_copyi(zs, z, nn);
+      mpn_copyi(xm, x, nn); /* j Q */
+      mpn_copyi(zm, z, nn);
+      for (i = 0, j = 1; j <= ECM_D/2; j += 2)
+      {
+         if (j > 1)
+         {
+            ecm_add(xm1, zm1, xm, zm, xt, zt, xs, zs, n, ninv, nn, norm, t);
+            mpn_copyi(xs, xm, nn);
+            mpn_copyi(zs, zm, nn);
+            mpn_copyi(xm, xm1, nn);
+            mpn_copyi(zm, zm1, nn);
+         }
+
+         if (n_gcd(ECM_D, j) == 1)
+         {
+            mpn_copyi(xj + i*nn, xm, nn);
+            mpn_copyi(zj + i*nn, zm, nn);
+            jind[j/2] = i++;
+         } else
+            jind[j/2] = -1;
+      }
+
+      /* giant steps (mD) Q, starting from m with mD - D/2 <= B1 */
+      m = (B1 + ECM_D/2)/ECM_D;
+      mpn_copyi(xs, x, nn);
+      mpn_copyi(zs, z, nn);
+      ecm_mul(xs, zs, ECM_D, a24, n, ninv, nn, norm, t); /* D Q */
+      mpn_copyi(xm, xs, nn);
+      mpn_copyi(zm, zs, nn);
+      if (m > 1) /* mD Q */
+         ecm_mul(xm, zm, m, a24, n, ninv, nn, norm, t); 
+      mpn_copyi(xm1, xs, nn);
+      mpn_copyi(zm1, zs, nn);
+      if (m > 2) /* (m - 1)D Q, never used as a difference if m = 1 */
+         ecm_mul(xm1, zm1, m - 1, a24, n, ninv, nn, norm, t); 
+
+      mpn_zero(acc, nn);
+      acc[0] = (1UL << norm);
+
+      for ( ; p <= B2; p = n_primes_next(iter))
+      {
+         while (p > (mp_limb_t) m*ECM_D + ECM_D/2) /* next giant step */
+         {
+            if (m == 1)
+               ecm_double(xt, zt, xm, zm, a24, n, ninv, nn, norm, t);
+            else
+               ecm_add(xt, zt, xm, zm, xs, zs, xm1, zm1, n, ninv, nn, norm, t);
+            mpn_copyi(xm1, xm, nn);
+            mpn_copyi(zm1, zm, nn);
+            mpn_copyi(xm, xt, nn);
+            mpn_copyi(zm, zt, nn);
+            m++;
+         }
+
+         j = (p > (mp_limb_t) m*ECM_D) ? p - m*ECM_D : m*ECM_D - p;
+
+         i = jind[j/2];
+         if (i < 0) /* p divides D */
+            continue;
+
+         flint_mpn_mulmod_preinvn(xt, xm, zj + i*nn, nn, n, ninv, norm);
+         flint_mpn_mulmod_preinvn(zt, xj + i*nn, zm, nn, n, ninv, norm);
+         ecm_submod(xt, xt, zt, n, nn);
+         flint_mpn_mulmod_preinvn(acc, acc, xt, nn, n, ninv, norm);
+      }
+
+      n_primes_clear(iter);
+
+      if (ecm_gcd(f, acc, nr, nn, norm, t) && !fmpz_is_one(f) 
+                                           && !fmpz_equal(f, n_in))
+         ret = 1;
+   }
+
+   flint_free(n);
+   flint_free(nr);
+   flint_free(ninv);
+   flint_free(t);
+   flint_free(xj);
+   flint_free(xm1);
+
+   return ret;
+}
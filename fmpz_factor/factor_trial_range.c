@@ -36,6 +36,7 @@ fmpz_factor_trial_range(fmpz_factor_t factor, const fmpz_t n, ulong start, ulong
 {
     ulong exp;
     mp_limb_t p;
+    const mp_limb_t * primes;
     mpz_t x;
     mp_ptr xd;
     mp_size_t xsize;
@@ -85,7 +86,8 @@ fmpz_factor_trial_range(fmpz_factor_t factor, const fmpz_t n, ulong start, ulong
 
         if (found)
         {
-            p = flint_primes[found];
+            primes = n_primes_arr_readonly(found + 1);
+            p = primes[found];
             exp = 1;
             xsize = flint_mpn_divexact_1(xd, xsize, p);
 
@@ -106,8 +108,8 @@ fmpz_factor_trial_range(fmpz_factor_t factor, const fmpz_t n, ulong start, ulong
                 exp += 3;
             }
 
-            _fmpz_factor_append_ui(factor, flint_primes[found], exp);
-            /* printf("added %lu %lu\n", flint_primes[found], exp); */
+            _fmpz_factor_append_ui(factor, primes[found], exp);
+            /* printf("added %lu %lu\n", primes[found], exp); */
 
             /* Continue using only trial division as long as it is successful.
                This allows quickly factoring huge highly composite numbers
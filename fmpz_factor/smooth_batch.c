@@ -0,0 +1,101 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_factor.h"
+#include "ulong_extras.h"
+
+/*
+   Appends to factor the primes of the comb below the given node which 
+   divide g, with their multiplicities in s, removing them from s
+*/
+static void
+_fmpz_factor_smooth_descend(fmpz_factor_t factor, fmpz_t s, const fmpz_t g,
+                            const fmpz_comb_t comb, long level, long index)
+{
+   fmpz_t h;
+   long i, exp;
+
+   fmpz_init(h);
+   fmpz_gcd(h, g, comb->comb[level] + index);
+
+   if (!fmpz_is_one(h))
+   {
+      if (level == 0)
+      {
+         for (i = 2*index; i < 2*index + 2 && i < comb->num_primes; i++)
+         {
+            fmpz_set_ui(h, comb->primes[i]);
+            exp = fmpz_remove(s, s, h);
+            if (exp > 0)
+               _fmpz_factor_append_ui(factor, comb->primes[i], exp);
+         }
+      } else
+      {
+         _fmpz_factor_smooth_descend(factor, s, h, comb, level - 1, 2*index);
+         _fmpz_factor_smooth_descend(factor, s, h, comb, level - 1, 2*index + 1);
+      }
+   }
+
+   fmpz_clear(h);
+}
+
+void fmpz_factor_smooth_batch(fmpz_factor_struct * factors, const fmpz * x, 
+                              long len, mp_limb_t bound)
+{
+   fmpz_comb_t comb;
+   const mp_limb_t * primes;
+   fmpz * s;
+   long i, num_primes;
+
+   for (i = 0; i < len; i++)
+   {
+      _fmpz_factor_set_length(factors + i, 0);
+      factors[i].sign = fmpz_sgn(x + i);
+   }
+
+   num_primes = (bound < 2) ? 0 : n_prime_pi(bound);
+   if (len == 0 || num_primes == 0)
+      return;
+
+   primes = n_primes_arr_readonly(num_primes);
+   fmpz_comb_init(comb, (mp_limb_t *) primes, num_primes);
+
+   s = _fmpz_vec_init(len);
+   _fmpz_factor_smooth_parts(s, x, len, comb->comb[comb->n - 1]);
+
+   for (i = 0; i < len; i++)
+   {
+      if (!fmpz_is_one(s + i))
+         _fmpz_factor_smooth_descend(factors + i, s + i, s + i, 
+                                     comb, comb->n - 1, 0);
+   }
+
+   _fmpz_vec_clear(s, len);
+   fmpz_comb_clear(comb);
+}
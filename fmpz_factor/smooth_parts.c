@@ -0,0 +1,130 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_factor.h"
+#include "ulong_extras.h"
+
+void _fmpz_factor_smooth_parts(fmpz * s, const fmpz * x, long len, 
+                               const fmpz_t P)
+{
+   fmpz ** tree;
+   long * tlen;
+   long i, j, k, depth;
+   ulong e;
+   fmpz_t y;
+
+   if (len == 0)
+      return;
+
+   /* product tree of the |x[i]|, level 0 being the x[i] themselves */
+   depth = FLINT_CLOG2(len);
+   tree = flint_malloc((depth + 1)*sizeof(fmpz *));
+   tlen = flint_malloc((depth + 1)*sizeof(long));
+
+   tree[0] = _fmpz_vec_init(len);
+   tlen[0] = len;
+   for (i = 0; i < len; i++)
+      fmpz_abs(tree[0] + i, x + i);
+
+   for (k = 1; k <= depth; k++)
+   {
+      tlen[k] = (tlen[k - 1] + 1)/2;
+      tree[k] = _fmpz_vec_init(tlen[k]);
+
+      for (j = 0; j + 1 < tlen[k - 1]; j += 2)
+         fmpz_mul(tree[k] + j/2, tree[k - 1] + j, tree[k - 1] + j + 1);
+      if (j < tlen[k - 1])
+         fmpz_set(tree[k] + j/2, tree[k - 1] + j);
+   }
+
+   /* 
+      remainder tree of P, each node being replaced by P modulo it, 
+      except for the leaves, which are still needed
+   */
+   if (depth > 0)
+      fmpz_mod(tree[depth], P, tree[depth]);
+   for (k = depth - 1; k >= 1; k--)
+   {
+      for (j = 0; j < tlen[k]; j++)
+         fmpz_mod(tree[k] + j, tree[k + 1] + j/2, tree[k] + j);
+   }
+
+   /* 
+      the smooth part of x is gcd(x, P^(2^e) mod x) where 2^e is at 
+      least the largest possible exponent of a prime in x
+   */
+   fmpz_init(y);
+
+   for (i = 0; i < len; i++)
+   {
+      if (depth == 0)
+         fmpz_mod(y, P, tree[0] + i);
+      else
+         fmpz_mod(y, tree[1] + i/2, tree[0] + i);
+
+      for (e = FLINT_CLOG2(fmpz_bits(tree[0] + i)); e > 0 && !fmpz_is_zero(y); e--)
+      {
+         fmpz_mul(y, y, y);
+         fmpz_mod(y, y, tree[0] + i);
+      }
+
+      fmpz_gcd(s + i, y, tree[0] + i);
+   }
+
+   fmpz_clear(y);
+
+   for (k = 0; k <= depth; k++)
+      _fmpz_vec_clear(tree[k], tlen[k]);
+   flint_free(tree);
+   flint_free(tlen);
+}
+
+void fmpz_factor_smooth_parts(fmpz * s, const fmpz * x, long len, 
+                              mp_limb_t bound)
+{
+   const mp_limb_t * primes;
+   fmpz * vec;
+   fmpz_t P;
+   long i, num_primes;
+
+   num_primes = (bound < 2) ? 0 : n_prime_pi(bound);
+   primes = n_primes_arr_readonly(num_primes);
+
+   vec = _fmpz_vec_init(num_primes);
+   for (i = 0; i < num_primes; i++)
+      fmpz_set_ui(vec + i, primes[i]);
+
+   fmpz_init(P);
+   _fmpz_vec_prod(P, vec, num_primes);
+
+   _fmpz_factor_smooth_parts(s, x, len, P);
+
+   fmpz_clear(P);
+   _fmpz_vec_clear(vec, num_primes);
+}
@@ -36,6 +36,7 @@ void check(fmpz_t n)
 {
     fmpz_factor_t factor;
     fmpz_t m;
+    long i;
 
     fmpz_factor_init(factor);
     fmpz_init(m);
@@ -43,6 +44,17 @@ void check(fmpz_t n)
     fmpz_factor(factor, n);
     fmpz_factor_expand(m, factor);
 
+    for (i = 0; i < factor->num; i++)
+    {
+        if (!fmpz_is_probabprime(factor->p + i))
+        {
+            printf("ERROR: factor is not prime!\n");
+            fmpz_factor_print(factor);
+            printf("\n");
+            abort();
+        }
+    }
+
     if (!fmpz_equal(n, m))
     {
         printf("ERROR: factors do not unfactor to original number!\n");
@@ -69,8 +81,9 @@ void check(fmpz_t n)
 int main(void)
 {
     int i, j;
-    fmpz_t x;
+    fmpz_t x, p;
     mpz_t y;
+    flint_rand_t state;
 
     printf("factor....");
     fflush(stdout);
@@ -138,6 +151,32 @@ int main(void)
     fmpz_set_mpz(x, y);
     check(x);
 
+    /* Products of powers of large primes */
+    flint_randinit(state);
+    fmpz_init(p);
+
+    for (i = 0; i < 30; i++)
+    {
+        fmpz_set_ui(x, n_randint(state, 1000) + 1);
+
+        for (j = 0; j < 2; j++)
+        {
+            do
+            {
+                fmpz_randbits(p, state, n_randint(state, 20) + 20);
+                fmpz_abs(p, p);
+            } while (!fmpz_is_probabprime(p));
+
+            fmpz_pow_ui(p, p, n_randint(state, 2) + 1);
+            fmpz_mul(x, x, p);
+        }
+
+        check(x);
+    }
+
+    fmpz_clear(p);
+    flint_randclear(state);
+
     fmpz_clear(x);
     mpz_clear(y);
 
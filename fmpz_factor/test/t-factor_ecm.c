@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_factor.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+   int i, result;
+   ulong count = 0UL;
+   flint_rand_t state;
+
+   printf("factor_ecm....");
+   fflush(stdout);
+
+   flint_randinit(state);
+
+   for (i = 0; i < 50 * flint_test_multiplier(); i++) /* Test random numbers */
+   {
+      fmpz_t n, p, q, f;
+
+      fmpz_init(n);
+      fmpz_init(p);
+      fmpz_init(q);
+      fmpz_init(f);
+
+      /* a prime of up to 35 bits and one which is much larger */
+      fmpz_set_ui(p, n_randprime(state, n_randint(state, 26) + 10, 0));
+      do
+      {
+         fmpz_randbits(q, state, n_randint(state, 100) + 60);
+         fmpz_abs(q, q);
+      } while (!fmpz_is_probabprime(q));
+      fmpz_mul(n, p, q);
+
+      if (fmpz_factor_ecm(f, n, 200, 2000, 50000, state))
+      {
+         count++;
+         result = (fmpz_equal(f, p) || fmpz_equal(f, q));
+         if (!result)
+         {
+            printf("FAIL:\n");
+            printf("n = "), fmpz_print(n);
+            printf(", f = "), fmpz_print(f), printf("\n");
+            abort();
+         }
+      }
+
+      fmpz_clear(n);
+      fmpz_clear(p);
+      fmpz_clear(q);
+      fmpz_clear(f);
+   }
+
+   if (count < 49 * flint_test_multiplier())
+   {
+      printf("FAIL:\n");
+      printf("Only %lu numbers factored\n", count); 
+      abort();
+   }
+
+   flint_randclear(state);
+
+   printf("PASS\n");
+   return 0;
+}
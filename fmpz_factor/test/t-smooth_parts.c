@@ -0,0 +1,116 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_factor.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+   int i, j, k, result;
+   flint_rand_t state;
+
+   printf("smooth_parts....");
+   fflush(stdout);
+
+   flint_randinit(state);
+
+   for (i = 0; i < 100 * flint_test_multiplier(); i++)
+   {
+      fmpz * x, * s;
+      fmpz_t c, t;
+      long len;
+      mp_limb_t bound, p;
+
+      len = n_randint(state, 50);
+      bound = n_randint(state, 1000);
+
+      x = _fmpz_vec_init(len);
+      s = _fmpz_vec_init(len);
+      fmpz_init(c);
+      fmpz_init(t);
+
+      /* products of small primes, some with a large cofactor */
+      for (j = 0; j < len; j++)
+      {
+         fmpz_one(x + j);
+         for (k = n_randint(state, 30); k > 0; k--)
+            fmpz_mul_ui(x + j, x + j, n_nth_prime(n_randint(state, 200) + 1));
+         if (n_randint(state, 2))
+         {
+            fmpz_randtest_not_zero(t, state, 100);
+            fmpz_mul(x + j, x + j, t);
+         }
+      }
+
+      fmpz_factor_smooth_parts(s, x, len, bound);
+
+      for (j = 0; j < len; j++)
+      {
+         result = (fmpz_sgn(s + j) > 0 && fmpz_divisible(x + j, s + j));
+         if (result)
+         {
+            /* x/s has no prime factors up to the bound */
+            fmpz_divexact(c, x + j, s + j);
+            for (p = 2; p <= bound && result; p = n_nextprime(p, 0))
+            {
+               fmpz_set_ui(t, p);
+               result = !fmpz_divisible(c, t);
+            }
+
+            /* s has no prime factors larger than the bound */
+            fmpz_set(t, s + j);
+            for (p = 2; p <= bound; p = n_nextprime(p, 0))
+               while (fmpz_fdiv_ui(t, p) == 0)
+                  fmpz_divexact_ui(t, t, p);
+            result = result && fmpz_is_one(t);
+         }
+
+         if (!result)
+         {
+            printf("FAIL:\n");
+            printf("bound = %lu\n", bound);
+            printf("x = "), fmpz_print(x + j), printf("\n");
+            printf("s = "), fmpz_print(s + j), printf("\n");
+            abort();
+         }
+      }
+
+      _fmpz_vec_clear(x, len);
+      _fmpz_vec_clear(s, len);
+      fmpz_clear(c);
+      fmpz_clear(t);
+   }
+
+   flint_randclear(state);
+   _fmpz_cleanup();
+   printf("PASS\n");
+   return 0;
+}
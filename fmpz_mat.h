@@ -175,6 +175,9 @@ void _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A,
 void fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A,
     const fmpz_mat_t B);
 
+/* Minimum dimension for using several threads in the multimodular product */
+#define FMPZ_MAT_MUL_MULTI_MOD_THREAD_CUTOFF 32
+
 void fmpz_mat_sqr(fmpz_mat_t B, const fmpz_mat_t A);
 
 void fmpz_mat_pow(fmpz_mat_t B, const fmpz_mat_t A, ulong exp);
@@ -276,6 +279,55 @@ int fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 
 long fmpz_mat_nullspace(fmpz_mat_t res, const fmpz_mat_t mat);
 
+/* Lattice reduction ********************************************************/
+
+#define FMPZ_MAT_LLL_MAX_REDUCTIONS 100 /* size reductions of one vector */
+
+#define FMPZ_MAT_LLL_MPFR_PREC 128 /* first precision tried with mpfr */
+
+int fmpz_mat_lll_d(fmpz_mat_t B, double delta, double eta, long depth);
+
+int fmpz_mat_lll_ld(fmpz_mat_t B, double delta, double eta, long depth);
+
+int fmpz_mat_lll_mpfr(fmpz_mat_t B, double delta, double eta, long depth, 
+                      mp_bitcnt_t prec);
+
+void fmpz_mat_lll_deep(fmpz_mat_t B, double delta, double eta, long depth);
+
+void fmpz_mat_lll(fmpz_mat_t B, double delta, double eta);
+
+void _fmpz_mat_lll_gram(fmpz_mat_t G, const fmpz_mat_t B);
+
+void _fmpz_mat_lll_submul(fmpz_mat_t B, fmpz_mat_t G, 
+                          long k, long j, const fmpz_t x);
+
+void _fmpz_mat_lll_insert(fmpz_mat_t B, fmpz_mat_t G, long i, long k);
+
+int fmpz_mat_is_reduced(const fmpz_mat_t B, double delta, double eta);
+
+/* Normal forms *************************************************************/
+
+void fmpz_mat_hnf(fmpz_mat_t H, const fmpz_mat_t A);
+
+void fmpz_mat_hnf_classical(fmpz_mat_t H, const fmpz_mat_t A);
+
+void fmpz_mat_hnf_modular(fmpz_mat_t H, const fmpz_mat_t A, const fmpz_t D);
+
+int fmpz_mat_is_in_hnf(const fmpz_mat_t A);
+
+void fmpz_mat_snf(fmpz_mat_t S, const fmpz_mat_t A);
+
+void fmpz_mat_snf_kannan_bachem(fmpz_mat_t S, const fmpz_mat_t A);
+
+void fmpz_mat_snf_iliopoulos(fmpz_mat_t S, const fmpz_mat_t A, 
+                             const fmpz_t mod);
+
+void _fmpz_mat_snf_eliminate(fmpz_mat_t S, const fmpz_t mod);
+
+void _fmpz_mat_snf_diagonal(fmpz_mat_t S);
+
+int fmpz_mat_is_in_snf(const fmpz_mat_t A);
+
 /* Inverse ******************************************************************/
 
 int fmpz_mat_inv(fmpz_mat_t B, fmpz_t den, const fmpz_mat_t A);
@@ -90,6 +90,11 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     p = 1UL;
 #else
     p = 1UL << NMOD_MAT_OPTIMAL_MODULUS_BITS;
+#if HAVE_BLAS
+    /* the products in the recursive LU decomposition go to the BLAS */
+    if (n / 2 >= NMOD_MAT_MUL_BLAS_CUTOFF)
+        p = 1UL << (NMOD_MAT_MUL_BLAS_MAX_BITS - 1);
+#endif
 #endif
 
     /* Compute x = det(A) / d */
@@ -0,0 +1,100 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+/*
+   Sets D to a multiple of the determinant of the lattice spanned by the
+   rows of A, which has at least as many rows as columns, or to zero if 
+   none is found. For non-square A this is the determinant of n vectors 
+   of the lattice, namely the first n rows plus random combinations of 
+   the others.
+*/
+static void _fmpz_mat_hnf_det_multiple(fmpz_t D, const fmpz_mat_t A)
+{
+    const long m = A->r, n = A->c;
+    fmpz_mat_t B;
+    flint_rand_t state;
+    long i, j;
+
+    if (m == n)
+    {
+        fmpz_mat_det_modular(D, A, 1);
+        fmpz_abs(D, D);
+        return;
+    }
+
+    flint_randinit(state);
+    fmpz_mat_init(B, n, n);
+
+    for (i = 0; i < n; i++)
+    {
+        _fmpz_vec_set(B->rows[i], A->rows[i], n);
+        for (j = n; j < m; j++)
+        {
+            switch (n_randint(state, 3))
+            {
+                case 0:
+                    _fmpz_vec_add(B->rows[i], B->rows[i], A->rows[j], n);
+                    break;
+                case 1:
+                    _fmpz_vec_sub(B->rows[i], B->rows[i], A->rows[j], n);
+                    break;
+            }
+        }
+    }
+
+    fmpz_mat_det_modular(D, B, 1);
+    fmpz_abs(D, D);
+
+    fmpz_mat_clear(B);
+    flint_randclear(state);
+}
+
+void fmpz_mat_hnf(fmpz_mat_t H, const fmpz_mat_t A)
+{
+    fmpz_t D;
+
+    if (A->r < A->c || A->c == 0)
+    {
+        fmpz_mat_hnf_classical(H, A);
+        return;
+    }
+
+    fmpz_init(D);
+    _fmpz_mat_hnf_det_multiple(D, A);
+
+    if (fmpz_is_zero(D))
+        fmpz_mat_hnf_classical(H, A);
+    else
+        fmpz_mat_hnf_modular(H, A, D);
+
+    fmpz_clear(D);
+}
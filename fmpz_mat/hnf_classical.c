@@ -0,0 +1,108 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+
+void fmpz_mat_hnf_classical(fmpz_mat_t H, const fmpz_mat_t A)
+{
+    const long m = A->r, n = A->c;
+    long i, j, k, p;
+    fmpz_t g, u, v, q, a, b;
+
+    fmpz_init(g);
+    fmpz_init(u);
+    fmpz_init(v);
+    fmpz_init(q);
+    fmpz_init(a);
+    fmpz_init(b);
+
+    fmpz_mat_set(H, A);
+
+    for (k = 0, p = 0; k < n && p < m; k++)
+    {
+        for (i = p; i < m && fmpz_is_zero(fmpz_mat_entry(H, i, k)); i++) ;
+        if (i == m)
+            continue;
+        if (i != p)
+            _fmpz_vec_swap(H->rows[i], H->rows[p], n);
+
+        /* gather the gcd of column k in row p */
+        for (i = p + 1; i < m; i++)
+        {
+            if (fmpz_is_zero(fmpz_mat_entry(H, i, k)))
+                continue;
+
+            fmpz_fdiv_qr(q, b, fmpz_mat_entry(H, i, k), 
+                               fmpz_mat_entry(H, p, k));
+            if (fmpz_is_zero(b))
+            {
+                for (j = k; j < n; j++)
+                    fmpz_submul(fmpz_mat_entry(H, i, j), q, 
+                                fmpz_mat_entry(H, p, j));
+                continue;
+            }
+
+            fmpz_xgcd(g, u, v, fmpz_mat_entry(H, p, k), 
+                               fmpz_mat_entry(H, i, k));
+            fmpz_divexact(a, fmpz_mat_entry(H, p, k), g);
+            fmpz_divexact(b, fmpz_mat_entry(H, i, k), g);
+
+            for (j = k; j < n; j++)
+            {
+                fmpz_mul(q, u, fmpz_mat_entry(H, p, j));
+                fmpz_addmul(q, v, fmpz_mat_entry(H, i, j));
+                fmpz_mul(fmpz_mat_entry(H, i, j), a, fmpz_mat_entry(H, i, j));
+                fmpz_submul(fmpz_mat_entry(H, i, j), b, 
+                            fmpz_mat_entry(H, p, j));
+                fmpz_swap(fmpz_mat_entry(H, p, j), q);
+            }
+        }
+
+        if (fmpz_sgn(fmpz_mat_entry(H, p, k)) < 0)
+            _fmpz_vec_neg(H->rows[p] + k, H->rows[p] + k, n - k);
+
+        /* reduce the entries above the pivot */
+        for (i = 0; i < p; i++)
+        {
+            fmpz_fdiv_q(q, fmpz_mat_entry(H, i, k), fmpz_mat_entry(H, p, k));
+            if (!fmpz_is_zero(q))
+                _fmpz_vec_scalar_submul_fmpz(H->rows[i] + k, 
+                                             H->rows[p] + k, n - k, q);
+        }
+
+        p++;
+    }
+
+    fmpz_clear(g);
+    fmpz_clear(u);
+    fmpz_clear(v);
+    fmpz_clear(q);
+    fmpz_clear(a);
+    fmpz_clear(b);
+}
@@ -0,0 +1,146 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+
+/*
+   Hermite normal form modulo D, after Domich, Kannan and Trotter, see 
+   Cohen, Algorithm 2.4.8. As D Z^n is contained in the lattice, all 
+   entries can be kept reduced modulo a divisor R of D. Once the pivot 
+   d of a column is known, R can be divided by d for the columns after.
+*/
+void fmpz_mat_hnf_modular(fmpz_mat_t H, const fmpz_mat_t A, const fmpz_t D)
+{
+    const long m = A->r, n = A->c;
+    fmpz_mat_t M;
+    fmpz_t R, g, u, v, q, a, b;
+    long i, j, k;
+
+    if (m < n || fmpz_sgn(D) <= 0)
+    {
+        printf("Exception (fmpz_mat_hnf_modular). "
+               "Not a full rank lattice.\n");
+        abort();
+    }
+
+    fmpz_mat_init(M, m, n);
+    fmpz_init_set(R, D);
+    fmpz_init(g);
+    fmpz_init(u);
+    fmpz_init(v);
+    fmpz_init(q);
+    fmpz_init(a);
+    fmpz_init(b);
+
+    for (i = 0; i < m; i++)
+        for (j = 0; j < n; j++)
+            fmpz_mod(fmpz_mat_entry(M, i, j), fmpz_mat_entry(A, i, j), R);
+
+    fmpz_mat_zero(H);
+
+    for (k = 0; k < n; k++)
+    {
+        /* gather the gcd of column k in row k */
+        for (i = k + 1; i < m; i++)
+        {
+            if (fmpz_is_zero(fmpz_mat_entry(M, i, k)))
+                continue;
+
+            if (fmpz_is_zero(fmpz_mat_entry(M, k, k)))
+            {
+                _fmpz_vec_swap(M->rows[i] + k, M->rows[k] + k, n - k);
+                continue;
+            }
+
+            fmpz_fdiv_qr(q, b, fmpz_mat_entry(M, i, k), 
+                               fmpz_mat_entry(M, k, k));
+            if (fmpz_is_zero(b))
+            {
+                for (j = k; j < n; j++)
+                {
+                    fmpz_submul(fmpz_mat_entry(M, i, j), q, 
+                                fmpz_mat_entry(M, k, j));
+                    fmpz_mod(fmpz_mat_entry(M, i, j), 
+                             fmpz_mat_entry(M, i, j), R);
+                }
+                continue;
+            }
+
+            fmpz_xgcd(g, u, v, fmpz_mat_entry(M, k, k), 
+                               fmpz_mat_entry(M, i, k));
+            fmpz_divexact(a, fmpz_mat_entry(M, k, k), g);
+            fmpz_divexact(b, fmpz_mat_entry(M, i, k), g);
+
+            for (j = k; j < n; j++)
+            {
+                fmpz_mul(q, u, fmpz_mat_entry(M, k, j));
+                fmpz_addmul(q, v, fmpz_mat_entry(M, i, j));
+                fmpz_mul(fmpz_mat_entry(M, i, j), a, fmpz_mat_entry(M, i, j));
+                fmpz_submul(fmpz_mat_entry(M, i, j), b, 
+                            fmpz_mat_entry(M, k, j));
+                fmpz_mod(fmpz_mat_entry(M, i, j), fmpz_mat_entry(M, i, j), R);
+                fmpz_mod(fmpz_mat_entry(M, k, j), q, R);
+            }
+        }
+
+        /* the pivot is gcd(M_kk, R), with u M_kk = d mod R */
+        fmpz_xgcd(g, u, v, fmpz_mat_entry(M, k, k), R);
+        for (j = k + 1; j < n; j++)
+        {
+            fmpz_mul(q, u, fmpz_mat_entry(M, k, j));
+            fmpz_mod(fmpz_mat_entry(H, k, j), q, R);
+        }
+        fmpz_set(fmpz_mat_entry(H, k, k), g);
+
+        fmpz_divexact(R, R, g);
+    }
+
+    /* reduce the entries above the diagonal */
+    for (k = 1; k < n; k++)
+    {
+        for (i = 0; i < k; i++)
+        {
+            fmpz_fdiv_q(q, fmpz_mat_entry(H, i, k), fmpz_mat_entry(H, k, k));
+            if (!fmpz_is_zero(q))
+                _fmpz_vec_scalar_submul_fmpz(H->rows[i] + k, 
+                                             H->rows[k] + k, n - k, q);
+        }
+    }
+
+    fmpz_mat_clear(M);
+    fmpz_clear(R);
+    fmpz_clear(g);
+    fmpz_clear(u);
+    fmpz_clear(v);
+    fmpz_clear(q);
+    fmpz_clear(a);
+    fmpz_clear(b);
+}
@@ -19,40 +19,41 @@
 =============================================================================*/
 /******************************************************************************
 
-    Copyright (C) 2006, 2011 William Hart
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
 #include <gmp.h>
 #include "flint.h"
-#include "ulong_extras.h"
-#include "qsieve.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
 
-mp_limb_t qsieve_ll_poly_init(qs_t qs_inf)
+int fmpz_mat_is_in_hnf(const fmpz_mat_t A)
 {
-   ulong num_primes = qs_inf->num_primes;
-   ulong s = qs_inf->s; /* number of prime factors in A coeff */
-   
-   mp_limb_t ** A_inv2B;
-
-   long i; 
-        
-   qs_inf->B_terms = flint_malloc(4*s*sizeof(mp_limb_t));
-   qs_inf->A_ind = qs_inf->B_terms + s;  
-   qs_inf->A_modp = qs_inf->A_ind + s;  
-   qs_inf->inv_p2 = qs_inf->A_modp + s;
-
-   qs_inf->A_inv2B = flint_malloc(s*sizeof(mp_limb_t *));
-
-   qs_inf->A_inv = flint_malloc(3*num_primes*sizeof(mp_limb_t));  
-   qs_inf->soln1 = qs_inf->A_inv + num_primes; 
-   qs_inf->soln2 = qs_inf->soln1 + num_primes; 
-   
-   A_inv2B = qs_inf->A_inv2B;
-   
-   A_inv2B[0] = flint_malloc(num_primes*s*sizeof(mp_limb_t));
-   for (i = 1; i < s; i++)
-      A_inv2B[i] = A_inv2B[i - 1] + num_primes;
-   
-   return 0;
+    long i, j, k, p = -1;
+
+    for (i = 0; i < A->r; i++)
+    {
+        /* the pivot of row i is to the right of that of row i - 1 */
+        for (k = 0; k < A->c && fmpz_is_zero(fmpz_mat_entry(A, i, k)); k++) ;
+
+        if (k == A->c)
+        {
+            p = A->c;
+            continue;
+        }
+
+        if (k <= p || fmpz_sgn(fmpz_mat_entry(A, i, k)) < 0)
+            return 0;
+
+        /* and the entries above it are reduced */
+        for (j = 0; j < i; j++)
+            if (fmpz_sgn(fmpz_mat_entry(A, j, k)) < 0 || 
+                fmpz_cmp(fmpz_mat_entry(A, j, k), fmpz_mat_entry(A, i, k)) >= 0)
+                return 0;
+
+        p = k;
+    }
+
+    return 1;
 }
@@ -0,0 +1,122 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong /* prevent clash with standard library */
+#include <math.h>
+#define ulong unsigned long
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "fmpq.h"
+
+/* approximates the double x by a rational with denominator 2^40 */
+static void _fmpq_set_d_approx(fmpq_t q, double x)
+{
+    fmpz_set_d(fmpq_numref(q), ldexp(x, 40));
+    fmpz_one(fmpq_denref(q));
+    fmpz_mul_2exp(fmpq_denref(q), fmpq_denref(q), 40);
+    fmpq_canonicalise(q);
+}
+
+int fmpz_mat_is_reduced(const fmpz_mat_t B, double delta, double eta)
+{
+    const long d = B->r, n = B->c;
+    fmpq * r, * mu;
+    fmpq_t del, et, s, t;
+    long i, j, k;
+    int reduced = 1;
+
+    if (d == 0)
+        return 1;
+
+    r  = flint_malloc(d*d*sizeof(fmpq));
+    mu = flint_malloc(d*d*sizeof(fmpq));
+    for (i = 0; i < d*d; i++)
+    {
+        fmpq_init(r + i);
+        fmpq_init(mu + i);
+    }
+    fmpq_init(del);
+    fmpq_init(et);
+    fmpq_init(s);
+    fmpq_init(t);
+
+    _fmpq_set_d_approx(del, delta);
+    _fmpq_set_d_approx(et, eta);
+
+    /* exact Gram-Schmidt orthogonalisation from the Gram matrix */
+    for (i = 0; i < d && reduced; i++)
+    {
+        for (j = 0; j <= i; j++)
+        {
+            fmpz_zero(fmpq_numref(s));
+            fmpz_one(fmpq_denref(s));
+            for (k = 0; k < n; k++)
+                fmpz_addmul(fmpq_numref(s), B->rows[i] + k, B->rows[j] + k);
+
+            for (k = 0; k < j; k++)
+                fmpq_submul(s, mu + j*d + k, r + i*d + k);
+
+            fmpq_set(r + i*d + j, s);
+
+            if (j < i)
+            {
+                fmpq_div(mu + i*d + j, s, r + j*d + j);
+
+                /* size reduction */
+                fmpq_abs(t, mu + i*d + j);
+                if (fmpq_cmp(t, et) > 0)
+                    reduced = 0;
+            }
+        }
+
+        if (fmpq_sgn(r + i*d + i) <= 0) /* dependent vectors */
+            reduced = 0;
+        else if (i > 0) /* Lovasz condition */
+        {
+            fmpq_mul(s, mu + i*d + i - 1, mu + i*d + i - 1);
+            fmpq_sub(s, del, s);
+            fmpq_mul(s, s, r + (i - 1)*d + i - 1);
+            if (fmpq_cmp(s, r + i*d + i) > 0)
+                reduced = 0;
+        }
+    }
+
+    for (i = 0; i < d*d; i++)
+    {
+        fmpq_clear(r + i);
+        fmpq_clear(mu + i);
+    }
+    flint_free(r);
+    flint_free(mu);
+    fmpq_clear(del);
+    fmpq_clear(et);
+    fmpq_clear(s);
+    fmpq_clear(t);
+
+    return reduced;
+}
@@ -0,0 +1,134 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong /* prevent clash with standard library */
+#include <math.h>
+#include <float.h>
+#define ulong unsigned long
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+
+int fmpz_mat_lll_d(fmpz_mat_t B, double delta, double eta, long depth)
+{
+    const long d = B->r;
+    double * r, * mu, s, max, X;
+    long i, j, k, iter;
+    fmpz_mat_t G;
+    fmpz_t x;
+    int ok = 1;
+
+    if (d <= 1)
+        return 1;
+
+    r  = flint_malloc(d*d*sizeof(double));
+    mu = flint_malloc(d*d*sizeof(double));
+    fmpz_init(x);
+    fmpz_mat_init(G, d, d);
+    _fmpz_mat_lll_gram(G, B);
+
+    r[0] = fmpz_get_d(fmpz_mat_entry(G, 0, 0));
+
+    for (k = 1; k < d && ok; )
+    {
+        /* lazy size reduction of b_k */
+        for (iter = 0; ; iter++)
+        {
+            max = 0.0;
+            for (j = 0; j < k; j++)
+            {
+                s = fmpz_get_d(fmpz_mat_entry(G, k, j));
+                for (i = 0; i < j; i++)
+                    s -= mu[j*d + i]*r[k*d + i];
+                r[k*d + j] = s;
+                mu[k*d + j] = s/r[j*d + j];
+                max = FLINT_MAX(max, fabs(mu[k*d + j]));
+            }
+
+            if (!(max <= DBL_MAX) || iter >= FMPZ_MAT_LLL_MAX_REDUCTIONS)
+            {
+                ok = 0; /* insufficient precision */
+                break;
+            }
+
+            if (max <= eta)
+                break;
+
+            for (j = k - 1; j >= 0; j--)
+            {
+                X = floor(mu[k*d + j] + 0.5);
+                if (X != 0.0)
+                {
+                    fmpz_set_d(x, X);
+                    _fmpz_mat_lll_submul(B, G, k, j, x);
+                    for (i = 0; i < j; i++)
+                        mu[k*d + i] -= X*mu[j*d + i];
+                }
+            }
+        }
+
+        if (!ok)
+            break;
+
+        /* 
+           s = squared norm of b_k projected orthogonally to b_0..b_{i-1},
+           inserting b_k before b_i if that is much shorter than b_i*
+        */
+        s = fmpz_get_d(fmpz_mat_entry(G, k, k));
+        for (i = 0; i < k - 1; i++)
+        {
+            if (i < depth && delta*r[i*d + i] > s)
+                break;
+            s -= mu[k*d + i]*r[k*d + i];
+        }
+
+        if (i == k - 1 && delta*r[i*d + i] <= s) /* Lovasz condition */
+        {
+            r[k*d + k] = s - mu[k*d + k - 1]*r[k*d + k - 1];
+            k++;
+        } else
+        {
+            _fmpz_mat_lll_insert(B, G, i, k);
+
+            for (j = 0; j < i; j++)
+            {
+                r[i*d + j] = r[k*d + j];
+                mu[i*d + j] = mu[k*d + j];
+            }
+            r[i*d + i] = s;
+
+            k = FLINT_MAX(i, 1);
+        }
+    }
+
+    flint_free(r);
+    flint_free(mu);
+    fmpz_clear(x);
+    fmpz_mat_clear(G);
+
+    return ok;
+}
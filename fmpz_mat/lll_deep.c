@@ -0,0 +1,44 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+
+void fmpz_mat_lll_deep(fmpz_mat_t B, double delta, double eta, long depth)
+{
+    mp_bitcnt_t prec;
+
+    /* each attempt continues from the basis the previous one left */
+    if (fmpz_mat_lll_d(B, delta, eta, depth))
+        return;
+
+    if (fmpz_mat_lll_ld(B, delta, eta, depth))
+        return;
+
+    for (prec = FMPZ_MAT_LLL_MPFR_PREC; 
+        !fmpz_mat_lll_mpfr(B, delta, eta, depth, prec); prec *= 2) ;
+}
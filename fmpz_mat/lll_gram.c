@@ -0,0 +1,88 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+
+/*
+   The L^2 algorithm works with the exact Gram matrix G of the rows of B,
+   which is kept up to date with the basis rather than recomputed.
+*/
+
+void _fmpz_mat_lll_gram(fmpz_mat_t G, const fmpz_mat_t B)
+{
+    fmpz_mat_t T;
+
+    fmpz_mat_init(T, B->c, B->r);
+    fmpz_mat_transpose(T, B);
+    fmpz_mat_mul(G, B, T);
+    fmpz_mat_clear(T);
+}
+
+void _fmpz_mat_lll_submul(fmpz_mat_t B, fmpz_mat_t G, 
+                          long k, long j, const fmpz_t x)
+{
+    const long d = B->r;
+    long i;
+    fmpz_t t;
+
+    fmpz_init(t);
+
+    _fmpz_vec_scalar_submul_fmpz(B->rows[k], B->rows[j], B->c, x);
+
+    /* <b_k - x b_j, b_k - x b_j> = G_kk - 2x G_kj + x^2 G_jj */
+    fmpz_mul(t, x, fmpz_mat_entry(G, j, j));
+    fmpz_submul_ui(t, fmpz_mat_entry(G, k, j), 2);
+    fmpz_addmul(fmpz_mat_entry(G, k, k), t, x);
+
+    for (i = 0; i < d; i++)
+    {
+        if (i != k)
+        {
+            fmpz_submul(fmpz_mat_entry(G, k, i), x, fmpz_mat_entry(G, j, i));
+            fmpz_set(fmpz_mat_entry(G, i, k), fmpz_mat_entry(G, k, i));
+        }
+    }
+
+    fmpz_clear(t);
+}
+
+void _fmpz_mat_lll_insert(fmpz_mat_t B, fmpz_mat_t G, long i, long k)
+{
+    const long d = B->r;
+    long j, l;
+
+    for (j = k; j > i; j--)
+    {
+        _fmpz_vec_swap(B->rows[j - 1], B->rows[j], B->c);
+        _fmpz_vec_swap(G->rows[j - 1], G->rows[j], d);
+
+        for (l = 0; l < d; l++)
+            fmpz_swap(fmpz_mat_entry(G, l, j - 1), fmpz_mat_entry(G, l, j));
+    }
+}
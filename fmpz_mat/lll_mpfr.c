@@ -0,0 +1,167 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include <mpfr.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "mpfr_vec.h"
+
+/* sets res to the entry x of the Gram matrix */
+static void _mpfr_set_fmpz(mpfr_t res, const fmpz_t x, mpz_t z)
+{
+    fmpz_get_mpz(z, x);
+    mpfr_set_z(res, z, MPFR_RNDN);
+}
+
+int fmpz_mat_lll_mpfr(fmpz_mat_t B, double delta, double eta, long depth, 
+                      mp_bitcnt_t prec)
+{
+    const long d = B->r;
+    __mpfr_struct * r, * mu;
+    mpfr_t s, max, X, u;
+    long i, j, k, iter;
+    fmpz_mat_t G;
+    fmpz_t x;
+    mpz_t z;
+    int ok = 1;
+
+    if (d <= 1)
+        return 1;
+
+    r  = _mpfr_vec_init(d*d, prec);
+    mu = _mpfr_vec_init(d*d, prec);
+    mpfr_init2(s, prec);
+    mpfr_init2(max, prec);
+    mpfr_init2(X, prec);
+    mpfr_init2(u, prec);
+    fmpz_init(x);
+    fmpz_mat_init(G, d, d);
+    _fmpz_mat_lll_gram(G, B);
+    mpz_init(z);
+
+    _mpfr_set_fmpz(r + 0, fmpz_mat_entry(G, 0, 0), z);
+
+    for (k = 1; k < d && ok; )
+    {
+        /* lazy size reduction of b_k */
+        for (iter = 0; ; iter++)
+        {
+            mpfr_set_ui(max, 0, MPFR_RNDN);
+            for (j = 0; j < k; j++)
+            {
+                _mpfr_set_fmpz(s, fmpz_mat_entry(G, k, j), z);
+                for (i = 0; i < j; i++)
+                {
+                    mpfr_mul(u, mu + j*d + i, r + k*d + i, MPFR_RNDN);
+                    mpfr_sub(s, s, u, MPFR_RNDN);
+                }
+                mpfr_set(r + k*d + j, s, MPFR_RNDN);
+                mpfr_div(mu + k*d + j, s, r + j*d + j, MPFR_RNDN);
+                if (mpfr_cmpabs(mu + k*d + j, max) > 0)
+                    mpfr_abs(max, mu + k*d + j, MPFR_RNDN);
+            }
+
+            if (!mpfr_number_p(max) || iter >= FMPZ_MAT_LLL_MAX_REDUCTIONS)
+            {
+                ok = 0; /* insufficient precision */
+                break;
+            }
+
+            if (mpfr_cmp_d(max, eta) <= 0)
+                break;
+
+            for (j = k - 1; j >= 0; j--)
+            {
+                mpfr_get_z(z, mu + k*d + j, MPFR_RNDN);
+                if (mpz_sgn(z) != 0)
+                {
+                    fmpz_set_mpz(x, z);
+                    mpfr_set_z(X, z, MPFR_RNDN);
+                    _fmpz_mat_lll_submul(B, G, k, j, x);
+                    for (i = 0; i < j; i++)
+                    {
+                        mpfr_mul(u, X, mu + j*d + i, MPFR_RNDN);
+                        mpfr_sub(mu + k*d + i, mu + k*d + i, u, MPFR_RNDN);
+                    }
+                }
+            }
+        }
+
+        if (!ok)
+            break;
+
+        /* 
+           s = squared norm of b_k projected orthogonally to b_0..b_{i-1},
+           inserting b_k before b_i if that is much shorter than b_i*
+        */
+        _mpfr_set_fmpz(s, fmpz_mat_entry(G, k, k), z);
+        for (i = 0; i < k - 1; i++)
+        {
+            if (i < depth)
+            {
+                mpfr_mul_d(u, r + i*d + i, delta, MPFR_RNDN);
+                if (mpfr_cmp(u, s) > 0)
+                    break;
+            }
+            mpfr_mul(u, mu + k*d + i, r + k*d + i, MPFR_RNDN);
+            mpfr_sub(s, s, u, MPFR_RNDN);
+        }
+        mpfr_mul_d(u, r + i*d + i, delta, MPFR_RNDN);
+
+        if (i == k - 1 && mpfr_cmp(u, s) <= 0) /* Lovasz condition */
+        {
+            mpfr_mul(u, mu + k*d + k - 1, r + k*d + k - 1, MPFR_RNDN);
+            mpfr_sub(r + k*d + k, s, u, MPFR_RNDN);
+            k++;
+        } else
+        {
+            _fmpz_mat_lll_insert(B, G, i, k);
+
+            for (j = 0; j < i; j++)
+            {
+                mpfr_set(r + i*d + j, r + k*d + j, MPFR_RNDN);
+                mpfr_set(mu + i*d + j, mu + k*d + j, MPFR_RNDN);
+            }
+            mpfr_set(r + i*d + i, s, MPFR_RNDN);
+
+            k = FLINT_MAX(i, 1);
+        }
+    }
+
+    _mpfr_vec_clear(r, d*d);
+    _mpfr_vec_clear(mu, d*d);
+    mpfr_clear(s);
+    mpfr_clear(max);
+    mpfr_clear(X);
+    mpfr_clear(u);
+    fmpz_clear(x);
+    fmpz_mat_clear(G);
+    mpz_clear(z);
+
+    return ok;
+}
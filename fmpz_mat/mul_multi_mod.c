@@ -20,10 +20,14 @@
 /******************************************************************************
 
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
+#undef ulong /* prevent clash with standard library */
 #include <stdlib.h>
+#include <pthread.h>
+#define ulong unsigned long
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_mat.h"
@@ -31,15 +35,168 @@
 #include "nmod_mat.h"
 #include "ulong_extras.h"
 
+typedef struct
+{
+    const fmpz_mat_struct * A;
+    const fmpz_mat_struct * B;
+    fmpz_mat_struct * C;
+    nmod_mat_struct * mod_A;
+    nmod_mat_struct * mod_B;
+    nmod_mat_struct * mod_C;
+    const fmpz_comb_struct * comb;
+    fmpz_comb_temp_struct * comb_temp;
+    mp_limb_t * residues;
+    long num_primes;
+    long num_blocks;    /* number of row blocks per prime in the product */
+    long start;         /* range of rows, or of (prime, block) pairs */
+    long stop;
+    long Bstart;        /* range of rows of B */
+    long Bstop;
+    int spawned;        /* set if running in a thread of its own */
+} fmpz_mat_mul_multi_mod_arg_t;
+
+/*
+   The mpz cache is thread local, so a thread spawned here has to empty 
+   its own cache before it exits. The comb temporaries are allocated by 
+   the calling thread and remain owned by it.
+*/
+static void
+_multi_mod_worker_exit(fmpz_mat_mul_multi_mod_arg_t * arg)
+{
+    if (arg->spawned)
+        _fmpz_cleanup();
+}
+
+/* Reduces rows [start, stop) of A and [Bstart, Bstop) of B */
+static void *
+_multi_mod_reduce_worker(void * arg_ptr)
+{
+    fmpz_mat_mul_multi_mod_arg_t * arg = arg_ptr;
+    long i, j, num_primes = arg->num_primes;
+
+    for (i = arg->start * arg->A->c; i < arg->stop * arg->A->c; i++)
+    {
+        fmpz_multi_mod_ui(arg->residues, arg->A->entries + i, arg->comb, 
+                          arg->comb_temp);
+        for (j = 0; j < num_primes; j++)
+            arg->mod_A[j].entries[i] = arg->residues[j];
+    }
+
+    for (i = arg->Bstart * arg->B->c; i < arg->Bstop * arg->B->c; i++)
+    {
+        fmpz_multi_mod_ui(arg->residues, arg->B->entries + i, arg->comb, 
+                          arg->comb_temp);
+        for (j = 0; j < num_primes; j++)
+            arg->mod_B[j].entries[i] = arg->residues[j];
+    }
+
+    _multi_mod_worker_exit(arg);
+
+    return NULL;
+}
+
+/* Multiplies modulo p for the pairs (p, row block) numbered [start, stop) */
+static void *
+_multi_mod_mul_worker(void * arg_ptr)
+{
+    fmpz_mat_mul_multi_mod_arg_t * arg = arg_ptr;
+    long u, m = arg->A->r;
+
+    for (u = arg->start; u < arg->stop; u++)
+    {
+        long i = u % arg->num_primes;
+        long b = u / arg->num_primes;
+        long r1 = (b * m) / arg->num_blocks;
+        long r2 = ((b + 1) * m) / arg->num_blocks;
+
+        if (arg->num_blocks == 1)
+        {
+            nmod_mat_mul(arg->mod_C + i, arg->mod_A + i, arg->mod_B + i);
+        }
+        else if (r1 < r2)
+        {
+            nmod_mat_t Aw, Cw;
+
+            nmod_mat_window_init(Aw, arg->mod_A + i, r1, 0, r2, arg->A->c);
+            nmod_mat_window_init(Cw, arg->mod_C + i, r1, 0, r2, arg->C->c);
+            nmod_mat_mul(Cw, Aw, arg->mod_B + i);
+            nmod_mat_window_clear(Aw);
+            nmod_mat_window_clear(Cw);
+        }
+    }
+
+    _multi_mod_worker_exit(arg);
+
+    return NULL;
+}
+
+/* Reconstructs rows [start, stop) of C */
+static void *
+_multi_mod_crt_worker(void * arg_ptr)
+{
+    fmpz_mat_mul_multi_mod_arg_t * arg = arg_ptr;
+    long i, j, num_primes = arg->num_primes;
+
+    for (i = arg->start * arg->C->c; i < arg->stop * arg->C->c; i++)
+    {
+        for (j = 0; j < num_primes; j++)
+            arg->residues[j] = arg->mod_C[j].entries[i];
+        fmpz_multi_CRT_ui(arg->C->entries + i, arg->residues, arg->comb, 
+                          arg->comb_temp, 1);
+    }
+
+    _multi_mod_worker_exit(arg);
+
+    return NULL;
+}
+
+static void
+_multi_mod_run(void * (* worker)(void *), 
+               fmpz_mat_mul_multi_mod_arg_t * args, int num_threads)
+{
+    pthread_t * threads;
+    long j, k;
+
+    if (num_threads == 1)
+    {
+        worker(args);
+        return;
+    }
+
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    for (k = 1; k < num_threads; k++)
+    {
+        args[k].spawned = 1;
+        if (pthread_create(threads + k, NULL, worker, args + k))
+            break;
+    }
+
+    worker(args);
+
+    /* the ranges for which no thread could be created are done here */
+    for (j = k; j < num_threads; j++)
+    {
+        args[j].spawned = 0;
+        worker(args + j);
+    }
+
+    for (j = 1; j < k; j++)
+        pthread_join(threads[j], NULL);
+
+    flint_free(threads);
+}
 
 void
 _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
     long bits)
 {
-    long i, j;
+    long i, k, num_units;
+    int num_threads;
 
     fmpz_comb_t comb;
-    fmpz_comb_temp_t comb_temp;
+    fmpz_comb_temp_t * comb_temp;
+    fmpz_mat_mul_multi_mod_arg_t * args;
 
     long num_primes;
     long primes_bits;
@@ -50,7 +207,7 @@ _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
     nmod_mat_t * mod_A;
     nmod_mat_t * mod_B;
 
-    primes_bits = NMOD_MAT_OPTIMAL_MODULUS_BITS;
+    primes_bits = _nmod_mat_mul_optimal_modulus_bits(A->r, A->c, B->c);
 
     if (bits < primes_bits)
     {
@@ -63,13 +220,21 @@ _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
         num_primes = (bits + primes_bits - 1) / primes_bits;
     }
 
+    num_threads = flint_get_num_threads();
+
+    /* without thread local storage the mpz cache is shared */
+    if (!HAVE_TLS || A->r < FMPZ_MAT_MUL_MULTI_MOD_THREAD_CUTOFF 
+        || A->c < FMPZ_MAT_MUL_MULTI_MOD_THREAD_CUTOFF 
+        || B->c < FMPZ_MAT_MUL_MULTI_MOD_THREAD_CUTOFF)
+        num_threads = 1;
+
     /* Initialize */
     primes = flint_malloc(sizeof(mp_limb_t) * num_primes);
     primes[0] = n_nextprime(1UL << primes_bits, 0);
     for (i = 1; i < num_primes; i++)
         primes[i] = n_nextprime(primes[i-1], 0);
 
-    residues = flint_malloc(sizeof(mp_limb_t) * num_primes);
+    residues = flint_malloc(sizeof(mp_limb_t) * num_primes * num_threads);
 
     mod_A = flint_malloc(sizeof(nmod_mat_t) * num_primes);
     mod_B = flint_malloc(sizeof(nmod_mat_t) * num_primes);
@@ -82,38 +247,61 @@ _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
     }
 
     fmpz_comb_init(comb, primes, num_primes);
-    fmpz_comb_temp_init(comb_temp, comb);
+    comb_temp = flint_malloc(sizeof(fmpz_comb_temp_t) * num_threads);
+    for (k = 0; k < num_threads; k++)
+        fmpz_comb_temp_init(comb_temp[k], comb);
 
-    /* Calculate residues of A */
-    for (i = 0; i < A->r * A->c; i++)
+    /*
+       If there are fewer primes than threads, the product modulo each 
+       prime is split into blocks of rows as well.
+    */
+    args = flint_malloc(sizeof(fmpz_mat_mul_multi_mod_arg_t) * num_threads);
+    for (k = 0; k < num_threads; k++)
     {
-        fmpz_multi_mod_ui(residues, &A->entries[i], comb, comb_temp);
-        for (j = 0; j < num_primes; j++)
-            mod_A[j]->entries[i] = residues[j];
+        args[k].A = A;
+        args[k].B = B;
+        args[k].C = C;
+        args[k].mod_A = (nmod_mat_struct *) mod_A;
+        args[k].mod_B = (nmod_mat_struct *) mod_B;
+        args[k].mod_C = (nmod_mat_struct *) mod_C;
+        args[k].comb = comb;
+        args[k].comb_temp = comb_temp[k];
+        args[k].residues = residues + k * num_primes;
+        args[k].num_primes = num_primes;
+        args[k].num_blocks = (num_threads + num_primes - 1) / num_primes;
+        args[k].spawned = (k != 0);
     }
 
-    /* Calculate residues of B */
-    for (i = 0; i < B->r * B->c; i++)
+    /* Calculate residues of A and B */
+    for (k = 0; k < num_threads; k++)
     {
-        fmpz_multi_mod_ui(residues, &B->entries[i], comb, comb_temp);
-        for (j = 0; j < num_primes; j++)
-            mod_B[j]->entries[i] = residues[j];
+        args[k].start = (k * A->r) / num_threads;
+        args[k].stop = ((k + 1) * A->r) / num_threads;
+        args[k].Bstart = (k * B->r) / num_threads;
+        args[k].Bstop = ((k + 1) * B->r) / num_threads;
     }
 
+    _multi_mod_run(_multi_mod_reduce_worker, args, num_threads);
+
     /* Multiply */
-    for (i = 0; i < num_primes; i++)
+    num_units = num_primes * args[0].num_blocks;
+    for (k = 0; k < num_threads; k++)
     {
-        nmod_mat_mul(mod_C[i], mod_A[i], mod_B[i]);
+        args[k].start = (k * num_units) / num_threads;
+        args[k].stop = ((k + 1) * num_units) / num_threads;
     }
 
+    _multi_mod_run(_multi_mod_mul_worker, args, num_threads);
+
     /* Chinese remaindering */
-    for (i = 0; i < C->r * C->c; i++)
+    for (k = 0; k < num_threads; k++)
     {
-        for (j = 0; j < num_primes; j++)
-            residues[j] = mod_C[j]->entries[i];
-        fmpz_multi_CRT_ui(&C->entries[i], residues, comb, comb_temp, 1);
+        args[k].start = (k * C->r) / num_threads;
+        args[k].stop = ((k + 1) * C->r) / num_threads;
     }
 
+    _multi_mod_run(_multi_mod_crt_worker, args, num_threads);
+
     /* Cleanup */
     for (i = 0; i < num_primes; i++)
     {
@@ -126,9 +314,12 @@ _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
     flint_free(mod_B);
     flint_free(mod_C);
 
-    fmpz_comb_temp_clear(comb_temp);
+    for (k = 0; k < num_threads; k++)
+        fmpz_comb_temp_clear(comb_temp[k]);
+    flint_free(comb_temp);
     fmpz_comb_clear(comb);
 
+    flint_free(args);
     flint_free(residues);
     flint_free(primes);
 }
@@ -0,0 +1,118 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "fmpz_mat.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    long dim;
+    int lattice;
+    long depth;
+} lll_t;
+
+static const char * names[] = { "intrel", "ntrulike", "ajtai", "simdioph" };
+
+static void randlattice(fmpz_mat_t A, flint_rand_t state, int lattice, long d)
+{
+    switch (lattice)
+    {
+        case 0:
+            fmpz_mat_init(A, d, d + 1);
+            fmpz_mat_randintrel(A, state, 10*d);
+            break;
+        case 1:
+            fmpz_mat_init(A, 2*(d/2), 2*(d/2));
+            fmpz_mat_randntrulike(A, state, 10, 1UL << 20);
+            break;
+        case 2:
+            fmpz_mat_init(A, d, d);
+            fmpz_mat_randajtai(A, state, 0.5);
+            break;
+        default:
+            fmpz_mat_init(A, d, d);
+            fmpz_mat_randsimdioph(A, state, 10*d, 5*d);
+    }
+}
+
+void sample(void * arg, ulong count)
+{
+    lll_t * params = (lll_t *) arg;
+    ulong i;
+    fmpz_mat_t A, B;
+    flint_rand_t state;
+    flint_randinit(state);
+
+    randlattice(A, state, params->lattice, params->dim);
+    fmpz_mat_init(B, A->r, A->c);
+
+    for (i = 0; i < count; i++)
+    {
+        fmpz_mat_set(B, A);
+
+        prof_start();
+        fmpz_mat_lll_deep(B, 0.99, 0.51, params->depth);
+        prof_stop();
+    }
+
+    fmpz_mat_clear(A);
+    fmpz_mat_clear(B);
+    flint_randclear(state);
+}
+
+int main(void)
+{
+    double min_plain, min_deep, max;
+    lll_t params;
+    int lattice;
+    long dim;
+
+    for (lattice = 0; lattice < 4; lattice++)
+    {
+        printf("fmpz_mat_lll (%s lattices):\n", names[lattice]);
+        params.lattice = lattice;
+
+        for (dim = 4; dim <= 48; dim = (long) ((double) dim * 1.5))
+        {
+            params.dim = dim;
+
+            params.depth = 0;
+            prof_repeat(&min_plain, &max, sample, &params);
+
+            params.depth = 10;
+            prof_repeat(&min_deep, &max, sample, &params);
+
+            printf("dim = %ld lll/deep(10) %.2f %.2f (us)\n", 
+                dim, min_plain, min_deep);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+
+void fmpz_mat_snf(fmpz_mat_t S, const fmpz_mat_t A)
+{
+    fmpz_t d;
+
+    if (A->r != A->c || A->r == 0)
+    {
+        fmpz_mat_snf_kannan_bachem(S, A);
+        return;
+    }
+
+    fmpz_init(d);
+    fmpz_mat_det_modular(d, A, 1);
+
+    if (fmpz_is_zero(d))
+        fmpz_mat_snf_kannan_bachem(S, A);
+    else
+    {
+        fmpz_abs(d, d);
+        fmpz_mat_snf_iliopoulos(S, A, d);
+    }
+
+    fmpz_clear(d);
+}
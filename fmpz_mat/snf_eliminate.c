@@ -0,0 +1,151 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+
+/* 
+   Replaces rows x and y of S (columns if cols is set), from index k on,
+   by unimodular combinations of them such that entry k of y becomes 
+   zero. Returns 1 if entry k of x may have changed. Needs 7 temporaries.
+*/
+static int _fmpz_mat_snf_combine(fmpz_mat_t S, long x, long y, long k, 
+                                 int cols, const fmpz_t mod, fmpz * t)
+{
+    const long len = cols ? S->r : S->c;
+    fmpz * g = t, * u = t + 1, * v = t + 2, * a = t + 3, * b = t + 4;
+    fmpz * q = t + 5, * r = t + 6;
+    fmpz * ex, * ey;
+    long l;
+    int changed = 0;
+
+#define ENTRY(z, l) (cols ? fmpz_mat_entry(S, l, z) : fmpz_mat_entry(S, z, l))
+
+    if (!fmpz_is_zero(ENTRY(x, k)))
+        fmpz_fdiv_qr(q, r, ENTRY(y, k), ENTRY(x, k));
+
+    if (!fmpz_is_zero(ENTRY(x, k)) && fmpz_is_zero(r))
+    {
+        for (l = k; l < len; l++)
+        {
+            ey = ENTRY(y, l);
+            fmpz_submul(ey, q, ENTRY(x, l));
+            if (mod != NULL)
+                fmpz_mod(ey, ey, mod);
+        }
+    }
+    else
+    {
+        fmpz_xgcd(g, u, v, ENTRY(x, k), ENTRY(y, k));
+        fmpz_divexact(a, ENTRY(x, k), g);
+        fmpz_divexact(b, ENTRY(y, k), g);
+
+        for (l = k; l < len; l++)
+        {
+            ex = ENTRY(x, l);
+            ey = ENTRY(y, l);
+            fmpz_mul(q, u, ex);
+            fmpz_addmul(q, v, ey);
+            fmpz_mul(ey, a, ey);
+            fmpz_submul(ey, b, ex);
+            fmpz_swap(ex, q);
+            if (mod != NULL)
+            {
+                fmpz_mod(ex, ex, mod);
+                fmpz_mod(ey, ey, mod);
+            }
+        }
+
+        changed = 1;
+    }
+
+#undef ENTRY
+
+    return changed;
+}
+
+/*
+   Brings S to diagonal form by unimodular row and column operations, 
+   with all entries reduced modulo mod unless it is NULL. Each pivot is 
+   the gcd of its row and column, alternating between the two until 
+   both are clear, which happens when a column step no longer changes 
+   the pivot.
+*/
+void _fmpz_mat_snf_eliminate(fmpz_mat_t S, const fmpz_t mod)
+{
+    const long m = S->r, n = S->c;
+    fmpz * t = _fmpz_vec_init(7);
+    long i, k;
+    int changed;
+
+    for (k = 0; k < FLINT_MIN(m, n); k++)
+    {
+        do
+        {
+            for (i = k + 1; i < m; i++)
+                if (!fmpz_is_zero(fmpz_mat_entry(S, i, k)))
+                    _fmpz_mat_snf_combine(S, k, i, k, 0, mod, t);
+
+            changed = 0;
+            for (i = k + 1; i < n; i++)
+                if (!fmpz_is_zero(fmpz_mat_entry(S, k, i)))
+                    changed |= _fmpz_mat_snf_combine(S, k, i, k, 1, mod, t);
+        } while (changed);
+    }
+
+    _fmpz_vec_clear(t, 7);
+}
+
+/* turns the diagonal of S into a chain of divisors */
+void _fmpz_mat_snf_diagonal(fmpz_mat_t S)
+{
+    const long r = FLINT_MIN(S->r, S->c);
+    fmpz_t g;
+    long i, j;
+
+    fmpz_init(g);
+
+    for (i = 0; i < r; i++)
+        fmpz_abs(fmpz_mat_entry(S, i, i), fmpz_mat_entry(S, i, i));
+
+    for (i = 0; i < r; i++)
+    {
+        for (j = i + 1; j < r; j++)
+        {
+            if (fmpz_is_one(fmpz_mat_entry(S, i, i)))
+                break;
+
+            fmpz_gcd(g, fmpz_mat_entry(S, i, i), fmpz_mat_entry(S, j, j));
+            fmpz_lcm(fmpz_mat_entry(S, j, j), fmpz_mat_entry(S, i, i), 
+                                              fmpz_mat_entry(S, j, j));
+            fmpz_swap(fmpz_mat_entry(S, i, i), g);
+        }
+    }
+
+    fmpz_clear(g);
+}
@@ -0,0 +1,61 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+
+/*
+   As mod Z^n is contained in the lattice spanned by the rows of A, 
+   row and column operations may be done modulo mod. Once S is diagonal, 
+   the lattice is spanned by the diagonal entries together with mod Z^n, 
+   so the invariants are their gcds with mod.
+*/
+void fmpz_mat_snf_iliopoulos(fmpz_mat_t S, const fmpz_mat_t A, 
+                             const fmpz_t mod)
+{
+    long i, j;
+
+    if (A->r != A->c || fmpz_sgn(mod) <= 0)
+    {
+        printf("Exception (fmpz_mat_snf_iliopoulos). "
+               "Not a full rank lattice.\n");
+        abort();
+    }
+
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < A->c; j++)
+            fmpz_mod(fmpz_mat_entry(S, i, j), fmpz_mat_entry(A, i, j), mod);
+
+    _fmpz_mat_snf_eliminate(S, mod);
+
+    for (i = 0; i < A->r; i++)
+        fmpz_gcd(fmpz_mat_entry(S, i, i), fmpz_mat_entry(S, i, i), mod);
+
+    _fmpz_mat_snf_diagonal(S);
+}
@@ -0,0 +1,128 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+/* random unimodular row operations, which leave the HNF unchanged */
+static void rowops(fmpz_mat_t A, flint_rand_t state, long count)
+{
+    long c, i, j;
+
+    if (A->r < 2)
+        return;
+
+    for (c = 0; c < count; c++)
+    {
+        i = n_randint(state, A->r);
+        j = n_randint(state, A->r);
+        if (i == j)
+            _fmpz_vec_swap(A->rows[i], A->rows[j], A->c);
+        else if (n_randint(state, 2))
+            _fmpz_vec_add(A->rows[i], A->rows[i], A->rows[j], A->c);
+        else
+            _fmpz_vec_sub(A->rows[i], A->rows[i], A->rows[j], A->c);
+    }
+}
+
+int
+main(void)
+{
+    flint_rand_t state;
+    long i;
+
+    printf("hnf_classical....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (i = 0; i < 1000; i++)
+    {
+        fmpz_mat_t A, B, H, H2;
+        long m = n_randint(state, 10), n = n_randint(state, 10), r;
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(B, m, n);
+        fmpz_mat_init(H, m, n);
+        fmpz_mat_init(H2, m, n);
+
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+        fmpz_mat_randrank(A, state, r, n_randint(state, 10) + 1);
+        if (n_randint(state, 2))
+            fmpz_mat_randops(A, state, n_randint(state, 2*m*n + 1));
+
+        fmpz_mat_hnf_classical(H, A);
+
+        if (!fmpz_mat_is_in_hnf(H) || fmpz_mat_rank(H) != fmpz_mat_rank(A))
+        {
+            printf("FAIL:\n");
+            printf("not in Hermite normal form or wrong rank\n");
+            fmpz_mat_print_pretty(A); printf("\n");
+            fmpz_mat_print_pretty(H); printf("\n");
+            abort();
+        }
+
+        fmpz_mat_set(B, A);
+        rowops(B, state, n_randint(state, 2*m*m + 1));
+        fmpz_mat_hnf_classical(H2, B);
+
+        if (!fmpz_mat_equal(H, H2))
+        {
+            printf("FAIL:\n");
+            printf("depends on the basis\n");
+            fmpz_mat_print_pretty(A); printf("\n");
+            fmpz_mat_print_pretty(H); printf("\n");
+            fmpz_mat_print_pretty(H2); printf("\n");
+            abort();
+        }
+
+        fmpz_mat_hnf_classical(H2, H);
+
+        if (!fmpz_mat_equal(H, H2))
+        {
+            printf("FAIL:\n");
+            printf("not idempotent\n");
+            fmpz_mat_print_pretty(H); printf("\n");
+            fmpz_mat_print_pretty(H2); printf("\n");
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(H);
+        fmpz_mat_clear(H2);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,93 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    flint_rand_t state;
+    long i;
+
+    printf("hnf_modular....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (i = 0; i < 1000; i++)
+    {
+        fmpz_mat_t A, H, H2;
+        fmpz_t D;
+        long j, m, n = n_randint(state, 10) + 1;
+
+        m = n + (n_randint(state, 2) ? 0 : n_randint(state, 5));
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(H, m, n);
+        fmpz_mat_init(H2, m, n);
+        fmpz_init(D);
+
+        do {
+            fmpz_mat_randtest(A, state, n_randint(state, 10) + 1);
+            fmpz_mat_randops(A, state, n_randint(state, 2*m*n + 1));
+            fmpz_mat_hnf_classical(H2, A);
+            fmpz_one(D);
+            for (j = 0; j < n; j++)
+                fmpz_mul(D, D, fmpz_mat_entry(H2, j, j));
+        } while (fmpz_is_zero(D));
+
+        /* any multiple of the determinant of the lattice will do */
+        fmpz_abs(D, D);
+        fmpz_mul_ui(D, D, n_randint(state, 10) + 1);
+
+        fmpz_mat_hnf_modular(H, A, D);
+
+        if (!fmpz_mat_equal(H, H2))
+        {
+            printf("FAIL:\n");
+            fmpz_mat_print_pretty(A); printf("\n");
+            fmpz_print(D); printf("\n");
+            fmpz_mat_print_pretty(H); printf("\n");
+            fmpz_mat_print_pretty(H2); printf("\n");
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(H);
+        fmpz_mat_clear(H2);
+        fmpz_clear(D);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    printf("is_reduced....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (i = 0; i < 1000; i++)
+    {
+        fmpz_mat_t A;
+        fmpz_t k;
+        long j, r = n_randint(state, 8) + 2;
+
+        fmpz_mat_init(A, r, r);
+        fmpz_init(k);
+
+        fmpz_mat_one(A);
+        result = fmpz_mat_is_reduced(A, 0.99, 0.51);
+        if (!result)
+        {
+            printf("FAIL (identity):\n");
+            fmpz_mat_print_pretty(A);
+            abort();
+        }
+
+        fmpz_mat_randajtai(A, state, 0.5);
+        fmpz_mat_lll(A, 0.99, 0.51);
+
+        result = fmpz_mat_is_reduced(A, 0.99, 0.51);
+        if (!result)
+        {
+            printf("FAIL (reduced):\n");
+            fmpz_mat_print_pretty(A);
+            abort();
+        }
+
+        /* destroys size reduction of the second vector */
+        fmpz_set_ui(k, n_randint(state, 10) + 2);
+        if (n_randint(state, 2))
+            fmpz_neg(k, k);
+        for (j = 0; j < r; j++)
+            fmpz_addmul(fmpz_mat_entry(A, 1, j), k, fmpz_mat_entry(A, 0, j));
+
+        result = !fmpz_mat_is_reduced(A, 0.99, 0.51);
+        if (!result)
+        {
+            printf("FAIL (not reduced):\n");
+            fmpz_mat_print_pretty(A);
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_clear(k);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
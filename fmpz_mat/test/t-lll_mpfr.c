@@ -0,0 +1,126 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+/* sets g to the determinant of the Gram matrix of the rows of A */
+static void gram_det(fmpz_t g, const fmpz_mat_t A)
+{
+    fmpz_mat_t T, G;
+
+    fmpz_mat_init(T, A->c, A->r);
+    fmpz_mat_init(G, A->r, A->r);
+    fmpz_mat_transpose(T, A);
+    fmpz_mat_mul(G, A, T);
+    fmpz_mat_det(g, G);
+    fmpz_mat_clear(T);
+    fmpz_mat_clear(G);
+}
+
+int
+main(void)
+{
+    fmpz_mat_t A, B;
+    fmpz_t g1, g2;
+    flint_rand_t state;
+    long i, r, c, depth;
+
+    printf("lll_mpfr....");
+    fflush(stdout);
+
+    flint_randinit(state);
+    fmpz_init(g1);
+    fmpz_init(g2);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        r = n_randint(state, 15) + 1;
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                c = r + 1;
+                fmpz_mat_init(A, r, c);
+                fmpz_mat_randintrel(A, state, n_randint(state, 100) + 1);
+                break;
+            case 1:
+                r = 2*((r + 1)/2);
+                c = r;
+                fmpz_mat_init(A, r, c);
+                fmpz_mat_randntrulike(A, state, n_randint(state, 30) + 1, 
+                                                n_randint(state, 1000) + 1);
+                break;
+            case 2:
+                c = r;
+                fmpz_mat_init(A, r, c);
+                fmpz_mat_randajtai(A, state, 0.5);
+                break;
+            default:
+                c = r + n_randint(state, 5);
+                fmpz_mat_init(A, r, c);
+                fmpz_mat_randrank(A, state, r, n_randint(state, 20) + 1);
+                fmpz_mat_randops(A, state, n_randint(state, 2*r*c + 1));
+        }
+
+        fmpz_mat_init_set(B, A);
+        depth = n_randint(state, 2) ? 0 : n_randint(state, r + 1);
+
+        if (!fmpz_mat_lll_mpfr(B, 0.99, 0.51, depth, 53 + n_randint(state, 100)))
+        {
+            printf("FAIL:\n");
+            printf("reduction failed, depth = %ld\n", depth);
+            fmpz_mat_print_pretty(A); printf("\n");
+            abort();
+        }
+
+        gram_det(g1, A);
+        gram_det(g2, B);
+
+        if (!fmpz_equal(g1, g2) || !fmpz_mat_is_reduced(B, 0.98, 0.52))
+        {
+            printf("FAIL:\n");
+            printf("not a reduced basis of the lattice, depth = %ld\n", depth);
+            fmpz_mat_print_pretty(A); printf("\n");
+            fmpz_mat_print_pretty(B); printf("\n");
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+    }
+
+    fmpz_clear(g1);
+    fmpz_clear(g2);
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
@@ -77,6 +77,45 @@ int main(void)
         fmpz_mat_clear(D);
     }
 
+    /* Check the threaded version, including fewer primes than threads */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        long m, n, k;
+
+        m = n_randint(state, 50) + FMPZ_MAT_MUL_MULTI_MOD_THREAD_CUTOFF;
+        n = n_randint(state, 50) + FMPZ_MAT_MUL_MULTI_MOD_THREAD_CUTOFF;
+        k = n_randint(state, 50) + FMPZ_MAT_MUL_MULTI_MOD_THREAD_CUTOFF;
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(B, n, k);
+        fmpz_mat_init(C, m, k);
+        fmpz_mat_init(D, m, k);
+
+        fmpz_mat_randtest(A, state, n_randint(state, 200) + 1);
+        fmpz_mat_randtest(B, state, n_randint(state, 200) + 1);
+        fmpz_mat_randtest(C, state, n_randint(state, 200) + 1);
+        fmpz_mat_randtest(D, state, n_randint(state, 200) + 1);
+
+        flint_set_num_threads(2 + n_randint(state, 7));
+
+        fmpz_mat_mul_classical_inline(C, A, B);
+        fmpz_mat_mul_multi_mod(D, A, B);
+
+        if (!fmpz_mat_equal(C, D))
+        {
+            printf("FAIL: results not equal (threaded)\n");
+            printf("num_threads = %d\n", flint_get_num_threads());
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(C);
+        fmpz_mat_clear(D);
+    }
+
+    flint_set_num_threads(1);
+
     flint_randclear(state);
     _fmpz_cleanup();
     printf("PASS\n");
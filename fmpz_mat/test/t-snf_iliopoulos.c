@@ -0,0 +1,88 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    flint_rand_t state;
+    long i;
+
+    printf("snf_iliopoulos....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (i = 0; i < 1000; i++)
+    {
+        fmpz_mat_t A, S, S2;
+        fmpz_t d;
+        long n = n_randint(state, 10) + 1;
+
+        fmpz_mat_init(A, n, n);
+        fmpz_mat_init(S, n, n);
+        fmpz_mat_init(S2, n, n);
+        fmpz_init(d);
+
+        do {
+            fmpz_mat_randtest(A, state, n_randint(state, 20) + 1);
+            fmpz_mat_randops(A, state, n_randint(state, 2*n*n + 1));
+            fmpz_mat_det(d, A);
+        } while (fmpz_is_zero(d));
+
+        fmpz_abs(d, d);
+        fmpz_mul_ui(d, d, n_randint(state, 10) + 1);
+
+        fmpz_mat_snf_iliopoulos(S, A, d);
+        fmpz_mat_snf_kannan_bachem(S2, A);
+
+        if (!fmpz_mat_equal(S, S2))
+        {
+            printf("FAIL:\n");
+            fmpz_mat_print_pretty(A); printf("\n");
+            fmpz_print(d); printf("\n");
+            fmpz_mat_print_pretty(S); printf("\n");
+            fmpz_mat_print_pretty(S2); printf("\n");
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(S);
+        fmpz_mat_clear(S2);
+        fmpz_clear(d);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    flint_rand_t state;
+    long i;
+
+    printf("snf_kannan_bachem....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (i = 0; i < 1000; i++)
+    {
+        fmpz_mat_t A, B, S, S2;
+        fmpz_t d, p;
+        long j, m = n_randint(state, 10), n = n_randint(state, 10), r;
+
+        fmpz_mat_init(A, m, n);
+        fmpz_mat_init(B, m, n);
+        fmpz_mat_init(S, m, n);
+        fmpz_mat_init(S2, m, n);
+        fmpz_init(d);
+        fmpz_init(p);
+
+        r = n_randint(state, FLINT_MIN(m, n) + 1);
+        fmpz_mat_randrank(A, state, r, n_randint(state, 10) + 1);
+        fmpz_mat_randops(A, state, n_randint(state, 2*m*n + 1));
+
+        fmpz_mat_snf_kannan_bachem(S, A);
+
+        if (!fmpz_mat_is_in_snf(S) || fmpz_mat_rank(S) != r)
+        {
+            printf("FAIL:\n");
+            printf("not in Smith normal form or wrong rank\n");
+            fmpz_mat_print_pretty(A); printf("\n");
+            fmpz_mat_print_pretty(S); printf("\n");
+            abort();
+        }
+
+        fmpz_mat_set(B, A);
+        fmpz_mat_randops(B, state, n_randint(state, 2*m*n + 1));
+        fmpz_mat_snf_kannan_bachem(S2, B);
+
+        if (!fmpz_mat_equal(S, S2))
+        {
+            printf("FAIL:\n");
+            printf("not invariant\n");
+            fmpz_mat_print_pretty(A); printf("\n");
+            fmpz_mat_print_pretty(S); printf("\n");
+            fmpz_mat_print_pretty(S2); printf("\n");
+            abort();
+        }
+
+        if (m == n)
+        {
+            fmpz_mat_det(d, A);
+            fmpz_abs(d, d);
+            fmpz_one(p);
+            for (j = 0; j < n; j++)
+                fmpz_mul(p, p, fmpz_mat_entry(S, j, j));
+
+            if (!fmpz_equal(d, p))
+            {
+                printf("FAIL:\n");
+                printf("wrong determinant\n");
+                fmpz_mat_print_pretty(A); printf("\n");
+                fmpz_mat_print_pretty(S); printf("\n");
+                abort();
+            }
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(S);
+        fmpz_mat_clear(S2);
+        fmpz_clear(d);
+        fmpz_clear(p);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
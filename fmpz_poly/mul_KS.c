@@ -30,6 +30,7 @@
 #include "fmpz.h"
 #include "fmpz_vec.h"
 #include "fmpz_poly.h"
+#include "mpn_extras.h"
 
 void
 _fmpz_poly_mul_KS(fmpz * res, const fmpz * poly1, long len1,
@@ -97,11 +98,11 @@ _fmpz_poly_mul_KS(fmpz * res, const fmpz * poly1, long len1,
     arr3 = (mp_limb_t *) flint_malloc((limbs1 + limbs2) * sizeof(mp_limb_t));
 
     if (limbs1 == limbs2)
-        mpn_mul_n(arr3, arr1, arr2, limbs1);
+        flint_mpn_mul_n(arr3, arr1, arr2, limbs1);
     else if (limbs1 > limbs2)
-        mpn_mul(arr3, arr1, limbs1, arr2, limbs2);
+        flint_mpn_mul(arr3, arr1, limbs1, arr2, limbs2);
     else
-        mpn_mul(arr3, arr2, limbs2, arr1, limbs1);
+        flint_mpn_mul(arr3, arr2, limbs2, arr1, limbs1);
 
     if (sign)
         _fmpz_poly_bit_unpack(res, len1 + len2 - 1, arr3, bits, neg1 ^ neg2);
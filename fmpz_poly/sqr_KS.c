@@ -30,6 +30,7 @@
 #include "fmpz.h"
 #include "fmpz_vec.h"
 #include "fmpz_poly.h"
+#include "mpn_extras.h"
 
 void
 _fmpz_poly_sqr_KS(fmpz *rop, const fmpz *op, long len)
@@ -68,7 +69,7 @@ _fmpz_poly_sqr_KS(fmpz *rop, const fmpz *op, long len)
 
     arr3 = (mp_limb_t *) flint_malloc((2 * limbs) * sizeof(mp_limb_t));
 
-    mpn_sqr(arr3, arr, limbs);
+    flint_mpn_sqr(arr3, arr, limbs);
 
     if (sign)
         _fmpz_poly_bit_unpack(rop, 2 * len - 1, arr3, bits, 0);
@@ -39,6 +39,8 @@
 #include "nmod_poly.h"
 #include "fmpz_poly.h"
 
+#define FMPZ_POLY_FACTOR_VAN_HOEIJ_BITS 20
+
 #ifdef __cplusplus
  extern "C" {
 #endif
@@ -66,6 +68,10 @@ void fmpz_poly_factor_print(const fmpz_poly_factor_t fac);
 void fmpz_poly_factor_zassenhaus_recombination(fmpz_poly_factor_t final_fac, 
 	const fmpz_poly_factor_t lifted_fac, 
     const fmpz_poly_t F, const fmpz_t P, long exp);
+
+int fmpz_poly_factor_van_hoeij(fmpz_poly_factor_t final_fac, 
+    const fmpz_poly_factor_t lifted_fac, 
+    const fmpz_poly_t f, const fmpz_t P, long exp);
     
 void fmpz_poly_factor_squarefree(fmpz_poly_factor_t fac, const fmpz_poly_t F);
 
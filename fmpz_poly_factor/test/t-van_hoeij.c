@@ -0,0 +1,149 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "fmpz_poly_factor.h"
+#include "arith.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    printf("van_hoeij....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* random squarefree products, recombining with lattices throughout */
+    for (i = 0; i < 300; i++)
+    {
+        fmpz_poly_t f, g, h;
+        fmpz_poly_factor_t fac;
+        long j, n = n_randint(state, 5) + 1;
+
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(h);
+        fmpz_poly_factor_init(fac);
+
+        fmpz_poly_set_ui(f, 1);
+        for (j = 0; j < n; j++)
+        {
+            do {
+                fmpz_poly_randtest(g, state, n_randint(state, 6) + 2, 
+                                             n_randint(state, 40) + 1);
+            } while (g->length < 2);
+
+            fmpz_poly_mul(f, f, g);
+        }
+
+        fmpz_poly_primitive_part(f, f);
+        fmpz_poly_derivative(g, f);
+        fmpz_poly_gcd(g, f, g);
+
+        if (fmpz_poly_degree(g) > 0 || fmpz_is_zero(f->coeffs))
+        {
+            fmpz_poly_clear(f);
+            fmpz_poly_clear(g);
+            fmpz_poly_clear(h);
+            fmpz_poly_factor_clear(fac);
+            continue;
+        }
+
+        _fmpz_poly_factor_zassenhaus(fac, 1, f, 0);
+
+        fmpz_poly_set_ui(h, 1);
+        for (j = 0; j < fac->num; j++)
+            fmpz_poly_mul(h, h, fac->p + j);
+        if (fmpz_sgn(fmpz_poly_lead(h)) != fmpz_sgn(fmpz_poly_lead(f)))
+            fmpz_poly_neg(h, h);
+
+        result = (fmpz_poly_equal(f, h) && fac->num >= n);
+        if (!result)
+        {
+            printf("FAIL (products):\n");
+            printf("n = %ld\n", n);
+            printf("f = "), fmpz_poly_print(f), printf("\n\n");
+            printf("fac = "), fmpz_poly_factor_print(fac), printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(h);
+        fmpz_poly_factor_clear(fac);
+    }
+
+    /* 
+       products of two Swinnerton-Dyer polynomials, which split into 
+       factors of degree at most 2 modulo every prime
+    */
+    for (i = 0; i < 4; i++)
+    {
+        fmpz_poly_t f, g, h;
+        fmpz_poly_factor_t fac;
+        long j, n = n_randint(state, 3) + 3;
+
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(h);
+        fmpz_poly_factor_init(fac);
+
+        arith_swinnerton_dyer_polynomial(f, n);
+        fmpz_poly_set_coeff_ui(h, 1, 1);
+        fmpz_poly_set_coeff_ui(h, 0, n_randint(state, 10) + 1);
+        fmpz_poly_compose(g, f, h);
+        fmpz_poly_mul(f, f, g);
+
+        fmpz_poly_factor_zassenhaus(fac, f);
+
+        fmpz_poly_set_fmpz(h, &fac->c);
+        for (j = 0; j < fac->num; j++)
+            fmpz_poly_mul(h, h, fac->p + j);
+
+        result = (fmpz_poly_equal(f, h) && fac->num == 2);
+        if (!result)
+        {
+            printf("FAIL (Swinnerton-Dyer):\n");
+            printf("n = %ld\n", n);
+            printf("fac = "), fmpz_poly_factor_print(fac), printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(h);
+        fmpz_poly_factor_clear(fac);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
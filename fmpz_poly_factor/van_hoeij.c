@@ -0,0 +1,347 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong /* prevent clash with standard library */
+#include <stdlib.h>
+#include <math.h>
+#define ulong unsigned long
+#include "fmpz_poly_factor.h"
+#include "fmpz_mat.h"
+
+#define VAN_HOEIJ_MAX_TRIES 8 /* LLL calls for one column */
+
+/*
+   Sets bits[j], for 0 <= j < n = deg(f), to an upper bound for the number
+   of bits of the coefficient of x^j in f h'/h for any factor h of f. 
+   This is the sum of f/(x - a) over the roots a of h, whose coefficients
+   can be bounded using the coefficients of f above or below x^j together
+   with upper and lower bounds for the absolute values of the roots.
+*/
+static void _fmpz_poly_factor_CLD_bits(long * bits, const fmpz_poly_t f)
+{
+    const long n = f->length - 1;
+    double * la, lR, lr, up, lo, t, ln;
+    long i, j, k, e;
+
+    la = flint_malloc((n + 1)*sizeof(double));
+
+    for (k = 0; k <= n; k++)
+    {
+        if (fmpz_is_zero(f->coeffs + k))
+            la[k] = -HUGE_VAL;
+        else
+        {
+            t = fmpz_get_d_2exp(&e, f->coeffs + k);
+            la[k] = log(fabs(t))/log(2.0) + e;
+        }
+    }
+
+    /* Fujiwara bounds for log2 |a| and log2 |1/a| over the roots a */
+    lR = lr = -HUGE_VAL;
+    for (i = 1; i <= n; i++)
+    {
+        lR = FLINT_MAX(lR, (la[n - i] - la[n])/i);
+        lr = FLINT_MAX(lr, (la[i] - la[0])/i);
+    }
+    lR += 1.0;
+    lr += 1.0;
+
+    ln = log((double) n)/log(2.0);
+
+    for (j = 0; j < n; j++)
+    {
+        up = lo = -HUGE_VAL;
+        for (k = j + 1; k <= n; k++)
+            up = FLINT_MAX(up, la[k] + (k - j - 1)*lR);
+        for (k = 0; k <= j; k++)
+            lo = FLINT_MAX(lo, la[k] + (j - k + 1)*lr);
+
+        /* n terms in each sum, n roots, and one bit to spare */
+        bits[j] = (long) ceil(FLINT_MIN(up, lo) + 2*ln + 1.0);
+        bits[j] = FLINT_MAX(bits[j], 1);
+    }
+
+    flint_free(la);
+}
+
+/* squared Gram-Schmidt norms of the rows of M, in double precision */
+static void _fmpz_mat_gso_norms_d(double * rr, const fmpz_mat_t M)
+{
+    const long d = M->r, n = M->c;
+    double * mu = flint_malloc(d*d*sizeof(double)), s;
+    fmpz_t t;
+    long i, j, k;
+
+    fmpz_init(t);
+
+    for (i = 0; i < d; i++)
+    {
+        for (j = 0; j <= i; j++)
+        {
+            fmpz_zero(t);
+            for (k = 0; k < n; k++)
+                fmpz_addmul(t, M->rows[i] + k, M->rows[j] + k);
+            s = fmpz_get_d(t);
+
+            for (k = 0; k < j; k++)
+                s -= mu[j*d + k]*mu[i*d + k]*rr[k];
+
+            if (j < i)
+                mu[i*d + j] = s/rr[j];
+            else
+                rr[i] = s;
+        }
+    }
+
+    fmpz_clear(t);
+    flint_free(mu);
+}
+
+/*
+   If the first r = lifted_fac->num columns of the r' rows of U take 
+   exactly r' distinct values, tries the corresponding partition of the 
+   local factors. Returns 1 and inserts the factors into final_fac if 
+   each class gives a factor of f.
+*/
+static int _fmpz_poly_factor_van_hoeij_check(fmpz_poly_factor_t final_fac,
+    const fmpz_mat_t U, const fmpz_poly_factor_t lifted_fac, 
+    const fmpz_poly_t f, const fmpz_t P, long exp)
+{
+    const long r = lifted_fac->num, rows = U->r;
+    long * cls, i, j, k, num = 0;
+    fmpz_poly_factor_t fac;
+    fmpz_poly_t g, Q, R, rem;
+    int ok = 1;
+
+    cls = flint_malloc(r*sizeof(long));
+
+    for (i = 0; i < r && num <= rows; i++)
+    {
+        for (j = 0; j < i; j++)
+        {
+            for (k = 0; k < rows; k++)
+                if (!fmpz_equal(U->rows[k] + i, U->rows[k] + j))
+                    break;
+            if (k == rows)
+                break;
+        }
+
+        cls[i] = (j < i) ? cls[j] : num++;
+    }
+
+    if (num != rows)
+    {
+        flint_free(cls);
+        return 0;
+    }
+
+    fmpz_poly_factor_init(fac);
+    fmpz_poly_init(g);
+    fmpz_poly_init(Q);
+    fmpz_poly_init(R);
+    fmpz_poly_init(rem);
+    fmpz_poly_set(rem, f);
+
+    for (k = 0; k < num && ok; k++)
+    {
+        if (k == num - 1)
+            fmpz_poly_set(g, rem);
+        else
+        {
+            fmpz_poly_set_fmpz(g, fmpz_poly_lead(f));
+            for (i = 0; i < r; i++)
+                if (cls[i] == k)
+                    fmpz_poly_mul(g, g, lifted_fac->p + i);
+
+            fmpz_poly_scalar_smod_fmpz(g, g, P);
+            fmpz_poly_primitive_part(g, g);
+
+            fmpz_poly_divrem(Q, R, rem, g);
+            ok = fmpz_poly_is_zero(R);
+            fmpz_poly_swap(rem, Q);
+        }
+
+        if (ok)
+            fmpz_poly_factor_insert(fac, g, exp);
+    }
+
+    if (ok)
+        fmpz_poly_factor_concat(final_fac, fac);
+
+    fmpz_poly_factor_clear(fac);
+    fmpz_poly_clear(g);
+    fmpz_poly_clear(Q);
+    fmpz_poly_clear(R);
+    fmpz_poly_clear(rem);
+    flint_free(cls);
+
+    return ok;
+}
+
+int fmpz_poly_factor_van_hoeij(fmpz_poly_factor_t final_fac, 
+    const fmpz_poly_factor_t lifted_fac, 
+    const fmpz_poly_t f, const fmpz_t P, long exp)
+{
+    const long r = lifted_fac->num, n = f->length - 1;
+    const long Pbits = fmpz_bits(P);
+    long * bits, * order, i, j, k, c, rows, T = 0, Tmax, tries;
+    fmpz ** cld, * col;
+    fmpz_mat_t L, M;
+    fmpz_poly_t q, t, dg;
+    fmpz_t s, half;
+    double * rr, bound;
+    int found = 0;
+
+    bits  = flint_malloc(n*sizeof(long));
+    order = flint_malloc(n*sizeof(long));
+    cld   = flint_malloc(r*sizeof(fmpz *));
+    rr    = flint_malloc((r + 1)*sizeof(double));
+    col   = _fmpz_vec_init(r);
+
+    fmpz_poly_init(q);
+    fmpz_poly_init(t);
+    fmpz_poly_init(dg);
+    fmpz_init(s);
+    fmpz_init(half);
+    fmpz_fdiv_q_2exp(half, P, 1);
+
+    _fmpz_poly_factor_CLD_bits(bits, f);
+
+    /* the coefficients of f g_i'/g_i modulo P for the local factors g_i */
+    for (i = 0; i < r; i++)
+    {
+        cld[i] = _fmpz_vec_init(n);
+
+        fmpz_poly_div(q, f, lifted_fac->p + i);
+        fmpz_poly_scalar_smod_fmpz(q, q, P);
+        fmpz_poly_derivative(dg, lifted_fac->p + i);
+        fmpz_poly_mul(t, q, dg);
+        fmpz_poly_scalar_smod_fmpz(t, t, P);
+
+        _fmpz_vec_set(cld[i], t->coeffs, FLINT_MIN(t->length, n));
+    }
+
+    /* use the coefficients with the smallest bounds first */
+    for (j = 0; j < n; j++)
+    {
+        for (k = j; k > 0 && bits[order[k - 1]] > bits[j]; k--)
+            order[k] = order[k - 1];
+        order[k] = j;
+    }
+
+    /* 
+       The knapsack lattice starts out as Z^r; each step appends a column 
+       with the coefficient of x^j of f g_i'/g_i for each local factor g_i 
+       modulo P, scaled to T bits, so that for a vector with 0/1 entries 
+       corresponding to a true factor the new entry is small
+    */
+    fmpz_mat_init(L, r, r);
+    fmpz_mat_one(L);
+    rows = r;
+
+    for (c = 0, tries = 0; c < n && !found; )
+    {
+        j = order[c];
+
+        Tmax = FLINT_MIN(Pbits - bits[j] - 1, r + FMPZ_POLY_FACTOR_VAN_HOEIJ_BITS);
+        if (Tmax < 4)
+            break;
+        if (tries == 0)
+            T = Tmax;
+
+        for (i = 0; i < r; i++)
+        {
+            fmpz_mul_2exp(s, cld[i] + j, T);
+            fmpz_add(s, s, half);
+            fmpz_fdiv_q(col + i, s, P);
+        }
+
+        fmpz_mat_init(M, rows + 1, L->c + 1);
+
+        for (k = 0; k < rows; k++)
+        {
+            _fmpz_vec_set(M->rows[k], L->rows[k], L->c);
+            for (i = 0; i < r; i++)
+                fmpz_addmul(M->rows[k] + L->c, L->rows[k] + i, col + i);
+        }
+        fmpz_one(fmpz_mat_entry(M, rows, L->c));
+        fmpz_mul_2exp(fmpz_mat_entry(M, rows, L->c), 
+                      fmpz_mat_entry(M, rows, L->c), T);
+
+        /*
+           If double precision does not suffice, feed the column in 
+           gradually, starting with fewer bits
+        */
+        if (!fmpz_mat_lll_d(M, 0.99, 0.51, 0))
+        {
+            fmpz_mat_clear(M);
+            T /= 2;
+            if (T < 4 || ++tries > VAN_HOEIJ_MAX_TRIES)
+                c++, tries = 0;
+            continue;
+        }
+
+        /* 
+           vectors for true factors have 0/1 entries in the first r 
+           places and entries of at most (r + 1)/2 in the others
+        */
+        bound = r + (M->c - r)*(r + 1.0)*(r + 1.0)/4.0;
+        rr = flint_realloc(rr, (rows + 1)*sizeof(double));
+        _fmpz_mat_gso_norms_d(rr, M);
+        for (k = rows + 1; k > 1 && rr[k - 1] > bound; k--) ;
+
+        fmpz_mat_clear(L);
+        fmpz_mat_init(L, k, M->c);
+        for (i = 0; i < k; i++)
+            _fmpz_vec_set(L->rows[i], M->rows[i], M->c);
+        rows = k;
+
+        fmpz_mat_clear(M);
+
+        found = _fmpz_poly_factor_van_hoeij_check(final_fac, L, 
+                                                  lifted_fac, f, P, exp);
+
+        if (T == Tmax || ++tries > VAN_HOEIJ_MAX_TRIES)
+            c++, tries = 0;
+        else
+            T = FLINT_MIN(2*T, Tmax);
+    }
+
+    for (i = 0; i < r; i++)
+        _fmpz_vec_clear(cld[i], n);
+    flint_free(cld);
+    flint_free(bits);
+    flint_free(order);
+    flint_free(rr);
+    _fmpz_vec_clear(col, r);
+    fmpz_mat_clear(L);
+    fmpz_poly_clear(q);
+    fmpz_poly_clear(t);
+    fmpz_poly_clear(dg);
+    fmpz_clear(s);
+    fmpz_clear(half);
+
+    return found;
+}
@@ -168,13 +168,7 @@ void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac,
         nmod_poly_clear(g);
         nmod_poly_clear(t);
 
-        if (r > cutoff)
-        {
-            printf("Exception (fmpz_poly_factor_zassenhaus). r > cutoff.\n");
-            nmod_poly_factor_clear(fac);
-            abort();
-        }
-        else if (r == 1)
+        if (r == 1)
         {
             fmpz_poly_factor_insert(final_fac, f, exp);
         }
@@ -191,6 +185,17 @@ void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac,
                 fmpz_poly_factor_mignotte(B, f);
                 fmpz_mul_ui(B, B, 2);
                 fmpz_add_ui(B, B, 1);
+
+                /*
+                   The lattice method needs room above the bounds 
+                   for the coefficients of f g'/g in P
+                */
+                if (r > cutoff)
+                {
+                    fmpz_mul(B, B, B);
+                    fmpz_mul_2exp(B, B, r + FMPZ_POLY_FACTOR_VAN_HOEIJ_BITS);
+                }
+
                 a = fmpz_clog_ui(B, p);
                 fmpz_clear(B);
             }
@@ -213,7 +218,10 @@ void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac,
                 fmpz_set_ui(P, p);
                 fmpz_pow_ui(P, P, a);
 
-                fmpz_poly_factor_zassenhaus_recombination(final_fac, lifted_fac, f, P, exp);
+                if (r <= cutoff || !fmpz_poly_factor_van_hoeij(final_fac, 
+                                                      lifted_fac, f, P, exp))
+                    fmpz_poly_factor_zassenhaus_recombination(final_fac, 
+                                                      lifted_fac, f, P, exp);
 
                 fmpz_clear(P);
             }
@@ -53,6 +53,11 @@ fq_ctx_struct;
 
 typedef fq_ctx_struct fq_ctx_t[1];
 
+int _fq_conway_polynomial(mp_ptr rop, ulong p, long d);
+
+int _fq_ctx_init_conway(fq_ctx_t ctx,
+                        const fmpz_t p, long d, const char *var);
+
 void fq_ctx_init_conway(fq_ctx_t ctx,
                         const fmpz_t p, long d, const char *var);
 
@@ -0,0 +1,78 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq.h"
+#include "CPimport.h"
+
+int _fq_conway_polynomial(mp_ptr rop, ulong p, long d)
+{
+    long lo, hi, mid, i, k;
+
+    if (d < 1 || p > conway_primes[CONWAY_NUM_PRIMES - 1])
+        return 0;
+
+    /* Find the prime */
+    lo = 0;
+    hi = CONWAY_NUM_PRIMES - 1;
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (conway_primes[mid] < p)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if (conway_primes[lo] != p)
+        return 0;
+
+    k = lo;
+
+    /* Find the degree among the polynomials for p */
+    lo = conway_start[k];
+    hi = conway_start[k + 1] - 1;
+    while (lo < hi)
+    {
+        mid = (lo + hi) / 2;
+        if (conway_degrees[mid] < d)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if (conway_degrees[lo] != d)
+        return 0;
+
+    if (p < 65536UL)
+        for (i = 0; i < d; i++)
+            rop[i] = conway_coeffs16[conway_offsets[lo] + i];
+    else
+        for (i = 0; i < d; i++)
+            rop[i] = conway_coeffs32[conway_offsets[lo] + i];
+
+    rop[d] = 1UL;
+
+    return 1;
+}
@@ -0,0 +1,115 @@
+#!/bin/sh
+#
+# Generates fq/CPimport.h from Frank Luebeck's data base of Conway
+# polynomials in fq/CP.txt.  Each line of the input holds a prime p,
+# a degree d and the d + 1 coefficients of the polynomial in order of
+# increasing degree.  Run as "make cpimport" from the top level, or as
+#
+#    sh fq/make_CPimport.sh < fq/CP.txt > fq/CPimport.h
+#
+
+cat <<'HEADER'
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#ifndef FQ_CPIMPORT_H
+#define FQ_CPIMPORT_H
+
+/*
+    Frank Luebeck's data base of Conway polynomials, as in fq/CP.txt, in
+    a compact indexed form.  The primes are sorted; the polynomials for
+    the prime conway_primes[k] are the entries conway_start[k] up to
+    conway_start[k + 1] - 1, sorted by their degree conway_degrees[i].
+    The d non-leading coefficients of entry i, in order of increasing
+    degree, are found at conway_offsets[i] in conway_coeffs16 for primes less
+    than 2^16 and in conway_coeffs32 otherwise.
+
+    This file is generated from fq/CP.txt by fq/make_CPimport.sh; do not
+    edit it by hand.
+ */
+
+HEADER
+
+awk '
+function emit(type, name, a, n,    i, line, s)
+{
+    printf "static const %s %s[%d] =\n{\n", type, name, n
+    line = "   "
+    for (i = 0; i < n; i++)
+    {
+        s = " " a[i] (i < n - 1 ? "," : "")
+        if (length(line) + length(s) > 78)
+        {
+            print line
+            line = "   "
+        }
+        line = line s
+    }
+    print line
+    print "};\n"
+}
+
+BEGIN { np = n = n16 = n32 = 0 }
+
+NF > 0 {
+    p = $1; d = $2
+    if (NF != d + 3 || $NF != 1)
+    {
+        print "make_CPimport.sh: bad line " NR > "/dev/stderr"
+        exit 1
+    }
+    if (np == 0 || primes[np - 1] != p)
+    {
+        primes[np] = p
+        start[np++] = n
+    }
+    degs[n] = d
+    if (p < 65536)
+    {
+        offs[n++] = n16
+        for (i = 3; i < NF; i++)
+            c16[n16++] = $i
+    }
+    else
+    {
+        offs[n++] = n32
+        for (i = 3; i < NF; i++)
+            c32[n32++] = $i
+    }
+}
+
+END {
+    start[np] = n
+    printf "#define CONWAY_NUM_PRIMES %d\n", np
+    printf "#define CONWAY_NUM_POLYS  %d\n\n", n
+    emit("unsigned int", "conway_primes", primes, np)
+    emit("unsigned int", "conway_start", start, np + 1)
+    emit("unsigned short", "conway_degrees", degs, n)
+    emit("unsigned int", "conway_offsets", offs, n)
+    emit("unsigned short", "conway_coeffs16", c16, n16)
+    emit("unsigned int", "conway_coeffs32", c32, n32)
+    print "#endif"
+}
+'
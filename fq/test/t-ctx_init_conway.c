@@ -0,0 +1,124 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq.h"
+#include "fmpz_mod_poly.h"
+#include "fmpz_mod_poly_factor.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    printf("ctx_init_conway... ");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* Check that the polynomials found are monic and irreducible */
+    for (i = 0; i < 1000; i++)
+    {
+        fmpz_t p;
+        long d, k;
+        fq_ctx_t ctx;
+        fmpz_mod_poly_t f;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 16), 1));
+        d = n_randint(state, 12) + 1;
+
+        if (_fq_ctx_init_conway(ctx, p, d, "a"))
+        {
+            fmpz_mod_poly_init(f, p);
+            for (k = 0; k < ctx->len; k++)
+                fmpz_mod_poly_set_coeff_fmpz(f, ctx->j[k], ctx->a + k);
+
+            result = (fq_ctx_degree(ctx) == d
+                      && fmpz_is_one(ctx->a + ctx->len - 1)
+                      && fmpz_mod_poly_is_irreducible(f));
+            if (!result)
+            {
+                printf("FAIL:\n\n");
+                printf("p = "), fmpz_print(p), printf("\n");
+                printf("d = %ld\n", d);
+                printf("f = "), fmpz_mod_poly_print(f), printf("\n");
+                abort();
+            }
+
+            fmpz_mod_poly_clear(f);
+            fq_ctx_clear(ctx);
+        }
+
+        fmpz_clear(p);
+    }
+
+    /* Check some pairs that are and are not present */
+    {
+        const ulong P[7] = {2UL, 2UL, 3UL, 65537UL, 65537UL, 4UL, 109997UL};
+        const long D[7]  = {409, 410, 263, 4, 2, 1, 1};
+        const int  R[7]  = {1, 0, 1, 1, 0, 0, 0};
+        fmpz_t p;
+        fq_ctx_t ctx;
+
+        fmpz_init(p);
+        for (i = 0; i < 7; i++)
+        {
+            int found;
+
+            fmpz_set_ui(p, P[i]);
+            found = _fq_ctx_init_conway(ctx, p, D[i], "a");
+
+            result = (found == R[i]);
+            if (!result)
+            {
+                printf("FAIL (presence):\n\n");
+                printf("(p,d) = (%lu,%ld), found = %d\n", P[i], D[i], found);
+                abort();
+            }
+
+            if (found)
+                fq_ctx_clear(ctx);
+        }
+
+        fmpz_neg(p, p);
+        result = !_fq_ctx_init_conway(ctx, p, 1, "a");
+        if (!result)
+        {
+            printf("FAIL (negative p):\n\n");
+            abort();
+        }
+        fmpz_clear(p);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,280 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#ifndef FQ_NMOD_H
+#define FQ_NMOD_H
+
+#undef ulong                /* interferes with system includes */
+#include <stdlib.h>
+#include <stdio.h>
+#define ulong unsigned long
+
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+/* Data types and context ****************************************************/
+
+typedef nmod_poly_t fq_nmod_t;
+typedef nmod_poly_struct fq_nmod_struct;
+
+typedef struct
+{
+    fmpz p;
+    nmod_t mod;
+
+    mp_limb_t *a;
+    long *j;
+    long len;
+
+    char *var;
+}
+fq_nmod_ctx_struct;
+
+typedef fq_nmod_ctx_struct fq_nmod_ctx_t[1];
+
+int _fq_nmod_ctx_init_conway(fq_nmod_ctx_t ctx,
+                             const fmpz_t p, long d, const char *var);
+
+void fq_nmod_ctx_init_conway(fq_nmod_ctx_t ctx,
+                             const fmpz_t p, long d, const char *var);
+
+void fq_nmod_ctx_clear(fq_nmod_ctx_t ctx);
+
+static __inline__ long fq_nmod_ctx_degree(const fq_nmod_ctx_t ctx)
+{
+    return ctx->j[ctx->len - 1];
+}
+
+#define fq_nmod_ctx_prime(ctx)  (&((ctx)->p))
+
+static __inline__ void fq_nmod_ctx_print(const fq_nmod_ctx_t ctx)
+{
+    long i, k;
+
+    printf("p = "), fmpz_print(fq_nmod_ctx_prime(ctx)), printf("\n");
+    printf("d = %ld\n", ctx->j[ctx->len - 1]);
+    printf("f(X) = ");
+    printf("%lu", ctx->a[0]);
+    for (k = 1; k < ctx->len; k++)
+    {
+        i = ctx->j[k];
+        printf(" + ");
+        if (ctx->a[k] == 1UL)
+        {
+            if (i == 1)
+                printf("X");
+            else
+                printf("X^%ld", i);
+        }
+        else
+        {
+            printf("%lu", ctx->a[k]);
+            if (i == 1)
+                printf("*X");
+            else
+                printf("*X^%ld", i);
+        }
+    }
+    printf("\n");
+}
+
+/* Memory managment  *********************************************************/
+
+static __inline__ void fq_nmod_init(fq_nmod_t rop, const fq_nmod_ctx_t ctx)
+{
+    nmod_poly_init_preinv(rop, ctx->mod.n, ctx->mod.ninv);
+}
+
+static __inline__ void fq_nmod_init2(fq_nmod_t rop, const fq_nmod_ctx_t ctx)
+{
+    nmod_poly_init2_preinv(rop, ctx->mod.n, ctx->mod.ninv,
+                           fq_nmod_ctx_degree(ctx));
+}
+
+static __inline__ void fq_nmod_clear(fq_nmod_t rop, const fq_nmod_ctx_t ctx)
+{
+    nmod_poly_clear(rop);
+}
+
+/*
+    Reduces (R, lenR) in place modulo the sparse polynomial given by
+    (a, j, len), leaving the remainder in the first d coefficients.
+    The coefficients of R are assumed to be reduced modulo p.
+ */
+
+static __inline__
+void _fq_nmod_reduce(mp_ptr R, long lenR,
+                     const mp_limb_t *a, const long *j, long len, nmod_t mod)
+{
+    const long d = j[len - 1];
+
+    if (lenR > d)
+    {
+        long i, k;
+
+        for (i = lenR - 1; i >= d; i--)
+        {
+            if (R[i] == 0UL)
+                continue;
+
+            for (k = len - 2; k >= 0; k--)
+            {
+                R[j[k] + i - d] = nmod_sub(R[j[k] + i - d],
+                                           nmod_mul(R[i], a[k], mod), mod);
+            }
+            R[i] = 0UL;
+        }
+    }
+}
+
+static __inline__ void fq_nmod_reduce(fq_nmod_t rop, const fq_nmod_ctx_t ctx)
+{
+    _fq_nmod_reduce(rop->coeffs, rop->length,
+                    ctx->a, ctx->j, ctx->len, ctx->mod);
+    rop->length = FLINT_MIN(rop->length, fq_nmod_ctx_degree(ctx));
+    _nmod_poly_normalise(rop);
+}
+
+/* Basic arithmetic **********************************************************/
+
+void fq_nmod_add(fq_nmod_t rop, const fq_nmod_t op1, const fq_nmod_t op2,
+                 const fq_nmod_ctx_t ctx);
+
+void fq_nmod_sub(fq_nmod_t rop, const fq_nmod_t op1, const fq_nmod_t op2,
+                 const fq_nmod_ctx_t ctx);
+
+void fq_nmod_neg(fq_nmod_t rop, const fq_nmod_t op1, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_mul(fq_nmod_t rop, const fq_nmod_t op1, const fq_nmod_t op2,
+                 const fq_nmod_ctx_t ctx);
+
+void fq_nmod_mul_fmpz(fq_nmod_t rop, const fq_nmod_t op, const fmpz_t x,
+                      const fq_nmod_ctx_t ctx);
+
+void fq_nmod_mul_si(fq_nmod_t rop, const fq_nmod_t op, long x,
+                    const fq_nmod_ctx_t ctx);
+
+void fq_nmod_mul_ui(fq_nmod_t rop, const fq_nmod_t op, ulong x,
+                    const fq_nmod_ctx_t ctx);
+
+void fq_nmod_sqr(fq_nmod_t rop, const fq_nmod_t op, const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_inv(mp_ptr rop, mp_srcptr op, long len,
+                  const mp_limb_t *a, const long *j, long lena, nmod_t mod);
+
+void fq_nmod_inv(fq_nmod_t rop, const fq_nmod_t op1, const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_pow(mp_ptr rop, mp_srcptr op, long len, const fmpz_t e,
+                  const mp_limb_t *a, const long *j, long lena, nmod_t mod);
+
+void fq_nmod_pow(fq_nmod_t rop, const fq_nmod_t op1, const fmpz_t e,
+                 const fq_nmod_ctx_t ctx);
+
+/* Randomisation *************************************************************/
+
+void fq_nmod_randtest(fq_nmod_t rop, flint_rand_t state,
+                      const fq_nmod_ctx_t ctx);
+
+void fq_nmod_randtest_not_zero(fq_nmod_t rop, flint_rand_t state,
+                               const fq_nmod_ctx_t ctx);
+
+/* Comparison ****************************************************************/
+
+static __inline__
+int fq_nmod_equal(const fq_nmod_t op1, const fq_nmod_t op2,
+                  const fq_nmod_ctx_t ctx)
+{
+    return nmod_poly_equal(op1, op2);
+}
+
+static __inline__
+int fq_nmod_is_zero(const fq_nmod_t op, const fq_nmod_ctx_t ctx)
+{
+    return nmod_poly_is_zero(op);
+}
+
+static __inline__
+int fq_nmod_is_one(const fq_nmod_t op, const fq_nmod_ctx_t ctx)
+{
+    return nmod_poly_is_one(op);
+}
+
+/* Assignments and conversions ***********************************************/
+
+static __inline__
+void fq_nmod_set(fq_nmod_t rop, const fq_nmod_t op, const fq_nmod_ctx_t ctx)
+{
+    nmod_poly_set(rop, op);
+}
+
+static __inline__
+void fq_nmod_swap(fq_nmod_t op1, fq_nmod_t op2, const fq_nmod_ctx_t ctx)
+{
+    nmod_poly_swap(op1, op2);
+}
+
+static __inline__ void fq_nmod_zero(fq_nmod_t rop, const fq_nmod_ctx_t ctx)
+{
+    nmod_poly_zero(rop);
+}
+
+static __inline__ void fq_nmod_one(fq_nmod_t rop, const fq_nmod_ctx_t ctx)
+{
+    nmod_poly_one(rop);
+}
+
+/* Output ********************************************************************/
+
+int fq_nmod_fprint_pretty(FILE * file, const fq_nmod_t op,
+                          const fq_nmod_ctx_t ctx);
+
+static __inline__
+int fq_nmod_print_pretty(const fq_nmod_t op, const fq_nmod_ctx_t ctx)
+{
+    return fq_nmod_fprint_pretty(stdout, op, ctx);
+}
+
+/* Special functions *********************************************************/
+
+void _fq_nmod_trace(fmpz_t rop, mp_srcptr op, long len,
+                    const mp_limb_t *a, const long *j, long lena, nmod_t mod);
+
+void fq_nmod_trace(fmpz_t rop, const fq_nmod_t op, const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_frobenius(mp_ptr rop, mp_srcptr op, long len, long e,
+                        const mp_limb_t *a, const long *j, long lena,
+                        nmod_t mod);
+
+void fq_nmod_frobenius(fq_nmod_t rop, const fq_nmod_t op, long e,
+                       const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_norm(fmpz_t rop, mp_srcptr op, long len,
+                   const mp_limb_t *a, const long *j, long lena, nmod_t mod);
+
+void fq_nmod_norm(fmpz_t rop, const fq_nmod_t op, const fq_nmod_ctx_t ctx);
+
+#endif
+
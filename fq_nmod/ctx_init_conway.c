@@ -0,0 +1,88 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <string.h>
+
+#include "fq.h"
+#include "fq_nmod.h"
+
+int _fq_nmod_ctx_init_conway(fq_nmod_ctx_t ctx,
+                             const fmpz_t p, long d, const char *var)
+{
+    long i, j;
+    mp_ptr c;
+
+    if (!fmpz_abs_fits_ui(p) || fmpz_sgn(p) <= 0)
+        return 0;
+
+    c = _nmod_vec_init(d + 1);
+
+    if (!_fq_conway_polynomial(c, fmpz_get_ui(p), d))
+    {
+        _nmod_vec_clear(c);
+        return 0;
+    }
+
+    fmpz_init_set(fq_nmod_ctx_prime(ctx), p);
+    nmod_init(&(ctx->mod), fmpz_get_ui(p));
+
+    /* Find number of non-zero coefficients */
+    ctx->len = 1;
+    for (i = 0; i < d; i++)
+        if (c[i])
+            ctx->len ++;
+
+    ctx->a = _nmod_vec_init(ctx->len);
+    ctx->j = flint_malloc(ctx->len * sizeof(long));
+
+    /* Copy the polynomial */
+    for (i = 0, j = 0; i <= d; i++)
+    {
+        if (c[i])
+        {
+            ctx->a[j] = c[i];
+            ctx->j[j] = i;
+            j++;
+        }
+    }
+
+    ctx->var = flint_malloc(strlen(var) + 1);
+    strcpy(ctx->var, var);
+
+    _nmod_vec_clear(c);
+    return 1;
+}
+
+void fq_nmod_ctx_init_conway(fq_nmod_ctx_t ctx,
+                             const fmpz_t p, long d, const char *var)
+{
+    if (!_fq_nmod_ctx_init_conway(ctx, p, d, var))
+    {
+        printf("Exception (fq_nmod_ctx_init_conway).  The polynomial for \n");
+        printf("(p,d) = ("), fmpz_print(p);
+        printf(",%ld) is not present in the database.\n", d);
+        abort();
+    }
+}
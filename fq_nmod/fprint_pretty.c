@@ -0,0 +1,69 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_nmod.h"
+
+int fq_nmod_fprint_pretty(FILE * file, const fq_nmod_t op,
+                          const fq_nmod_ctx_t ctx)
+{
+    const mp_limb_t *c = op->coeffs;
+    const char *x = ctx->var;
+    long i;
+    int first = 1, r = 1;
+
+    if (op->length == 0)
+    {
+        r = fputc('0', file);
+        return (r != EOF) ? 1 : EOF;
+    }
+
+    for (i = op->length - 1; (r > 0) && (i >= 0); i--)
+    {
+        if (c[i] == 0UL)
+            continue;
+
+        if (!first)
+        {
+            r = fputc('+', file);
+            r = (r != EOF) ? 1 : EOF;
+            if (r <= 0)
+                break;
+        }
+        first = 0;
+
+        if (i == 0)
+            r = fprintf(file, "%lu", c[i]);
+        else if (c[i] == 1UL && i == 1)
+            r = fprintf(file, "%s", x);
+        else if (c[i] == 1UL)
+            r = fprintf(file, "%s^%ld", x, i);
+        else if (i == 1)
+            r = fprintf(file, "%lu*%s", c[i], x);
+        else
+            r = fprintf(file, "%lu*%s^%ld", c[i], x, i);
+    }
+
+    return r;
+}
@@ -0,0 +1,99 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_nmod.h"
+
+/*
+    Sets (rop, 2d-1) to the image of (op, len) under the Frobenius operator
+    raised to the e-th power, assuming that neither op nor e are zero.
+ */
+
+void _fq_nmod_frobenius(mp_ptr rop, mp_srcptr op, long len, long e,
+                        const mp_limb_t *a, const long *j, long lena,
+                        nmod_t mod)
+{
+    const long d = j[lena - 1];
+
+    if (len == 1)  /* op is in Fp, not just Fq */
+    {
+        _nmod_vec_set(rop, op, len);
+        _nmod_vec_zero(rop + len, (2*d - 1)  - len);
+    }
+    else
+    {
+        fmpz_t t;
+
+        fmpz_init(t);
+        fmpz_set_ui(t, mod.n);
+        fmpz_pow_ui(t, t, e);
+        _fq_nmod_pow(rop, op, len, t, a, j, lena, mod);
+        fmpz_clear(t);
+    }
+}
+
+void fq_nmod_frobenius(fq_nmod_t rop, const fq_nmod_t op, long e,
+                       const fq_nmod_ctx_t ctx)
+{
+    const long d = fq_nmod_ctx_degree(ctx);
+
+    e = e % d;
+    if (e < 0)
+        e += d;
+
+    if (fq_nmod_is_zero(op, ctx))
+    {
+        fq_nmod_zero(rop, ctx);
+    }
+    else if (e == 0)
+    {
+        fq_nmod_set(rop, op, ctx);
+    }
+    else
+    {
+        mp_ptr t;
+
+        if (rop == op)
+        {
+            t = _nmod_vec_init(2 * d - 1);
+        }
+        else
+        {
+            nmod_poly_fit_length(rop, 2 * d - 1);
+            t = rop->coeffs;
+        }
+
+        _fq_nmod_frobenius(t, op->coeffs, op->length, e,
+                           ctx->a, ctx->j, ctx->len, ctx->mod);
+
+        if (rop == op)
+        {
+            _nmod_vec_clear(rop->coeffs);
+            rop->coeffs = t;
+            rop->alloc  = 2 * d - 1;
+        }
+        rop->length = d;
+        _nmod_poly_normalise(rop);
+    }
+}
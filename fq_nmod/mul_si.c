@@ -0,0 +1,44 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_nmod.h"
+
+void fq_nmod_mul_si(fq_nmod_t rop, const fq_nmod_t op, long x,
+                    const fq_nmod_ctx_t ctx)
+{
+    mp_limb_t c;
+
+    if (x >= 0)
+    {
+        NMOD_RED(c, (mp_limb_t) x, ctx->mod);
+    }
+    else
+    {
+        NMOD_RED(c, - (mp_limb_t) x, ctx->mod);
+        c = nmod_neg(c, ctx->mod);
+    }
+
+    nmod_poly_scalar_mul_nmod(rop, op, c);
+}
@@ -0,0 +1,85 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_nmod.h"
+
+/*
+    Computes the norm on $\mathbf{F}_q$ as the resultant of the
+    defining polynomial and the representative of the element,
+    rather than via a determinant as in the \code{fq} module.
+ */
+
+void _fq_nmod_norm(fmpz_t rop, mp_srcptr op, long len,
+                   const mp_limb_t *a, const long *j, long lena, nmod_t mod)
+{
+    const long d = j[lena - 1];
+
+    mp_limb_t r;
+
+    if (len == 1)
+    {
+        r = n_powmod2_ui_preinv(op[0], d, mod.n, mod.ninv);
+    }
+    else
+    {
+        mp_ptr f;
+        long k;
+
+        f = _nmod_vec_init(d + 1);
+        _nmod_vec_zero(f, d + 1);
+        for (k = 0; k < lena; k++)
+            f[j[k]] = a[k];
+
+        r = _nmod_poly_resultant(f, d + 1, op, len, mod);
+
+        /*
+            XXX:  This part of the code is currently untested as the Conway
+            polynomials used for the extension Fq/Fp are monic.
+         */
+        if (f[d] != 1UL)
+        {
+            mp_limb_t s = n_powmod2_ui_preinv(f[d], len - 1, mod.n, mod.ninv);
+
+            r = nmod_mul(r, n_invmod(s, mod.n), mod);
+        }
+
+        _nmod_vec_clear(f);
+    }
+
+    fmpz_set_ui(rop, r);
+}
+
+void fq_nmod_norm(fmpz_t rop, const fq_nmod_t op, const fq_nmod_ctx_t ctx)
+{
+    if (fq_nmod_is_zero(op, ctx))
+    {
+        fmpz_zero(rop);
+    }
+    else
+    {
+        _fq_nmod_norm(rop, op->coeffs, op->length,
+                      ctx->a, ctx->j, ctx->len, ctx->mod);
+    }
+}
@@ -0,0 +1,171 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_nmod.h"
+
+void _fq_nmod_pow(mp_ptr rop, mp_srcptr op, long len, const fmpz_t e,
+                  const mp_limb_t *a, const long *j, long lena, nmod_t mod)
+{
+    const long d = j[lena - 1];
+
+    if (fmpz_is_zero(e))
+    {
+        rop[0] = 1UL;
+        _nmod_vec_zero(rop + 1, 2 * d - 1 - 1);
+    }
+    else if (fmpz_is_one(e))
+    {
+        _nmod_vec_set(rop, op, len);
+        _nmod_vec_zero(rop + len, 2 * d - 1 - len);
+    }
+    else
+    {
+        ulong bit;
+        mp_ptr v = _nmod_vec_init(2 * d - 1);
+        mp_ptr R, S, T;
+
+        _nmod_vec_zero(v, 2 * d - 1);
+        _nmod_vec_zero(rop, 2 * d - 1);
+
+        /*
+           Set bits to the bitmask with a 1 one place lower than the msb of e
+         */
+
+        bit = fmpz_bits(e) - 2;
+
+        /*
+           Trial run without any polynomial arithmetic to determine the parity
+           of the number of swaps;  then set R and S accordingly
+         */
+
+        {
+            unsigned int swaps = 0U;
+            ulong bit2 = bit;
+            if (fmpz_tstbit(e, bit2))
+                swaps = ~swaps;
+            while (bit2--)
+                if (!fmpz_tstbit(e, bit2))
+                    swaps = ~swaps;
+
+            if (swaps == 0U)
+            {
+                R = rop;
+                S = v;
+            }
+            else
+            {
+                R = v;
+                S = rop;
+            }
+        }
+
+        /*
+           We unroll the first step of the loop, referring to {op, len}
+         */
+
+        _nmod_poly_mul(R, op, len, op, len, mod);
+        _fq_nmod_reduce(R, 2 * len - 1, a, j, lena, mod);
+
+        if (fmpz_tstbit(e, bit))
+        {
+            _nmod_poly_mul(S, R, d, op, len, mod);
+            _fq_nmod_reduce(S, d + len - 1, a, j, lena, mod);
+            T = R;
+            R = S;
+            S = T;
+        }
+
+        while (bit--)
+        {
+            if (fmpz_tstbit(e, bit))
+            {
+                _nmod_poly_mul(S, R, d, R, d, mod);
+                _fq_nmod_reduce(S, 2 * d - 1, a, j, lena, mod);
+                _nmod_poly_mul(R, S, d, op, len, mod);
+                _fq_nmod_reduce(R, d + len - 1, a, j, lena, mod);
+            }
+            else
+            {
+                _nmod_poly_mul(S, R, d, R, d, mod);
+                _fq_nmod_reduce(S, 2 * d - 1, a, j, lena, mod);
+                T = R;
+                R = S;
+                S = T;
+            }
+        }
+
+        _nmod_vec_clear(v);
+    }
+}
+
+void fq_nmod_pow(fq_nmod_t rop, const fq_nmod_t op, const fmpz_t e,
+                 const fq_nmod_ctx_t ctx)
+{
+    if (fmpz_sgn(e) < 0)
+    {
+        printf("Exception (fq_nmod_pow).  e < 0.\n");
+        abort();
+    }
+
+    if (fmpz_is_zero(e))
+    {
+        fq_nmod_one(rop, ctx);
+    }
+    else if (fq_nmod_is_zero(op, ctx))
+    {
+        fq_nmod_zero(rop, ctx);
+    }
+    else if (fmpz_is_one(e))
+    {
+        fq_nmod_set(rop, op, ctx);
+    }
+    else
+    {
+        const long d = fq_nmod_ctx_degree(ctx);
+        mp_ptr t;
+
+        if (rop == op)
+        {
+            t = _nmod_vec_init(2 * d - 1);
+        }
+        else
+        {
+            nmod_poly_fit_length(rop, 2 * d - 1);
+            t = rop->coeffs;
+        }
+
+        _fq_nmod_pow(t, op->coeffs, op->length, e,
+                     ctx->a, ctx->j, ctx->len, ctx->mod);
+
+        if (rop == op)
+        {
+            _nmod_vec_clear(rop->coeffs);
+            rop->coeffs = t;
+            rop->alloc  = 2 * d - 1;
+        }
+        rop->length = d;
+        _nmod_poly_normalise(rop);
+    }
+}
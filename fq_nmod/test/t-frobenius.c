@@ -0,0 +1,266 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz 
+    Copyright (C) 2012 Andres Goens
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_nmod.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    printf("frobenius... ");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* Check aliasing */
+    for (i = 0; i < 1000; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_nmod_ctx_t ctx;
+
+        fq_nmod_t a, b, c;
+        long e;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_nmod_ctx_init_conway(ctx, p, d, "a");
+
+        fq_nmod_init(a, ctx);
+        fq_nmod_init(b, ctx);
+        fq_nmod_init(c, ctx);
+
+        fq_nmod_randtest(a, state, ctx);
+        fq_nmod_set(b, a, ctx);
+        e = n_randint(state, 10) % d;
+
+        fq_nmod_frobenius(c, b, e, ctx);
+        fq_nmod_frobenius(b, b, e, ctx);
+
+        result = (fq_nmod_equal(b, c, ctx));
+        if (!result)
+        {
+            printf("FAIL (alias):\n\n");
+            printf("a = "), fq_nmod_print_pretty(a, ctx), printf("\n");
+            printf("b = "), fq_nmod_print_pretty(b, ctx), printf("\n");
+            printf("c = "), fq_nmod_print_pretty(c, ctx), printf("\n");
+            printf("e = %ld\n", e);
+            abort();
+        }
+
+        fq_nmod_clear(a, ctx);
+        fq_nmod_clear(b, ctx);
+        fq_nmod_clear(c, ctx);
+
+        fmpz_clear(p);
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    /* Check sigma^e(x) == x^{p^e}  */
+    for (i = 0; i < 1000; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_nmod_ctx_t ctx;
+
+        fq_nmod_t a, b, c;
+        long e;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_nmod_ctx_init_conway(ctx, p, d, "a");
+
+        fq_nmod_init(a, ctx);
+        fq_nmod_init(b, ctx);
+        fq_nmod_init(c, ctx);
+
+        fq_nmod_randtest(a, state, ctx);
+        e = n_randint(state, 10) % d;
+
+        fq_nmod_frobenius(b, a, e, ctx);
+        {
+            fmpz_t t;
+
+            fmpz_init(t);
+            fmpz_pow_ui(t, p, e);
+            fq_nmod_pow(c, a, t, ctx);
+            fmpz_clear(t);
+        }
+
+        result = (fq_nmod_equal(b,c, ctx));
+        if (!result)
+        {
+            printf("FAIL (sigma^e(x) = x^{p^e}):\n\n");
+            printf("a = "), fq_nmod_print_pretty(a, ctx), printf("\n");
+            printf("b = "), fq_nmod_print_pretty(b, ctx), printf("\n");
+            printf("c = "), fq_nmod_print_pretty(c, ctx), printf("\n");
+            printf("e = %ld\n", e);
+            abort();
+        }
+
+        fq_nmod_clear(a, ctx);
+        fq_nmod_clear(b, ctx);
+        fq_nmod_clear(c, ctx);
+
+        fmpz_clear(p);
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    /* Check sigma^e(x + y) = sigma^e(x) + sigma^e(y) */
+    for (i = 0; i < 1000; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_nmod_ctx_t ctx;
+
+        fq_nmod_t a, b, s, s1, s2, lhs, rhs;
+        long e;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_nmod_ctx_init_conway(ctx, p, d, "a");
+
+        fq_nmod_init(a, ctx);
+        fq_nmod_init(b, ctx);
+        fq_nmod_init(s, ctx);
+        fq_nmod_init(s1, ctx);
+        fq_nmod_init(s2, ctx);
+        fq_nmod_init(lhs, ctx);
+        fq_nmod_init(rhs, ctx);
+
+        fq_nmod_randtest(a, state, ctx);
+        fq_nmod_randtest(b, state, ctx);
+        e = n_randint(state, 10) % d;
+
+        fq_nmod_add(s, a, b, ctx);
+        fq_nmod_frobenius(lhs, s, e, ctx);
+        fq_nmod_frobenius(s1, a, e, ctx);
+        fq_nmod_frobenius(s2, b, e, ctx);
+        fq_nmod_add(rhs, s1, s2, ctx);
+
+        result = (fq_nmod_equal(lhs, rhs, ctx));
+        if (!result)
+        {
+            printf("FAIL (sigma(a+b) = sigma(a) + sigma(b)):\n\n");
+            printf("a = "), fq_nmod_print_pretty(a, ctx), printf("\n");
+            printf("b = "), fq_nmod_print_pretty(b, ctx), printf("\n");
+            printf("s = "), fq_nmod_print_pretty(s, ctx), printf("\n");
+            printf("s1 = "), fq_nmod_print_pretty(s1, ctx), printf("\n");
+            printf("s2 = "), fq_nmod_print_pretty(s2, ctx), printf("\n");
+            printf("lhs = "), fq_nmod_print_pretty(lhs, ctx), printf("\n");
+            printf("rhs = "), fq_nmod_print_pretty(rhs, ctx), printf("\n");
+            printf("e = %ld\n", e);
+            abort();
+        }
+
+        fq_nmod_clear(a, ctx);
+        fq_nmod_clear(b, ctx);
+        fq_nmod_clear(s, ctx);
+        fq_nmod_clear(s1, ctx);
+        fq_nmod_clear(s2, ctx);
+        fq_nmod_clear(lhs, ctx);
+        fq_nmod_clear(rhs, ctx);
+
+        fmpz_clear(p);
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    /* Check sigma^e(x * y) = sigma^e(x) * sigma^e(y) on Zq */
+    for (i = 0; i < 1000; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_nmod_ctx_t ctx;
+
+        fq_nmod_t a, b, s, s1, s2, lhs, rhs;
+        long e;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_nmod_ctx_init_conway(ctx, p, d, "a");
+
+        fq_nmod_init(a, ctx);
+        fq_nmod_init(b, ctx);
+        fq_nmod_init(s, ctx);
+        fq_nmod_init(s1, ctx);
+        fq_nmod_init(s2, ctx);
+        fq_nmod_init(lhs, ctx);
+        fq_nmod_init(rhs, ctx);
+
+        fq_nmod_randtest(a, state, ctx);
+        fq_nmod_randtest(b, state, ctx);
+        e = n_randint(state, 10) % d;
+
+        fq_nmod_mul(s, a, b, ctx);
+        fq_nmod_frobenius(lhs, s, e, ctx);
+        fq_nmod_frobenius(s1, a, e, ctx);
+        fq_nmod_frobenius(s2, b, e, ctx);
+        fq_nmod_mul(rhs, s1, s2, ctx);
+
+        result = (fq_nmod_equal(lhs, rhs, ctx));
+        if (!result)
+        {
+            printf("FAIL (sigma(a*b) = sigma(a) * sigma(b)):\n\n");
+            printf("a = "), fq_nmod_print_pretty(a, ctx), printf("\n");
+            printf("b = "), fq_nmod_print_pretty(b, ctx), printf("\n");
+            printf("s = "), fq_nmod_print_pretty(s, ctx), printf("\n");
+            printf("s1 = "), fq_nmod_print_pretty(s1, ctx), printf("\n");
+            printf("s2 = "), fq_nmod_print_pretty(s2, ctx), printf("\n");
+            printf("lhs = "), fq_nmod_print_pretty(lhs, ctx), printf("\n");
+            printf("rhs = "), fq_nmod_print_pretty(rhs, ctx), printf("\n");
+            printf("e = %ld\n", e);
+            abort();
+        }
+
+        fq_nmod_clear(a, ctx);
+        fq_nmod_clear(b, ctx);
+        fq_nmod_clear(s, ctx);
+        fq_nmod_clear(s1, ctx);
+        fq_nmod_clear(s2, ctx);
+        fq_nmod_clear(lhs, ctx);
+        fq_nmod_clear(rhs, ctx);
+
+        fmpz_clear(p);
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
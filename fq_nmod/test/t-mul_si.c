@@ -0,0 +1,135 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2009 William Hart
+    Copyright (C) 2013 Andres Goens
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fq_nmod.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    printf("mul_si....");
+    fflush(stdout);
+
+    flint_randinit(state);
+    /* Check aliasing of a, b */
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_nmod_ctx_t ctx;
+        long x;
+        fq_nmod_t a, b;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_nmod_ctx_init_conway(ctx, p, d, "a");
+
+        fq_nmod_init(a, ctx);
+        fq_nmod_init(b, ctx);
+
+        fq_nmod_randtest(a, state, ctx);
+        x = z_randtest(state);
+        fq_nmod_mul_si(b, a, x, ctx);
+        fq_nmod_mul_si(a, a, x, ctx);
+
+        result = (fq_nmod_equal(a, b, ctx));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_nmod_print_pretty(a, ctx), printf("\n");
+            printf("b = "), fq_nmod_print_pretty(b, ctx), printf("\n");
+	    printf("x = %ld\n",x);
+            abort();
+        }
+
+        fq_nmod_clear(a, ctx);
+        fq_nmod_clear(b, ctx);
+
+        fmpz_clear(p);
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    /* compare with direct multiplication */
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_nmod_ctx_t ctx;
+        long x;
+        fq_nmod_t a, c;
+        fq_nmod_t b;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_nmod_ctx_init_conway(ctx, p, d, "a");
+
+        fq_nmod_init(a, ctx);
+        fq_nmod_init(c, ctx);
+        fq_nmod_init(b, ctx);
+
+        fq_nmod_randtest(a, state, ctx);
+        x = z_randtest(state);
+        fq_nmod_mul_si(c, a, x, ctx);
+        if (x >= 0)
+            nmod_poly_set_coeff_ui(b, 0, x);
+        else
+            nmod_poly_set_coeff_ui(b, 0, nmod_neg(n_mod2_preinv(- (ulong) x, 
+                                   ctx->mod.n, ctx->mod.ninv), ctx->mod));
+        fq_nmod_mul(b, a, b, ctx);
+
+
+        result = (fq_nmod_equal(c, b, ctx));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_nmod_print_pretty(a, ctx), printf("\n");
+            printf("b = "), fq_nmod_print_pretty(b, ctx), printf("\n");
+	    printf("x = %ld\n",x);
+            abort();
+        }
+
+        fq_nmod_clear(a, ctx);
+        fq_nmod_clear(c, ctx);
+        fq_nmod_clear(b, ctx);
+        fmpz_clear(p);
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_nmod.h"
+
+void _fq_nmod_trace(fmpz_t rop, mp_srcptr op, long len,
+                    const mp_limb_t *a, const long *j, long lena, nmod_t mod)
+{
+    const long d = j[lena - 1];
+
+    long i, l;
+    mp_ptr t;
+    mp_limb_t s;
+
+    t = _nmod_vec_init(d);
+    _nmod_vec_zero(t, d);
+
+    NMOD_RED(t[0], (mp_limb_t) d, mod);
+    for (i = 1; i < d; i++)
+    {
+        for (l = lena - 2; l >= 0 && j[l] >= d - (i - 1); l--)
+        {
+            t[i] = nmod_add(t[i], nmod_mul(t[j[l] + i - d], a[l], mod), mod);
+        }
+
+        if (l >= 0 && j[l] == d - i)
+        {
+            NMOD_RED(s, (mp_limb_t) i, mod);
+            t[i] = nmod_add(t[i], nmod_mul(a[l], s, mod), mod);
+        }
+
+        t[i] = nmod_neg(t[i], mod);
+    }
+
+    s = 0UL;
+    for (i = 0; i < len; i++)
+    {
+        s = nmod_add(s, nmod_mul(op[i], t[i], mod), mod);
+    }
+    fmpz_set_ui(rop, s);
+
+    _nmod_vec_clear(t);
+}
+
+void fq_nmod_trace(fmpz_t rop, const fq_nmod_t op, const fq_nmod_ctx_t ctx)
+{
+    if (fq_nmod_is_zero(op, ctx))
+    {
+        fmpz_zero(rop);
+    }
+    else
+    {
+        _fq_nmod_trace(rop, op->coeffs, op->length,
+                       ctx->a, ctx->j, ctx->len, ctx->mod);
+    }
+}
@@ -0,0 +1,514 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#ifndef FQ_NMOD_POLY_H
+#define FQ_NMOD_POLY_H
+
+#undef ulong                /* interferes with system includes */
+#include <stdlib.h>
+#include <stdio.h>
+#define ulong unsigned long
+
+#include "fq_nmod.h"
+
+/*  Type definitions *********************************************************/
+
+typedef struct
+{
+    fq_nmod_struct *coeffs;
+    long alloc;
+    long length;
+}
+fq_nmod_poly_struct;
+
+typedef fq_nmod_poly_struct fq_nmod_poly_t[1];
+
+/*  Memory management ********************************************************/
+
+fq_nmod_struct * _fq_nmod_poly_init(long len, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_init(fq_nmod_poly_t poly, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_init2(fq_nmod_poly_t poly, long alloc,
+                        const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_realloc(fq_nmod_poly_t poly, long alloc,
+                          const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_truncate(fq_nmod_poly_t poly, long len,
+                           const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_fit_length(fq_nmod_poly_t poly, long len,
+                             const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_clear(fq_nmod_struct *v, long len,
+                         const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_clear(fq_nmod_poly_t poly, const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_normalise(fq_nmod_poly_t poly, const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_normalise2(fq_nmod_struct *poly, long *length,
+                              const fq_nmod_ctx_t ctx);
+
+static __inline__
+void _fq_nmod_poly_set_length(fq_nmod_poly_t poly, long len,
+                              const fq_nmod_ctx_t ctx)
+{
+    if (poly->length > len)
+    {
+        long i;
+
+        for (i = len; i < poly->length; i++)
+            fq_nmod_zero(poly->coeffs + i, ctx);
+    }
+    poly->length = len;
+}
+
+#define FQ_NMOD_VEC_NORM(vec, i, ctx)                     \
+do {                                                      \
+    while ((i) && fq_nmod_is_zero((vec) + (i) - 1, ctx))  \
+        (i)--;                                            \
+} while (0)
+
+/*  Polynomial parameters  ***************************************************/
+
+static __inline__
+long fq_nmod_poly_length(const fq_nmod_poly_t poly, const fq_nmod_ctx_t ctx)
+{
+    return poly->length;
+}
+
+static __inline__
+long fq_nmod_poly_degree(const fq_nmod_poly_t poly, const fq_nmod_ctx_t ctx)
+{
+    return poly->length - 1;
+}
+
+static __inline__ fq_nmod_struct *
+fq_nmod_poly_lead(const fq_nmod_poly_t poly, const fq_nmod_ctx_t ctx)
+{
+    return poly->length > 0 ? poly->coeffs + (poly->length - 1) : NULL;
+}
+
+/*  Randomisation  ***********************************************************/
+
+void fq_nmod_poly_randtest(fq_nmod_poly_t f, flint_rand_t state,
+                           long len, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_randtest_not_zero(fq_nmod_poly_t f, flint_rand_t state,
+                                    long len, const fq_nmod_ctx_t ctx);
+
+/*  Assignment and basic manipulation  ***************************************/
+
+void _fq_nmod_poly_set(fq_nmod_struct *rop, const fq_nmod_struct *op, long len,
+                       const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_set(fq_nmod_poly_t rop, const fq_nmod_poly_t op,
+                      const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_set_fq_nmod(fq_nmod_poly_t poly, const fq_nmod_t c,
+                              const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_swap(fq_nmod_poly_t op1, fq_nmod_poly_t op2,
+                       const fq_nmod_ctx_t ctx);
+
+static __inline__
+void _fq_nmod_poly_zero(fq_nmod_struct *rop, long len, const fq_nmod_ctx_t ctx)
+{
+    long i;
+
+    for (i = 0; i < len; i++)
+        fq_nmod_zero(rop + i, ctx);
+}
+
+static __inline__
+void fq_nmod_poly_zero(fq_nmod_poly_t poly, const fq_nmod_ctx_t ctx)
+{
+   _fq_nmod_poly_set_length(poly, 0, ctx);
+}
+
+void fq_nmod_poly_one(fq_nmod_poly_t poly, const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_make_monic(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long length, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_make_monic(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, const fq_nmod_ctx_t ctx);
+
+/*  Getting and setting coefficients  ****************************************/
+
+void fq_nmod_poly_get_coeff(fq_nmod_t x, const fq_nmod_poly_t poly, long n,
+                            const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_set_coeff(fq_nmod_poly_t poly, long n, const fq_nmod_t x,
+                            const fq_nmod_ctx_t ctx);
+
+/*  Comparison  **************************************************************/
+
+int fq_nmod_poly_equal(const fq_nmod_poly_t poly1,
+                       const fq_nmod_poly_t poly2, const fq_nmod_ctx_t ctx);
+
+static __inline__
+int fq_nmod_poly_is_zero(const fq_nmod_poly_t poly, const fq_nmod_ctx_t ctx)
+{
+    return (poly->length == 0);
+}
+
+static __inline__
+int fq_nmod_poly_is_one(const fq_nmod_poly_t op, const fq_nmod_ctx_t ctx)
+{
+    return (op->length == 1) && (fq_nmod_is_one(op->coeffs + 0, ctx));
+}
+
+static __inline__
+int fq_nmod_poly_is_unit(const fq_nmod_poly_t op, const fq_nmod_ctx_t ctx)
+{
+    return (op->length == 1) && (!(fq_nmod_is_zero(op->coeffs + 0, ctx)));
+}
+
+static __inline__
+int fq_nmod_poly_equal_fq_nmod(const fq_nmod_poly_t poly, const fq_nmod_t c,
+                               const fq_nmod_ctx_t ctx)
+{
+    return ((poly->length == 0) && fq_nmod_is_zero(c, ctx)) ||
+        ((poly->length == 1) && fq_nmod_equal(poly->coeffs, c, ctx));
+}
+
+/*  Addition and subtraction  ************************************************/
+
+void _fq_nmod_poly_add(fq_nmod_struct *res,
+                       const fq_nmod_struct *poly1, long len1,
+                       const fq_nmod_struct *poly2, long len2,
+                       const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_add(fq_nmod_poly_t rop,
+                      const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+                      const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_sub(fq_nmod_struct *res,
+                       const fq_nmod_struct *poly1, long len1,
+                       const fq_nmod_struct *poly2, long len2,
+                       const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_sub(fq_nmod_poly_t rop,
+                      const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+                      const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_neg(fq_nmod_struct *rop, const fq_nmod_struct *op, long len,
+                       const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_neg(fq_nmod_poly_t rop, const fq_nmod_poly_t op,
+                      const fq_nmod_ctx_t ctx);
+
+/*  Scalar multiplication and division  **************************************/
+
+void _fq_nmod_poly_scalar_mul_fq_nmod(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long len, const fq_nmod_t x,
+    const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_scalar_mul_fq_nmod(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, const fq_nmod_t x, const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_scalar_addmul_fq_nmod(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long len, const fq_nmod_t x,
+    const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_scalar_addmul_fq_nmod(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, const fq_nmod_t x, const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_scalar_submul_fq_nmod(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long len, const fq_nmod_t x,
+    const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_scalar_submul_fq_nmod(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, const fq_nmod_t x, const fq_nmod_ctx_t ctx);
+
+/*  Multiplication  **********************************************************/
+
+void _fq_nmod_poly_mul_classical(fq_nmod_struct *rop,
+                                 const fq_nmod_struct *op1, long len1,
+                                 const fq_nmod_struct *op2, long len2,
+                                 const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_mul_classical(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+    const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_mul_reorder(fq_nmod_struct *rop,
+                               const fq_nmod_struct *op1, long len1,
+                               const fq_nmod_struct *op2, long len2,
+                               const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_mul_reorder(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+    const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_mul_KS(fq_nmod_struct *rop,
+                          const fq_nmod_struct *op1, long len1,
+                          const fq_nmod_struct *op2, long len2,
+                          const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_mul_KS(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+    const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_mul(fq_nmod_struct *rop,
+                       const fq_nmod_struct *op1, long len1,
+                       const fq_nmod_struct *op2, long len2,
+                       const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_mul(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+    const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_mullow_classical(fq_nmod_struct *rop,
+                                    const fq_nmod_struct *op1, long len1,
+                                    const fq_nmod_struct *op2, long len2,
+                                    long n, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_mullow_classical(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op1, const fq_nmod_poly_t op2, long n,
+    const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_mullow_KS(fq_nmod_struct *rop,
+                             const fq_nmod_struct *op1, long len1,
+                             const fq_nmod_struct *op2, long len2,
+                             long n, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_mullow_KS(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op1, const fq_nmod_poly_t op2, long n,
+    const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_mullow(fq_nmod_struct *rop,
+                          const fq_nmod_struct *op1, long len1,
+                          const fq_nmod_struct *op2, long len2,
+                          long n, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_mullow(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op1, const fq_nmod_poly_t op2, long n,
+    const fq_nmod_ctx_t ctx);
+
+/* Squaring ******************************************************************/
+
+void _fq_nmod_poly_sqr_classical(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long len, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_sqr_classical(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_sqr_reorder(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long len, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_sqr_reorder(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_sqr_KS(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long len, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_sqr_KS(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_sqr(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long len, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_sqr(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, const fq_nmod_ctx_t ctx);
+
+/*  Powering  ****************************************************************/
+
+void _fq_nmod_poly_pow(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long len, ulong e, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_pow(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, ulong e, const fq_nmod_ctx_t ctx);
+
+/*  Shifting  ****************************************************************/
+
+void _fq_nmod_poly_shift_left(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long len, long n, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_shift_left(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, long n, const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_shift_right(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long len, long n, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_shift_right(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, long n, const fq_nmod_ctx_t ctx);
+
+/*  Norms  *******************************************************************/
+
+long _fq_nmod_poly_hamming_weight(const fq_nmod_struct *op, long len,
+                                  const fq_nmod_ctx_t ctx);
+
+long fq_nmod_poly_hamming_weight(const fq_nmod_poly_t op,
+                                 const fq_nmod_ctx_t ctx);
+
+/*  Greatest common divisor  *************************************************/
+
+void fq_nmod_poly_gcd_euclidean(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+    const fq_nmod_ctx_t ctx);
+
+long _fq_nmod_poly_gcd_euclidean(fq_nmod_struct *G,
+    const fq_nmod_struct *A, long lenA, const fq_nmod_struct *B, long lenB,
+    const fq_nmod_ctx_t ctx);
+
+static __inline__
+void fq_nmod_poly_gcd(fq_nmod_poly_t rop,
+                      const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+                      const fq_nmod_ctx_t ctx)
+{
+    fq_nmod_poly_gcd_euclidean(rop, op1, op2, ctx);
+}
+
+/*  Euclidean division  ******************************************************/
+
+void _fq_nmod_poly_divrem_basecase(fq_nmod_struct *Q, fq_nmod_struct *R,
+    const fq_nmod_struct *A, long lenA, const fq_nmod_struct *B, long lenB,
+    const fq_nmod_t invB, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_divrem_basecase(fq_nmod_poly_t Q, fq_nmod_poly_t R,
+    const fq_nmod_poly_t A, const fq_nmod_poly_t B, const fq_nmod_ctx_t ctx);
+
+static __inline__
+void _fq_nmod_poly_divrem(fq_nmod_struct *Q, fq_nmod_struct *R,
+    const fq_nmod_struct *A, long lenA, const fq_nmod_struct *B, long lenB,
+    const fq_nmod_t invB, const fq_nmod_ctx_t ctx)
+{
+    _fq_nmod_poly_divrem_basecase(Q, R, A, lenA, B, lenB, invB, ctx);
+}
+
+static __inline__
+void fq_nmod_poly_divrem(fq_nmod_poly_t Q, fq_nmod_poly_t R,
+    const fq_nmod_poly_t A, const fq_nmod_poly_t B, const fq_nmod_ctx_t ctx)
+{
+    fq_nmod_poly_divrem_basecase(Q, R, A, B, ctx);
+}
+
+static __inline__
+void _fq_nmod_poly_rem(fq_nmod_struct *R,
+    const fq_nmod_struct *A, long lenA, const fq_nmod_struct *B, long lenB,
+    const fq_nmod_t invB, const fq_nmod_ctx_t ctx)
+{
+    fq_nmod_struct *Q = _fq_nmod_poly_init(lenA - lenB + 1, ctx);
+
+    _fq_nmod_poly_divrem(Q, R, A, lenA, B, lenB, invB, ctx);
+    _fq_nmod_poly_clear(Q, lenA - lenB + 1, ctx);
+}
+
+static __inline__
+void fq_nmod_poly_rem(fq_nmod_poly_t R,
+    const fq_nmod_poly_t A, const fq_nmod_poly_t B, const fq_nmod_ctx_t ctx)
+{
+    fq_nmod_poly_t Q;
+
+    fq_nmod_poly_init(Q, ctx);
+    fq_nmod_poly_divrem_basecase(Q, R, A, B, ctx);
+    fq_nmod_poly_clear(Q, ctx);
+}
+
+/*  Divisibility testing  ***************************************************/
+
+int _fq_nmod_poly_divides(fq_nmod_struct *Q,
+                          const fq_nmod_struct *A, long lenA,
+                          const fq_nmod_struct *B, long lenB,
+                          const fq_nmod_t invB, const fq_nmod_ctx_t ctx);
+
+int fq_nmod_poly_divides(fq_nmod_poly_t Q,
+    const fq_nmod_poly_t A, const fq_nmod_poly_t B, const fq_nmod_ctx_t ctx);
+
+/*  Derivative  **************************************************************/
+
+void _fq_nmod_poly_derivative(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long len, const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_derivative(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, const fq_nmod_ctx_t ctx);
+
+/*  Evaluation  **************************************************************/
+
+void _fq_nmod_poly_evaluate_fq_nmod(fq_nmod_t rop,
+    const fq_nmod_struct *op, long len, const fq_nmod_t a,
+    const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_evaluate_fq_nmod(fq_nmod_t res,
+    const fq_nmod_poly_t f, const fq_nmod_t a, const fq_nmod_ctx_t ctx);
+
+/*  Composition  *************************************************************/
+
+void _fq_nmod_poly_compose_divconquer(fq_nmod_struct *rop,
+                                      const fq_nmod_struct *op1, long len1,
+                                      const fq_nmod_struct *op2, long len2,
+                                      const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_compose_divconquer(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+    const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_compose_horner(fq_nmod_struct *rop,
+                                  const fq_nmod_struct *op1, long len1,
+                                  const fq_nmod_struct *op2, long len2,
+                                  const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_compose_horner(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+    const fq_nmod_ctx_t ctx);
+
+void _fq_nmod_poly_compose(fq_nmod_struct *rop,
+                           const fq_nmod_struct *op1, long len1,
+                           const fq_nmod_struct *op2, long len2,
+                           const fq_nmod_ctx_t ctx);
+
+void fq_nmod_poly_compose(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+    const fq_nmod_ctx_t ctx);
+
+/*  Input and output  ********************************************************/
+
+int _fq_nmod_poly_fprint_pretty(FILE *file,
+    const fq_nmod_struct *poly, long len, const char *x,
+    const fq_nmod_ctx_t ctx);
+
+int fq_nmod_poly_fprint_pretty(FILE * file,
+    const fq_nmod_poly_t poly, const char *x, const fq_nmod_ctx_t ctx);
+
+static __inline__
+int _fq_nmod_poly_print_pretty(const fq_nmod_struct *poly, long len,
+                               const char *x, const fq_nmod_ctx_t ctx)
+{
+    return _fq_nmod_poly_fprint_pretty(stdout, poly, len, x, ctx);
+}
+
+static __inline__
+int fq_nmod_poly_print_pretty(const fq_nmod_poly_t poly, const char *x,
+                              const fq_nmod_ctx_t ctx)
+{
+    return fq_nmod_poly_fprint_pretty(stdout, poly, x, ctx);
+}
+
+#endif
+
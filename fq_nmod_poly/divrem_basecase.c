@@ -0,0 +1,112 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_nmod_poly.h"
+
+void _fq_nmod_poly_divrem_basecase(fq_nmod_struct *Q, fq_nmod_struct *R,
+    const fq_nmod_struct *A, long lenA, const fq_nmod_struct *B, long lenB,
+    const fq_nmod_t invB, const fq_nmod_ctx_t ctx)
+{
+    long iQ, iR;
+
+    if (R != A)
+        _fq_nmod_poly_set(R, A, lenA, ctx);
+
+    for (iQ = lenA - lenB, iR = lenA - 1; iQ >= 0; iQ--, iR--)
+    {
+        if (fq_nmod_is_zero(R + iR, ctx))
+            fq_nmod_zero(Q + iQ, ctx);
+        else
+        {
+            fq_nmod_mul(Q + iQ, R + iR, invB, ctx);
+
+            _fq_nmod_poly_scalar_submul_fq_nmod(R + iQ, B, lenB, Q + iQ, ctx);
+        }
+    }
+}
+
+void fq_nmod_poly_divrem_basecase(fq_nmod_poly_t Q, fq_nmod_poly_t R,
+    const fq_nmod_poly_t A, const fq_nmod_poly_t B, const fq_nmod_ctx_t ctx)
+{
+    const long lenA = A->length, lenB = B->length, lenQ = lenA - lenB + 1;
+    fq_nmod_struct *q, *r;
+    fq_nmod_t invB;
+
+    if (lenA < lenB)
+    {
+        fq_nmod_poly_set(R, A, ctx);
+        fq_nmod_poly_zero(Q, ctx);
+        return;
+    }
+
+    fq_nmod_init(invB, ctx);
+    fq_nmod_inv(invB, fq_nmod_poly_lead(B, ctx), ctx);
+
+    if (Q == A || Q == B)
+    {
+        q = _fq_nmod_poly_init(lenQ, ctx);
+    }
+    else
+    {
+        fq_nmod_poly_fit_length(Q, lenQ, ctx);
+        q = Q->coeffs;
+    }
+    if (R == B)
+    {
+        r = _fq_nmod_poly_init(lenA, ctx);
+    }
+    else
+    {
+        fq_nmod_poly_fit_length(R, lenA, ctx);
+        r = R->coeffs;
+    }
+
+    _fq_nmod_poly_divrem_basecase(q, r, A->coeffs, lenA,
+                                   B->coeffs, lenB, invB, ctx);
+
+    if (Q == A || Q == B)
+    {
+        _fq_nmod_poly_clear(Q->coeffs, Q->alloc, ctx);
+        Q->coeffs = q;
+        Q->alloc  = lenQ;
+        Q->length = lenQ;
+    }
+    else
+    {
+        _fq_nmod_poly_set_length(Q, lenQ, ctx);
+    }
+    if (R == B)
+    {
+        _fq_nmod_poly_clear(R->coeffs, R->alloc, ctx);
+        R->coeffs = r;
+        R->alloc  = lenA;
+        R->length = lenA;
+    }
+    _fq_nmod_poly_set_length(R, lenB - 1, ctx);
+    _fq_nmod_poly_normalise(R, ctx);
+
+    fq_nmod_clear(invB, ctx);
+}
+
@@ -0,0 +1,72 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_nmod_poly.h"
+
+void _fq_nmod_poly_evaluate_fq_nmod(fq_nmod_t rop,
+    const fq_nmod_struct *op, long len, const fq_nmod_t a,
+    const fq_nmod_ctx_t ctx)
+{
+    if (len == 0)
+    {
+        fq_nmod_zero(rop, ctx);
+    }
+    else if (len == 1 || fq_nmod_is_zero(a, ctx))
+    {
+        fq_nmod_set(rop, op + 0, ctx);
+    }
+    else
+    {
+        long i = len - 1;
+        fq_nmod_t t;
+
+        fq_nmod_init(t, ctx);
+        fq_nmod_set(rop, op + i, ctx);
+        for (i = len - 2; i >= 0; i--)
+        {
+            fq_nmod_mul(t, rop, a, ctx);
+            fq_nmod_add(rop, op + i, t, ctx);
+        }
+        fq_nmod_clear(t, ctx);
+    }
+}
+
+void fq_nmod_poly_evaluate_fq_nmod(fq_nmod_t rop,
+    const fq_nmod_poly_t f, const fq_nmod_t a, const fq_nmod_ctx_t ctx)
+{
+    if (rop == a)
+    {
+        fq_nmod_t t;
+        fq_nmod_init(t, ctx);
+        _fq_nmod_poly_evaluate_fq_nmod(t, f->coeffs, f->length, a, ctx);
+        fq_nmod_swap(rop, t, ctx);
+        fq_nmod_clear(t, ctx);
+    }
+    else
+    {
+        _fq_nmod_poly_evaluate_fq_nmod(rop, f->coeffs, f->length, a, ctx);
+    }
+}
+
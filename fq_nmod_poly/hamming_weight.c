@@ -0,0 +1,44 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_nmod_poly.h"
+
+long _fq_nmod_poly_hamming_weight(const fq_nmod_struct *op, long len,
+                                  const fq_nmod_ctx_t ctx)
+{
+    long i, sum = 0;
+    for (i = 0; i < len; i++)
+        sum += !fq_nmod_is_zero(op + i, ctx);
+
+    return sum;
+}
+
+long fq_nmod_poly_hamming_weight(const fq_nmod_poly_t op,
+                                 const fq_nmod_ctx_t ctx)
+{
+
+    return _fq_nmod_poly_hamming_weight(op->coeffs, op->length, ctx);
+}
+
@@ -0,0 +1,53 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2007, David Howden.
+    Copyright (C) 2010 William Hart
+    Copyright (C) 2012 Andres Goens
+
+******************************************************************************/
+
+#include "fq_nmod_poly.h"
+
+void _fq_nmod_poly_make_monic(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long length, const fq_nmod_ctx_t ctx)
+{
+    fq_nmod_t inv;
+    fq_nmod_init(inv, ctx);
+    fq_nmod_inv(inv, &op[length - 1], ctx);
+    _fq_nmod_poly_scalar_mul_fq_nmod(rop, op, length, inv, ctx);
+    fq_nmod_clear(inv, ctx);
+}
+
+void fq_nmod_poly_make_monic(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, const fq_nmod_ctx_t ctx)
+{
+    if (op->length == 0)
+    {
+        fq_nmod_poly_zero(rop, ctx);
+    }
+
+    fq_nmod_poly_fit_length(rop, op->length, ctx);
+    _fq_nmod_poly_make_monic(rop->coeffs,
+                            op->coeffs, op->length, ctx);
+    _fq_nmod_poly_set_length(rop, op->length, ctx);
+}
+
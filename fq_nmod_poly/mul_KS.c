@@ -0,0 +1,121 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2008, 2009 William Hart
+    Copyright (C) 2010, 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_nmod_poly.h"
+
+/*
+    Packs the coefficients of (op, len), each a polynomial of length at
+    most d over Fp, into a single polynomial over Fp with stride 2d - 1,
+    so that a product of two such polynomials can be read off directly.
+ */
+
+static void
+__fq_nmod_poly_pack(mp_ptr rop, const fq_nmod_struct *op, long len, long d)
+{
+    long i;
+
+    _nmod_vec_zero(rop, (len - 1) * (2 * d - 1) + d);
+
+    for (i = 0; i < len; i++)
+        _nmod_vec_set(rop + i * (2 * d - 1),
+                      (op + i)->coeffs, (op + i)->length);
+}
+
+void _fq_nmod_poly_mul_KS(fq_nmod_struct *rop,
+                          const fq_nmod_struct *op1, long len1,
+                          const fq_nmod_struct *op2, long len2,
+                          const fq_nmod_ctx_t ctx)
+{
+    const long in1_len = len1, in2_len = len2;
+    const long d = fq_nmod_ctx_degree(ctx);
+    long i, lenf, leng, lenh;
+    mp_ptr f, g, h;
+
+    FQ_NMOD_VEC_NORM(op1, len1, ctx);
+    FQ_NMOD_VEC_NORM(op2, len2, ctx);
+
+    if (!len1 | !len2)
+    {
+        if (in1_len + in2_len - 1 > 0)
+            _fq_nmod_poly_zero(rop, in1_len + in2_len - 1, ctx);
+        return;
+    }
+
+    leng = (len1 - 1) * (2 * d - 1) + d;
+    lenh = (len2 - 1) * (2 * d - 1) + d;
+    lenf = leng + lenh - 1;
+
+    f = _nmod_vec_init(lenf + leng + lenh);
+    g = f + lenf;
+    h = g + leng;
+
+    __fq_nmod_poly_pack(g, op1, len1, d);
+    __fq_nmod_poly_pack(h, op2, len2, d);
+
+    if (leng >= lenh)
+        _nmod_poly_mul(f, g, leng, h, lenh, ctx->mod);
+    else
+        _nmod_poly_mul(f, h, lenh, g, leng, ctx->mod);
+
+    for (i = 0; i < len1 + len2 - 1; i++)
+    {
+        mp_ptr c = f + i * (2 * d - 1);
+        long lenc = FLINT_MIN(2 * d - 1, lenf - i * (2 * d - 1));
+
+        _fq_nmod_reduce(c, lenc, ctx->a, ctx->j, ctx->len, ctx->mod);
+
+        nmod_poly_fit_length(rop + i, d);
+        _nmod_vec_set((rop + i)->coeffs, c, FLINT_MIN(d, lenc));
+        (rop + i)->length = FLINT_MIN(d, lenc);
+        _nmod_poly_normalise(rop + i);
+    }
+
+    _fq_nmod_poly_zero(rop + (len1 + len2 - 1),
+                       (in1_len - len1) + (in2_len - len2), ctx);
+
+    _nmod_vec_clear(f);
+}
+
+void fq_nmod_poly_mul_KS(fq_nmod_poly_t rop,
+                         const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+                         const fq_nmod_ctx_t ctx)
+{
+    const long len1 = op1->length;
+    const long len2 = op2->length;
+    const long rlen = len1 + len2 - 1;
+
+    if (len1 == 0 || len2 == 0)
+    {
+        fq_nmod_poly_zero(rop, ctx);
+    }
+    else
+    {
+        fq_nmod_poly_fit_length(rop, rlen, ctx);
+        _fq_nmod_poly_mul_KS(rop->coeffs, op1->coeffs, len1,
+                                          op2->coeffs, len2, ctx);
+        _fq_nmod_poly_set_length(rop, rlen, ctx);
+    }
+}
@@ -0,0 +1,281 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_nmod_poly.h"
+
+/*
+    Include routines for vectors over \code{nmod_poly_struct},
+    for use in the classical multiplication routine in the
+    $X$-direction.
+ */
+
+static nmod_poly_struct * __vec_init(long len, nmod_t mod)
+{
+    long i;
+    nmod_poly_struct *v;
+
+    v = flint_malloc(len * sizeof(nmod_poly_struct));
+    for (i = 0; i < len; i++)
+        nmod_poly_init_preinv(v + i, mod.n, mod.ninv);
+
+    return v;
+}
+
+static nmod_poly_struct * __vec_init2(long len, long n, nmod_t mod)
+{
+    long i;
+    nmod_poly_struct *v;
+
+    v = flint_malloc(len * sizeof(nmod_poly_struct));
+    for (i = 0; i < len; i++)
+        nmod_poly_init2_preinv(v + i, mod.n, mod.ninv, n);
+
+    return v;
+}
+
+static void __vec_clear(nmod_poly_struct *v, long len)
+{
+    long i;
+
+    for (i = 0; i < len; i++)
+        nmod_poly_clear(v + i);
+    flint_free(v);
+}
+
+static void __scalar_addmul(nmod_poly_struct *rop,
+    const nmod_poly_struct *op, long len, const nmod_poly_t x)
+{
+    long i;
+
+    if (nmod_poly_is_zero(x))
+    {
+        return;
+    }
+    else if (nmod_poly_is_one(x))
+    {
+        for (i = 0; i < len; i++)
+            nmod_poly_add(rop + i, rop + i, op + i);
+    }
+    else
+    {
+        nmod_poly_t t;
+
+        nmod_poly_init_preinv(t, x->mod.n, x->mod.ninv);
+
+        for (i = 0; i < len; i++)
+        {
+            nmod_poly_mul(t, op + i, x);
+            nmod_poly_add(rop + i, rop + i, t);
+        }
+
+        nmod_poly_clear(t);
+    }
+}
+
+static void __scalar_mul(nmod_poly_struct *rop,
+    const nmod_poly_struct *op, long len, const nmod_poly_t x)
+{
+    long i;
+
+    if (nmod_poly_is_zero(x))
+    {
+        for (i = 0; i < len; i++)
+            nmod_poly_zero(rop + i);
+    }
+    else if (nmod_poly_is_one(x))
+    {
+        for (i = 0; i < len; i++)
+            nmod_poly_set(rop + i, op + i);
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+            nmod_poly_mul(rop + i, op + i, x);
+    }
+}
+
+/*
+    Sets rop to rop - c * op, where c is reduced modulo p.
+ */
+
+static void __submul_nmod(nmod_poly_t rop, const nmod_poly_t op, mp_limb_t c)
+{
+    if (c != 0UL && op->length > 0)
+    {
+        long i;
+
+        nmod_poly_fit_length(rop, op->length);
+        for (i = rop->length; i < op->length; i++)
+            rop->coeffs[i] = 0UL;
+        rop->length = FLINT_MAX(rop->length, op->length);
+
+        _nmod_vec_scalar_addmul_nmod(rop->coeffs, op->coeffs, op->length,
+                                     nmod_neg(c, rop->mod), rop->mod);
+        _nmod_poly_normalise(rop);
+    }
+}
+
+/*
+    Reduces the vector (f, lenF) of polynomials in $X$ modulo the
+    defining polynomial of the context, treated as a polynomial in
+    the generator with coefficients in $\mathbf{F}_p[X]$.
+ */
+
+static void __reduce(nmod_poly_struct *f, long lenF, const fq_nmod_ctx_t ctx)
+{
+    const long d = fq_nmod_ctx_degree(ctx);
+    long i, k;
+
+    for (i = lenF - 1; i >= d; i--)
+    {
+        for (k = ctx->len - 2; k >= 0; k--)
+        {
+            __submul_nmod(f + ctx->j[k] + i - d, f + i, ctx->a[k]);
+        }
+        nmod_poly_zero(f + i);
+    }
+}
+
+/*
+    Converts (op, len), a polynomial over $\mathbf{F}_q$, into the
+    vector (g, d) of polynomials over $\mathbf{F}_p$ so that
+    (g + j) is the coefficient of the $j$-th power of the generator.
+ */
+
+static void __transpose_in(nmod_poly_struct *g,
+                           const fq_nmod_struct *op, long len, long d)
+{
+    long i, j;
+
+    for (j = 0; j < d; j++)
+        _nmod_vec_zero((g + j)->coeffs, len);
+
+    for (i = 0; i < len; i++)
+        for (j = 0; j < (op + i)->length; j++)
+            (g + j)->coeffs[i] = (op + i)->coeffs[j];
+
+    for (j = 0; j < d; j++)
+    {
+        (g + j)->length = len;
+        _nmod_poly_normalise(g + j);
+    }
+}
+
+/*
+    Converts the vector (f, d) back into (rop, len).
+ */
+
+static void __transpose_out(fq_nmod_struct *rop, long len,
+                            const nmod_poly_struct *f, long d)
+{
+    long i, j;
+
+    for (i = 0; i < len; i++)
+    {
+        nmod_poly_fit_length(rop + i, d);
+        _nmod_vec_zero((rop + i)->coeffs, d);
+    }
+
+    for (j = 0; j < d; j++)
+        for (i = 0; i < (f + j)->length; i++)
+            (rop + i)->coeffs[j] = (f + j)->coeffs[i];
+
+    for (i = 0; i < len; i++)
+    {
+        (rop + i)->length = d;
+        _nmod_poly_normalise(rop + i);
+    }
+}
+
+static void __mul(nmod_poly_struct *rop,
+    nmod_poly_struct *op1, long len1, nmod_poly_struct *op2, long len2)
+{
+    if (len1 == 1 && len2 == 1)
+    {
+        nmod_poly_mul(rop, op1, op2);
+    }
+    else
+    {
+        long i;
+
+        __scalar_mul(rop, op1, len1, op2);
+
+        __scalar_mul(rop + len1, op2 + 1, len2 - 1, op1 + len1 - 1);
+
+        for (i = 0; i < len1 - 1; i++)
+            __scalar_addmul(rop + i + 1, op2 + 1, len2 - 1, op1 + i);
+    }
+}
+
+void _fq_nmod_poly_mul_reorder(fq_nmod_struct *rop,
+                               const fq_nmod_struct *op1, long len1,
+                               const fq_nmod_struct *op2, long len2,
+                               const fq_nmod_ctx_t ctx)
+{
+    const long d = fq_nmod_ctx_degree(ctx);
+    nmod_poly_struct *f, *g, *h;
+    long len;
+
+    f = __vec_init(2 * d - 1, ctx->mod);
+    g = __vec_init2(d, len1, ctx->mod);
+    h = __vec_init2(d, len2, ctx->mod);
+
+    __transpose_in(g, op1, len1, d);
+    __transpose_in(h, op2, len2, d);
+
+    __mul(f, g, d, h, d);
+
+    /* Normalise (f, len) */
+    len = 2 * d - 1;
+    while ((len) && nmod_poly_is_zero(f + (len - 1)))
+        len--;
+
+    /* Reduce (f, j) using polynomial operations */
+    __reduce(f, len, ctx);
+
+    __transpose_out(rop, len1 + len2 - 1, f, d);
+
+    __vec_clear(f, 2 * d - 1);
+    __vec_clear(g, d);
+    __vec_clear(h, d);
+}
+
+void fq_nmod_poly_mul_reorder(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op1, const fq_nmod_poly_t op2,
+    const fq_nmod_ctx_t ctx)
+{
+    const long len = op1->length + op2->length - 1;
+
+    if (op1->length == 0 || op2->length == 0)
+    {
+        fq_nmod_poly_zero(rop, ctx);
+        return;
+    }
+
+    fq_nmod_poly_fit_length(rop, len, ctx);
+    _fq_nmod_poly_mul_reorder(rop->coeffs, op1->coeffs, op1->length,
+                                           op2->coeffs, op2->length, ctx);
+    _fq_nmod_poly_set_length(rop, len, ctx);
+}
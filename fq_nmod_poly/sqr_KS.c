@@ -0,0 +1,102 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2008, 2009 William Hart
+    Copyright (C) 2010, 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_nmod_poly.h"
+
+static void
+__fq_nmod_poly_pack(mp_ptr rop, const fq_nmod_struct *op, long len, long d)
+{
+    long i;
+
+    _nmod_vec_zero(rop, (len - 1) * (2 * d - 1) + d);
+
+    for (i = 0; i < len; i++)
+        _nmod_vec_set(rop + i * (2 * d - 1),
+                      (op + i)->coeffs, (op + i)->length);
+}
+
+void _fq_nmod_poly_sqr_KS(fq_nmod_struct *rop,
+                          const fq_nmod_struct *op, long len,
+                          const fq_nmod_ctx_t ctx)
+{
+    const long in_len = len;
+    const long d = fq_nmod_ctx_degree(ctx);
+    long i, lenf, leng;
+    mp_ptr f, g;
+
+    FQ_NMOD_VEC_NORM(op, len, ctx);
+
+    if (!len)
+    {
+        if (2 * in_len - 1 > 0)
+            _fq_nmod_poly_zero(rop, 2 * in_len - 1, ctx);
+        return;
+    }
+
+    leng = (len - 1) * (2 * d - 1) + d;
+    lenf = 2 * leng - 1;
+
+    f = _nmod_vec_init(lenf + leng);
+    g = f + lenf;
+
+    __fq_nmod_poly_pack(g, op, len, d);
+
+    _nmod_poly_mul(f, g, leng, g, leng, ctx->mod);
+
+    for (i = 0; i < 2 * len - 1; i++)
+    {
+        mp_ptr c = f + i * (2 * d - 1);
+        long lenc = FLINT_MIN(2 * d - 1, lenf - i * (2 * d - 1));
+
+        _fq_nmod_reduce(c, lenc, ctx->a, ctx->j, ctx->len, ctx->mod);
+
+        nmod_poly_fit_length(rop + i, d);
+        _nmod_vec_set((rop + i)->coeffs, c, FLINT_MIN(d, lenc));
+        (rop + i)->length = FLINT_MIN(d, lenc);
+        _nmod_poly_normalise(rop + i);
+    }
+
+    _fq_nmod_poly_zero(rop + (2 * len - 1), 2 * (in_len - len), ctx);
+
+    _nmod_vec_clear(f);
+}
+
+void fq_nmod_poly_sqr_KS(fq_nmod_poly_t rop, const fq_nmod_poly_t op,
+                         const fq_nmod_ctx_t ctx)
+{
+    const long len = 2 * op->length - 1;
+
+    if (op->length == 0)
+    {
+        fq_nmod_poly_zero(rop, ctx);
+    }
+    else
+    {
+        fq_nmod_poly_fit_length(rop, len, ctx);
+        _fq_nmod_poly_sqr_KS(rop->coeffs, op->coeffs, op->length, ctx);
+        _fq_nmod_poly_set_length(rop, len, ctx);
+    }
+}
@@ -0,0 +1,288 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_nmod_poly.h"
+
+/*
+    Include routines for vectors over \code{nmod_poly_struct},
+    for use in the classical multiplication routine in the
+    $X$-direction.
+ */
+
+static nmod_poly_struct * __vec_init(long len, nmod_t mod)
+{
+    long i;
+    nmod_poly_struct *v;
+
+    v = flint_malloc(len * sizeof(nmod_poly_struct));
+    for (i = 0; i < len; i++)
+        nmod_poly_init_preinv(v + i, mod.n, mod.ninv);
+
+    return v;
+}
+
+static nmod_poly_struct * __vec_init2(long len, long n, nmod_t mod)
+{
+    long i;
+    nmod_poly_struct *v;
+
+    v = flint_malloc(len * sizeof(nmod_poly_struct));
+    for (i = 0; i < len; i++)
+        nmod_poly_init2_preinv(v + i, mod.n, mod.ninv, n);
+
+    return v;
+}
+
+static void __vec_clear(nmod_poly_struct *v, long len)
+{
+    long i;
+
+    for (i = 0; i < len; i++)
+        nmod_poly_clear(v + i);
+    flint_free(v);
+}
+
+static void __scalar_addmul(nmod_poly_struct *rop,
+    const nmod_poly_struct *op, long len, const nmod_poly_t x)
+{
+    long i;
+
+    if (nmod_poly_is_zero(x))
+    {
+        return;
+    }
+    else if (nmod_poly_is_one(x))
+    {
+        for (i = 0; i < len; i++)
+            nmod_poly_add(rop + i, rop + i, op + i);
+    }
+    else
+    {
+        nmod_poly_t t;
+
+        nmod_poly_init_preinv(t, x->mod.n, x->mod.ninv);
+
+        for (i = 0; i < len; i++)
+        {
+            nmod_poly_mul(t, op + i, x);
+            nmod_poly_add(rop + i, rop + i, t);
+        }
+
+        nmod_poly_clear(t);
+    }
+}
+
+static void __scalar_mul(nmod_poly_struct *rop,
+    const nmod_poly_struct *op, long len, const nmod_poly_t x)
+{
+    long i;
+
+    if (nmod_poly_is_zero(x))
+    {
+        for (i = 0; i < len; i++)
+            nmod_poly_zero(rop + i);
+    }
+    else if (nmod_poly_is_one(x))
+    {
+        for (i = 0; i < len; i++)
+            nmod_poly_set(rop + i, op + i);
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+            nmod_poly_mul(rop + i, op + i, x);
+    }
+}
+
+/*
+    Sets rop to rop - c * op, where c is reduced modulo p.
+ */
+
+static void __submul_nmod(nmod_poly_t rop, const nmod_poly_t op, mp_limb_t c)
+{
+    if (c != 0UL && op->length > 0)
+    {
+        long i;
+
+        nmod_poly_fit_length(rop, op->length);
+        for (i = rop->length; i < op->length; i++)
+            rop->coeffs[i] = 0UL;
+        rop->length = FLINT_MAX(rop->length, op->length);
+
+        _nmod_vec_scalar_addmul_nmod(rop->coeffs, op->coeffs, op->length,
+                                     nmod_neg(c, rop->mod), rop->mod);
+        _nmod_poly_normalise(rop);
+    }
+}
+
+/*
+    Reduces the vector (f, lenF) of polynomials in $X$ modulo the
+    defining polynomial of the context, treated as a polynomial in
+    the generator with coefficients in $\mathbf{F}_p[X]$.
+ */
+
+static void __reduce(nmod_poly_struct *f, long lenF, const fq_nmod_ctx_t ctx)
+{
+    const long d = fq_nmod_ctx_degree(ctx);
+    long i, k;
+
+    for (i = lenF - 1; i >= d; i--)
+    {
+        for (k = ctx->len - 2; k >= 0; k--)
+        {
+            __submul_nmod(f + ctx->j[k] + i - d, f + i, ctx->a[k]);
+        }
+        nmod_poly_zero(f + i);
+    }
+}
+
+/*
+    Converts (op, len), a polynomial over $\mathbf{F}_q$, into the
+    vector (g, d) of polynomials over $\mathbf{F}_p$ so that
+    (g + j) is the coefficient of the $j$-th power of the generator.
+ */
+
+static void __transpose_in(nmod_poly_struct *g,
+                           const fq_nmod_struct *op, long len, long d)
+{
+    long i, j;
+
+    for (j = 0; j < d; j++)
+        _nmod_vec_zero((g + j)->coeffs, len);
+
+    for (i = 0; i < len; i++)
+        for (j = 0; j < (op + i)->length; j++)
+            (g + j)->coeffs[i] = (op + i)->coeffs[j];
+
+    for (j = 0; j < d; j++)
+    {
+        (g + j)->length = len;
+        _nmod_poly_normalise(g + j);
+    }
+}
+
+/*
+    Converts the vector (f, d) back into (rop, len).
+ */
+
+static void __transpose_out(fq_nmod_struct *rop, long len,
+                            const nmod_poly_struct *f, long d)
+{
+    long i, j;
+
+    for (i = 0; i < len; i++)
+    {
+        nmod_poly_fit_length(rop + i, d);
+        _nmod_vec_zero((rop + i)->coeffs, d);
+    }
+
+    for (j = 0; j < d; j++)
+        for (i = 0; i < (f + j)->length; i++)
+            (rop + i)->coeffs[j] = (f + j)->coeffs[i];
+
+    for (i = 0; i < len; i++)
+    {
+        (rop + i)->length = d;
+        _nmod_poly_normalise(rop + i);
+    }
+}
+
+static void __sqr(nmod_poly_struct *rop, nmod_poly_struct *op, long len)
+{
+    if (len == 1)
+    {
+        nmod_poly_mul(rop, op, op);
+    }
+    else
+    {
+        long i;
+        nmod_poly_t t;
+
+        nmod_poly_init_preinv(t, op->mod.n, op->mod.ninv);
+
+        __scalar_mul(rop, op, len, op);
+
+        __scalar_mul(rop + len, op + 1, len - 1, op + len - 1);
+
+        for (i = 1; i < len - 1; i++)
+            __scalar_addmul(rop + i + 1, op + 1, i - 1, op + i);
+
+        for (i = 1; i < 2 * len - 2; i++)
+            nmod_poly_add(rop + i, rop + i, rop + i);
+
+        for (i = 1; i < len - 1; i++)
+        {
+            nmod_poly_mul(t, op + i, op + i);
+            nmod_poly_add(rop + 2 * i, rop + 2 * i, t);
+        }
+
+        nmod_poly_clear(t);
+    }
+}
+
+void _fq_nmod_poly_sqr_reorder(fq_nmod_struct *rop,
+    const fq_nmod_struct *op, long len, const fq_nmod_ctx_t ctx)
+{
+    const long d = fq_nmod_ctx_degree(ctx);
+    nmod_poly_struct *f, *g;
+    long lenF;
+
+    f = __vec_init(2 * d - 1, ctx->mod);
+    g = __vec_init2(d, len, ctx->mod);
+
+    __transpose_in(g, op, len, d);
+
+    __sqr(f, g, d);
+
+    /* Normalise (f, len) */
+    lenF = 2 * d - 1;
+    while ((lenF) && nmod_poly_is_zero(f + (lenF - 1)))
+        lenF--;
+
+    /* Reduce (f, j) using polynomial operations */
+    __reduce(f, lenF, ctx);
+
+    __transpose_out(rop, 2 * len - 1, f, d);
+
+    __vec_clear(f, 2 * d - 1);
+    __vec_clear(g, d);
+}
+
+void fq_nmod_poly_sqr_reorder(fq_nmod_poly_t rop,
+    const fq_nmod_poly_t op, const fq_nmod_ctx_t ctx)
+{
+    const long len = 2 * op->length - 1;
+
+    if (op->length == 0)
+    {
+        fq_nmod_poly_zero(rop, ctx);
+    }
+    else
+    {
+        fq_nmod_poly_fit_length(rop, len, ctx);
+        _fq_nmod_poly_sqr_reorder(rop->coeffs, op->coeffs, op->length, ctx);
+        _fq_nmod_poly_set_length(rop, len, ctx);
+    }
+}
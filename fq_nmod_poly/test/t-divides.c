@@ -0,0 +1,170 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz 
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_nmod_poly.h"
+
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    printf("divides... ");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* Check that b divides a b and that the quotient is a */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_nmod_ctx_t ctx;
+
+        fq_nmod_poly_t a, b, c, q;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_nmod_ctx_init_conway(ctx, p, d, "a");
+        fq_nmod_poly_init(a, ctx);
+        fq_nmod_poly_init(b, ctx);
+        fq_nmod_poly_init(c, ctx);
+        fq_nmod_poly_init(q, ctx);
+
+        fq_nmod_poly_randtest(a, state, n_randint(state, 100), ctx);
+        fq_nmod_poly_randtest_not_zero(b, state, n_randint(state, 100) + 1, ctx);
+        fq_nmod_poly_mul(c, a, b, ctx);
+
+        result = fq_nmod_poly_divides(q, c, b, ctx) && fq_nmod_poly_equal(q, a, ctx);
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_nmod_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b = "), fq_nmod_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("c = "), fq_nmod_poly_print_pretty(c, "X", ctx), printf("\n");
+            printf("q = "), fq_nmod_poly_print_pretty(q, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_nmod_poly_clear(a, ctx);
+        fq_nmod_poly_clear(b, ctx);
+        fq_nmod_poly_clear(c, ctx);
+        fq_nmod_poly_clear(q, ctx);
+
+        fmpz_clear(p);
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    /* Check aliasing of a and q */
+    for (i = 0; i < 100; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_nmod_ctx_t ctx;
+
+        fq_nmod_poly_t a, b, c;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_nmod_ctx_init_conway(ctx, p, d, "a");
+        fq_nmod_poly_init(a, ctx);
+        fq_nmod_poly_init(b, ctx);
+        fq_nmod_poly_init(c, ctx);
+
+        fq_nmod_poly_randtest(a, state, n_randint(state, 100), ctx);
+        fq_nmod_poly_randtest_not_zero(b, state, n_randint(state, 100) + 1, ctx);
+        fq_nmod_poly_mul(c, a, b, ctx);
+
+        result = fq_nmod_poly_divides(c, c, b, ctx) && fq_nmod_poly_equal(c, a, ctx);
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_nmod_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b = "), fq_nmod_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("c = "), fq_nmod_poly_print_pretty(c, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_nmod_poly_clear(a, ctx);
+        fq_nmod_poly_clear(b, ctx);
+        fq_nmod_poly_clear(c, ctx);
+
+        fmpz_clear(p);
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    /* Check aliasing of b and q */
+    for (i = 0; i < 100; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_nmod_ctx_t ctx;
+
+        fq_nmod_poly_t a, b, c;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_nmod_ctx_init_conway(ctx, p, d, "a");
+        fq_nmod_poly_init(a, ctx);
+        fq_nmod_poly_init(b, ctx);
+        fq_nmod_poly_init(c, ctx);
+
+        fq_nmod_poly_randtest(a, state, n_randint(state, 100), ctx);
+        fq_nmod_poly_randtest_not_zero(b, state, n_randint(state, 100) + 1, ctx);
+        fq_nmod_poly_mul(c, a, b, ctx);
+
+        result = fq_nmod_poly_divides(b, c, b, ctx) && fq_nmod_poly_equal(b, a, ctx);
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_nmod_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b = "), fq_nmod_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("c = "), fq_nmod_poly_print_pretty(c, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_nmod_poly_clear(a, ctx);
+        fq_nmod_poly_clear(b, ctx);
+        fq_nmod_poly_clear(c, ctx);
+
+        fmpz_clear(p);
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
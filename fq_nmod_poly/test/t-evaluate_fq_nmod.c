@@ -0,0 +1,153 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz 
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_nmod_poly.h"
+
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    printf("evaluate_fq... ");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* Check aliasing */
+    for (i = 0; i < 2000; i++)
+    {
+        fmpz_t p;
+        long d,len;
+        fq_nmod_ctx_t ctx;
+
+        fq_nmod_poly_t f;
+        fq_nmod_t x, y, z;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        len = n_randint(state, 15) + 1;
+        fq_nmod_ctx_init_conway(ctx, p, d, "a");
+        fq_nmod_poly_init(f, ctx);
+        fq_nmod_init(x, ctx);
+        fq_nmod_init(y, ctx);
+        fq_nmod_init(z, ctx);
+
+        fq_nmod_poly_randtest(f, state, len, ctx);
+        fq_nmod_randtest(x, state, ctx);
+
+        fq_nmod_set(z, x, ctx);
+        fq_nmod_poly_evaluate_fq_nmod(y, f, x, ctx);
+        fq_nmod_poly_evaluate_fq_nmod(x, f, x, ctx);
+
+        result = (fq_nmod_equal(x, y, ctx));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("f = "), fq_nmod_poly_print_pretty(f, "X", ctx), printf("\n");
+            printf("x = "), fq_nmod_print_pretty(x, ctx), printf("\n");
+            printf("y = "), fq_nmod_print_pretty(y, ctx), printf("\n");
+            printf("z = "), fq_nmod_print_pretty(z, ctx), printf("\n");
+            abort();
+        }
+
+        fq_nmod_poly_clear(f, ctx);
+        fq_nmod_clear(x, ctx);
+        fq_nmod_clear(y, ctx);
+        fq_nmod_clear(z, ctx);
+
+        fmpz_clear(p);
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    /* Check (f + g)(a) == f(a) + g(a) */
+    for (i = 0; i < 2000; i++)
+    {
+        fmpz_t p;
+        long d,len;
+        fq_nmod_ctx_t ctx;
+
+        fq_nmod_poly_t f, g, h;
+        fq_nmod_t x, y, z;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        len = n_randint(state, 15) + 1;
+        fq_nmod_ctx_init_conway(ctx, p, d, "a");
+        fq_nmod_poly_init(f, ctx);
+        fq_nmod_poly_init(g, ctx);
+        fq_nmod_poly_init(h, ctx);
+        fq_nmod_init(x, ctx);
+        fq_nmod_init(y, ctx);
+        fq_nmod_init(z, ctx);
+
+        fq_nmod_poly_randtest(f, state, len, ctx);
+        fq_nmod_poly_randtest(g, state, len, ctx);
+        fq_nmod_randtest(x, state, ctx);
+
+        fq_nmod_poly_add(h, f, g, ctx);
+        fq_nmod_poly_evaluate_fq_nmod(y, f, x, ctx);
+        fq_nmod_poly_evaluate_fq_nmod(z, g, x, ctx);
+        fq_nmod_add(y, y, z, ctx);
+        fq_nmod_poly_evaluate_fq_nmod(z, h, x, ctx);
+
+        result = (fq_nmod_equal(y, z, ctx));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("f = "), fq_nmod_poly_print_pretty(f, "X", ctx), printf("\n");
+            printf("g = "), fq_nmod_poly_print_pretty(g, "X", ctx), printf("\n");
+            printf("h = "), fq_nmod_poly_print_pretty(h, "X", ctx), printf("\n");
+            printf("x = "), fq_nmod_print_pretty(x, ctx), printf("\n");
+            printf("y = "), fq_nmod_print_pretty(y, ctx), printf("\n");
+            printf("z = "), fq_nmod_print_pretty(z, ctx), printf("\n");
+            abort();
+        }
+
+        fq_nmod_poly_clear(f, ctx);
+        fq_nmod_poly_clear(g, ctx);
+        fq_nmod_poly_clear(h, ctx);
+        fq_nmod_clear(x, ctx);
+        fq_nmod_clear(y, ctx);
+        fq_nmod_clear(z, ctx);
+
+        fmpz_clear(p);
+        fq_nmod_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
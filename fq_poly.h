@@ -46,6 +46,11 @@ fq_poly_struct;
 
 typedef fq_poly_struct fq_poly_t[1];
 
+#define FQ_POLY_DIVREM_NEWTON_CUTOFF  32   /* Divrem: Basecase -> Newton     */
+#define FQ_POLY_HGCD_CUTOFF  30            /* HGCD: Basecase -> Recursion    */
+#define FQ_POLY_GCD_CUTOFF  60             /* GCD:  Euclidean -> HGCD        */
+#define FQ_POLY_COMPOSE_MOD_BRENT_KUNG_CUTOFF  12  /* Horner -> Brent-Kung */
+
 /*  Memory management ********************************************************/
 
 fq_struct * _fq_poly_init(long len);
@@ -140,6 +145,10 @@ void _fq_poly_make_monic(fq_struct *rop, const fq_struct *op, long length, const
 
 void fq_poly_make_monic(fq_poly_t rop, const fq_poly_t op, const fq_ctx_t ctx);
 
+void _fq_poly_reverse(fq_struct *rop, const fq_struct *op, long len, long n);
+
+void fq_poly_reverse(fq_poly_t rop, const fq_poly_t op, long n);
+
 /*  Getting and setting coefficients  ****************************************/
 
 void fq_poly_get_coeff(fq_t x, const fq_poly_t poly, long n);
@@ -331,12 +340,22 @@ void fq_poly_gcd_euclidean(fq_poly_t rop, const fq_poly_t op1, const fq_poly_t o
 long _fq_poly_gcd_euclidean(fq_struct* G,const fq_struct* A, long lenA, 
                             const fq_struct* B, long lenB, const fq_ctx_t ctx);
 
-static __inline__
-void fq_poly_gcd(fq_poly_t rop, const fq_poly_t op1, const fq_poly_t op2, 
-                 const fq_ctx_t ctx)
-{
-    fq_poly_gcd_euclidean(rop,op1,op2,ctx);
-}
+long _fq_poly_hgcd(fq_struct **M, long *lenM, 
+                   fq_struct *A, long *lenA, fq_struct *B, long *lenB, 
+                   const fq_struct *a, long lena, const fq_struct *b, long lenb, 
+                   const fq_ctx_t ctx);
+
+long _fq_poly_gcd_hgcd(fq_struct *G, const fq_struct *A, long lenA, 
+                       const fq_struct *B, long lenB, const fq_ctx_t ctx);
+
+void fq_poly_gcd_hgcd(fq_poly_t G, const fq_poly_t A, const fq_poly_t B, 
+                      const fq_ctx_t ctx);
+
+long _fq_poly_gcd(fq_struct *G, const fq_struct *A, long lenA, 
+                  const fq_struct *B, long lenB, const fq_ctx_t ctx);
+
+void fq_poly_gcd(fq_poly_t G, const fq_poly_t A, const fq_poly_t B, 
+                 const fq_ctx_t ctx);
 
 
 /*  Euclidean division  ******************************************************/
@@ -349,12 +368,31 @@ void fq_poly_divrem_basecase(fq_poly_t Q, fq_poly_t R,
                              const fq_poly_t A, const fq_poly_t B, 
                              const fq_ctx_t ctx);
 
+void _fq_poly_divrem_newton_n_preinv(fq_struct *Q, fq_struct *R, 
+    const fq_struct *A, long lenA, const fq_struct *B, long lenB, 
+    const fq_struct *Binv, long lenBinv, const fq_ctx_t ctx);
+
+void fq_poly_divrem_newton_n_preinv(fq_poly_t Q, fq_poly_t R, 
+    const fq_poly_t A, const fq_poly_t B, const fq_poly_t Binv, 
+    const fq_ctx_t ctx);
+
+void _fq_poly_divrem_newton(fq_struct *Q, fq_struct *R, 
+    const fq_struct *A, long lenA, const fq_struct *B, long lenB, 
+    const fq_t invB, const fq_ctx_t ctx);
+
+void fq_poly_divrem_newton(fq_poly_t Q, fq_poly_t R, 
+                           const fq_poly_t A, const fq_poly_t B, 
+                           const fq_ctx_t ctx);
+
 static __inline__ 
 void _fq_poly_divrem(fq_struct *Q, fq_struct *R, 
     const fq_struct *A, long lenA, const fq_struct *B, long lenB, 
     const fq_t invB, const fq_ctx_t ctx)
 {
-    _fq_poly_divrem_basecase(Q, R, A, lenA, B, lenB, invB, ctx);
+    if (FLINT_MIN(lenB, lenA - lenB + 1) < FQ_POLY_DIVREM_NEWTON_CUTOFF)
+        _fq_poly_divrem_basecase(Q, R, A, lenA, B, lenB, invB, ctx);
+    else
+        _fq_poly_divrem_newton(Q, R, A, lenA, B, lenB, invB, ctx);
 }
 
 static __inline__ 
@@ -362,7 +400,12 @@ void fq_poly_divrem(fq_poly_t Q, fq_poly_t R,
                     const fq_poly_t A, const fq_poly_t B, 
                     const fq_ctx_t ctx)
 {
-    fq_poly_divrem_basecase(Q, R, A, B, ctx);
+    const long lenA = A->length, lenB = B->length;
+
+    if (FLINT_MIN(lenB, lenA - lenB + 1) < FQ_POLY_DIVREM_NEWTON_CUTOFF)
+        fq_poly_divrem_basecase(Q, R, A, B, ctx);
+    else
+        fq_poly_divrem_newton(Q, R, A, B, ctx);
 }
 
 static __inline__ 
@@ -370,24 +413,31 @@ void _fq_poly_rem(fq_struct *R, const fq_struct *A, long lenA,
                   const fq_struct *B, long lenB, const fq_t invB,
                   const fq_ctx_t ctx)
 {
-    fq_struct *Q = _fq_poly_init(lenA + lenB); /*TODO: smaller bound */
+    fq_struct *Q = _fq_poly_init(lenA - lenB + 1);
+
     _fq_poly_divrem(Q, R, A, lenA, B, lenB, invB, ctx);
-    _fq_poly_clear(Q,lenA+lenB);
+    _fq_poly_clear(Q, lenA - lenB + 1);
 }
 
-
-
 static __inline__ 
 void fq_poly_rem(fq_poly_t R, 
                     const fq_poly_t A, const fq_poly_t B, 
                     const fq_ctx_t ctx)
 {
     fq_poly_t Q;
-    fq_poly_init2(Q,A->length+B->length);/*TDOO: smaller bound*/
-    fq_poly_divrem_basecase(Q, R, A, B, ctx);
+
+    fq_poly_init(Q);
+    fq_poly_divrem(Q, R, A, B, ctx);
     fq_poly_clear(Q);
 }
 
+/*  Power series inversion  **************************************************/
+
+void _fq_poly_inv_series_newton(fq_struct *Qinv, const fq_struct *Q, long n, 
+                                const fq_t cinv, const fq_ctx_t ctx);
+
+void fq_poly_inv_series_newton(fq_poly_t Qinv, const fq_poly_t Q, long n, 
+                               const fq_ctx_t ctx);
 
 /*  Divisibility testing  ***************************************************/
 
@@ -399,6 +449,8 @@ int _fq_poly_divides(fq_struct *Q,
 int fq_poly_divides(fq_poly_t Q, const fq_poly_t A, const fq_poly_t B, 
                                  const fq_ctx_t ctx);
 
+ulong fq_poly_remove(fq_poly_t f, const fq_poly_t g, const fq_ctx_t ctx);
+
 /*  Derivative  **************************************************************/
 
 void _fq_poly_derivative(fq_struct *rop, const fq_struct *op, long len, 
@@ -440,6 +492,83 @@ void _fq_poly_compose(fq_struct *rop, const fq_struct *op1, long len1,
 void fq_poly_compose(fq_poly_t rop, const fq_poly_t op1, const fq_poly_t op2, 
                      const fq_ctx_t ctx);
 
+/*  Modular arithmetic  ******************************************************/
+
+void _fq_poly_mulmod(fq_struct *res, const fq_struct *poly1, long len1, 
+                     const fq_struct *poly2, long len2, 
+                     const fq_struct *f, long lenf, const fq_ctx_t ctx);
+
+void fq_poly_mulmod(fq_poly_t res, 
+                    const fq_poly_t poly1, const fq_poly_t poly2, 
+                    const fq_poly_t f, const fq_ctx_t ctx);
+
+void _fq_poly_mulmod_preinv(fq_struct *res, 
+    const fq_struct *poly1, long len1, const fq_struct *poly2, long len2, 
+    const fq_struct *f, long lenf, const fq_struct *finv, long lenfinv, 
+    const fq_ctx_t ctx);
+
+void fq_poly_mulmod_preinv(fq_poly_t res, 
+    const fq_poly_t poly1, const fq_poly_t poly2, 
+    const fq_poly_t f, const fq_poly_t finv, const fq_ctx_t ctx);
+
+void _fq_poly_powmod_ui_binexp(fq_struct *res, const fq_struct *poly, 
+                               ulong e, const fq_struct *f, long lenf, 
+                               const fq_ctx_t ctx);
+
+void fq_poly_powmod_ui_binexp(fq_poly_t res, const fq_poly_t poly, ulong e, 
+                              const fq_poly_t f, const fq_ctx_t ctx);
+
+void _fq_poly_powmod_fmpz_binexp(fq_struct *res, const fq_struct *poly, 
+                                 const fmpz_t e, const fq_struct *f, long lenf, 
+                                 const fq_ctx_t ctx);
+
+void fq_poly_powmod_fmpz_binexp(fq_poly_t res, const fq_poly_t poly, 
+                                const fmpz_t e, const fq_poly_t f, 
+                                const fq_ctx_t ctx);
+
+void _fq_poly_powmod_fmpz_binexp_preinv(fq_struct *res, 
+    const fq_struct *poly, const fmpz_t e, const fq_struct *f, long lenf, 
+    const fq_struct *finv, long lenfinv, const fq_ctx_t ctx);
+
+void fq_poly_powmod_fmpz_binexp_preinv(fq_poly_t res, 
+    const fq_poly_t poly, const fmpz_t e, 
+    const fq_poly_t f, const fq_poly_t finv, const fq_ctx_t ctx);
+
+/*  Modular composition  *****************************************************/
+
+void _fq_poly_compose_mod_horner(fq_struct *res, 
+    const fq_struct *f, long lenf, const fq_struct *g, 
+    const fq_struct *h, long lenh, const fq_ctx_t ctx);
+
+void fq_poly_compose_mod_horner(fq_poly_t res, 
+    const fq_poly_t poly1, const fq_poly_t poly2, const fq_poly_t poly3, 
+    const fq_ctx_t ctx);
+
+void _fq_poly_compose_mod_brent_kung_preinv(fq_struct *res, 
+    const fq_struct *poly1, long len1, const fq_struct *poly2, 
+    const fq_struct *poly3, long len3, 
+    const fq_struct *poly3inv, long len3inv, const fq_ctx_t ctx);
+
+void fq_poly_compose_mod_brent_kung_preinv(fq_poly_t res, 
+    const fq_poly_t poly1, const fq_poly_t poly2, 
+    const fq_poly_t poly3, const fq_poly_t poly3inv, const fq_ctx_t ctx);
+
+void _fq_poly_compose_mod_brent_kung(fq_struct *res, 
+    const fq_struct *poly1, long len1, const fq_struct *poly2, 
+    const fq_struct *poly3, long len3, const fq_ctx_t ctx);
+
+void fq_poly_compose_mod_brent_kung(fq_poly_t res, 
+    const fq_poly_t poly1, const fq_poly_t poly2, const fq_poly_t poly3, 
+    const fq_ctx_t ctx);
+
+void _fq_poly_compose_mod(fq_struct *res, 
+    const fq_struct *f, long lenf, const fq_struct *g, 
+    const fq_struct *h, long lenh, const fq_ctx_t ctx);
+
+void fq_poly_compose_mod(fq_poly_t res, 
+    const fq_poly_t poly1, const fq_poly_t poly2, const fq_poly_t poly3, 
+    const fq_ctx_t ctx);
+
 /*  Input and output  ********************************************************/
 
 int _fq_poly_fprint_pretty(FILE *file, const fq_struct *poly, long len, 
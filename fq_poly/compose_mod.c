@@ -0,0 +1,101 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly.h"
+
+void _fq_poly_compose_mod(fq_struct *res, 
+    const fq_struct *f, long lenf, const fq_struct *g, 
+    const fq_struct *h, long lenh, const fq_ctx_t ctx)
+{
+    if (lenh < FQ_POLY_COMPOSE_MOD_BRENT_KUNG_CUTOFF || lenf >= lenh)
+        _fq_poly_compose_mod_horner(res, f, lenf, g, h, lenh, ctx);
+    else
+        _fq_poly_compose_mod_brent_kung(res, f, lenf, g, h, lenh, ctx);
+}
+
+void fq_poly_compose_mod(fq_poly_t res, 
+    const fq_poly_t poly1, const fq_poly_t poly2, const fq_poly_t poly3, 
+    const fq_ctx_t ctx)
+{
+    const long len1 = poly1->length;
+    const long len2 = poly2->length;
+    const long len3 = poly3->length;
+    const long len  = len3 - 1;
+    const long vec_len = FLINT_MAX(len3 - 1, len2);
+    fq_struct *ptr2;
+
+    if (len3 == 0)
+    {
+        printf("Exception (fq_poly_compose_mod).  Division by zero.\n");
+        abort();
+    }
+
+    if (len1 == 0 || len3 == 1)
+    {
+        fq_poly_zero(res);
+        return;
+    }
+
+    if (len1 == 1)
+    {
+        fq_poly_set(res, poly1);
+        return;
+    }
+
+    if (res == poly3 || res == poly1)
+    {
+        fq_poly_t tmp;
+
+        fq_poly_init(tmp);
+        fq_poly_compose_mod(tmp, poly1, poly2, poly3, ctx);
+        fq_poly_swap(tmp, res);
+        fq_poly_clear(tmp);
+        return;
+    }
+
+    ptr2 = _fq_poly_init(vec_len);
+
+    if (len2 <= len)
+    {
+        _fq_poly_set(ptr2, poly2->coeffs, len2);
+    }
+    else
+    {
+        fq_t inv3;
+
+        fq_init(inv3);
+        fq_inv(inv3, poly3->coeffs + len, ctx);
+        _fq_poly_rem(ptr2, poly2->coeffs, len2, poly3->coeffs, len3, inv3, ctx);
+        fq_clear(inv3);
+    }
+
+    fq_poly_fit_length(res, len);
+    _fq_poly_compose_mod(res->coeffs, poly1->coeffs, len1, ptr2, 
+                         poly3->coeffs, len3, ctx);
+    _fq_poly_set_length(res, len);
+    _fq_poly_normalise(res);
+
+    _fq_poly_clear(ptr2, vec_len);
+}
@@ -0,0 +1,210 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly.h"
+#include "fmpz_mat.h"
+#include "ulong_extras.h"
+
+/*
+    Sets the m x n matrix {C, n} to the product of the m x m matrix 
+    {B, m} and the m x n matrix {A, n}, where all matrices are stored 
+    as arrays of reduced elements of F_q in row-major order.
+
+    Each element of F_q is packed into an integer by evaluating it at 
+    2^bits, with bits large enough so that the coefficients of the dot 
+    products do not overlap, so that the product can be computed as a 
+    single product of integer matrices.
+ */
+static void 
+__fq_mat_mul_KS(fq_struct *C, const fq_struct *B, const fq_struct *A, 
+                long m, long n, const fq_ctx_t ctx)
+{
+    const long d = fq_ctx_degree(ctx);
+    long i, j, bits;
+    fmpz_mat_t MA, MB, MC;
+
+    bits = 2 * fmpz_bits(fq_ctx_prime(ctx)) 
+           + FLINT_BIT_COUNT(d) + FLINT_BIT_COUNT(m);
+
+    fmpz_mat_init(MA, m, n);
+    fmpz_mat_init(MB, m, m);
+    fmpz_mat_init(MC, m, n);
+
+    for (i = 0; i < m; i++)
+        for (j = 0; j < n; j++)
+            fmpz_poly_bit_pack(fmpz_mat_entry(MA, i, j), A + (i * n + j), bits);
+    for (i = 0; i < m; i++)
+        for (j = 0; j < m; j++)
+            fmpz_poly_bit_pack(fmpz_mat_entry(MB, i, j), B + (i * m + j), bits);
+
+    fmpz_mat_mul(MC, MB, MA);
+
+    for (i = 0; i < m; i++)
+        for (j = 0; j < n; j++)
+        {
+            fmpz_poly_bit_unpack_unsigned(C + (i * n + j), 
+                                          fmpz_mat_entry(MC, i, j), bits);
+            fq_reduce(C + (i * n + j), ctx);
+        }
+
+    fmpz_mat_clear(MA);
+    fmpz_mat_clear(MB);
+    fmpz_mat_clear(MC);
+}
+
+void _fq_poly_compose_mod_brent_kung_preinv(fq_struct *res, 
+    const fq_struct *poly1, long len1, const fq_struct *poly2, 
+    const fq_struct *poly3, long len3, 
+    const fq_struct *poly3inv, long len3inv, const fq_ctx_t ctx)
+{
+    const long n = len3 - 1;
+    fq_struct *A, *B, *C, *h, *t;
+    long i, m;
+
+    if (len3 == 1)
+        return;
+
+    if (len1 == 1)
+    {
+        fq_set(res, poly1);
+        return;
+    }
+
+    if (len3 == 2)
+    {
+        _fq_poly_evaluate_fq(res, poly1, len1, poly2, ctx);
+        return;
+    }
+
+    m = n_sqrt(n) + 1;
+
+    A = _fq_poly_init(2 * m * n + m * m + 2 * n);
+    C = A + m * n;
+    B = C + m * n;
+    h = B + m * m;
+    t = h + n;
+
+    /* Set rows of B to the segments of poly1 */
+    _fq_poly_set(B, poly1, len1);
+
+    /* Set rows of A to the powers of poly2 */
+    fq_one(A);
+    _fq_poly_set(A + n, poly2, n);
+    for (i = 2; i < m; i++)
+        _fq_poly_mulmod_preinv(A + i * n, A + (i - 1) * n, n, poly2, n, 
+                               poly3, len3, poly3inv, len3inv, ctx);
+
+    __fq_mat_mul_KS(C, B, A, m, n, ctx);
+
+    /* Evaluate block composition using the Horner scheme */
+    _fq_poly_set(res, C + (m - 1) * n, n);
+    _fq_poly_mulmod_preinv(h, A + (m - 1) * n, n, poly2, n, 
+                           poly3, len3, poly3inv, len3inv, ctx);
+
+    for (i = m - 2; i >= 0; i--)
+    {
+        _fq_poly_mulmod_preinv(t, res, n, h, n, 
+                               poly3, len3, poly3inv, len3inv, ctx);
+        _fq_poly_add(res, t, n, C + i * n, n, ctx);
+    }
+
+    _fq_poly_clear(A, 2 * m * n + m * m + 2 * n);
+}
+
+void fq_poly_compose_mod_brent_kung_preinv(fq_poly_t res, 
+    const fq_poly_t poly1, const fq_poly_t poly2, 
+    const fq_poly_t poly3, const fq_poly_t poly3inv, const fq_ctx_t ctx)
+{
+    const long len1 = poly1->length;
+    const long len2 = poly2->length;
+    const long len3 = poly3->length;
+    const long len  = len3 - 1;
+    const long vec_len = FLINT_MAX(len3 - 1, len2);
+    fq_struct *ptr2;
+
+    if (len3 == 0)
+    {
+        printf("Exception (fq_poly_compose_mod_brent_kung_preinv).  "
+               "Division by zero.\n");
+        abort();
+    }
+
+    if (len1 >= len3)
+    {
+        printf("Exception (fq_poly_compose_mod_brent_kung_preinv).  "
+               "The degree of the first polynomial must be smaller than "
+               "that of the modulus.\n");
+        abort();
+    }
+
+    if (len1 == 0 || len3 == 1)
+    {
+        fq_poly_zero(res);
+        return;
+    }
+
+    if (len1 == 1)
+    {
+        fq_poly_set(res, poly1);
+        return;
+    }
+
+    if (res == poly3 || res == poly1 || res == poly3inv)
+    {
+        fq_poly_t tmp;
+
+        fq_poly_init(tmp);
+        fq_poly_compose_mod_brent_kung_preinv(tmp, poly1, poly2, 
+                                              poly3, poly3inv, ctx);
+        fq_poly_swap(tmp, res);
+        fq_poly_clear(tmp);
+        return;
+    }
+
+    ptr2 = _fq_poly_init(vec_len);
+
+    if (len2 <= len)
+    {
+        _fq_poly_set(ptr2, poly2->coeffs, len2);
+    }
+    else
+    {
+        fq_t inv3;
+
+        fq_init(inv3);
+        fq_inv(inv3, poly3->coeffs + len, ctx);
+        _fq_poly_rem(ptr2, poly2->coeffs, len2, poly3->coeffs, len3, inv3, ctx);
+        fq_clear(inv3);
+    }
+
+    fq_poly_fit_length(res, len);
+    _fq_poly_compose_mod_brent_kung_preinv(res->coeffs, 
+        poly1->coeffs, len1, ptr2, poly3->coeffs, len3, 
+        poly3inv->coeffs, poly3inv->length, ctx);
+    _fq_poly_set_length(res, len);
+    _fq_poly_normalise(res);
+
+    _fq_poly_clear(ptr2, vec_len);
+}
@@ -31,7 +31,7 @@ int _fq_poly_divides(fq_struct *Q,
                      const fq_ctx_t ctx)
 {
     fq_struct *R;
-    long lenR;
+    long lenR = lenB - 1;
 
     R = _fq_poly_init(lenA);
 
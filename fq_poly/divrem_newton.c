@@ -0,0 +1,120 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly.h"
+
+void _fq_poly_divrem_newton(fq_struct *Q, fq_struct *R, 
+    const fq_struct *A, long lenA, const fq_struct *B, long lenB, 
+    const fq_t invB, const fq_ctx_t ctx)
+{
+    const long lenQ = lenA - lenB + 1;
+    const long len  = FLINT_MIN(lenB, lenQ);
+    fq_struct *Brev, *Binv;
+    long i;
+
+    Brev = _fq_poly_init(2 * lenQ);
+    Binv = Brev + lenQ;
+
+    for (i = 0; i < len; i++)
+        fq_set(Brev + i, B + (lenB - 1 - i));
+
+    _fq_poly_inv_series_newton(Binv, Brev, lenQ, invB, ctx);
+
+    _fq_poly_divrem_newton_n_preinv(Q, R, A, lenA, B, lenB, Binv, lenQ, ctx);
+
+    _fq_poly_clear(Brev, 2 * lenQ);
+}
+
+void fq_poly_divrem_newton(fq_poly_t Q, fq_poly_t R, 
+                           const fq_poly_t A, const fq_poly_t B, 
+                           const fq_ctx_t ctx)
+{
+    const long lenA = A->length, lenB = B->length, lenQ = lenA - lenB + 1;
+    fq_struct *q, *r;
+    fq_t invB;
+
+    if (lenB == 0)
+    {
+        printf("Exception (fq_poly_divrem_newton).  Division by zero.\n");
+        abort();
+    }
+
+    if (lenA < lenB)
+    {
+        fq_poly_set(R, A);
+        fq_poly_zero(Q);
+        return;
+    }
+
+    fq_init(invB);
+    fq_inv(invB, fq_poly_lead(B), ctx);
+
+    if (Q == A || Q == B)
+    {
+        q = _fq_poly_init(lenQ);
+    }
+    else
+    {
+        fq_poly_fit_length(Q, lenQ);
+        q = Q->coeffs;
+    }
+    if (R == A || R == B)
+    {
+        r = _fq_poly_init(lenB - 1);
+    }
+    else
+    {
+        fq_poly_fit_length(R, lenB - 1);
+        r = R->coeffs;
+    }
+
+    _fq_poly_divrem_newton(q, r, A->coeffs, lenA, B->coeffs, lenB, invB, ctx);
+
+    if (Q == A || Q == B)
+    {
+        _fq_poly_clear(Q->coeffs, Q->alloc);
+        Q->coeffs = q;
+        Q->alloc  = lenQ;
+        Q->length = lenQ;
+    }
+    else
+    {
+        _fq_poly_set_length(Q, lenQ);
+    }
+    if (R == A || R == B)
+    {
+        _fq_poly_clear(R->coeffs, R->alloc);
+        R->coeffs = r;
+        R->alloc  = lenB - 1;
+        R->length = lenB - 1;
+    }
+    else
+    {
+        _fq_poly_set_length(R, lenB - 1);
+    }
+    _fq_poly_normalise(R);
+
+    fq_clear(invB);
+}
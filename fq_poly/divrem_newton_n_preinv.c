@@ -0,0 +1,120 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly.h"
+
+void _fq_poly_divrem_newton_n_preinv(fq_struct *Q, fq_struct *R, 
+    const fq_struct *A, long lenA, const fq_struct *B, long lenB, 
+    const fq_struct *Binv, long lenBinv, const fq_ctx_t ctx)
+{
+    const long lenQ = lenA - lenB + 1;
+    fq_struct *W;
+
+    W = _fq_poly_init(FLINT_MAX(lenQ, lenB - 1));
+
+    _fq_poly_reverse(W, A + (lenA - lenQ), lenQ, lenQ);
+    _fq_poly_mullow(Q, W, lenQ, Binv, FLINT_MIN(lenQ, lenBinv), lenQ, ctx);
+    _fq_poly_reverse(Q, Q, lenQ, lenQ);
+
+    if (lenB > 1)
+    {
+        if (lenQ >= lenB - 1)
+            _fq_poly_mullow(W, Q, lenQ, B, lenB - 1, lenB - 1, ctx);
+        else
+            _fq_poly_mullow(W, B, lenB - 1, Q, lenQ, lenB - 1, ctx);
+
+        _fq_poly_sub(R, A, lenB - 1, W, lenB - 1, ctx);
+    }
+
+    _fq_poly_clear(W, FLINT_MAX(lenQ, lenB - 1));
+}
+
+void fq_poly_divrem_newton_n_preinv(fq_poly_t Q, fq_poly_t R, 
+    const fq_poly_t A, const fq_poly_t B, const fq_poly_t Binv, 
+    const fq_ctx_t ctx)
+{
+    const long lenA = A->length, lenB = B->length, lenBinv = Binv->length;
+    const long lenQ = lenA - lenB + 1;
+    fq_struct *q, *r;
+
+    if (lenB == 0)
+    {
+        printf("Exception (fq_poly_divrem_newton_n_preinv).  Division by zero.\n");
+        abort();
+    }
+
+    if (lenA < lenB)
+    {
+        fq_poly_set(R, A);
+        fq_poly_zero(Q);
+        return;
+    }
+
+    if (Q == A || Q == B || Q == Binv)
+    {
+        q = _fq_poly_init(lenQ);
+    }
+    else
+    {
+        fq_poly_fit_length(Q, lenQ);
+        q = Q->coeffs;
+    }
+    if (R == A || R == B || R == Binv)
+    {
+        r = _fq_poly_init(lenB - 1);
+    }
+    else
+    {
+        fq_poly_fit_length(R, lenB - 1);
+        r = R->coeffs;
+    }
+
+    _fq_poly_divrem_newton_n_preinv(q, r, A->coeffs, lenA, B->coeffs, lenB, 
+                                    Binv->coeffs, lenBinv, ctx);
+
+    if (Q == A || Q == B || Q == Binv)
+    {
+        _fq_poly_clear(Q->coeffs, Q->alloc);
+        Q->coeffs = q;
+        Q->alloc  = lenQ;
+        Q->length = lenQ;
+    }
+    else
+    {
+        _fq_poly_set_length(Q, lenQ);
+    }
+    if (R == A || R == B || R == Binv)
+    {
+        _fq_poly_clear(R->coeffs, R->alloc);
+        R->coeffs = r;
+        R->alloc  = lenB - 1;
+        R->length = lenB - 1;
+    }
+    else
+    {
+        _fq_poly_set_length(R, lenB - 1);
+    }
+    _fq_poly_normalise(R);
+}
@@ -0,0 +1,86 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly.h"
+
+long _fq_poly_gcd(fq_struct *G, const fq_struct *A, long lenA, 
+                  const fq_struct *B, long lenB, const fq_ctx_t ctx)
+{
+    if (lenB < FQ_POLY_GCD_CUTOFF)
+        return _fq_poly_gcd_euclidean(G, A, lenA, B, lenB, ctx);
+    else
+        return _fq_poly_gcd_hgcd(G, A, lenA, B, lenB, ctx);
+}
+
+void fq_poly_gcd(fq_poly_t G, const fq_poly_t A, const fq_poly_t B, 
+                 const fq_ctx_t ctx)
+{
+    if (A->length < B->length)
+    {
+        fq_poly_gcd(G, B, A, ctx);
+    }
+    else /* lenA >= lenB >= 0 */
+    {
+        long lenA = A->length, lenB = B->length, lenG;
+        fq_poly_t tG;
+        fq_struct *g;
+
+        if (lenA == 0) /* lenA = lenB = 0 */
+        {
+            fq_poly_zero(G);
+        } 
+        else if (lenB == 0) /* lenA > lenB = 0 */
+        {
+            fq_poly_make_monic(G, A, ctx);
+        }
+        else /* lenA >= lenB >= 1 */
+        {
+            if (G == A || G == B)
+            {
+                fq_poly_init2(tG, FLINT_MIN(lenA, lenB));
+                g = tG->coeffs;
+            }
+            else
+            {
+                fq_poly_fit_length(G, FLINT_MIN(lenA, lenB));
+                g = G->coeffs;
+            }
+
+            lenG = _fq_poly_gcd(g, A->coeffs, lenA, B->coeffs, lenB, ctx);
+
+            if (G == A || G == B)
+            {
+                fq_poly_swap(tG, G);
+                fq_poly_clear(tG);
+            }
+            G->length = lenG;
+
+            if (G->length == 1)
+                fq_one(G->coeffs + 0);
+            else
+                fq_poly_make_monic(G, G, ctx);
+        }
+    }
+}
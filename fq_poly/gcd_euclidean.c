@@ -24,121 +24,74 @@
 
 ******************************************************************************/
 
-#include <stdlib.h>
 #include "fq_poly.h"
 
-long _fq_poly_gcd_euclidean(fq_struct* G,const fq_struct* A, long lenA, 
-                            const fq_struct* B, long lenB, const fq_ctx_t ctx)
+long _fq_poly_gcd_euclidean(fq_struct *G, const fq_struct *A, long lenA, 
+                            const fq_struct *B, long lenB, const fq_ctx_t ctx)
 {
-    long lenR1 = lenA, lenR2 = lenB, lenT; /* assumes lenA \geq lenB */
-    
-    fq_struct *R1, *R2, *T;
-    
-    fq_t inv;
-
-    fq_init(inv);
-    T = _fq_poly_init(lenA);
-    R1 = _fq_poly_init(lenA);
-    R2 = _fq_poly_init(lenB);
-    _fq_poly_set(R1,A,lenA);
-    _fq_poly_set(R2,B,lenB);
-
-    while(lenR2 > 0)
-      {
-          if(!fq_is_zero(&R2[lenR2-1])) fq_inv(inv,&R2[lenR2-1],ctx);
-             else printf("something wrong with length");
-	_fq_poly_rem(R1, R1, lenR1, R2, lenR2, inv, ctx);
-	_fq_poly_normalise2(R1,&lenR1);
-	
-	_fq_poly_set(T,R1,lenR1);
-	_fq_poly_set(R1,R2,lenR2);
-	_fq_poly_set(R2,T,lenR1);
-	lenT = lenR1; 
-	lenR1 = lenR2;
-	lenR2 = lenT;
-      }
-
-    _fq_poly_set(G,R1,lenR1);
-    return lenR1;
-}
-/*
-
-    fq_struct *F, *R1, *R2, *R3 = G, *T;
-    fq_t inv;
-    
-    fq_init(inv);
-    fq_inv(inv,&B[lenB-1],ctx);
-
     if (lenB == 1)
     {
-        fq_set(&G[0],&B[0]);
+        fq_one(G);
         return 1;
     }
+    else  /* lenA >= lenB > 1 */
+    {
+        const long lenW = FLINT_MAX(lenA - lenB + 1, lenB) + lenA + 2 * lenB;
+        fq_t invR3;
+        fq_struct *Q, *R1, *R2, *R3, *T, *W;
+        long lenR2, lenR3;
 
-    F  = _fq_poly_init(2*lenB);
-    R1 = F;
-    R2 = R1 + lenB - 1;
+        W  = _fq_poly_init(lenW);
+        Q  = W;
+        R1 = W + FLINT_MAX(lenA - lenB + 1, lenB);
+        R2 = R1 + lenA;
+        R3 = R2 + lenB;
 
-    _fq_poly_rem(R1, A, lenA, B, lenB, inv, ctx);
-    lenR1 = lenB - 1;
-    _fq_poly_normalise2(R1,&lenR1);
+        fq_init(invR3);
+        fq_inv(invR3, B + (lenB - 1), ctx);
 
-    if (lenR1 > 1)
-    {
-        fq_inv(inv,R1+(lenR1-1),ctx);
-        _fq_poly_rem(R2, B, lenB, R1, lenR1, inv, ctx);
-        lenR2 = lenR1 - 1;
-        _fq_poly_normalise2(R2, &lenR2);
-    }
-    else
-    {
-        if (lenR1 == 0)
+        _fq_poly_divrem(Q, R1, A, lenA, B, lenB, invR3, ctx);
+
+        lenR3 = lenB - 1;
+        FQ_VEC_NORM(R1, lenR3);
+
+        if (lenR3 == 0)
         {
             _fq_poly_set(G, B, lenB);
-            _fq_poly_clear(F,2*lenB);
+            _fq_poly_clear(W, lenW);
+            fq_clear(invR3);
             return lenB;
         }
-        else
+
+        T  = R3;
+        R3 = R1;
+        R1 = T;
+        _fq_poly_set(R2, B, lenB);
+        lenR2 = lenB;
+
+        do
         {
-            fq_set(&G[0],&R1[0]);
-            _fq_poly_clear(F,2*lenB);
-            return 1;
-        }
-    }
+            fq_inv(invR3, R3 + (lenR3 - 1), ctx);
 
-    for (steps = 2; lenR2 > 1; steps++)
-    {
+            _fq_poly_divrem(Q, R1, R2, lenR2, R3, lenR3, invR3, ctx);
+            lenR2 = lenR3--;
+            FQ_VEC_NORM(R1, lenR3);
+            T = R2; R2 = R3; R3 = R1; R1 = T;
+        } 
+        while (lenR3 > 0);
 
-        fq_inv(inv,R2+(lenR2 -1),ctx);
-        _fq_poly_normalise2(R2,&lenR2);
-        _fq_poly_rem(R3, R1, lenR1, R2, lenR2, inv, ctx);
-        lenR1 = lenR2--;
-        _fq_poly_normalise2(R3, &lenR2);
-        T = R1; R1 = R2; R2 = R3; R3 = T;
-    }
+        _fq_poly_set(G, R2, lenR2);
 
-    if (lenR2 == 1)
-    {
-        lenG = 1;
-        if (steps % 3) 
-            fq_set(&G[0],&R2[0]);
-    }
-    else
-    {
-        lenG = lenR1;
-        if (steps % 3 != 1)
-            _fq_poly_set(G, R1, lenR1);
-    }
+        _fq_poly_clear(W, lenW);
+        fq_clear(invR3);
 
-    _fq_poly_clear(F,2*lenB);
-    fq_clear(inv);
-    return lenG;
+        return lenR2;
+    }
 }
 
-*/
-
 void fq_poly_gcd_euclidean(fq_poly_t G, 
-                           const fq_poly_t A, const fq_poly_t B, const fq_ctx_t ctx)
+                           const fq_poly_t A, const fq_poly_t B, 
+                           const fq_ctx_t ctx)
 {
     if (A->length < B->length)
     {
@@ -146,8 +99,8 @@ void fq_poly_gcd_euclidean(fq_poly_t G,
     }
     else /* lenA >= lenB >= 0 */
     {
-        long lenA = A->length, lenB = B->length, lenG;
-        fq_poly_t tG;
+        const long lenA = A->length, lenB = B->length;
+        long lenG;
         fq_struct *g;
 
         if (lenA == 0) /* lenA = lenB = 0 */
@@ -162,8 +115,7 @@ void fq_poly_gcd_euclidean(fq_poly_t G,
         {
             if (G == A || G == B)
             {
-                fq_poly_init2(tG, FLINT_MIN(lenA, lenB));
-                g = tG->coeffs;
+                g = _fq_poly_init(FLINT_MIN(lenA, lenB));
             }
             else
             {
@@ -172,19 +124,21 @@ void fq_poly_gcd_euclidean(fq_poly_t G,
             }
 
             lenG = _fq_poly_gcd_euclidean(g, A->coeffs, lenA,
-                                               B->coeffs, lenB, ctx);
+                                             B->coeffs, lenB, ctx);
 
             if (G == A || G == B)
             {
-                fq_poly_swap(tG, G);
-                fq_poly_clear(tG);
+                _fq_poly_clear(G->coeffs, G->alloc);
+                G->coeffs = g;
+                G->alloc  = FLINT_MIN(lenA, lenB);
+                G->length = FLINT_MIN(lenA, lenB);
             }
-            G->length = lenG;
+            _fq_poly_set_length(G, lenG);
 
-            if (G->length == 1)
-                fq_one(&(G->coeffs[0]));
+            if (lenG == 1)
+                fq_one(G->coeffs);
             else
-                fq_poly_make_monic(G, G,ctx);
+                fq_poly_make_monic(G, G, ctx);
         }
     }
 }
@@ -0,0 +1,153 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly.h"
+
+#define __set(B, lenB, A, lenA)     \
+do {                                \
+    _fq_poly_set((B), (A), (lenA)); \
+    (lenB) = (lenA);                \
+} while (0)
+
+#define __rem(R, lenR, A, lenA, B, lenB)                          \
+do {                                                              \
+    if ((lenA) >= (lenB))                                         \
+    {                                                             \
+        fq_t __invB;                                              \
+                                                                  \
+        fq_init(__invB);                                          \
+        fq_inv(__invB, (B) + ((lenB) - 1), ctx);                  \
+        _fq_poly_rem((R), (A), (lenA), (B), (lenB), __invB, ctx); \
+        (lenR) = (lenB) - 1;                                      \
+        FQ_VEC_NORM((R), (lenR));                                 \
+        fq_clear(__invB);                                         \
+    }                                                             \
+    else                                                          \
+    {                                                             \
+        _fq_poly_set((R), (A), (lenA));                           \
+        (lenR) = (lenA);                                          \
+    }                                                             \
+} while (0)
+
+/*
+    XXX: Incidentally, this implementation currently supports aliasing.  
+    But since this may change in the future, no function other than 
+    fq_poly_gcd_hgcd() should rely on this.
+ */
+
+long _fq_poly_gcd_hgcd(fq_struct *G, const fq_struct *A, long lenA, 
+                       const fq_struct *B, long lenB, const fq_ctx_t ctx)
+{
+    fq_struct *J = _fq_poly_init(2 * lenB + lenA);
+    fq_struct *R = J + lenB;
+
+    long lenG, lenJ, lenR;
+
+    __rem(R, lenR, A, lenA, B, lenB);
+
+    if (lenR == 0)
+    {
+        __set(G, lenG, B, lenB);
+    }
+    else
+    {
+        _fq_poly_hgcd(NULL, NULL, G, &(lenG), J, &(lenJ), B, lenB, R, lenR, ctx);
+
+        while (lenJ != 0)
+        {
+            __rem(R, lenR, G, lenG, J, lenJ);
+
+            if (lenR == 0)
+            {
+                __set(G, lenG, J, lenJ);
+                break;
+            }
+            if (lenJ < FQ_POLY_GCD_CUTOFF)
+            {
+                lenG = _fq_poly_gcd_euclidean(G, J, lenJ, R, lenR, ctx);
+                break;
+            }
+
+            _fq_poly_hgcd(NULL, NULL, G, &(lenG), J, &(lenJ), J, lenJ, R, lenR, ctx);
+        }
+    }
+    _fq_poly_clear(J, 2 * lenB + lenA);
+
+    return lenG;
+}
+
+void fq_poly_gcd_hgcd(fq_poly_t G, const fq_poly_t A, const fq_poly_t B, 
+                      const fq_ctx_t ctx)
+{
+    if (A->length < B->length)
+    {
+        fq_poly_gcd_hgcd(G, B, A, ctx);
+    }
+    else /* lenA >= lenB >= 0 */
+    {
+        long lenA = A->length, lenB = B->length, lenG;
+        fq_poly_t tG;
+        fq_struct *g;
+
+        if (lenA == 0) /* lenA = lenB = 0 */
+        {
+            fq_poly_zero(G);
+        } 
+        else if (lenB == 0) /* lenA > lenB = 0 */
+        {
+            fq_poly_make_monic(G, A, ctx);
+        }
+        else /* lenA >= lenB >= 1 */
+        {
+            if (G == A || G == B)
+            {
+                fq_poly_init2(tG, FLINT_MIN(lenA, lenB));
+                g = tG->coeffs;
+            }
+            else
+            {
+                fq_poly_fit_length(G, FLINT_MIN(lenA, lenB));
+                g = G->coeffs;
+            }
+
+            lenG = _fq_poly_gcd_hgcd(g, A->coeffs, lenA, B->coeffs, lenB, ctx);
+
+            if (G == A || G == B)
+            {
+                fq_poly_swap(tG, G);
+                fq_poly_clear(tG);
+            }
+            G->length = lenG;
+
+            if (G->length == 1)
+                fq_one(G->coeffs + 0);
+            else
+                fq_poly_make_monic(G, G, ctx);
+        }
+    }
+}
+
+#undef __set
+#undef __rem
@@ -0,0 +1,163 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly.h"
+
+#define FQ_POLY_INV_NEWTON_CUTOFF  64
+
+/*
+    Classical inversion of the power series {Q, n} modulo x^n, 
+    using the recurrence Qinv[i] = - cinv sum_{j=1}^{i} Q[j] Qinv[i-j].
+ */
+static void 
+__fq_poly_inv_series_basecase(fq_struct *Qinv, const fq_struct *Q, long n, 
+                              const fq_t cinv, const fq_ctx_t ctx)
+{
+    long i, j;
+    fq_t s, t;
+
+    fq_init(s);
+    fq_init(t);
+
+    fq_set(Qinv, cinv);
+
+    for (i = 1; i < n; i++)
+    {
+        fq_zero(s);
+        for (j = 1; j <= i; j++)
+        {
+            fq_mul(t, Q + j, Qinv + (i - j), ctx);
+            fq_add(s, s, t, ctx);
+        }
+        fq_mul(Qinv + i, s, cinv, ctx);
+        fq_neg(Qinv + i, Qinv + i, ctx);
+    }
+
+    fq_clear(s);
+    fq_clear(t);
+}
+
+void 
+_fq_poly_inv_series_newton(fq_struct *Qinv, const fq_struct *Q, long n, 
+                           const fq_t cinv, const fq_ctx_t ctx)
+{
+    if (n < FQ_POLY_INV_NEWTON_CUTOFF)
+    {
+        __fq_poly_inv_series_basecase(Qinv, Q, n, cinv, ctx);
+    }
+    else
+    {
+        long *a, i, m;
+        fq_struct *W;
+
+        W = _fq_poly_init(n);
+
+        for (i = 1; (1L << i) < n; i++) ;
+
+        a = (long *) flint_malloc(i * sizeof(long));
+        a[i = 0] = n;
+        while (n >= FQ_POLY_INV_NEWTON_CUTOFF)
+            a[++i] = (n = (n + 1) / 2);
+
+        __fq_poly_inv_series_basecase(Qinv, Q, n, cinv, ctx);
+
+        for (i--; i >= 0; i--)
+        {
+            m = n;
+            n = a[i];
+
+            _fq_poly_mullow(W, Q, n, Qinv, m, n, ctx);
+            _fq_poly_mullow(Qinv + m, Qinv, m, W + m, n - m, n - m, ctx);
+            _fq_poly_neg(Qinv + m, Qinv + m, n - m, ctx);
+        }
+
+        _fq_poly_clear(W, a[0]);
+        flint_free(a);
+    }
+}
+
+void fq_poly_inv_series_newton(fq_poly_t Qinv, const fq_poly_t Q, long n, 
+                               const fq_ctx_t ctx)
+{
+    const long lenQ = Q->length;
+    fq_struct *Qcopy;
+    int Qalloc;
+    fq_t cinv;
+
+    if (lenQ == 0 || fq_is_zero(Q->coeffs + 0))
+    {
+        printf("Exception (fq_poly_inv_series_newton).  Division by zero.\n");
+        abort();
+    }
+
+    if (lenQ >= n)
+    {
+        Qcopy = Q->coeffs;
+        Qalloc = 0;
+    }
+    else
+    {
+        long i;
+
+        Qcopy = (fq_struct *) flint_malloc(n * sizeof(fq_struct));
+        for (i = 0; i < lenQ; i++)
+            Qcopy[i] = Q->coeffs[i];
+        for ( ; i < n; i++)
+            fq_init(Qcopy + i);
+        Qalloc = 1;
+    }
+
+    fq_init(cinv);
+    fq_inv(cinv, Q->coeffs + 0, ctx);
+
+    if (Qinv != Q)
+    {
+        fq_poly_fit_length(Qinv, n);
+        _fq_poly_inv_series_newton(Qinv->coeffs, Qcopy, n, cinv, ctx);
+    }
+    else
+    {
+        fq_struct *t = _fq_poly_init(n);
+
+        _fq_poly_inv_series_newton(t, Qcopy, n, cinv, ctx);
+
+        _fq_poly_clear(Qinv->coeffs, Qinv->alloc);
+        Qinv->coeffs = t;
+        Qinv->alloc  = n;
+        Qinv->length = n;
+    }
+    _fq_poly_set_length(Qinv, n);
+    _fq_poly_normalise(Qinv);
+
+    if (Qalloc)
+    {
+        long i;
+
+        for (i = lenQ; i < n; i++)
+            fq_clear(Qcopy + i);
+        flint_free(Qcopy);
+    }
+    fq_clear(cinv);
+}
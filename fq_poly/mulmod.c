@@ -0,0 +1,104 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly.h"
+
+void _fq_poly_mulmod(fq_struct *res, const fq_struct *poly1, long len1, 
+                     const fq_struct *poly2, long len2, 
+                     const fq_struct *f, long lenf, const fq_ctx_t ctx)
+{
+    const long lenT = len1 + len2 - 1;
+    const long lenQ = lenT - lenf + 1;
+    fq_struct *T, *Q;
+    fq_t invf;
+    long i;
+
+    T = _fq_poly_init(lenT + lenQ);
+    Q = T + lenT;
+
+    if (len1 >= len2)
+        _fq_poly_mul(T, poly1, len1, poly2, len2, ctx);
+    else
+        _fq_poly_mul(T, poly2, len2, poly1, len1, ctx);
+
+    fq_init(invf);
+    fq_inv(invf, f + (lenf - 1), ctx);
+
+    _fq_poly_divrem(Q, T, T, lenT, f, lenf, invf, ctx);
+
+    for (i = 0; i < lenf - 1; i++)
+        fq_swap(res + i, T + i);
+
+    _fq_poly_clear(T, lenT + lenQ);
+    fq_clear(invf);
+}
+
+void fq_poly_mulmod(fq_poly_t res, 
+                    const fq_poly_t poly1, const fq_poly_t poly2, 
+                    const fq_poly_t f, const fq_ctx_t ctx)
+{
+    const long len1 = poly1->length, len2 = poly2->length, lenf = f->length;
+
+    if (lenf == 0)
+    {
+        printf("Exception (fq_poly_mulmod).  Division by zero.\n");
+        abort();
+    }
+
+    if (lenf == 1 || len1 == 0 || len2 == 0)
+    {
+        fq_poly_zero(res);
+        return;
+    }
+
+    if (len1 + len2 - lenf > 0)
+    {
+        if (res == f)
+        {
+            fq_poly_t t;
+
+            fq_poly_init2(t, lenf - 1);
+            _fq_poly_mulmod(t->coeffs, poly1->coeffs, len1, 
+                                       poly2->coeffs, len2, 
+                                       f->coeffs, lenf, ctx);
+            fq_poly_swap(res, t);
+            fq_poly_clear(t);
+        }
+        else
+        {
+            fq_poly_fit_length(res, lenf - 1);
+            _fq_poly_mulmod(res->coeffs, poly1->coeffs, len1, 
+                                         poly2->coeffs, len2, 
+                                         f->coeffs, lenf, ctx);
+        }
+
+        _fq_poly_set_length(res, lenf - 1);
+        _fq_poly_normalise(res);
+    }
+    else
+    {
+        fq_poly_mul(res, poly1, poly2, ctx);
+    }
+}
@@ -0,0 +1,75 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly.h"
+
+void _fq_poly_powmod_fmpz_binexp(fq_struct *res, const fq_struct *poly, 
+                                 const fmpz_t e, const fq_struct *f, long lenf, 
+                                 const fq_ctx_t ctx)
+{
+    fq_struct *finv;
+    fq_t invf;
+
+    if (lenf == 2)
+    {
+        fq_pow(res, poly, e, ctx);
+        return;
+    }
+
+    finv = _fq_poly_init(2 * lenf);
+
+    fq_init(invf);
+    fq_inv(invf, f + (lenf - 1), ctx);
+
+    _fq_poly_reverse(finv + lenf, f, lenf, lenf);
+    _fq_poly_inv_series_newton(finv, finv + lenf, lenf, invf, ctx);
+
+    _fq_poly_powmod_fmpz_binexp_preinv(res, poly, e, f, lenf, 
+                                       finv, lenf, ctx);
+
+    _fq_poly_clear(finv, 2 * lenf);
+    fq_clear(invf);
+}
+
+void fq_poly_powmod_fmpz_binexp(fq_poly_t res, const fq_poly_t poly, 
+                                const fmpz_t e, const fq_poly_t f, 
+                                const fq_ctx_t ctx)
+{
+    fq_poly_t finv;
+
+    if (f->length == 0)
+    {
+        printf("Exception (fq_poly_powmod_fmpz_binexp).  Division by zero.\n");
+        abort();
+    }
+
+    fq_poly_init(finv);
+    fq_poly_reverse(finv, f, f->length);
+    fq_poly_inv_series_newton(finv, finv, f->length, ctx);
+
+    fq_poly_powmod_fmpz_binexp_preinv(res, poly, e, f, finv, ctx);
+
+    fq_poly_clear(finv);
+}
@@ -0,0 +1,205 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly.h"
+
+/*
+    Sets {R, lenf - 1} to {T, lenT} modulo {f, lenf}, destroying T.  
+    Assumes that lenf - 1 <= lenT <= 2 lenf - 3.
+ */
+static void 
+__fq_poly_rem_preinv(fq_struct *R, fq_struct *T, long lenT, fq_struct *Q, 
+                     const fq_struct *f, long lenf, 
+                     const fq_struct *finv, long lenfinv, const fq_ctx_t ctx)
+{
+    long i;
+
+    if (lenT >= lenf)
+    {
+        if (lenf < FQ_POLY_DIVREM_NEWTON_CUTOFF)
+            _fq_poly_divrem_basecase(Q, T, T, lenT, f, lenf, finv + 0, ctx);
+        else
+            _fq_poly_divrem_newton_n_preinv(Q, T, T, lenT, f, lenf, 
+                                            finv, lenfinv, ctx);
+    }
+
+    for (i = 0; i < lenf - 1; i++)
+        fq_swap(R + i, T + i);
+}
+
+void _fq_poly_powmod_fmpz_binexp_preinv(fq_struct *res, 
+    const fq_struct *poly, const fmpz_t e, const fq_struct *f, long lenf, 
+    const fq_struct *finv, long lenfinv, const fq_ctx_t ctx)
+{
+    const long lenT = 2 * lenf - 3, lenQ = lenT - lenf + 1;
+    fq_struct *T, *Q;
+    long i;
+    int isx;
+
+    if (lenf == 2)
+    {
+        fq_pow(res, poly, e, ctx);
+        return;
+    }
+
+    T = _fq_poly_init(lenT + lenQ);
+    Q = T + lenT;
+
+    /*
+        Multiplication by X only requires a shift and a single 
+        step of the division algorithm, so we special case this.
+     */
+    isx = fq_is_zero(poly + 0) && fq_is_one(poly + 1);
+    for (i = 2; isx && i < lenf - 1; i++)
+        isx = fq_is_zero(poly + i);
+
+    _fq_poly_set(res, poly, lenf - 1);
+
+    for (i = fmpz_sizeinbase(e, 2) - 2; i >= 0; i--)
+    {
+        _fq_poly_sqr(T, res, lenf - 1, ctx);
+        __fq_poly_rem_preinv(res, T, lenT, Q, f, lenf, finv, lenfinv, ctx);
+
+        if (fmpz_tstbit(e, i))
+        {
+            if (isx)
+            {
+                _fq_poly_shift_left(T, res, lenf - 1, 1);
+                _fq_poly_divrem_basecase(Q, T, T, lenf, f, lenf, finv + 0, ctx);
+                _fq_poly_set(res, T, lenf - 1);
+            }
+            else
+            {
+                _fq_poly_mul(T, res, lenf - 1, poly, lenf - 1, ctx);
+                __fq_poly_rem_preinv(res, T, lenT, Q, f, lenf, 
+                                     finv, lenfinv, ctx);
+            }
+        }
+    }
+
+    _fq_poly_clear(T, lenT + lenQ);
+}
+
+void fq_poly_powmod_fmpz_binexp_preinv(fq_poly_t res, 
+    const fq_poly_t poly, const fmpz_t e, 
+    const fq_poly_t f, const fq_poly_t finv, const fq_ctx_t ctx)
+{
+    const long len = poly->length, lenf = f->length, trunc = lenf - 1;
+    fq_struct *q;
+    int qcopy = 0;
+
+    if (lenf == 0)
+    {
+        printf("Exception (fq_poly_powmod_fmpz_binexp_preinv).  "
+               "Division by zero.\n");
+        abort();
+    }
+
+    if (fmpz_sgn(e) < 0)
+    {
+        printf("Exception (fq_poly_powmod_fmpz_binexp_preinv).  "
+               "Negative exponent.\n");
+        abort();
+    }
+
+    if (lenf == 1)
+    {
+        fq_poly_zero(res);
+        return;
+    }
+
+    if (len >= lenf)
+    {
+        fq_poly_t t, r;
+
+        fq_poly_init(t);
+        fq_poly_init(r);
+        fq_poly_divrem(t, r, poly, f, ctx);
+        fq_poly_powmod_fmpz_binexp_preinv(res, r, e, f, finv, ctx);
+        fq_poly_clear(t);
+        fq_poly_clear(r);
+        return;
+    }
+
+    if (fmpz_cmp_ui(e, 2) <= 0)
+    {
+        if (fmpz_is_zero(e))
+        {
+            fq_poly_one(res);
+        }
+        else if (fmpz_is_one(e))
+        {
+            fq_poly_set(res, poly);
+        }
+        else
+        {
+            fq_poly_mulmod_preinv(res, poly, poly, f, finv, ctx);
+        }
+        return;
+    }
+
+    if (len == 0)
+    {
+        fq_poly_zero(res);
+        return;
+    }
+
+    if (len < trunc)
+    {
+        long i;
+
+        q = _fq_poly_init(trunc);
+        for (i = 0; i < len; i++)
+            fq_set(q + i, poly->coeffs + i);
+        qcopy = 1;
+    }
+    else
+    {
+        q = poly->coeffs;
+    }
+
+    if ((res == poly && !qcopy) || res == f || res == finv)
+    {
+        fq_poly_t t;
+
+        fq_poly_init2(t, trunc);
+        _fq_poly_powmod_fmpz_binexp_preinv(t->coeffs, q, e, f->coeffs, lenf, 
+                                           finv->coeffs, finv->length, ctx);
+        fq_poly_swap(res, t);
+        fq_poly_clear(t);
+    }
+    else
+    {
+        fq_poly_fit_length(res, trunc);
+        _fq_poly_powmod_fmpz_binexp_preinv(res->coeffs, q, e, f->coeffs, lenf, 
+                                           finv->coeffs, finv->length, ctx);
+    }
+
+    if (qcopy)
+        _fq_poly_clear(q, trunc);
+
+    _fq_poly_set_length(res, trunc);
+    _fq_poly_normalise(res);
+}
@@ -0,0 +1,49 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly.h"
+
+void _fq_poly_powmod_ui_binexp(fq_struct *res, const fq_struct *poly, 
+                               ulong e, const fq_struct *f, long lenf, 
+                               const fq_ctx_t ctx)
+{
+    fmpz_t t;
+
+    fmpz_init(t);
+    fmpz_set_ui(t, e);
+    _fq_poly_powmod_fmpz_binexp(res, poly, t, f, lenf, ctx);
+    fmpz_clear(t);
+}
+
+void fq_poly_powmod_ui_binexp(fq_poly_t res, const fq_poly_t poly, ulong e, 
+                              const fq_poly_t f, const fq_ctx_t ctx)
+{
+    fmpz_t t;
+
+    fmpz_init(t);
+    fmpz_set_ui(t, e);
+    fq_poly_powmod_fmpz_binexp(res, poly, t, f, ctx);
+    fmpz_clear(t);
+}
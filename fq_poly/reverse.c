@@ -0,0 +1,72 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly.h"
+
+void _fq_poly_reverse(fq_struct *rop, const fq_struct *op, long len, long n)
+{
+    if (rop == op)
+    {
+        long i;
+
+        for (i = 0; i < n / 2; i++)
+        {
+            fq_struct t = rop[i];
+            rop[i] = rop[n - 1 - i];
+            rop[n - 1 - i] = t;
+        }
+
+        for (i = 0; i < n - len; i++)
+            fq_zero(rop + i);
+    }
+    else
+    {
+        long i;
+
+        for (i = 0; i < n - len; i++)
+            fq_zero(rop + i);
+
+        for (i = 0; i < len; i++)
+            fq_set(rop + (n - len) + i, op + (len - 1) - i);
+    }
+}
+
+void fq_poly_reverse(fq_poly_t rop, const fq_poly_t op, long n)
+{
+    long len = FLINT_MIN(n, op->length);
+
+    if (len == 0)
+    {
+        fq_poly_zero(rop);
+        return;
+    }
+
+    fq_poly_fit_length(rop, n);
+
+    _fq_poly_reverse(rop->coeffs, op->coeffs, len, n);
+
+    _fq_poly_set_length(rop, n);
+    _fq_poly_normalise(rop);
+}
@@ -0,0 +1,239 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_poly.h"
+
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    printf("compose_mod_horner... ");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* Check aliasing of res and a */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, b, c, res;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(b);
+        fq_poly_init(c);
+        fq_poly_init(res);
+
+        fq_poly_randtest_not_zero(c, state, n_randint(state, 40) + 1, ctx);
+        fq_poly_randtest(a, state, n_randint(state, 20), ctx);
+        fq_poly_randtest(b, state, n_randint(state, 20), ctx);
+
+        fq_poly_compose_mod_horner(res, a, b, c, ctx);
+        fq_poly_compose_mod_horner(a, a, b, c, ctx);
+
+        result = (fq_poly_equal(res, a));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a   = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b   = "), fq_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("c   = "), fq_poly_print_pretty(c, "X", ctx), printf("\n");
+            printf("res = "), fq_poly_print_pretty(res, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(b);
+        fq_poly_clear(c);
+        fq_poly_clear(res);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Check aliasing of res and b */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, b, c, res;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(b);
+        fq_poly_init(c);
+        fq_poly_init(res);
+
+        fq_poly_randtest_not_zero(c, state, n_randint(state, 40) + 1, ctx);
+        fq_poly_randtest(a, state, n_randint(state, 20), ctx);
+        fq_poly_randtest(b, state, n_randint(state, 20), ctx);
+
+        fq_poly_compose_mod_horner(res, a, b, c, ctx);
+        fq_poly_compose_mod_horner(b, a, b, c, ctx);
+
+        result = (fq_poly_equal(res, b));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a   = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b   = "), fq_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("c   = "), fq_poly_print_pretty(c, "X", ctx), printf("\n");
+            printf("res = "), fq_poly_print_pretty(res, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(b);
+        fq_poly_clear(c);
+        fq_poly_clear(res);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Check aliasing of res and c */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, b, c, res;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(b);
+        fq_poly_init(c);
+        fq_poly_init(res);
+
+        fq_poly_randtest_not_zero(c, state, n_randint(state, 40) + 1, ctx);
+        fq_poly_randtest(a, state, n_randint(state, 20), ctx);
+        fq_poly_randtest(b, state, n_randint(state, 20), ctx);
+
+        fq_poly_compose_mod_horner(res, a, b, c, ctx);
+        fq_poly_compose_mod_horner(c, a, b, c, ctx);
+
+        result = (fq_poly_equal(res, c));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a   = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b   = "), fq_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("c   = "), fq_poly_print_pretty(c, "X", ctx), printf("\n");
+            printf("res = "), fq_poly_print_pretty(res, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(b);
+        fq_poly_clear(c);
+        fq_poly_clear(res);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Compare with compose followed by rem */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, b, c, res, t;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(b);
+        fq_poly_init(c);
+        fq_poly_init(res);
+        fq_poly_init(t);
+
+        fq_poly_randtest_not_zero(c, state, n_randint(state, 40) + 1, ctx);
+        fq_poly_randtest(a, state, n_randint(state, 20), ctx);
+        fq_poly_randtest(b, state, n_randint(state, 20), ctx);
+
+        fq_poly_compose_mod_horner(res, a, b, c, ctx);
+        fq_poly_compose(t, a, b, ctx);
+        fq_poly_rem(t, t, c, ctx);
+
+        result = (fq_poly_equal(res, t));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a   = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b   = "), fq_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("c   = "), fq_poly_print_pretty(c, "X", ctx), printf("\n");
+            printf("res = "), fq_poly_print_pretty(res, "X", ctx), printf("\n");
+            printf("t   = "), fq_poly_print_pretty(t, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(b);
+        fq_poly_clear(c);
+        fq_poly_clear(res);
+        fq_poly_clear(t);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
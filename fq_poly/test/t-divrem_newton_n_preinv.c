@@ -0,0 +1,407 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_poly.h"
+
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    printf("divrem_newton_n_preinv... ");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* Compare with divrem_basecase */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, b, binv, q, r, s, t;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(b);
+        fq_poly_init(binv);
+        fq_poly_init(q);
+        fq_poly_init(r);
+        fq_poly_init(s);
+        fq_poly_init(t);
+
+        fq_poly_randtest_not_zero(b, state, n_randint(state, 100) + 1, ctx);
+        fq_poly_randtest(a, state, n_randint(state, 2 * b->length - 1), ctx);
+
+        fq_poly_reverse(binv, b, b->length);
+        fq_poly_inv_series_newton(binv, binv, b->length, ctx);
+
+        fq_poly_divrem_newton_n_preinv(q, r, a, b, binv, ctx);
+        fq_poly_divrem_basecase(s, t, a, b, ctx);
+
+        result = (fq_poly_equal(q, s) && fq_poly_equal(r, t));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b = "), fq_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("q = "), fq_poly_print_pretty(q, "X", ctx), printf("\n");
+            printf("r = "), fq_poly_print_pretty(r, "X", ctx), printf("\n");
+            printf("s = "), fq_poly_print_pretty(s, "X", ctx), printf("\n");
+            printf("t = "), fq_poly_print_pretty(t, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(b);
+        fq_poly_clear(binv);
+        fq_poly_clear(q);
+        fq_poly_clear(r);
+        fq_poly_clear(s);
+        fq_poly_clear(t);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Check aliasing: a and r */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, b, binv, q, r;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(b);
+        fq_poly_init(binv);
+        fq_poly_init(q);
+        fq_poly_init(r);
+
+        fq_poly_randtest_not_zero(b, state, n_randint(state, 100) + 1, ctx);
+        fq_poly_randtest(a, state, n_randint(state, 2 * b->length - 1), ctx);
+
+        fq_poly_reverse(binv, b, b->length);
+        fq_poly_inv_series_newton(binv, binv, b->length, ctx);
+
+        fq_poly_divrem_newton_n_preinv(q, r, a, b, binv, ctx);
+        fq_poly_divrem_newton_n_preinv(q, a, a, b, binv, ctx);
+
+        result = (fq_poly_equal(a, r));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b = "), fq_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("q = "), fq_poly_print_pretty(q, "X", ctx), printf("\n");
+            printf("r = "), fq_poly_print_pretty(r, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(b);
+        fq_poly_clear(binv);
+        fq_poly_clear(q);
+        fq_poly_clear(r);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Check aliasing: b and r */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, b, binv, q, r;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(b);
+        fq_poly_init(binv);
+        fq_poly_init(q);
+        fq_poly_init(r);
+
+        fq_poly_randtest_not_zero(b, state, n_randint(state, 100) + 1, ctx);
+        fq_poly_randtest(a, state, n_randint(state, 2 * b->length - 1), ctx);
+
+        fq_poly_reverse(binv, b, b->length);
+        fq_poly_inv_series_newton(binv, binv, b->length, ctx);
+
+        fq_poly_divrem_newton_n_preinv(q, r, a, b, binv, ctx);
+        fq_poly_divrem_newton_n_preinv(q, b, a, b, binv, ctx);
+
+        result = (fq_poly_equal(b, r));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b = "), fq_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("q = "), fq_poly_print_pretty(q, "X", ctx), printf("\n");
+            printf("r = "), fq_poly_print_pretty(r, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(b);
+        fq_poly_clear(binv);
+        fq_poly_clear(q);
+        fq_poly_clear(r);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Check aliasing: a and q */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, b, binv, q, r;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(b);
+        fq_poly_init(binv);
+        fq_poly_init(q);
+        fq_poly_init(r);
+
+        fq_poly_randtest_not_zero(b, state, n_randint(state, 100) + 1, ctx);
+        fq_poly_randtest(a, state, n_randint(state, 2 * b->length - 1), ctx);
+
+        fq_poly_reverse(binv, b, b->length);
+        fq_poly_inv_series_newton(binv, binv, b->length, ctx);
+
+        fq_poly_divrem_newton_n_preinv(q, r, a, b, binv, ctx);
+        fq_poly_divrem_newton_n_preinv(a, r, a, b, binv, ctx);
+
+        result = (fq_poly_equal(a, q));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b = "), fq_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("q = "), fq_poly_print_pretty(q, "X", ctx), printf("\n");
+            printf("r = "), fq_poly_print_pretty(r, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(b);
+        fq_poly_clear(binv);
+        fq_poly_clear(q);
+        fq_poly_clear(r);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Check aliasing: b and q */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, b, binv, q, r;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(b);
+        fq_poly_init(binv);
+        fq_poly_init(q);
+        fq_poly_init(r);
+
+        fq_poly_randtest_not_zero(b, state, n_randint(state, 100) + 1, ctx);
+        fq_poly_randtest(a, state, n_randint(state, 2 * b->length - 1), ctx);
+
+        fq_poly_reverse(binv, b, b->length);
+        fq_poly_inv_series_newton(binv, binv, b->length, ctx);
+
+        fq_poly_divrem_newton_n_preinv(q, r, a, b, binv, ctx);
+        fq_poly_divrem_newton_n_preinv(b, r, a, b, binv, ctx);
+
+        result = (fq_poly_equal(b, q));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b = "), fq_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("q = "), fq_poly_print_pretty(q, "X", ctx), printf("\n");
+            printf("r = "), fq_poly_print_pretty(r, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(b);
+        fq_poly_clear(binv);
+        fq_poly_clear(q);
+        fq_poly_clear(r);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Check aliasing: binv and q */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, b, binv, q, r;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(b);
+        fq_poly_init(binv);
+        fq_poly_init(q);
+        fq_poly_init(r);
+
+        fq_poly_randtest_not_zero(b, state, n_randint(state, 100) + 1, ctx);
+        fq_poly_randtest(a, state, n_randint(state, 2 * b->length - 1), ctx);
+
+        fq_poly_reverse(binv, b, b->length);
+        fq_poly_inv_series_newton(binv, binv, b->length, ctx);
+
+        fq_poly_divrem_newton_n_preinv(q, r, a, b, binv, ctx);
+        fq_poly_divrem_newton_n_preinv(binv, r, a, b, binv, ctx);
+
+        result = (fq_poly_equal(binv, q));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b = "), fq_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("q = "), fq_poly_print_pretty(q, "X", ctx), printf("\n");
+            printf("r = "), fq_poly_print_pretty(r, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(b);
+        fq_poly_clear(binv);
+        fq_poly_clear(q);
+        fq_poly_clear(r);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Check aliasing: binv and r */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, b, binv, q, r;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(b);
+        fq_poly_init(binv);
+        fq_poly_init(q);
+        fq_poly_init(r);
+
+        fq_poly_randtest_not_zero(b, state, n_randint(state, 100) + 1, ctx);
+        fq_poly_randtest(a, state, n_randint(state, 2 * b->length - 1), ctx);
+
+        fq_poly_reverse(binv, b, b->length);
+        fq_poly_inv_series_newton(binv, binv, b->length, ctx);
+
+        fq_poly_divrem_newton_n_preinv(q, r, a, b, binv, ctx);
+        fq_poly_divrem_newton_n_preinv(q, binv, a, b, binv, ctx);
+
+        result = (fq_poly_equal(binv, r));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("b = "), fq_poly_print_pretty(b, "X", ctx), printf("\n");
+            printf("q = "), fq_poly_print_pretty(q, "X", ctx), printf("\n");
+            printf("r = "), fq_poly_print_pretty(r, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(b);
+        fq_poly_clear(binv);
+        fq_poly_clear(q);
+        fq_poly_clear(r);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,283 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_poly.h"
+
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    printf("powmod_fmpz_binexp_preinv... ");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* Check aliasing of res and a */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, f, finv, res;
+        fmpz_t e;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(f);
+        fq_poly_init(finv);
+        fq_poly_init(res);
+        fmpz_init(e);
+
+        fq_poly_randtest_not_zero(f, state, n_randint(state, 50) + 1, ctx);
+        if (n_randint(state, 2))
+            fq_poly_randtest(a, state, n_randint(state, 50), ctx);
+        else
+        {
+            fq_poly_one(a);
+            fq_poly_shift_left(a, a, 1);
+        }
+        fmpz_set_ui(e, n_randint(state, 50));
+
+        fq_poly_reverse(finv, f, f->length);
+        fq_poly_inv_series_newton(finv, finv, f->length, ctx);
+
+        fq_poly_powmod_fmpz_binexp_preinv(res, a, e, f, finv, ctx);
+        fq_poly_powmod_fmpz_binexp_preinv(a, a, e, f, finv, ctx);
+
+        result = (fq_poly_equal(res, a));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a   = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("f   = "), fq_poly_print_pretty(f, "X", ctx), printf("\n");
+            printf("res = "), fq_poly_print_pretty(res, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(f);
+        fq_poly_clear(finv);
+        fq_poly_clear(res);
+        fmpz_clear(e);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Check aliasing of res and f */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, f, finv, res;
+        fmpz_t e;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(f);
+        fq_poly_init(finv);
+        fq_poly_init(res);
+        fmpz_init(e);
+
+        fq_poly_randtest_not_zero(f, state, n_randint(state, 50) + 1, ctx);
+        if (n_randint(state, 2))
+            fq_poly_randtest(a, state, n_randint(state, 50), ctx);
+        else
+        {
+            fq_poly_one(a);
+            fq_poly_shift_left(a, a, 1);
+        }
+        fmpz_set_ui(e, n_randint(state, 50));
+
+        fq_poly_reverse(finv, f, f->length);
+        fq_poly_inv_series_newton(finv, finv, f->length, ctx);
+
+        fq_poly_powmod_fmpz_binexp_preinv(res, a, e, f, finv, ctx);
+        fq_poly_powmod_fmpz_binexp_preinv(f, a, e, f, finv, ctx);
+
+        result = (fq_poly_equal(res, f));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a   = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("f   = "), fq_poly_print_pretty(f, "X", ctx), printf("\n");
+            printf("res = "), fq_poly_print_pretty(res, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(f);
+        fq_poly_clear(finv);
+        fq_poly_clear(res);
+        fmpz_clear(e);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Check aliasing of res and finv */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, f, finv, res;
+        fmpz_t e;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(f);
+        fq_poly_init(finv);
+        fq_poly_init(res);
+        fmpz_init(e);
+
+        fq_poly_randtest_not_zero(f, state, n_randint(state, 50) + 1, ctx);
+        if (n_randint(state, 2))
+            fq_poly_randtest(a, state, n_randint(state, 50), ctx);
+        else
+        {
+            fq_poly_one(a);
+            fq_poly_shift_left(a, a, 1);
+        }
+        fmpz_set_ui(e, n_randint(state, 50));
+
+        fq_poly_reverse(finv, f, f->length);
+        fq_poly_inv_series_newton(finv, finv, f->length, ctx);
+
+        fq_poly_powmod_fmpz_binexp_preinv(res, a, e, f, finv, ctx);
+        fq_poly_powmod_fmpz_binexp_preinv(finv, a, e, f, finv, ctx);
+
+        result = (fq_poly_equal(res, finv));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a   = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("f   = "), fq_poly_print_pretty(f, "X", ctx), printf("\n");
+            printf("res = "), fq_poly_print_pretty(res, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(f);
+        fq_poly_clear(finv);
+        fq_poly_clear(res);
+        fmpz_clear(e);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    /* Compare with pow followed by rem */
+    for (i = 0; i < 500; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t a, f, finv, res, t;
+        fmpz_t e;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 10) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(a);
+        fq_poly_init(f);
+        fq_poly_init(finv);
+        fq_poly_init(res);
+        fq_poly_init(t);
+        fmpz_init(e);
+
+        fq_poly_randtest_not_zero(f, state, n_randint(state, 50) + 1, ctx);
+        if (n_randint(state, 2))
+            fq_poly_randtest(a, state, n_randint(state, 50), ctx);
+        else
+        {
+            fq_poly_one(a);
+            fq_poly_shift_left(a, a, 1);
+        }
+        fmpz_set_ui(e, n_randint(state, 50));
+
+        fq_poly_reverse(finv, f, f->length);
+        fq_poly_inv_series_newton(finv, finv, f->length, ctx);
+
+        fq_poly_powmod_fmpz_binexp_preinv(res, a, e, f, finv, ctx);
+        fq_poly_pow(t, a, fmpz_get_ui(e), ctx);
+        fq_poly_rem(t, t, f, ctx);
+
+        result = (fq_poly_equal(res, t));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a   = "), fq_poly_print_pretty(a, "X", ctx), printf("\n");
+            printf("f   = "), fq_poly_print_pretty(f, "X", ctx), printf("\n");
+            printf("res = "), fq_poly_print_pretty(res, "X", ctx), printf("\n");
+            printf("t   = "), fq_poly_print_pretty(t, "X", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(a);
+        fq_poly_clear(f);
+        fq_poly_clear(finv);
+        fq_poly_clear(res);
+        fq_poly_clear(t);
+        fmpz_clear(e);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,118 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#ifndef FQ_POLY_FACTOR_H
+#define FQ_POLY_FACTOR_H
+
+#undef ulong                /* interferes with system includes */
+#include <stdlib.h>
+#include <stdio.h>
+#define ulong unsigned long
+
+#include "fq_poly.h"
+
+/*  Type definitions *********************************************************/
+
+typedef struct
+{
+    fq_poly_struct *poly;
+    long *exp;
+    long num;
+    long alloc;
+}
+fq_poly_factor_struct;
+
+typedef fq_poly_factor_struct fq_poly_factor_t[1];
+
+/*  Memory management  *******************************************************/
+
+void fq_poly_factor_init(fq_poly_factor_t fac);
+
+void fq_poly_factor_clear(fq_poly_factor_t fac);
+
+void fq_poly_factor_realloc(fq_poly_factor_t fac, long alloc);
+
+void fq_poly_factor_fit_length(fq_poly_factor_t fac, long len);
+
+/*  Basic manipulation  ******************************************************/
+
+void fq_poly_factor_set(fq_poly_factor_t res, const fq_poly_factor_t fac);
+
+void fq_poly_factor_insert(fq_poly_factor_t fac, 
+                           const fq_poly_t poly, long exp);
+
+void fq_poly_factor_concat(fq_poly_factor_t res, const fq_poly_factor_t fac);
+
+void fq_poly_factor_pow(fq_poly_factor_t fac, long exp);
+
+/*  Irreducibility and squarefreeness  ***************************************/
+
+int fq_poly_is_irreducible(const fq_poly_t f, const fq_ctx_t ctx);
+
+int fq_poly_is_irreducible_ddf(const fq_poly_t f, const fq_ctx_t ctx);
+
+int _fq_poly_is_squarefree(const fq_struct *f, long len, const fq_ctx_t ctx);
+
+int fq_poly_is_squarefree(const fq_poly_t f, const fq_ctx_t ctx);
+
+/*  Factorisation  ***********************************************************/
+
+void fq_poly_factor_squarefree(fq_poly_factor_t res, 
+                               const fq_poly_t f, const fq_ctx_t ctx);
+
+void fq_poly_factor_distinct_deg(fq_poly_factor_t res, 
+                                 const fq_poly_t poly, long **degs, 
+                                 const fq_ctx_t ctx);
+
+int fq_poly_factor_equal_deg_prob(fq_poly_t factor, flint_rand_t state, 
+                                  const fq_poly_t pol, long d, 
+                                  const fq_ctx_t ctx);
+
+void fq_poly_factor_equal_deg(fq_poly_factor_t factors, 
+                              const fq_poly_t pol, long d, 
+                              const fq_ctx_t ctx);
+
+void fq_poly_factor_cantor_zassenhaus(fq_poly_factor_t res, 
+                                      const fq_poly_t f, const fq_ctx_t ctx);
+
+void fq_poly_factor_kaltofen_shoup(fq_poly_factor_t res, 
+                                   const fq_poly_t poly, const fq_ctx_t ctx);
+
+void fq_poly_factor_with_cantor_zassenhaus(fq_poly_factor_t res, 
+    fq_t leading_coeff, const fq_poly_t f, const fq_ctx_t ctx);
+
+void fq_poly_factor_with_kaltofen_shoup(fq_poly_factor_t res, 
+    fq_t leading_coeff, const fq_poly_t f, const fq_ctx_t ctx);
+
+void fq_poly_factor(fq_poly_factor_t res, fq_t leading_coeff, 
+                    const fq_poly_t f, const fq_ctx_t ctx);
+
+/*  Output  ******************************************************************/
+
+void fq_poly_factor_print_pretty(const fq_poly_factor_t fac, const char *var, 
+                                 const fq_ctx_t ctx);
+
+#endif
+
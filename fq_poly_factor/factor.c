@@ -0,0 +1,115 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly_factor.h"
+
+#define ZASSENHAUS 0
+#define KALTOFEN   1
+
+static void __fq_poly_factor(fq_poly_factor_t result, fq_t leading_coeff, 
+                             const fq_poly_t input, int algorithm, 
+                             const fq_ctx_t ctx)
+{
+    fq_poly_t monic_input;
+    fq_poly_factor_t sqfree_factors, factors;
+    long i, len;
+
+    len = input->length;
+
+    if (len <= 1)
+    {
+        if (len == 0)
+            fq_zero(leading_coeff);
+        else
+            fq_set(leading_coeff, input->coeffs + 0);
+        return;
+    }
+
+    fq_set(leading_coeff, input->coeffs + (len - 1));
+
+    fq_poly_init(monic_input);
+    fq_poly_make_monic(monic_input, input, ctx);
+
+    if (len == 2)
+    {
+        fq_poly_factor_insert(result, monic_input, 1);
+        fq_poly_clear(monic_input);
+        return;
+    }
+
+    if (algorithm == KALTOFEN)
+    {
+        fq_poly_factor_kaltofen_shoup(result, monic_input, ctx);
+    }
+    else
+    {
+        fq_poly_factor_init(sqfree_factors);
+        fq_poly_factor_squarefree(sqfree_factors, monic_input, ctx);
+
+        /* Run CZ on each of the square-free factors */
+        for (i = 0; i < sqfree_factors->num; i++)
+        {
+            fq_poly_factor_init(factors);
+            fq_poly_factor_cantor_zassenhaus(factors, 
+                                             sqfree_factors->poly + i, ctx);
+            fq_poly_factor_pow(factors, sqfree_factors->exp[i]);
+            fq_poly_factor_concat(result, factors);
+            fq_poly_factor_clear(factors);
+        }
+
+        fq_poly_factor_clear(sqfree_factors);
+    }
+
+    fq_poly_clear(monic_input);
+}
+
+void fq_poly_factor_with_cantor_zassenhaus(fq_poly_factor_t result, 
+                                           fq_t leading_coeff, 
+                                           const fq_poly_t input, 
+                                           const fq_ctx_t ctx)
+{
+    __fq_poly_factor(result, leading_coeff, input, ZASSENHAUS, ctx);
+}
+
+void fq_poly_factor_with_kaltofen_shoup(fq_poly_factor_t result, 
+                                        fq_t leading_coeff, 
+                                        const fq_poly_t input, 
+                                        const fq_ctx_t ctx)
+{
+    __fq_poly_factor(result, leading_coeff, input, KALTOFEN, ctx);
+}
+
+void fq_poly_factor(fq_poly_factor_t result, fq_t leading_coeff, 
+                    const fq_poly_t input, const fq_ctx_t ctx)
+{
+    const long n = fq_poly_degree(input);
+    const long bits = fmpz_bits(fq_ctx_prime(ctx)) * fq_ctx_degree(ctx);
+
+    if (5 * bits + n > 75)
+        __fq_poly_factor(result, leading_coeff, input, KALTOFEN, ctx);
+    else
+        __fq_poly_factor(result, leading_coeff, input, ZASSENHAUS, ctx);
+}
+
@@ -0,0 +1,62 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly_factor.h"
+
+void fq_poly_factor_equal_deg(fq_poly_factor_t factors, 
+                              const fq_poly_t pol, long d, 
+                              const fq_ctx_t ctx)
+{
+    if (pol->length == d + 1)
+    {
+        fq_poly_factor_insert(factors, pol, 1);
+    }
+    else
+    {
+        fq_poly_t f, g, r;
+        flint_rand_t state;
+
+        fq_poly_init(f);
+
+        flint_randinit(state);
+
+        while (!fq_poly_factor_equal_deg_prob(f, state, pol, d, ctx))
+        {
+        };
+
+        flint_randclear(state);
+
+        fq_poly_init(g);
+        fq_poly_init(r);
+        fq_poly_divrem(g, r, pol, f, ctx);
+        fq_poly_clear(r);
+
+        fq_poly_factor_equal_deg(factors, f, d, ctx);
+        fq_poly_clear(f);
+        fq_poly_factor_equal_deg(factors, g, d, ctx);
+        fq_poly_clear(g);
+    }
+}
+
@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly_factor.h"
+
+int fq_poly_factor_equal_deg_prob(fq_poly_t factor, flint_rand_t state, 
+                                  const fq_poly_t pol, long d, 
+                                  const fq_ctx_t ctx)
+{
+    fq_poly_t a, b, c;
+    fmpz_t exp;
+    int res = 1;
+    long i, k;
+
+    if (pol->length <= 1)
+    {
+        printf("Exception (fq_poly_factor_equal_deg_prob).  \n");
+        printf("Input polynomial is linear.\n");
+        abort();
+    }
+
+    fq_poly_init(a);
+
+    do
+    {
+        fq_poly_randtest(a, state, pol->length - 1, ctx);
+    } while (a->length <= 1);
+
+    fq_poly_gcd(factor, a, pol, ctx);
+
+    if (factor->length != 1)
+    {
+        fq_poly_clear(a);
+        return 1;
+    }
+
+    fq_poly_init(b);
+
+    /* k d is the degree of the extension of F_p in which the 
+       irreducible factors of pol split into linear factors */
+    k = fq_ctx_degree(ctx) * d;
+
+    if (fmpz_cmp_ui(fq_ctx_prime(ctx), 2) > 0)
+    {
+        /* compute a^{(q^d-1)/2} rem pol */
+        fmpz_init(exp);
+        fmpz_pow_ui(exp, fq_ctx_prime(ctx), k);
+        fmpz_sub_ui(exp, exp, 1);
+        fmpz_fdiv_q_2exp(exp, exp, 1);
+
+        fq_poly_powmod_fmpz_binexp(b, a, exp, pol, ctx);
+        fmpz_clear(exp);
+    }
+    else
+    {
+        /* compute b = (a^{2^{k-1}}+a^{2^{k-2}}+...+a^4+a^2+a) rem pol */
+        fq_poly_rem(b, a, pol, ctx);
+        fq_poly_init(c);
+        fq_poly_set(c, b);
+        for (i = 1; i < k; i++)
+        {
+            /* c = a^{2^i} = (a^{2^{i-1}})^2 */
+            fq_poly_mulmod(c, c, c, pol, ctx);
+            fq_poly_add(b, b, c, ctx);
+        }
+        fq_poly_clear(c);
+    }
+
+    /* b = b - 1 */
+    fq_poly_init(c);
+    fq_poly_one(c);
+    fq_poly_sub(b, b, c, ctx);
+    fq_poly_clear(c);
+
+    fq_poly_gcd(factor, b, pol, ctx);
+
+    if ((factor->length <= 1) || (factor->length == pol->length))
+        res = 0;
+
+    fq_poly_clear(a);
+    fq_poly_clear(b);
+
+    return res;
+}
+
@@ -0,0 +1,159 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly_factor.h"
+
+/*
+    Sets h to the p-th root of f, assuming that f' = 0, i.e. that 
+    f = \sum_i f_{ip} X^{ip}.  As the Frobenius map is an automorphism 
+    of order d of \mathbf{F}_q, the p-th root of a coefficient c is 
+    given by c^{p^{d-1}}.
+ */
+
+static void 
+__fq_poly_pth_root(fq_poly_t h, const fq_poly_t f, ulong p, const fq_ctx_t ctx)
+{
+    const long d = fq_ctx_degree(ctx);
+    long i, len = fq_poly_degree(f) / p + 1;
+
+    fq_poly_fit_length(h, len);
+    for (i = 0; i < len; i++)
+        fq_frobenius(h->coeffs + i, f->coeffs + i * p, d - 1, ctx);
+    _fq_poly_set_length(h, len);
+    _fq_poly_normalise(h);
+}
+
+void fq_poly_factor_squarefree(fq_poly_factor_t res, 
+                               const fq_poly_t f, const fq_ctx_t ctx)
+{
+    fq_poly_t f_d, g, g_1, r;
+    ulong p_ui;
+    long i;
+
+    if (f->length <= 1)
+    {
+        res->num = 0;
+        return;
+    }
+
+    if (f->length == 2)
+    {
+        fq_poly_factor_insert(res, f, 1);
+        return;
+    }
+
+    p_ui = fmpz_get_ui(fq_ctx_prime(ctx));
+
+    /* Step 1, look at f', if it is zero then we are done since f = h(x)^p
+       for some particular h(x), clearly f(x) = sum a_k x^kp, k <= deg(f) */
+
+    fq_poly_init(g_1);
+    fq_poly_init(f_d);
+    fq_poly_init(g);
+    fq_poly_derivative(f_d, f, ctx);
+
+    /* Case 1 */
+    if (fq_poly_is_zero(f_d))
+    {
+        fq_poly_factor_t new_res;
+        fq_poly_t h;
+
+        fq_poly_init(h);
+        __fq_poly_pth_root(h, f, p_ui, ctx);
+
+        /* Now run squarefree on h, and return it to the pth power */
+        fq_poly_factor_init(new_res);
+
+        fq_poly_factor_squarefree(new_res, h, ctx);
+        fq_poly_factor_pow(new_res, p_ui);
+
+        fq_poly_factor_concat(res, new_res);
+        fq_poly_clear(h);
+        fq_poly_factor_clear(new_res);
+    }
+    else
+    {
+        fq_poly_t h, z;
+
+        fq_poly_init(r);
+
+        fq_poly_gcd(g, f, f_d, ctx);
+        fq_poly_divrem(g_1, r, f, g, ctx);
+
+        i = 1;
+
+        fq_poly_init(h);
+        fq_poly_init(z);
+
+        /* Case 2 */
+        while (g_1->length > 1)
+        {
+            fq_poly_gcd(h, g_1, g, ctx);
+            fq_poly_divrem(z, r, g_1, h, ctx);
+
+            /* out <- out.z */
+            if (z->length > 1)
+            {
+                fq_poly_make_monic(z, z, ctx);
+                fq_poly_factor_insert(res, z, i);
+            }
+
+            i++;
+            fq_poly_set(g_1, h);
+            fq_poly_divrem(g, r, g, h, ctx);
+        }
+
+        fq_poly_clear(h);
+        fq_poly_clear(z);
+        fq_poly_clear(r);
+
+        fq_poly_make_monic(g, g, ctx);
+
+        if (g->length > 1)
+        {
+            /* so now we multiply res with squarefree(g^1/p) ^ p  */
+            fq_poly_t g_p;    /* g^(1/p) */
+            fq_poly_factor_t new_res_2;
+
+            fq_poly_init(g_p);
+            __fq_poly_pth_root(g_p, g, p_ui, ctx);
+
+            fq_poly_factor_init(new_res_2);
+
+            /* squarefree(g^(1/p)) */
+            fq_poly_factor_squarefree(new_res_2, g_p, ctx);
+            fq_poly_factor_pow(new_res_2, p_ui);
+
+            fq_poly_factor_concat(res, new_res_2);
+            fq_poly_clear(g_p);
+            fq_poly_factor_clear(new_res_2);
+        }
+    }
+
+    fq_poly_clear(g_1);
+    fq_poly_clear(f_d);
+    fq_poly_clear(g);
+}
+
@@ -0,0 +1,51 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly_factor.h"
+
+void fq_poly_factor_insert(fq_poly_factor_t fac, 
+                           const fq_poly_t poly, long exp)
+{
+    long i;
+
+    if (poly->length <= 1)
+        return;
+
+    for (i = 0; i < fac->num; i++)
+    {
+        if (fq_poly_equal(poly, fac->poly + i))
+        {
+            fac->exp[i] += exp;
+            return;
+        }
+    }
+
+    fq_poly_factor_fit_length(fac, fac->num + 1);
+
+    fq_poly_set(fac->poly + fac->num, poly);
+    fac->exp[fac->num] = exp;
+    fac->num++;
+}
+
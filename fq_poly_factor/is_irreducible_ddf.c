@@ -0,0 +1,65 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly_factor.h"
+
+int fq_poly_is_irreducible_ddf(const fq_poly_t f, const fq_ctx_t ctx)
+{
+    fq_poly_factor_t dist_deg;
+    long i, n, *degs;
+    int res = 1;
+
+    n = fq_poly_degree(f);
+
+    if (n < 2)
+        return 1;
+
+    if (!fq_poly_is_squarefree(f, ctx))
+        return 0;
+
+    degs = flint_malloc(n * sizeof(long));
+
+    fq_poly_factor_init(dist_deg);
+    fq_poly_factor_distinct_deg(dist_deg, f, &degs, ctx);
+    for (i = 0; i < dist_deg->num; i++)
+    {
+        if (degs[i] == n)
+        {
+            res = 1;
+            break;
+        }
+        if (degs[i] > 0)
+        {
+            res = 0;
+            break;
+        }
+    }
+
+    flint_free(degs);
+    fq_poly_factor_clear(dist_deg);
+
+    return res;
+}
+
@@ -0,0 +1,57 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_poly_factor.h"
+
+int _fq_poly_is_squarefree(const fq_struct *f, long len, const fq_ctx_t ctx)
+{
+    fq_struct *fd, *g;
+    long dlen;
+    int res;
+
+    if (len <= 2)
+        return len != 0;
+
+    fd = _fq_poly_init(2 * (len - 1));
+    g  = fd + (len - 1);
+
+    _fq_poly_derivative(fd, f, len, ctx);
+    dlen = len - 1;
+    FQ_VEC_NORM(fd, dlen);
+
+    if (dlen)
+        res = (_fq_poly_gcd(g, f, len, fd, dlen, ctx) == 1);
+    else
+        res = 0;   /* gcd(f, 0) = f, and len(f) > 2 */
+
+    _fq_poly_clear(fd, 2 * (len - 1));
+    return res;
+}
+
+int fq_poly_is_squarefree(const fq_poly_t f, const fq_ctx_t ctx)
+{
+    return _fq_poly_is_squarefree(f->coeffs, f->length, ctx);
+}
+
@@ -0,0 +1,118 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "fq_poly_factor.h"
+
+#define NF 5   /* number of fields */
+#define ND 8   /* number of degrees */
+
+/*
+    Benchmarking code for factorisation in fq_poly.
+
+    Compares Cantor-Zassenhaus and Kaltofen-Shoup on random polynomials 
+    of degree n over \mathbf{F}_{p^d} for a few choices of (p, d).
+*/
+
+int main(void)
+{
+    flint_rand_t state;
+    fq_poly_t f;
+    fq_poly_factor_t res;
+    fmpz_t p;
+    fq_ctx_t ctx;
+    int i, j, k;
+    long n;
+    double t, T1, T2;
+
+    const ulong primes[NF] = {2, 3, 5, 101, 65521};
+    const long dims[NF] = {8, 5, 3, 2, 2};
+    const long degs[ND] = {8, 16, 32, 64, 128, 256, 512, 1024};
+    const int iter_count[ND] = {100, 50, 20, 10, 5, 2, 1, 1};
+
+    flint_randinit(state);
+    fmpz_init(p);
+
+    for (i = 0; i < NF; i++)
+    {
+        fmpz_set_ui(p, primes[i]);
+        fq_ctx_init_conway(ctx, p, dims[i], "a");
+
+        printf("========== p: %lu, d: %ld ==========\n", primes[i], dims[i]);
+        fflush(stdout);
+
+        for (j = 0; j < ND; j++)
+        {
+            n = degs[j];
+
+            T1 = 0;
+            T2 = 0;
+            for (k = 0; k < iter_count[j]; k++)
+            {
+                fq_poly_init(f);
+                fq_poly_randtest_not_zero(f, state, n + 1, ctx);
+                fq_poly_make_monic(f, f, ctx);
+
+                if (n <= 128)
+                {
+                    t = clock();
+                    fq_poly_factor_init(res);
+                    fq_poly_factor_cantor_zassenhaus(res, f, ctx);
+                    fq_poly_factor_clear(res);
+                    t = (clock() - t) / CLOCKS_PER_SEC;
+                    T1 += t;
+                }
+
+                t = clock();
+                fq_poly_factor_init(res);
+                fq_poly_factor_kaltofen_shoup(res, f, ctx);
+                fq_poly_factor_clear(res);
+                t = (clock() - t) / CLOCKS_PER_SEC;
+                T2 += t;
+
+                fq_poly_clear(f);
+            }
+
+            if (n <= 128)
+                printf("n: %4ld  CZ: %.3lf KS: %.3lf\n", n, 
+                       T1 / iter_count[j], T2 / iter_count[j]);
+            else
+                printf("n: %4ld  CZ: -     KS: %.3lf\n", n, 
+                       T2 / iter_count[j]);
+            fflush(stdout);
+        }
+
+        fq_ctx_clear(ctx);
+    }
+
+    fmpz_clear(p);
+    flint_randclear(state);
+    _fmpz_cleanup();
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,148 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_poly_factor.h"
+
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int iter;
+    flint_rand_t state;
+
+    printf("factor_distinct_deg... ");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100; iter++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t poly1, poly, q, r, product;
+        fq_poly_factor_t res;
+        long i, j, length, num;
+        long exp[5];
+        long *degs;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 5) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(poly1);
+        fq_poly_init(poly);
+        fq_poly_init(q);
+        fq_poly_init(r);
+
+        fq_poly_one(poly1);
+
+        length = n_randint(state, 7) + 2;
+        do 
+        {
+            fq_poly_randtest(poly, state, length, ctx);
+            if (poly->length)
+                fq_poly_make_monic(poly, poly, ctx);
+        }
+        while ((poly->length < 2) || (!fq_poly_is_irreducible(poly, ctx)));
+
+        exp[0] = n_randint(state, 1) + 1;
+        for (i = 0; i < exp[0]; i++)
+            fq_poly_mul(poly1, poly1, poly, ctx);
+
+        num = n_randint(state, 5) + 1;
+
+        for (i = 1; i < num; i++)
+        {
+            do 
+            {
+                length = n_randint(state, 7) + 2;
+                fq_poly_randtest(poly, state, length, ctx);
+                if (poly->length)
+                {
+                    fq_poly_make_monic(poly, poly, ctx);
+                    fq_poly_divrem(q, r, poly1, poly, ctx);
+                }
+            }
+            while ((poly->length < 2) || (!fq_poly_is_irreducible(poly, ctx)) 
+                   || (r->length == 0));
+
+            exp[i] = n_randint(state, 1) + 1;
+            for (j = 0; j < exp[i]; j++)
+                fq_poly_mul(poly1, poly1, poly, ctx);
+        }
+
+        degs = flint_malloc((poly1->length - 1) * sizeof(long));
+
+        fq_poly_factor_init(res);
+        fq_poly_factor_distinct_deg(res, poly1, &degs, ctx);
+
+        fq_poly_init(product);
+        fq_poly_one(product);
+        for (i = 0; i < res->num; i++)
+        {
+            if (fq_poly_degree(res->poly + i) % degs[i] != 0)
+            {
+                printf("Error: factor degree is not a multiple of %ld\n", degs[i]);
+                printf("factor:\n"), fq_poly_print_pretty(res->poly + i, "x", ctx), printf("\n");
+                abort();
+            }
+            fq_poly_mul(product, product, res->poly + i, ctx);
+        }
+
+        if (!fq_poly_equal(poly1, product))
+        {
+            printf("Error: product of factors does not equal the original "
+                   "polynomial\n");
+            printf("poly:\n"), fq_poly_print_pretty(poly1, "x", ctx), printf("\n");
+            printf("product:\n"), fq_poly_print_pretty(product, "x", ctx), printf("\n");
+            abort();
+        }
+
+        flint_free(degs);
+        fq_poly_clear(product);
+        fq_poly_clear(q);
+        fq_poly_clear(r);
+        fq_poly_clear(poly1);
+        fq_poly_clear(poly);
+        fq_poly_factor_clear(res);
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,117 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_poly_factor.h"
+
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int iter;
+    flint_rand_t state;
+
+    printf("factor_equal_deg_prob... ");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 100; iter++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t poly1, poly2, q, r;
+        long length;
+        int i, num;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 5) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(q);
+        fq_poly_init(r);
+        fq_poly_init(poly1);
+        fq_poly_init(poly2);
+
+        length = n_randint(state, 7) + 2;
+        do 
+        {
+            fq_poly_randtest(poly1, state, length, ctx);
+            if (poly1->length)
+                fq_poly_make_monic(poly1, poly1, ctx);
+        }
+        while ((poly1->length < 2) || (!fq_poly_is_irreducible(poly1, ctx)));
+
+        num = n_randint(state, 5) + 1;
+
+        for (i = 0; i < num; i++)
+        {
+            do 
+            {
+                fq_poly_randtest(poly2, state, length, ctx);
+                if (poly2->length)
+                    fq_poly_make_monic(poly2, poly2, ctx);
+            }
+            while ((poly2->length < 2) || (!fq_poly_is_irreducible(poly2, ctx)));
+
+            fq_poly_mul(poly1, poly1, poly2, ctx);
+        }
+
+        while (!fq_poly_factor_equal_deg_prob(poly2, state, poly1, length - 1, ctx))
+        {
+        };
+        fq_poly_divrem(q, r, poly1, poly2, ctx);
+        if (!fq_poly_is_zero(r))
+        {
+            printf("FAIL:\n");
+            printf("Error: factor does not divide original polynomial\n");
+            printf("factor:\n"), fq_poly_print_pretty(poly2, "x", ctx), printf("\n");
+            printf("polynomial:\n"), fq_poly_print_pretty(poly1, "x", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(q);
+        fq_poly_clear(r);
+        fq_poly_clear(poly1);
+        fq_poly_clear(poly2);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,123 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_poly_factor.h"
+
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int iter;
+    flint_rand_t state;
+
+    printf("is_squarefree... ");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    for (iter = 0; iter < 200; iter++)
+    {
+        fmpz_t p;
+        long d;
+        fq_ctx_t ctx;
+
+        fq_poly_t poly, Q, R, t;
+        fq_t x;
+        long i, num_factors, exp, max_exp;
+        int v, result;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 5) + 1;
+        fq_ctx_init_conway(ctx, p, d, "a");
+
+        fq_poly_init(poly);
+        fq_poly_init(t);
+        fq_poly_init(Q);
+        fq_poly_init(R);
+        fq_init(x);
+
+        fq_randtest(x, state, ctx);
+        fq_poly_set_coeff(poly, 0, x);
+        num_factors = n_randint(state, 5);
+
+        max_exp = 0;
+        for (i = 0; i < num_factors; i++)
+        {
+            do 
+            {
+                fq_poly_randtest(t, state, n_randint(state, 10), ctx);
+            } while (!fq_poly_is_irreducible(t, ctx) || (t->length < 2));
+
+            exp = n_randint(state, 4) + 1;
+            if (n_randint(state, 2) == 0)
+                exp = 1;
+
+            fq_poly_divrem(Q, R, poly, t, ctx);
+            if (!fq_poly_is_zero(R))
+            {
+                fq_poly_pow(t, t, exp, ctx);
+                fq_poly_mul(poly, poly, t, ctx);
+                max_exp = FLINT_MAX(exp, max_exp);
+            }
+        }
+
+        v = fq_poly_is_squarefree(poly, ctx);
+
+        if (v == 1)
+            result = (max_exp <= 1 && !fq_poly_is_zero(poly));
+        else
+            result = (max_exp > 1 || fq_poly_is_zero(poly));
+
+        if (!result)
+        {
+            printf("FAIL:\n");
+            printf("max_exp = %ld, v = %d\n", max_exp, v);
+            printf("poly = "), fq_poly_print_pretty(poly, "x", ctx), printf("\n");
+            abort();
+        }
+
+        fq_poly_clear(poly);
+        fq_poly_clear(t);
+        fq_poly_clear(Q);
+        fq_poly_clear(R);
+        fq_clear(x);
+
+        fmpz_clear(p);
+        fq_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
+
@@ -0,0 +1,305 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#ifndef FQ_ZECH_H
+#define FQ_ZECH_H
+
+#undef ulong                /* interferes with system includes */
+#include <stdlib.h>
+#include <stdio.h>
+#define ulong unsigned long
+
+#include "fq.h"
+#include "fq_nmod.h"
+#include "ulong_extras.h"
+
+/* Data types and context ****************************************************/
+
+/*
+    Bound on the number of bits of q; the context holds three tables of
+    q limbs each, and products of two logarithms must fit in a limb.
+*/
+
+#if FLINT_BITS == 64
+#define FQ_ZECH_MAX_BITS 24
+#else
+#define FQ_ZECH_MAX_BITS 16
+#endif
+
+/*
+    An element is stored as its discrete logarithm to the base X, which
+    generates the multiplicative group as the defining polynomial is a
+    Conway polynomial.  Zero is represented by q - 1.
+ */
+
+typedef struct
+{
+    mp_limb_t value;
+}
+fq_zech_struct;
+
+typedef fq_zech_struct fq_zech_t[1];
+
+typedef struct
+{
+    mp_limb_t q;
+    mp_limb_t qm1;
+    mp_limb_t qm1o2;
+
+    mp_limb_t *zech_log_table;
+    mp_limb_t *log_table;
+    mp_limb_t *eval_table;
+
+    fq_nmod_ctx_t fq_nmod_ctx;
+}
+fq_zech_ctx_struct;
+
+typedef fq_zech_ctx_struct fq_zech_ctx_t[1];
+
+int _fq_zech_ctx_init_conway(fq_zech_ctx_t ctx,
+                             const fmpz_t p, long d, const char *var);
+
+void fq_zech_ctx_init_conway(fq_zech_ctx_t ctx,
+                             const fmpz_t p, long d, const char *var);
+
+void fq_zech_ctx_clear(fq_zech_ctx_t ctx);
+
+static __inline__ long fq_zech_ctx_degree(const fq_zech_ctx_t ctx)
+{
+    return fq_nmod_ctx_degree(ctx->fq_nmod_ctx);
+}
+
+#define fq_zech_ctx_prime(ctx)  (fq_nmod_ctx_prime((ctx)->fq_nmod_ctx))
+
+static __inline__ void fq_zech_ctx_print(const fq_zech_ctx_t ctx)
+{
+    fq_nmod_ctx_print(ctx->fq_nmod_ctx);
+    printf("q = %lu\n", ctx->q);
+}
+
+/* Memory managment  *********************************************************/
+
+static __inline__ void fq_zech_init(fq_zech_t rop, const fq_zech_ctx_t ctx)
+{
+    rop->value = ctx->qm1;
+}
+
+static __inline__ void fq_zech_init2(fq_zech_t rop, const fq_zech_ctx_t ctx)
+{
+    rop->value = ctx->qm1;
+}
+
+static __inline__ void fq_zech_clear(fq_zech_t rop, const fq_zech_ctx_t ctx)
+{
+}
+
+/* Basic arithmetic **********************************************************/
+
+static __inline__ void fq_zech_add(fq_zech_t rop, const fq_zech_t op1,
+                                   const fq_zech_t op2,
+                                   const fq_zech_ctx_t ctx)
+{
+    const mp_limb_t a = op1->value, b = op2->value, qm1 = ctx->qm1;
+    mp_limb_t z;
+
+    if (a == qm1)
+    {
+        rop->value = b;
+    }
+    else if (b == qm1)
+    {
+        rop->value = a;
+    }
+    else
+    {
+        /* X^a + X^b = X^a (1 + X^(b - a)) */
+        z = ctx->zech_log_table[(b >= a) ? b - a : b + qm1 - a];
+
+        if (z == qm1)
+            rop->value = qm1;
+        else
+            rop->value = (z >= qm1 - a) ? z - (qm1 - a) : z + a;
+    }
+}
+
+static __inline__ void fq_zech_neg(fq_zech_t rop, const fq_zech_t op,
+                                   const fq_zech_ctx_t ctx)
+{
+    const mp_limb_t a = op->value, qm1 = ctx->qm1;
+
+    if (a == qm1)
+        rop->value = qm1;
+    else
+        rop->value = (a >= qm1 - ctx->qm1o2) ? a - (qm1 - ctx->qm1o2)
+                                              : a + ctx->qm1o2;
+}
+
+static __inline__ void fq_zech_sub(fq_zech_t rop, const fq_zech_t op1,
+                                   const fq_zech_t op2,
+                                   const fq_zech_ctx_t ctx)
+{
+    fq_zech_t t;
+
+    fq_zech_neg(t, op2, ctx);
+    fq_zech_add(rop, op1, t, ctx);
+}
+
+static __inline__ void fq_zech_mul(fq_zech_t rop, const fq_zech_t op1,
+                                   const fq_zech_t op2,
+                                   const fq_zech_ctx_t ctx)
+{
+    const mp_limb_t a = op1->value, b = op2->value, qm1 = ctx->qm1;
+
+    if (a == qm1 || b == qm1)
+        rop->value = qm1;
+    else
+        rop->value = (b >= qm1 - a) ? b - (qm1 - a) : a + b;
+}
+
+static __inline__ void fq_zech_sqr(fq_zech_t rop, const fq_zech_t op,
+                                   const fq_zech_ctx_t ctx)
+{
+    fq_zech_mul(rop, op, op, ctx);
+}
+
+void fq_zech_mul_fmpz(fq_zech_t rop, const fq_zech_t op, const fmpz_t x,
+                      const fq_zech_ctx_t ctx);
+
+void fq_zech_mul_si(fq_zech_t rop, const fq_zech_t op, long x,
+                    const fq_zech_ctx_t ctx);
+
+void fq_zech_mul_ui(fq_zech_t rop, const fq_zech_t op, ulong x,
+                    const fq_zech_ctx_t ctx);
+
+static __inline__ void fq_zech_inv(fq_zech_t rop, const fq_zech_t op,
+                                   const fq_zech_ctx_t ctx)
+{
+    if (op->value == ctx->qm1)
+    {
+        printf("Exception (fq_zech_inv).  Zero is not invertible.\n");
+        abort();
+    }
+
+    rop->value = (op->value == 0) ? 0 : ctx->qm1 - op->value;
+}
+
+void fq_zech_pow(fq_zech_t rop, const fq_zech_t op, const fmpz_t e,
+                 const fq_zech_ctx_t ctx);
+
+void fq_zech_pow_ui(fq_zech_t rop, const fq_zech_t op, ulong e,
+                    const fq_zech_ctx_t ctx);
+
+/* Randomisation *************************************************************/
+
+void fq_zech_randtest(fq_zech_t rop, flint_rand_t state,
+                      const fq_zech_ctx_t ctx);
+
+void fq_zech_randtest_not_zero(fq_zech_t rop, flint_rand_t state,
+                               const fq_zech_ctx_t ctx);
+
+/* Comparison ****************************************************************/
+
+static __inline__
+int fq_zech_equal(const fq_zech_t op1, const fq_zech_t op2,
+                  const fq_zech_ctx_t ctx)
+{
+    return op1->value == op2->value;
+}
+
+static __inline__
+int fq_zech_is_zero(const fq_zech_t op, const fq_zech_ctx_t ctx)
+{
+    return op->value == ctx->qm1;
+}
+
+static __inline__
+int fq_zech_is_one(const fq_zech_t op, const fq_zech_ctx_t ctx)
+{
+    return op->value == 0;
+}
+
+/* Assignments and conversions ***********************************************/
+
+static __inline__
+void fq_zech_set(fq_zech_t rop, const fq_zech_t op, const fq_zech_ctx_t ctx)
+{
+    rop->value = op->value;
+}
+
+static __inline__
+void fq_zech_swap(fq_zech_t op1, fq_zech_t op2, const fq_zech_ctx_t ctx)
+{
+    mp_limb_t t = op1->value;
+    op1->value = op2->value;
+    op2->value = t;
+}
+
+static __inline__ void fq_zech_zero(fq_zech_t rop, const fq_zech_ctx_t ctx)
+{
+    rop->value = ctx->qm1;
+}
+
+static __inline__ void fq_zech_one(fq_zech_t rop, const fq_zech_ctx_t ctx)
+{
+    rop->value = 0;
+}
+
+static __inline__ void fq_zech_gen(fq_zech_t rop, const fq_zech_ctx_t ctx)
+{
+    rop->value = (ctx->qm1 == 1) ? 0 : 1;
+}
+
+void fq_zech_get_fq_nmod(fq_nmod_t rop, const fq_zech_t op,
+                         const fq_zech_ctx_t ctx);
+
+void fq_zech_set_fq_nmod(fq_zech_t rop, const fq_nmod_t op,
+                         const fq_zech_ctx_t ctx);
+
+void fq_zech_get_fq(fq_t rop, const fq_zech_t op, const fq_zech_ctx_t ctx);
+
+void fq_zech_set_fq(fq_zech_t rop, const fq_t op, const fq_zech_ctx_t ctx);
+
+/* Output ********************************************************************/
+
+int fq_zech_fprint_pretty(FILE * file, const fq_zech_t op,
+                          const fq_zech_ctx_t ctx);
+
+static __inline__
+int fq_zech_print_pretty(const fq_zech_t op, const fq_zech_ctx_t ctx)
+{
+    return fq_zech_fprint_pretty(stdout, op, ctx);
+}
+
+/* Special functions *********************************************************/
+
+void fq_zech_trace(fmpz_t rop, const fq_zech_t op, const fq_zech_ctx_t ctx);
+
+void fq_zech_frobenius(fq_zech_t rop, const fq_zech_t op, long e,
+                       const fq_zech_ctx_t ctx);
+
+void fq_zech_norm(fmpz_t rop, const fq_zech_t op, const fq_zech_ctx_t ctx);
+
+#endif
+
@@ -0,0 +1,132 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_zech.h"
+
+int _fq_zech_ctx_init_conway(fq_zech_ctx_t ctx,
+                             const fmpz_t p, long d, const char *var)
+{
+    fmpz_t q;
+    mp_limb_t i, n, r, qm1;
+    mp_limb_t *x;
+    nmod_t mod;
+    long k, len;
+    const mp_limb_t *a;
+    const long *j;
+
+    fmpz_init(q);
+    fmpz_pow_ui(q, p, d);
+
+    if (fmpz_bits(q) > FQ_ZECH_MAX_BITS
+        || !_fq_nmod_ctx_init_conway(ctx->fq_nmod_ctx, p, d, var))
+    {
+        fmpz_clear(q);
+        return 0;
+    }
+
+    mod = ctx->fq_nmod_ctx->mod;
+    a   = ctx->fq_nmod_ctx->a;
+    j   = ctx->fq_nmod_ctx->j;
+    len = ctx->fq_nmod_ctx->len;
+
+    ctx->q     = fmpz_get_ui(q);
+    ctx->qm1   = qm1 = ctx->q - 1;
+    ctx->qm1o2 = (mod.n == 2UL) ? 0UL : qm1 / 2;
+
+    ctx->zech_log_table = flint_malloc(ctx->q * sizeof(mp_limb_t));
+    ctx->log_table      = flint_malloc(ctx->q * sizeof(mp_limb_t));
+    ctx->eval_table     = flint_malloc(ctx->q * sizeof(mp_limb_t));
+
+    for (n = 0; n < ctx->q; n++)
+        ctx->log_table[n] = qm1;
+
+    /*
+        Walk through the powers X^i, storing the integer p-adic
+        evaluation n of each one and the inverse map n -> i.
+     */
+    x = _nmod_vec_init(d);
+    _nmod_vec_zero(x, d);
+    x[0] = 1UL;
+
+    for (i = 0; i < qm1; i++)
+    {
+        for (n = 0, k = d - 1; k >= 0; k--)
+            n = n * mod.n + x[k];
+
+        if (ctx->log_table[n] != qm1)
+        {
+            printf("Exception (fq_zech_ctx_init_conway).  ");
+            printf("The defining polynomial is not primitive.\n");
+            abort();
+        }
+
+        ctx->eval_table[i] = n;
+        ctx->log_table[n]  = i;
+
+        r = x[d - 1];
+        for (k = d - 1; k > 0; k--)
+            x[k] = x[k - 1];
+        x[0] = 0UL;
+
+        if (r != 0UL)
+            for (k = 0; k < len - 1; k++)
+                x[j[k]] = nmod_sub(x[j[k]], n_mulmod2_preinv(r, a[k],
+                                                   mod.n, mod.ninv), mod);
+    }
+    ctx->eval_table[qm1] = 0UL;
+
+    /*
+        The Zech logarithm Z(i) satisfies 1 + X^i = X^Z(i); adding one
+        only changes the constant coefficient, that is, the lowest
+        digit of the evaluation.
+     */
+    for (i = 0; i < qm1; i++)
+    {
+        n = ctx->eval_table[i];
+        n = (n % mod.n == mod.n - 1) ? n - (mod.n - 1) : n + 1;
+        ctx->zech_log_table[i] = ctx->log_table[n];
+    }
+    ctx->zech_log_table[qm1] = 0UL;
+
+    _nmod_vec_clear(x);
+    fmpz_clear(q);
+    return 1;
+}
+
+void fq_zech_ctx_init_conway(fq_zech_ctx_t ctx,
+                             const fmpz_t p, long d, const char *var)
+{
+    if (!_fq_zech_ctx_init_conway(ctx, p, d, var))
+    {
+        printf("Exception (fq_zech_ctx_init_conway).  Either q = p^d is\n");
+        printf("not less than 2^FQ_ZECH_MAX_BITS or the polynomial for ");
+        printf("(p,d) = ("), fmpz_print(p);
+        printf(",%ld) is not present in the database.\n", d);
+        abort();
+    }
+}
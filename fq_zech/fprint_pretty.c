@@ -0,0 +1,40 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_zech.h"
+
+int fq_zech_fprint_pretty(FILE * file, const fq_zech_t op,
+                          const fq_zech_ctx_t ctx)
+{
+    fq_nmod_t t;
+    int r;
+
+    fq_nmod_init(t, ctx->fq_nmod_ctx);
+    fq_zech_get_fq_nmod(t, op, ctx);
+    r = fq_nmod_fprint_pretty(file, t, ctx->fq_nmod_ctx);
+    fq_nmod_clear(t, ctx->fq_nmod_ctx);
+
+    return r;
+}
@@ -0,0 +1,59 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_zech.h"
+
+void fq_zech_get_fq_nmod(fq_nmod_t rop, const fq_zech_t op,
+                         const fq_zech_ctx_t ctx)
+{
+    const long d = fq_zech_ctx_degree(ctx);
+    const mp_limb_t p = ctx->fq_nmod_ctx->mod.n;
+    mp_limb_t n = ctx->eval_table[op->value];
+    long k;
+
+    nmod_poly_fit_length(rop, d);
+
+    for (k = 0; k < d; k++)
+    {
+        rop->coeffs[k] = n % p;
+        n /= p;
+    }
+
+    rop->length = d;
+    _nmod_poly_normalise(rop);
+}
+
+void fq_zech_set_fq_nmod(fq_zech_t rop, const fq_nmod_t op,
+                         const fq_zech_ctx_t ctx)
+{
+    const mp_limb_t p = ctx->fq_nmod_ctx->mod.n;
+    mp_limb_t n = 0UL;
+    long k;
+
+    for (k = op->length - 1; k >= 0; k--)
+        n = n * p + op->coeffs[k];
+
+    rop->value = ctx->log_table[n];
+}
@@ -0,0 +1,37 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_zech.h"
+
+void fq_zech_mul_ui(fq_zech_t rop, const fq_zech_t op, ulong x,
+                    const fq_zech_ctx_t ctx)
+{
+    fq_zech_t t;
+
+    /* The evaluation of a constant c in F_p is c itself */
+    t->value = ctx->log_table[n_mod2_preinv(x, ctx->fq_nmod_ctx->mod.n,
+                                               ctx->fq_nmod_ctx->mod.ninv)];
+    fq_zech_mul(rop, op, t, ctx);
+}
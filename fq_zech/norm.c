@@ -0,0 +1,41 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_zech.h"
+
+void fq_zech_norm(fmpz_t rop, const fq_zech_t op, const fq_zech_ctx_t ctx)
+{
+    const mp_limb_t p = ctx->fq_nmod_ctx->mod.n;
+
+    /*
+        The norm of X^a is X^(a (q - 1)/(p - 1)), which lies in F_p
+        and so is its own evaluation.
+     */
+    if (fq_zech_is_zero(op, ctx))
+        fmpz_zero(rop);
+    else
+        fmpz_set_ui(rop, ctx->eval_table[(op->value * (ctx->qm1 / (p - 1)))
+                                         % ctx->qm1]);
+}
@@ -0,0 +1,103 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include "fq_zech.h"
+#include "profiler.h"
+
+#ifndef REPS
+#define REPS 10000000
+#endif
+
+/*
+    Compares multiplication and addition in GF(2^16) and GF(3^10) using
+    Zech logarithms against the polynomial representation of fq_nmod.
+ */
+
+int
+main(void)
+{
+    const ulong primes[2]  = {2UL, 3UL};
+    const long degrees[2]  = {16, 10};
+    flint_rand_t state;
+    timeit_t t0;
+    long i, k;
+
+    flint_randinit(state);
+
+    for (k = 0; k < 2; k++)
+    {
+        fmpz_t p;
+        fq_zech_ctx_t ctx;
+        fq_zech_t a, b, c;
+        fq_nmod_t x, y, z;
+
+        fmpz_init_set_ui(p, primes[k]);
+
+        timeit_start(t0);
+        fq_zech_ctx_init_conway(ctx, p, degrees[k], "a");
+        timeit_stop(t0);
+        printf("GF(%lu^%ld): tables built in %ld ms\n",
+               primes[k], degrees[k], t0->cpu);
+
+        fq_zech_init(a, ctx);
+        fq_zech_init(b, ctx);
+        fq_zech_init(c, ctx);
+        fq_zech_randtest_not_zero(a, state, ctx);
+        fq_zech_randtest_not_zero(b, state, ctx);
+        fq_nmod_init(x, ctx->fq_nmod_ctx);
+        fq_nmod_init(y, ctx->fq_nmod_ctx);
+        fq_nmod_init(z, ctx->fq_nmod_ctx);
+        fq_zech_get_fq_nmod(x, a, ctx);
+        fq_zech_get_fq_nmod(y, b, ctx);
+
+        timeit_start(t0);
+        for (i = 0; i < REPS; i++)
+        {
+            fq_zech_mul(c, a, b, ctx);
+            fq_zech_add(a, c, b, ctx);
+        }
+        timeit_stop(t0);
+        printf("  fq_zech: cpu = %ld ms\n", t0->cpu);
+
+        timeit_start(t0);
+        for (i = 0; i < REPS; i++)
+        {
+            fq_nmod_mul(z, x, y, ctx->fq_nmod_ctx);
+            fq_nmod_add(x, z, y, ctx->fq_nmod_ctx);
+        }
+        timeit_stop(t0);
+        printf("  fq_nmod: cpu = %ld ms\n", t0->cpu);
+
+        fq_nmod_clear(x, ctx->fq_nmod_ctx);
+        fq_nmod_clear(y, ctx->fq_nmod_ctx);
+        fq_nmod_clear(z, ctx->fq_nmod_ctx);
+        fq_zech_ctx_clear(ctx);
+        fmpz_clear(p);
+    }
+
+    flint_randclear(state);
+    return 0;
+}
@@ -0,0 +1,138 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fq_zech.h"
+#include "ulong_extras.h"
+#include "long_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    flint_rand_t state;
+
+    printf("frobenius... ");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* Check aliasing */
+    for (i = 0; i < 2000; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_zech_ctx_t ctx;
+
+        fq_zech_t a, b;
+        long e;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 4) + 1;
+        fq_zech_ctx_init_conway(ctx, p, d, "a");
+        fq_zech_init(a, ctx);
+        fq_zech_init(b, ctx);
+
+        e = n_randint(state, 10) % d;
+        fq_zech_randtest(a, state, ctx);
+
+        fq_zech_frobenius(b, a, e, ctx);
+        fq_zech_frobenius(a, a, e, ctx);
+
+        result = (fq_zech_equal(a, b, ctx));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_zech_print_pretty(a, ctx), printf("\n");
+            printf("b = "), fq_zech_print_pretty(b, ctx), printf("\n");
+            abort();
+        }
+
+        fq_zech_clear(a, ctx);
+        fq_zech_clear(b, ctx);
+
+        fmpz_clear(p);
+        fq_zech_ctx_clear(ctx);
+    }
+
+    /* Compare with fq_nmod */
+    for (i = 0; i < 2000; i++)
+    {
+        fmpz_t p;
+        long d;
+        fq_zech_ctx_t ctx;
+
+        fq_zech_t a, b, c;
+        fq_nmod_t x, y;
+        long e;
+
+        fmpz_init(p);
+        fmpz_set_ui(p, n_randprime(state, 2 + n_randint(state, 3), 1));
+        d = n_randint(state, 4) + 1;
+        fq_zech_ctx_init_conway(ctx, p, d, "a");
+        fq_zech_init(a, ctx);
+        fq_zech_init(b, ctx);
+        fq_zech_init(c, ctx);
+        fq_nmod_init(x, ctx->fq_nmod_ctx);
+        fq_nmod_init(y, ctx->fq_nmod_ctx);
+
+        e = n_randint(state, 10) % d;
+        fq_zech_randtest(a, state, ctx);
+
+        fq_zech_frobenius(b, a, e, ctx);
+
+        fq_zech_get_fq_nmod(x, a, ctx);
+        fq_nmod_frobenius(y, x, e, ctx->fq_nmod_ctx);
+        fq_zech_set_fq_nmod(c, y, ctx);
+
+        result = (fq_zech_equal(b, c, ctx));
+        if (!result)
+        {
+            printf("FAIL:\n\n");
+            printf("a = "), fq_zech_print_pretty(a, ctx), printf("\n");
+            printf("b = "), fq_zech_print_pretty(b, ctx), printf("\n");
+            printf("c = "), fq_zech_print_pretty(c, ctx), printf("\n");
+            abort();
+        }
+
+        fq_zech_clear(a, ctx);
+        fq_zech_clear(b, ctx);
+        fq_zech_clear(c, ctx);
+        fq_nmod_clear(x, ctx->fq_nmod_ctx);
+        fq_nmod_clear(y, ctx->fq_nmod_ctx);
+
+        fmpz_clear(p);
+        fq_zech_ctx_clear(ctx);
+    }
+
+    flint_randclear(state);
+    _fmpz_cleanup();
+    printf("PASS\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,511 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#ifndef FQ_ZECH_POLY_H
+#define FQ_ZECH_POLY_H
+
+#undef ulong                /* interferes with system includes */
+#include <stdlib.h>
+#include <stdio.h>
+#define ulong unsigned long
+
+#include "fq_zech.h"
+
+/*
+    Classical multiplication costs only table lookups per coefficient, so
+    Kronecker substitution is used from length FQ_ZECH_POLY_KS_CUTOFF * d.
+ */
+#define FQ_ZECH_POLY_KS_CUTOFF  20
+
+/*  Type definitions *********************************************************/
+
+typedef struct
+{
+    fq_zech_struct *coeffs;
+    long alloc;
+    long length;
+}
+fq_zech_poly_struct;
+
+typedef fq_zech_poly_struct fq_zech_poly_t[1];
+
+/*  Memory management ********************************************************/
+
+fq_zech_struct * _fq_zech_poly_init(long len, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_init(fq_zech_poly_t poly, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_init2(fq_zech_poly_t poly, long alloc,
+                        const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_realloc(fq_zech_poly_t poly, long alloc,
+                          const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_truncate(fq_zech_poly_t poly, long len,
+                           const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_fit_length(fq_zech_poly_t poly, long len,
+                             const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_clear(fq_zech_struct *v, long len,
+                         const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_clear(fq_zech_poly_t poly, const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_normalise(fq_zech_poly_t poly, const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_normalise2(fq_zech_struct *poly, long *length,
+                              const fq_zech_ctx_t ctx);
+
+static __inline__
+void _fq_zech_poly_set_length(fq_zech_poly_t poly, long len,
+                              const fq_zech_ctx_t ctx)
+{
+    if (poly->length > len)
+    {
+        long i;
+
+        for (i = len; i < poly->length; i++)
+            fq_zech_zero(poly->coeffs + i, ctx);
+    }
+    poly->length = len;
+}
+
+#define FQ_ZECH_VEC_NORM(vec, i, ctx)                     \
+do {                                                      \
+    while ((i) && fq_zech_is_zero((vec) + (i) - 1, ctx))  \
+        (i)--;                                            \
+} while (0)
+
+/*  Polynomial parameters  ***************************************************/
+
+static __inline__
+long fq_zech_poly_length(const fq_zech_poly_t poly, const fq_zech_ctx_t ctx)
+{
+    return poly->length;
+}
+
+static __inline__
+long fq_zech_poly_degree(const fq_zech_poly_t poly, const fq_zech_ctx_t ctx)
+{
+    return poly->length - 1;
+}
+
+static __inline__ fq_zech_struct *
+fq_zech_poly_lead(const fq_zech_poly_t poly, const fq_zech_ctx_t ctx)
+{
+    return poly->length > 0 ? poly->coeffs + (poly->length - 1) : NULL;
+}
+
+/*  Randomisation  ***********************************************************/
+
+void fq_zech_poly_randtest(fq_zech_poly_t f, flint_rand_t state,
+                           long len, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_randtest_not_zero(fq_zech_poly_t f, flint_rand_t state,
+                                    long len, const fq_zech_ctx_t ctx);
+
+/*  Assignment and basic manipulation  ***************************************/
+
+void _fq_zech_poly_set(fq_zech_struct *rop, const fq_zech_struct *op, long len,
+                       const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_set(fq_zech_poly_t rop, const fq_zech_poly_t op,
+                      const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_set_fq_zech(fq_zech_poly_t poly, const fq_zech_t c,
+                              const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_swap(fq_zech_poly_t op1, fq_zech_poly_t op2,
+                       const fq_zech_ctx_t ctx);
+
+static __inline__
+void _fq_zech_poly_zero(fq_zech_struct *rop, long len, const fq_zech_ctx_t ctx)
+{
+    long i;
+
+    for (i = 0; i < len; i++)
+        fq_zech_zero(rop + i, ctx);
+}
+
+static __inline__
+void fq_zech_poly_zero(fq_zech_poly_t poly, const fq_zech_ctx_t ctx)
+{
+   _fq_zech_poly_set_length(poly, 0, ctx);
+}
+
+void fq_zech_poly_one(fq_zech_poly_t poly, const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_make_monic(fq_zech_struct *rop,
+    const fq_zech_struct *op, long length, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_make_monic(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, const fq_zech_ctx_t ctx);
+
+/*  Getting and setting coefficients  ****************************************/
+
+void fq_zech_poly_get_coeff(fq_zech_t x, const fq_zech_poly_t poly, long n,
+                            const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_set_coeff(fq_zech_poly_t poly, long n, const fq_zech_t x,
+                            const fq_zech_ctx_t ctx);
+
+/*  Comparison  **************************************************************/
+
+int fq_zech_poly_equal(const fq_zech_poly_t poly1,
+                       const fq_zech_poly_t poly2, const fq_zech_ctx_t ctx);
+
+static __inline__
+int fq_zech_poly_is_zero(const fq_zech_poly_t poly, const fq_zech_ctx_t ctx)
+{
+    return (poly->length == 0);
+}
+
+static __inline__
+int fq_zech_poly_is_one(const fq_zech_poly_t op, const fq_zech_ctx_t ctx)
+{
+    return (op->length == 1) && (fq_zech_is_one(op->coeffs + 0, ctx));
+}
+
+static __inline__
+int fq_zech_poly_is_unit(const fq_zech_poly_t op, const fq_zech_ctx_t ctx)
+{
+    return (op->length == 1) && (!(fq_zech_is_zero(op->coeffs + 0, ctx)));
+}
+
+static __inline__
+int fq_zech_poly_equal_fq_zech(const fq_zech_poly_t poly, const fq_zech_t c,
+                               const fq_zech_ctx_t ctx)
+{
+    return ((poly->length == 0) && fq_zech_is_zero(c, ctx)) ||
+        ((poly->length == 1) && fq_zech_equal(poly->coeffs, c, ctx));
+}
+
+/*  Addition and subtraction  ************************************************/
+
+void _fq_zech_poly_add(fq_zech_struct *res,
+                       const fq_zech_struct *poly1, long len1,
+                       const fq_zech_struct *poly2, long len2,
+                       const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_add(fq_zech_poly_t rop,
+                      const fq_zech_poly_t op1, const fq_zech_poly_t op2,
+                      const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_sub(fq_zech_struct *res,
+                       const fq_zech_struct *poly1, long len1,
+                       const fq_zech_struct *poly2, long len2,
+                       const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_sub(fq_zech_poly_t rop,
+                      const fq_zech_poly_t op1, const fq_zech_poly_t op2,
+                      const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_neg(fq_zech_struct *rop, const fq_zech_struct *op, long len,
+                       const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_neg(fq_zech_poly_t rop, const fq_zech_poly_t op,
+                      const fq_zech_ctx_t ctx);
+
+/*  Scalar multiplication and division  **************************************/
+
+void _fq_zech_poly_scalar_mul_fq_zech(fq_zech_struct *rop,
+    const fq_zech_struct *op, long len, const fq_zech_t x,
+    const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_scalar_mul_fq_zech(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, const fq_zech_t x, const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_scalar_addmul_fq_zech(fq_zech_struct *rop,
+    const fq_zech_struct *op, long len, const fq_zech_t x,
+    const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_scalar_addmul_fq_zech(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, const fq_zech_t x, const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_scalar_submul_fq_zech(fq_zech_struct *rop,
+    const fq_zech_struct *op, long len, const fq_zech_t x,
+    const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_scalar_submul_fq_zech(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, const fq_zech_t x, const fq_zech_ctx_t ctx);
+
+/*  Multiplication  **********************************************************/
+
+void _fq_zech_poly_mul_classical(fq_zech_struct *rop,
+                                 const fq_zech_struct *op1, long len1,
+                                 const fq_zech_struct *op2, long len2,
+                                 const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_mul_classical(fq_zech_poly_t rop,
+    const fq_zech_poly_t op1, const fq_zech_poly_t op2,
+    const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_pack_KS(mp_ptr rop, const fq_zech_struct *op, long len,
+                           const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_unpack_KS(fq_zech_struct *rop, long len,
+                             mp_ptr f, long lenf, const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_mul_KS(fq_zech_struct *rop,
+                          const fq_zech_struct *op1, long len1,
+                          const fq_zech_struct *op2, long len2,
+                          const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_mul_KS(fq_zech_poly_t rop,
+    const fq_zech_poly_t op1, const fq_zech_poly_t op2,
+    const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_mul(fq_zech_struct *rop,
+                       const fq_zech_struct *op1, long len1,
+                       const fq_zech_struct *op2, long len2,
+                       const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_mul(fq_zech_poly_t rop,
+    const fq_zech_poly_t op1, const fq_zech_poly_t op2,
+    const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_mullow_classical(fq_zech_struct *rop,
+                                    const fq_zech_struct *op1, long len1,
+                                    const fq_zech_struct *op2, long len2,
+                                    long n, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_mullow_classical(fq_zech_poly_t rop,
+    const fq_zech_poly_t op1, const fq_zech_poly_t op2, long n,
+    const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_mullow_KS(fq_zech_struct *rop,
+                             const fq_zech_struct *op1, long len1,
+                             const fq_zech_struct *op2, long len2,
+                             long n, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_mullow_KS(fq_zech_poly_t rop,
+    const fq_zech_poly_t op1, const fq_zech_poly_t op2, long n,
+    const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_mullow(fq_zech_struct *rop,
+                          const fq_zech_struct *op1, long len1,
+                          const fq_zech_struct *op2, long len2,
+                          long n, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_mullow(fq_zech_poly_t rop,
+    const fq_zech_poly_t op1, const fq_zech_poly_t op2, long n,
+    const fq_zech_ctx_t ctx);
+
+/* Squaring ******************************************************************/
+
+void _fq_zech_poly_sqr_classical(fq_zech_struct *rop,
+    const fq_zech_struct *op, long len, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_sqr_classical(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_sqr_KS(fq_zech_struct *rop,
+    const fq_zech_struct *op, long len, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_sqr_KS(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_sqr(fq_zech_struct *rop,
+    const fq_zech_struct *op, long len, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_sqr(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, const fq_zech_ctx_t ctx);
+
+/*  Powering  ****************************************************************/
+
+void _fq_zech_poly_pow(fq_zech_struct *rop,
+    const fq_zech_struct *op, long len, ulong e, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_pow(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, ulong e, const fq_zech_ctx_t ctx);
+
+/*  Shifting  ****************************************************************/
+
+void _fq_zech_poly_shift_left(fq_zech_struct *rop,
+    const fq_zech_struct *op, long len, long n, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_shift_left(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, long n, const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_shift_right(fq_zech_struct *rop,
+    const fq_zech_struct *op, long len, long n, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_shift_right(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, long n, const fq_zech_ctx_t ctx);
+
+/*  Norms  *******************************************************************/
+
+long _fq_zech_poly_hamming_weight(const fq_zech_struct *op, long len,
+                                  const fq_zech_ctx_t ctx);
+
+long fq_zech_poly_hamming_weight(const fq_zech_poly_t op,
+                                 const fq_zech_ctx_t ctx);
+
+/*  Greatest common divisor  *************************************************/
+
+void fq_zech_poly_gcd_euclidean(fq_zech_poly_t rop,
+    const fq_zech_poly_t op1, const fq_zech_poly_t op2,
+    const fq_zech_ctx_t ctx);
+
+long _fq_zech_poly_gcd_euclidean(fq_zech_struct *G,
+    const fq_zech_struct *A, long lenA, const fq_zech_struct *B, long lenB,
+    const fq_zech_ctx_t ctx);
+
+static __inline__
+void fq_zech_poly_gcd(fq_zech_poly_t rop,
+                      const fq_zech_poly_t op1, const fq_zech_poly_t op2,
+                      const fq_zech_ctx_t ctx)
+{
+    fq_zech_poly_gcd_euclidean(rop, op1, op2, ctx);
+}
+
+/*  Euclidean division  ******************************************************/
+
+void _fq_zech_poly_divrem_basecase(fq_zech_struct *Q, fq_zech_struct *R,
+    const fq_zech_struct *A, long lenA, const fq_zech_struct *B, long lenB,
+    const fq_zech_t invB, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_divrem_basecase(fq_zech_poly_t Q, fq_zech_poly_t R,
+    const fq_zech_poly_t A, const fq_zech_poly_t B, const fq_zech_ctx_t ctx);
+
+static __inline__
+void _fq_zech_poly_divrem(fq_zech_struct *Q, fq_zech_struct *R,
+    const fq_zech_struct *A, long lenA, const fq_zech_struct *B, long lenB,
+    const fq_zech_t invB, const fq_zech_ctx_t ctx)
+{
+    _fq_zech_poly_divrem_basecase(Q, R, A, lenA, B, lenB, invB, ctx);
+}
+
+static __inline__
+void fq_zech_poly_divrem(fq_zech_poly_t Q, fq_zech_poly_t R,
+    const fq_zech_poly_t A, const fq_zech_poly_t B, const fq_zech_ctx_t ctx)
+{
+    fq_zech_poly_divrem_basecase(Q, R, A, B, ctx);
+}
+
+static __inline__
+void _fq_zech_poly_rem(fq_zech_struct *R,
+    const fq_zech_struct *A, long lenA, const fq_zech_struct *B, long lenB,
+    const fq_zech_t invB, const fq_zech_ctx_t ctx)
+{
+    fq_zech_struct *Q = _fq_zech_poly_init(lenA - lenB + 1, ctx);
+
+    _fq_zech_poly_divrem(Q, R, A, lenA, B, lenB, invB, ctx);
+    _fq_zech_poly_clear(Q, lenA - lenB + 1, ctx);
+}
+
+static __inline__
+void fq_zech_poly_rem(fq_zech_poly_t R,
+    const fq_zech_poly_t A, const fq_zech_poly_t B, const fq_zech_ctx_t ctx)
+{
+    fq_zech_poly_t Q;
+
+    fq_zech_poly_init(Q, ctx);
+    fq_zech_poly_divrem_basecase(Q, R, A, B, ctx);
+    fq_zech_poly_clear(Q, ctx);
+}
+
+/*  Divisibility testing  ***************************************************/
+
+int _fq_zech_poly_divides(fq_zech_struct *Q,
+                          const fq_zech_struct *A, long lenA,
+                          const fq_zech_struct *B, long lenB,
+                          const fq_zech_t invB, const fq_zech_ctx_t ctx);
+
+int fq_zech_poly_divides(fq_zech_poly_t Q,
+    const fq_zech_poly_t A, const fq_zech_poly_t B, const fq_zech_ctx_t ctx);
+
+/*  Derivative  **************************************************************/
+
+void _fq_zech_poly_derivative(fq_zech_struct *rop,
+    const fq_zech_struct *op, long len, const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_derivative(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, const fq_zech_ctx_t ctx);
+
+/*  Evaluation  **************************************************************/
+
+void _fq_zech_poly_evaluate_fq_zech(fq_zech_t rop,
+    const fq_zech_struct *op, long len, const fq_zech_t a,
+    const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_evaluate_fq_zech(fq_zech_t res,
+    const fq_zech_poly_t f, const fq_zech_t a, const fq_zech_ctx_t ctx);
+
+/*  Composition  *************************************************************/
+
+void _fq_zech_poly_compose_divconquer(fq_zech_struct *rop,
+                                      const fq_zech_struct *op1, long len1,
+                                      const fq_zech_struct *op2, long len2,
+                                      const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_compose_divconquer(fq_zech_poly_t rop,
+    const fq_zech_poly_t op1, const fq_zech_poly_t op2,
+    const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_compose_horner(fq_zech_struct *rop,
+                                  const fq_zech_struct *op1, long len1,
+                                  const fq_zech_struct *op2, long len2,
+                                  const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_compose_horner(fq_zech_poly_t rop,
+    const fq_zech_poly_t op1, const fq_zech_poly_t op2,
+    const fq_zech_ctx_t ctx);
+
+void _fq_zech_poly_compose(fq_zech_struct *rop,
+                           const fq_zech_struct *op1, long len1,
+                           const fq_zech_struct *op2, long len2,
+                           const fq_zech_ctx_t ctx);
+
+void fq_zech_poly_compose(fq_zech_poly_t rop,
+    const fq_zech_poly_t op1, const fq_zech_poly_t op2,
+    const fq_zech_ctx_t ctx);
+
+/*  Input and output  ********************************************************/
+
+int _fq_zech_poly_fprint_pretty(FILE *file,
+    const fq_zech_struct *poly, long len, const char *x,
+    const fq_zech_ctx_t ctx);
+
+int fq_zech_poly_fprint_pretty(FILE * file,
+    const fq_zech_poly_t poly, const char *x, const fq_zech_ctx_t ctx);
+
+static __inline__
+int _fq_zech_poly_print_pretty(const fq_zech_struct *poly, long len,
+                               const char *x, const fq_zech_ctx_t ctx)
+{
+    return _fq_zech_poly_fprint_pretty(stdout, poly, len, x, ctx);
+}
+
+static __inline__
+int fq_zech_poly_print_pretty(const fq_zech_poly_t poly, const char *x,
+                              const fq_zech_ctx_t ctx)
+{
+    return fq_zech_poly_fprint_pretty(stdout, poly, x, ctx);
+}
+
+#endif
+
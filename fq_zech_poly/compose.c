@@ -0,0 +1,80 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_zech_poly.h"
+
+void _fq_zech_poly_compose(fq_zech_struct *rop,
+                           const fq_zech_struct *op1, long len1,
+                           const fq_zech_struct *op2, long len2,
+                           const fq_zech_ctx_t ctx)
+{
+    if (len1 == 1)
+        fq_zech_set(rop + 0, op1 + 0, ctx);
+    else if (len2 == 1)
+        _fq_zech_poly_evaluate_fq_zech(rop + 0, op1, len1, op2 + 0, ctx);
+    else if (len1 <= 4)
+        _fq_zech_poly_compose_horner(rop, op1, len1, op2, len2, ctx);
+    else
+        _fq_zech_poly_compose_divconquer(rop, op1, len1, op2, len2, ctx);
+}
+
+void fq_zech_poly_compose(fq_zech_poly_t rop,
+    const fq_zech_poly_t op1, const fq_zech_poly_t op2,
+    const fq_zech_ctx_t ctx)
+{
+    const long len1 = op1->length;
+    const long len2 = op2->length;
+    const long lenr = (len1 - 1) * (len2 - 1) + 1;
+
+    if (len1 == 0)
+    {
+        fq_zech_poly_zero(rop, ctx);
+    }
+    else if (len1 == 1 || len2 == 0)
+    {
+        fq_zech_poly_set_fq_zech(rop, op1->coeffs + 0, ctx);
+    }
+    else if (rop != op1 && rop != op2)
+    {
+        fq_zech_poly_fit_length(rop, lenr, ctx);
+        _fq_zech_poly_compose(rop->coeffs, op1->coeffs, len1,
+                                      op2->coeffs, len2, ctx);
+        _fq_zech_poly_set_length(rop, lenr, ctx);
+        _fq_zech_poly_normalise(rop, ctx);
+    }
+    else
+    {
+        fq_zech_poly_t t;
+
+        fq_zech_poly_init2(t, lenr, ctx);
+        _fq_zech_poly_compose(t->coeffs, op1->coeffs, len1,
+                                    op2->coeffs, len2, ctx);
+        _fq_zech_poly_set_length(t, lenr, ctx);
+        _fq_zech_poly_normalise(t, ctx);
+        fq_zech_poly_swap(rop, t, ctx);
+        fq_zech_poly_clear(t, ctx);
+    }
+}
+
@@ -0,0 +1,112 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_zech_poly.h"
+
+void _fq_zech_poly_divrem_basecase(fq_zech_struct *Q, fq_zech_struct *R,
+    const fq_zech_struct *A, long lenA, const fq_zech_struct *B, long lenB,
+    const fq_zech_t invB, const fq_zech_ctx_t ctx)
+{
+    long iQ, iR;
+
+    if (R != A)
+        _fq_zech_poly_set(R, A, lenA, ctx);
+
+    for (iQ = lenA - lenB, iR = lenA - 1; iQ >= 0; iQ--, iR--)
+    {
+        if (fq_zech_is_zero(R + iR, ctx))
+            fq_zech_zero(Q + iQ, ctx);
+        else
+        {
+            fq_zech_mul(Q + iQ, R + iR, invB, ctx);
+
+            _fq_zech_poly_scalar_submul_fq_zech(R + iQ, B, lenB, Q + iQ, ctx);
+        }
+    }
+}
+
+void fq_zech_poly_divrem_basecase(fq_zech_poly_t Q, fq_zech_poly_t R,
+    const fq_zech_poly_t A, const fq_zech_poly_t B, const fq_zech_ctx_t ctx)
+{
+    const long lenA = A->length, lenB = B->length, lenQ = lenA - lenB + 1;
+    fq_zech_struct *q, *r;
+    fq_zech_t invB;
+
+    if (lenA < lenB)
+    {
+        fq_zech_poly_set(R, A, ctx);
+        fq_zech_poly_zero(Q, ctx);
+        return;
+    }
+
+    fq_zech_init(invB, ctx);
+    fq_zech_inv(invB, fq_zech_poly_lead(B, ctx), ctx);
+
+    if (Q == A || Q == B)
+    {
+        q = _fq_zech_poly_init(lenQ, ctx);
+    }
+    else
+    {
+        fq_zech_poly_fit_length(Q, lenQ, ctx);
+        q = Q->coeffs;
+    }
+    if (R == B)
+    {
+        r = _fq_zech_poly_init(lenA, ctx);
+    }
+    else
+    {
+        fq_zech_poly_fit_length(R, lenA, ctx);
+        r = R->coeffs;
+    }
+
+    _fq_zech_poly_divrem_basecase(q, r, A->coeffs, lenA,
+                                   B->coeffs, lenB, invB, ctx);
+
+    if (Q == A || Q == B)
+    {
+        _fq_zech_poly_clear(Q->coeffs, Q->alloc, ctx);
+        Q->coeffs = q;
+        Q->alloc  = lenQ;
+        Q->length = lenQ;
+    }
+    else
+    {
+        _fq_zech_poly_set_length(Q, lenQ, ctx);
+    }
+    if (R == B)
+    {
+        _fq_zech_poly_clear(R->coeffs, R->alloc, ctx);
+        R->coeffs = r;
+        R->alloc  = lenA;
+        R->length = lenA;
+    }
+    _fq_zech_poly_set_length(R, lenB - 1, ctx);
+    _fq_zech_poly_normalise(R, ctx);
+
+    fq_zech_clear(invB, ctx);
+}
+
@@ -0,0 +1,72 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_zech_poly.h"
+
+void _fq_zech_poly_evaluate_fq_zech(fq_zech_t rop,
+    const fq_zech_struct *op, long len, const fq_zech_t a,
+    const fq_zech_ctx_t ctx)
+{
+    if (len == 0)
+    {
+        fq_zech_zero(rop, ctx);
+    }
+    else if (len == 1 || fq_zech_is_zero(a, ctx))
+    {
+        fq_zech_set(rop, op + 0, ctx);
+    }
+    else
+    {
+        long i = len - 1;
+        fq_zech_t t;
+
+        fq_zech_init(t, ctx);
+        fq_zech_set(rop, op + i, ctx);
+        for (i = len - 2; i >= 0; i--)
+        {
+            fq_zech_mul(t, rop, a, ctx);
+            fq_zech_add(rop, op + i, t, ctx);
+        }
+        fq_zech_clear(t, ctx);
+    }
+}
+
+void fq_zech_poly_evaluate_fq_zech(fq_zech_t rop,
+    const fq_zech_poly_t f, const fq_zech_t a, const fq_zech_ctx_t ctx)
+{
+    if (rop == a)
+    {
+        fq_zech_t t;
+        fq_zech_init(t, ctx);
+        _fq_zech_poly_evaluate_fq_zech(t, f->coeffs, f->length, a, ctx);
+        fq_zech_swap(rop, t, ctx);
+        fq_zech_clear(t, ctx);
+    }
+    else
+    {
+        _fq_zech_poly_evaluate_fq_zech(rop, f->coeffs, f->length, a, ctx);
+    }
+}
+
@@ -0,0 +1,129 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_zech_poly.h"
+
+/*
+    TODO:  When op has only one non-zero term, this
+    function would omit the parentheses.
+ */
+
+static void
+__fq_zech_print(FILE *file, const fq_zech_struct *op, const fq_zech_ctx_t ctx)
+{
+    fputc('(', file);
+    fq_zech_fprint_pretty(file, op, ctx);
+    fputc(')', file);
+}
+
+int _fq_zech_poly_fprint_pretty(FILE *file,
+    const fq_zech_struct *poly, long len, const char *x,
+    const fq_zech_ctx_t ctx)
+{
+    if (len == 0)
+    {
+        fputc('0', file);
+    }
+    else if (len == 1)
+    {
+        fq_zech_fprint_pretty(file, poly + 0, ctx);
+    }
+    else if (len == 2)
+    {
+        if (fq_zech_is_one(poly + 1, ctx))
+            fprintf(file, "%s", x);
+        else
+        {
+            __fq_zech_print(file, poly + 1, ctx);
+            fprintf(file, "*%s", x);
+        }
+        if (!fq_zech_is_zero(poly + 0, ctx))
+        {
+            fputc('+', file);
+            __fq_zech_print(file, poly + 0, ctx);
+        }
+    }
+    else
+    {
+        long i = len - 1;
+
+        {
+            if (fq_zech_is_one(poly + i, ctx))
+                fprintf(file, "%s^%ld", x, i);
+            else
+            {
+                __fq_zech_print(file, poly + i, ctx);
+                fprintf(file, "*%s^%ld", x, i);
+            }
+            --i;
+        }
+
+        for (; i > 1; --i)
+        {
+            if (fq_zech_is_zero(poly + i, ctx))
+                continue;
+
+            if (fq_zech_is_one(poly + i, ctx))
+                fprintf(file, "+%s^%ld", x, i);
+            else
+            {
+                fputc('+', file);
+                __fq_zech_print(file, poly + i, ctx);
+                fprintf(file, "*%s^%ld", x, i);
+            }
+        }
+
+        if (!fq_zech_is_zero(poly + 1, ctx))
+        {
+            if (fq_zech_is_one(poly + 1, ctx))
+            {
+                fputc('+', file);
+                fputs(x, file);
+            }
+            else
+            {
+                fputc('+', file);
+                __fq_zech_print(file, poly + 1, ctx);
+                fputc('*', file);
+                fputs(x, file);
+            }
+        }
+        if (!fq_zech_is_zero(poly + 0, ctx))
+        {
+            fputc('+', file);
+            __fq_zech_print(file, poly + 0, ctx);
+        }
+    }
+
+    return 1;
+}
+
+int fq_zech_poly_fprint_pretty(FILE * file,
+    const fq_zech_poly_t poly, const char *x, const fq_zech_ctx_t ctx)
+{
+    return _fq_zech_poly_fprint_pretty(file, poly->coeffs, poly->length, x,
+                                       ctx);
+}
+
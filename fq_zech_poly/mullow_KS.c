@@ -0,0 +1,94 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2008, 2009 William Hart
+    Copyright (C) 2010, 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_zech_poly.h"
+
+void _fq_zech_poly_mullow_KS(fq_zech_struct *rop,
+                             const fq_zech_struct *op1, long len1,
+                             const fq_zech_struct *op2, long len2,
+                             long n, const fq_zech_ctx_t ctx)
+{
+    const long d = fq_zech_ctx_degree(ctx);
+    long m, lenf, leng, lenh;
+    mp_ptr f, g, h;
+
+    FQ_ZECH_VEC_NORM(op1, len1, ctx);
+    FQ_ZECH_VEC_NORM(op2, len2, ctx);
+
+    if (!len1 | !len2)
+    {
+        _fq_zech_poly_zero(rop, n, ctx);
+        return;
+    }
+
+    leng = (len1 - 1) * (2 * d - 1) + d;
+    lenh = (len2 - 1) * (2 * d - 1) + d;
+    m    = FLINT_MIN(n, len1 + len2 - 1);
+    lenf = FLINT_MIN(leng + lenh - 1, m * (2 * d - 1));
+
+    f = _nmod_vec_init(lenf + leng + lenh);
+    g = f + lenf;
+    h = g + leng;
+
+    _fq_zech_poly_pack_KS(g, op1, len1, ctx);
+    _fq_zech_poly_pack_KS(h, op2, len2, ctx);
+
+    if (leng >= lenh)
+        _nmod_poly_mullow(f, g, leng, h, lenh, lenf, ctx->fq_nmod_ctx->mod);
+    else
+        _nmod_poly_mullow(f, h, lenh, g, leng, lenf, ctx->fq_nmod_ctx->mod);
+
+    _fq_zech_poly_unpack_KS(rop, m, f, lenf, ctx);
+    _fq_zech_poly_zero(rop + m, n - m, ctx);
+
+    _nmod_vec_clear(f);
+}
+
+void fq_zech_poly_mullow_KS(fq_zech_poly_t rop,
+                            const fq_zech_poly_t op1, const fq_zech_poly_t op2,
+                            long n, const fq_zech_ctx_t ctx)
+{
+    const long len1 = op1->length;
+    const long len2 = op2->length;
+
+    if (len1 == 0 || len2 == 0 || n == 0)
+    {
+        fq_zech_poly_zero(rop, ctx);
+    }
+    else
+    {
+        const long lenr = op1->length + op2->length - 1;
+
+        if (n > lenr)
+            n = lenr;
+
+        fq_zech_poly_fit_length(rop, n, ctx);
+        _fq_zech_poly_mullow_KS(rop->coeffs, op1->coeffs, len1,
+                                             op2->coeffs, len2, n, ctx);
+        _fq_zech_poly_set_length(rop, n, ctx);
+        _fq_zech_poly_normalise(rop, ctx);
+    }
+}
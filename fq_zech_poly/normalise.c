@@ -0,0 +1,44 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2008, 2009 William Hart
+    Copyright (C) 2012 Andres Goens
+
+******************************************************************************/
+
+#include "fq_zech_poly.h"
+
+void _fq_zech_poly_normalise(fq_zech_poly_t poly, const fq_zech_ctx_t ctx)
+{
+    long i;
+
+    for (i = poly->length - 1;
+         (i >= 0) && fq_zech_is_zero(poly->coeffs + i, ctx); i--) ;
+    poly->length = i + 1;
+}
+
+void _fq_zech_poly_normalise2(fq_zech_struct *poly, long *length,
+                              const fq_zech_ctx_t ctx)
+{
+    long i;
+    for (i = (*length) - 1; (i >= 0) && fq_zech_is_zero(poly + i, ctx); i--) ;
+    (*length) = i + 1;
+}
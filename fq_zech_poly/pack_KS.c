@@ -0,0 +1,70 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "fq_zech_poly.h"
+
+void _fq_zech_poly_pack_KS(mp_ptr rop, const fq_zech_struct *op, long len,
+                           const fq_zech_ctx_t ctx)
+{
+    const long d = fq_zech_ctx_degree(ctx);
+    const mp_limb_t p = ctx->fq_nmod_ctx->mod.n;
+    long i, k;
+
+    _nmod_vec_zero(rop, (len - 1) * (2 * d - 1) + d);
+
+    for (i = 0; i < len; i++)
+    {
+        mp_limb_t n = ctx->eval_table[(op + i)->value];
+
+        for (k = 0; n != 0UL; k++)
+        {
+            rop[i * (2 * d - 1) + k] = n % p;
+            n /= p;
+        }
+    }
+}
+
+void _fq_zech_poly_unpack_KS(fq_zech_struct *rop, long len,
+                             mp_ptr f, long lenf, const fq_zech_ctx_t ctx)
+{
+    const fq_nmod_ctx_struct *fctx = ctx->fq_nmod_ctx;
+    const long d = fq_zech_ctx_degree(ctx);
+    const mp_limb_t p = fctx->mod.n;
+    long i, k;
+
+    for (i = 0; i < len; i++)
+    {
+        mp_ptr c = f + i * (2 * d - 1);
+        long lenc = FLINT_MIN(2 * d - 1, lenf - i * (2 * d - 1));
+        mp_limb_t n = 0UL;
+
+        _fq_nmod_reduce(c, lenc, fctx->a, fctx->j, fctx->len, fctx->mod);
+
+        for (k = FLINT_MIN(d, lenc) - 1; k >= 0; k--)
+            n = n * p + c[k];
+
+        (rop + i)->value = ctx->log_table[n];
+    }
+}
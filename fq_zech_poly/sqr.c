@@ -0,0 +1,70 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_zech_poly.h"
+
+void _fq_zech_poly_sqr(fq_zech_struct *rop,
+    const fq_zech_struct *op, long len, const fq_zech_ctx_t ctx)
+{
+    const long d = fq_zech_ctx_degree(ctx);
+
+    if (len < FQ_ZECH_POLY_KS_CUTOFF * d)
+    {
+        _fq_zech_poly_sqr_classical(rop, op, len, ctx);
+    }
+    else
+    {
+        _fq_zech_poly_sqr_KS(rop, op, len, ctx);
+    }
+}
+
+void fq_zech_poly_sqr(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, const fq_zech_ctx_t ctx)
+{
+    const long rlen = 2 * op->length - 1;
+
+    if (op->length == 0)
+    {
+        fq_zech_poly_zero(rop, ctx);
+        return;
+    }
+
+    if (rop == op)
+    {
+        fq_zech_poly_t t;
+
+        fq_zech_poly_init2(t, rlen, ctx);
+        _fq_zech_poly_sqr(t->coeffs, op->coeffs, op->length, ctx);
+        fq_zech_poly_swap(rop, t, ctx);
+        fq_zech_poly_clear(t, ctx);
+    }
+    else
+    {
+        fq_zech_poly_fit_length(rop, rlen, ctx);
+        _fq_zech_poly_sqr(rop->coeffs, op->coeffs, op->length, ctx);
+    }
+
+    _fq_zech_poly_set_length(rop, rlen, ctx);
+}
@@ -0,0 +1,79 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2008, 2009 William Hart
+    Copyright (C) 2010, 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_zech_poly.h"
+
+void _fq_zech_poly_sqr_KS(fq_zech_struct *rop,
+                          const fq_zech_struct *op, long len,
+                          const fq_zech_ctx_t ctx)
+{
+    const long in_len = len;
+    const long d = fq_zech_ctx_degree(ctx);
+    long lenf, leng;
+    mp_ptr f, g;
+
+    FQ_ZECH_VEC_NORM(op, len, ctx);
+
+    if (!len)
+    {
+        if (2 * in_len - 1 > 0)
+            _fq_zech_poly_zero(rop, 2 * in_len - 1, ctx);
+        return;
+    }
+
+    leng = (len - 1) * (2 * d - 1) + d;
+    lenf = 2 * leng - 1;
+
+    f = _nmod_vec_init(lenf + leng);
+    g = f + lenf;
+
+    _fq_zech_poly_pack_KS(g, op, len, ctx);
+
+    _nmod_poly_mul(f, g, leng, g, leng, ctx->fq_nmod_ctx->mod);
+
+    _fq_zech_poly_unpack_KS(rop, 2 * len - 1, f, lenf, ctx);
+
+    _fq_zech_poly_zero(rop + (2 * len - 1), 2 * (in_len - len), ctx);
+
+    _nmod_vec_clear(f);
+}
+
+void fq_zech_poly_sqr_KS(fq_zech_poly_t rop, const fq_zech_poly_t op,
+                         const fq_zech_ctx_t ctx)
+{
+    const long len = 2 * op->length - 1;
+
+    if (op->length == 0)
+    {
+        fq_zech_poly_zero(rop, ctx);
+    }
+    else
+    {
+        fq_zech_poly_fit_length(rop, len, ctx);
+        _fq_zech_poly_sqr_KS(rop->coeffs, op->coeffs, op->length, ctx);
+        _fq_zech_poly_set_length(rop, len, ctx);
+    }
+}
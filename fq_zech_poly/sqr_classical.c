@@ -0,0 +1,90 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_zech_poly.h"
+
+void _fq_zech_poly_sqr_classical(fq_zech_struct *rop,
+    const fq_zech_struct *op, long len, const fq_zech_ctx_t ctx)
+{
+    if (len == 1)
+    {
+        fq_zech_mul(rop, op, op, ctx);
+    }
+    else
+    {
+        long i;
+        fq_zech_t t;
+
+        fq_zech_init(t, ctx);
+
+        _fq_zech_poly_scalar_mul_fq_zech(rop, op, len, op, ctx);
+
+        _fq_zech_poly_scalar_mul_fq_zech(rop + len, op + 1, len - 1,
+                                         op + len - 1, ctx);
+
+        for (i = 1; i < len - 1; i++)
+            _fq_zech_poly_scalar_addmul_fq_zech(rop + i + 1, op + 1, i - 1,
+                                                op + i, ctx);
+
+        for (i = 1; i < 2 * len - 2; i++)
+            fq_zech_add(rop + i, rop + i, rop + i, ctx);
+
+        for (i = 1; i < len - 1; i++)
+        {
+            fq_zech_sqr(t, op + i, ctx);
+            fq_zech_add(rop + 2 * i, rop + 2 * i, t, ctx);
+        }
+        fq_zech_clear(t, ctx);
+    }
+}
+
+void fq_zech_poly_sqr_classical(fq_zech_poly_t rop,
+    const fq_zech_poly_t op, const fq_zech_ctx_t ctx)
+{
+    const long len = 2 * op->length - 1;
+
+    if (op->length == 0)
+    {
+        fq_zech_poly_zero(rop, ctx);
+        return;
+    }
+
+    if (rop == op)
+    {
+        fq_zech_poly_t t;
+
+        fq_zech_poly_init2(t, len, ctx);
+        _fq_zech_poly_sqr_classical(t->coeffs, op->coeffs, op->length, ctx);
+        fq_zech_poly_swap(rop, t, ctx);
+        fq_zech_poly_clear(t, ctx);
+    }
+    else
+    {
+        fq_zech_poly_fit_length(rop, len, ctx);
+        _fq_zech_poly_sqr_classical(rop->coeffs, op->coeffs, op->length, ctx);
+    }
+
+    _fq_zech_poly_set_length(rop, len, ctx);
+}
@@ -0,0 +1,60 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2012 Sebastian Pancratz
+
+******************************************************************************/
+
+#include "fq_zech_poly.h"
+
+void _fq_zech_poly_sub(fq_zech_struct *res,
+                       const fq_zech_struct *poly1, long len1,
+                       const fq_zech_struct *poly2, long len2,
+                       const fq_zech_ctx_t ctx)
+{
+    const long min  = FLINT_MIN(len1, len2);
+    long i;
+
+    for (i = 0; i < min; i++)
+        fq_zech_sub(res + i, poly1 + i, poly2 + i, ctx);
+
+    if (poly1 != res)
+        for (i = min; i < len1; i++)
+            fq_zech_set(res + i, poly1 + i, ctx);
+
+    for (i = min; i < len2; i++)
+        fq_zech_neg(res + i, poly2 + i, ctx);
+}
+
+void fq_zech_poly_sub(fq_zech_poly_t res,
+                      const fq_zech_poly_t poly1, const fq_zech_poly_t poly2,
+                      const fq_zech_ctx_t ctx)
+{
+    const long max  = FLINT_MAX(poly1->length, poly2->length);
+
+    fq_zech_poly_fit_length(res, max, ctx);
+
+    _fq_zech_poly_sub(res->coeffs, poly1->coeffs, poly1->length,
+                              poly2->coeffs, poly2->length, ctx);
+
+    _fq_zech_poly_set_length(res, max, ctx);
+    _fq_zech_poly_normalise(res, ctx);
+}
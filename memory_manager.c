@@ -20,13 +20,28 @@
 /******************************************************************************
 
     Copyright (C) 2011 Fredrik Johansson
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
 #include <stdlib.h>
 #include <stdio.h>
+#undef ulong /* prevent clash with standard library */
+#include <pthread.h>
+#define ulong unsigned long
 #include "flint.h"
 
+#if HAVE_TLS
+#define TLS_PREFIX __thread
+#else
+#define TLS_PREFIX
+#endif
+
+static void * (*__flint_allocate_func)(size_t) = malloc;
+static void * (*__flint_callocate_func)(size_t, size_t) = calloc;
+static void * (*__flint_reallocate_func)(void *, size_t) = realloc;
+static void (*__flint_free_func)(void *) = free;
+
 static void flint_memory_error()
 {
     printf("Exception (FLINT memory_manager). Unable to allocate memory.\n");
@@ -35,7 +50,7 @@ static void flint_memory_error()
 
 void * flint_malloc(size_t size)
 {
-    void * ptr = malloc(size);
+    void * ptr = (*__flint_allocate_func)(size);
 
     if (ptr == NULL)
         flint_memory_error();
@@ -45,7 +60,7 @@ void * flint_malloc(size_t size)
 
 void * flint_realloc(void * ptr, size_t size)
 {
-    void * ptr2 = realloc(ptr, size);
+    void * ptr2 = (*__flint_reallocate_func)(ptr, size);
 
     if (ptr2 == NULL)
         flint_memory_error();
@@ -55,7 +70,7 @@ void * flint_realloc(void * ptr, size_t size)
 
 void * flint_calloc(size_t num, size_t size)
 {
-    void * ptr = calloc(num, size);
+    void * ptr = (*__flint_callocate_func)(num, size);
 
     if (ptr == NULL)
         flint_memory_error();
@@ -65,5 +80,290 @@ void * flint_calloc(size_t num, size_t size)
 
 void flint_free(void * ptr)
 {
-    free(ptr);
+    (*__flint_free_func)(ptr);
+}
+
+/*
+   GMP memory functions
+
+   GMP's memory functions are left alone until the user installs memory 
+   functions with __flint_set_memory_functions, so that nothing changes 
+   for programs which set their own GMP memory functions. From then on 
+   GMP allocates with the user's functions too. This layer is only ever 
+   installed once.
+*/
+
+static void * (*_flint_gmp_prev_allocate_func)(size_t);
+static void * (*_flint_gmp_prev_reallocate_func)(void *, size_t, size_t);
+static void (*_flint_gmp_prev_free_func)(void *, size_t);
+
+static int _flint_gmp_use_flint = 0;
+
+static pthread_once_t _flint_gmp_once = PTHREAD_ONCE_INIT;
+
+static void * _flint_gmp_allocate(size_t size)
+{
+    if (_flint_gmp_use_flint)
+        return flint_malloc(size);
+    else
+        return (*_flint_gmp_prev_allocate_func)(size);
+}
+
+static void * _flint_gmp_reallocate(void * ptr, size_t old_size, size_t new_size)
+{
+    if (_flint_gmp_use_flint)
+        return flint_realloc(ptr, new_size);
+    else
+        return (*_flint_gmp_prev_reallocate_func)(ptr, old_size, new_size);
+}
+
+static void _flint_gmp_free(void * ptr, size_t size)
+{
+    if (_flint_gmp_use_flint)
+        flint_free(ptr);
+    else
+        (*_flint_gmp_prev_free_func)(ptr, size);
+}
+
+static void _flint_gmp_install(void)
+{
+    mp_get_memory_functions(&_flint_gmp_prev_allocate_func,
+        &_flint_gmp_prev_reallocate_func, &_flint_gmp_prev_free_func);
+    mp_set_memory_functions(_flint_gmp_allocate,
+        _flint_gmp_reallocate, _flint_gmp_free);
+}
+
+void _flint_gmp_memory_init(void)
+{
+    pthread_once(&_flint_gmp_once, _flint_gmp_install);
+}
+
+void __flint_set_memory_functions(void * (*alloc_func)(size_t),
+     void * (*calloc_func)(size_t, size_t),
+     void * (*realloc_func)(void *, size_t), void (*free_func)(void *))
+{
+    __flint_allocate_func = alloc_func;
+    __flint_callocate_func = calloc_func;
+    __flint_reallocate_func = realloc_func;
+    __flint_free_func = free_func;
+
+    _flint_gmp_memory_init();
+    _flint_gmp_use_flint = 1;
+}
+
+void __flint_get_memory_functions(void * (**alloc_func)(size_t),
+     void * (**calloc_func)(size_t, size_t),
+     void * (**realloc_func)(void *, size_t), void (**free_func)(void *))
+{
+    *alloc_func = __flint_allocate_func;
+    *calloc_func = __flint_callocate_func;
+    *realloc_func = __flint_reallocate_func;
+    *free_func = __flint_free_func;
+}
+
+/*
+   Temporary allocation
+
+   Each thread owns a stack of blocks from which flint_tmp_alloc hands 
+   out memory by bumping an offset. A mark records the top of the stack, 
+   and releasing it pops everything allocated since. Blocks which are 
+   no longer needed are not freed immediately; the largest is kept as a 
+   spare so that a computation which repeatedly needs more than one 
+   block does not go back to the allocator every time. Blocks larger 
+   than FLINT_TMP_MAX_SPARE are always freed, so that one large 
+   computation does not pin its scratch space in every thread that ran 
+   it.
+
+   The blocks of a thread are freed when it exits, or by 
+   flint_tmp_cleanup.
+*/
+
+#define FLINT_TMP_ALIGN (2 * sizeof(mp_limb_t))
+
+#define FLINT_TMP_ROUND(size) \
+   (((size) + FLINT_TMP_ALIGN - 1) & ~(size_t) (FLINT_TMP_ALIGN - 1))
+
+#define FLINT_TMP_MIN_BLOCK (1UL << 16)
+
+#define FLINT_TMP_MAX_SPARE (8 * FLINT_TMP_MIN_BLOCK)
+
+typedef struct flint_tmp_block_struct
+{
+    struct flint_tmp_block_struct * prev;
+    size_t size;
+} flint_tmp_block_struct;
+
+#define FLINT_TMP_HEADER FLINT_TMP_ROUND(sizeof(flint_tmp_block_struct))
+
+#define FLINT_TMP_DATA(b) ((char *) (b) + FLINT_TMP_HEADER)
+
+typedef struct
+{
+    flint_tmp_block_struct * top;
+    flint_tmp_block_struct * spare;
+    size_t used;
+    int registered;
+} flint_tmp_arena_struct;
+
+static pthread_key_t _flint_tmp_key;
+
+static pthread_once_t _flint_tmp_key_once = PTHREAD_ONCE_INIT;
+
+static void _flint_tmp_arena_clear(flint_tmp_arena_struct * arena)
+{
+    flint_tmp_block_struct * b;
+
+    while (arena->top != NULL)
+    {
+        b = arena->top;
+        arena->top = b->prev;
+        flint_free(b);
+    }
+
+    if (arena->spare != NULL)
+    {
+        flint_free(arena->spare);
+        arena->spare = NULL;
+    }
+
+    arena->used = 0;
+}
+
+static void _flint_tmp_destructor(void * arena)
+{
+    _flint_tmp_arena_clear(arena);
+#if !HAVE_TLS
+    flint_free(arena);
+#endif
+}
+
+static void _flint_tmp_key_create(void)
+{
+    pthread_key_create(&_flint_tmp_key, _flint_tmp_destructor);
+}
+
+#if HAVE_TLS
+
+static TLS_PREFIX flint_tmp_arena_struct _flint_tmp_arena;
+
+static __inline__ flint_tmp_arena_struct * _flint_tmp_get_arena(void)
+{
+    return &_flint_tmp_arena;
+}
+
+#else
+
+static flint_tmp_arena_struct * _flint_tmp_get_arena(void)
+{
+    flint_tmp_arena_struct * arena;
+
+    pthread_once(&_flint_tmp_key_once, _flint_tmp_key_create);
+
+    arena = pthread_getspecific(_flint_tmp_key);
+
+    if (arena == NULL)
+    {
+        arena = flint_calloc(1, sizeof(flint_tmp_arena_struct));
+        arena->registered = 1;
+        pthread_setspecific(_flint_tmp_key, arena);
+    }
+
+    return arena;
+}
+
+#endif
+
+static void * _flint_tmp_grow(flint_tmp_arena_struct * arena, size_t size)
+{
+    flint_tmp_block_struct * b;
+    size_t bsize;
+
+    if (!arena->registered)
+    {
+        pthread_once(&_flint_tmp_key_once, _flint_tmp_key_create);
+        pthread_setspecific(_flint_tmp_key, arena);
+        arena->registered = 1;
+    }
+
+    if (arena->spare != NULL && arena->spare->size >= size)
+    {
+        b = arena->spare;
+        arena->spare = NULL;
+    }
+    else
+    {
+        bsize = FLINT_MAX(size, FLINT_TMP_MIN_BLOCK);
+        if (arena->top != NULL)
+            bsize = FLINT_MAX(bsize, 2 * arena->top->size);
+
+        b = flint_malloc(FLINT_TMP_HEADER + bsize);
+        b->size = bsize;
+    }
+
+    b->prev = arena->top;
+    arena->top = b;
+    arena->used = size;
+
+    return FLINT_TMP_DATA(b);
+}
+
+void flint_tmp_start(flint_tmp_mark_t mark)
+{
+    flint_tmp_arena_struct * arena = _flint_tmp_get_arena();
+
+    mark->block = arena->top;
+    mark->used = arena->used;
+}
+
+void * flint_tmp_alloc(size_t size)
+{
+    flint_tmp_arena_struct * arena = _flint_tmp_get_arena();
+    void * ptr;
+
+    size = FLINT_TMP_ROUND(size);
+
+    if (arena->top == NULL || arena->used + size > arena->top->size)
+        return _flint_tmp_grow(arena, size);
+
+    ptr = FLINT_TMP_DATA(arena->top) + arena->used;
+    arena->used += size;
+
+    return ptr;
+}
+
+void flint_tmp_end(const flint_tmp_mark_t mark)
+{
+    flint_tmp_arena_struct * arena = _flint_tmp_get_arena();
+    flint_tmp_block_struct * b;
+
+    while (arena->top != mark->block)
+    {
+        b = arena->top;
+        arena->top = b->prev;
+
+        if (b->size <= FLINT_TMP_MAX_SPARE && (arena->spare == NULL 
+                                          || b->size > arena->spare->size))
+        {
+            if (arena->spare != NULL)
+                flint_free(arena->spare);
+            arena->spare = b;
+        }
+        else
+            flint_free(b);
+    }
+
+    arena->used = mark->used;
+}
+
+void flint_tmp_cleanup(void)
+{
+    flint_tmp_arena_struct * arena = _flint_tmp_get_arena();
+
+    if (arena->top != NULL)
+    {
+        printf("Exception (flint_tmp_cleanup). Temporary memory in use.\n");
+        abort();
+    }
+
+    _flint_tmp_arena_clear(arena);
 }
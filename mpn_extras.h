@@ -28,6 +28,7 @@
 
 #include <gmp.h>
 #include "flint.h"
+#include "longlong.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
 
@@ -95,6 +96,48 @@ mp_size_t flint_mpn_divexact_1(mp_ptr x, mp_size_t xsize, mp_limb_t d)
 
 void flint_mpn_debug(mp_srcptr x, mp_size_t xsize);
 
+mp_limb_t flint_mpn_mul(mp_ptr z, mp_srcptr x, mp_size_t xn, 
+                                               mp_srcptr y, mp_size_t yn);
+
+void flint_mpn_mul_n(mp_ptr z, mp_srcptr x, mp_srcptr y, mp_size_t n);
+
+void flint_mpn_sqr(mp_ptr z, mp_srcptr x, mp_size_t n);
+
+/*
+   Sets {p, 4} to the product of x and y, which must be nonzero and have 
+   at most two limbs each, and returns the size of the product as for 
+   the _mp_size field of an mpz
+*/
+static __inline__
+mp_size_t flint_mpz_mul_2x2(mp_ptr p, mpz_srcptr x, mpz_srcptr y)
+{
+    mp_size_t xn = x->_mp_size, yn = y->_mp_size, zn;
+    mp_limb_t a0, a1, b0, b1, s1, s0;
+
+    a0 = x->_mp_d[0];
+    a1 = (xn == 2 || xn == -2) ? x->_mp_d[1] : 0;
+    b0 = y->_mp_d[0];
+    b1 = (yn == 2 || yn == -2) ? y->_mp_d[1] : 0;
+
+    umul_ppmm(p[1], p[0], a0, b0);
+    umul_ppmm(p[3], p[2], a1, b1);
+    umul_ppmm(s1, s0, a0, b1);
+    add_sssaaaaaa(p[3], p[2], p[1], p[3], p[2], p[1], 0, s1, s0);
+    umul_ppmm(s1, s0, a1, b0);
+    add_sssaaaaaa(p[3], p[2], p[1], p[3], p[2], p[1], 0, s1, s0);
+
+    zn = FLINT_ABS(xn) + FLINT_ABS(yn);
+    zn -= (p[zn - 1] == 0);
+
+    return ((xn ^ yn) < 0) ? -zn : zn;
+}
+
+void flint_mpz_mul(mpz_ptr z, mpz_srcptr x, mpz_srcptr y);
+
+void flint_mpz_addmul(mpz_ptr z, mpz_srcptr x, mpz_srcptr y);
+
+void flint_mpz_submul(mpz_ptr z, mpz_srcptr x, mpz_srcptr y);
+
 mp_size_t flint_mpn_remove_2exp(mp_ptr x, mp_size_t xsize, mp_bitcnt_t *bits);
 
 mp_size_t flint_mpn_remove_power_ascending(mp_ptr x, mp_size_t xsize,
@@ -135,9 +178,9 @@ do {                                            \
     mp_limb_t __top;                            \
     xs = ys + zs;                               \
     if (ys >= zs)                               \
-        __top = mpn_mul(xx, yy, ys, zz, zs);    \
+        __top = flint_mpn_mul(xx, yy, ys, zz, zs); \
     else                                        \
-        __top = mpn_mul(xx, zz, zs, yy, ys);    \
+        __top = flint_mpn_mul(xx, zz, zs, yy, ys); \
     if (!__top)                                 \
         xs--;                                   \
 } while (0)
@@ -208,6 +251,9 @@ void flint_mpn_mulmod_preinvn(mp_ptr r,
         mp_srcptr a, mp_srcptr b, mp_size_t n, 
         mp_srcptr d, mp_srcptr dinv, ulong norm);
 
+void flint_mpn_mod_preinvn(mp_ptr r, mp_srcptr a, mp_size_t m, 
+                           mp_srcptr d, mp_size_t n, mp_srcptr dinv);
+
 int flint_mpn_mulmod_2expp1_basecase(mp_ptr xp, mp_srcptr yp, mp_srcptr zp, int c,
     mp_bitcnt_t b, mp_ptr tp);
 
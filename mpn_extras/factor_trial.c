@@ -35,10 +35,11 @@
 int flint_mpn_factor_trial(mp_srcptr x, mp_size_t xsize, long start, long stop)
 {
     long i;
-    n_compute_primes(stop);
+    const mp_limb_t * primes = n_primes_arr_readonly(stop);
+
     for (i = start; i < stop; i++)
     {
-        if (flint_mpn_divisible_1_p(x, xsize, flint_primes[i]))
+        if (flint_mpn_divisible_1_p(x, xsize, primes[i]))
             return i;
     }
     return 0;
@@ -0,0 +1,121 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "longlong.h"
+#include "mpn_extras.h"
+
+/*
+    Sets {t + n, n} to {t, 2n} modulo {d, n}, assuming that the top n 
+    limbs of {t, 2n} are already reduced.  Requires 3n limbs of scratch 
+    space after t + 2n.
+ */
+static __inline__ void 
+__mpn_reduce_preinvn(mp_ptr t, mp_srcptr d, mp_size_t n, mp_srcptr dinv)
+{
+   mp_limb_t cy, top = t[n];
+
+   flint_mpn_mul_n(t + 3*n, t + n, dinv, n);
+   mpn_add_n(t + 4*n, t + 4*n, t + n, n);
+
+   flint_mpn_mul_n(t + 2*n, t + 4*n, d, n);
+   cy = top - t[3*n] - mpn_sub_n(t + n, t, t + 2*n, n);
+
+   while (cy > 0)
+      cy -= mpn_sub_n(t + n, t + n, d, n);
+
+   if (mpn_cmp(t + n, d, n) >= 0)
+      mpn_sub_n(t + n, t + n, d, n);
+}
+
+void flint_mpn_mod_preinvn(mp_ptr r, mp_srcptr a, mp_size_t m, 
+                           mp_srcptr d, mp_size_t n, mp_srcptr dinv)
+{
+   mp_size_t i, s = m % n;
+
+   if (n == 1)
+   {
+      const mp_limb_t d0 = d[0], dinv0 = dinv[0];
+      mp_limb_t q, q0, r1, r0, t1, t0;
+
+      r1 = 0;
+
+      for (i = m - 1; i >= 0; i--)
+      {
+         umul_ppmm(q, q0, r1, dinv0);
+         q += r1;
+
+         umul_ppmm(t1, t0, q, d0);
+         sub_ddmmss(r1, r0, r1, a[i], t1, t0);
+
+         while (r1 != 0 || r0 >= d0)
+            sub_ddmmss(r1, r0, r1, r0, 0, d0);
+
+         r1 = r0;
+      }
+
+      r[0] = r1;
+   }
+   else
+   {
+      mp_limb_t ts[150];
+      mp_ptr t;
+
+      if (n <= 30)
+         t = ts;
+      else
+         t = flint_malloc(5*n*sizeof(mp_limb_t));
+
+      /* 
+         Start with the leading s limbs, or with the leading n limbs 
+         if s is zero, which are smaller than 2d as d is normalised
+       */
+      if (s == 0)
+      {
+         s = n;
+         mpn_copyi(t + n, a + (m - n), n);
+         if (mpn_cmp(t + n, d, n) >= 0)
+            mpn_sub_n(t + n, t + n, d, n);
+      }
+      else
+      {
+         mpn_zero(t + n, n);
+         mpn_copyi(t + n, a + (m - s), s);
+      }
+
+      for (i = m - s - n; i >= 0; i -= n)
+      {
+         mpn_copyi(t, a + i, n);
+         __mpn_reduce_preinvn(t, d, n, dinv);
+      }
+
+      mpn_copyi(r, t + n, n);
+
+      if (n > 30)
+         flint_free(t);
+   }
+}
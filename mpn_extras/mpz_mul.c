@@ -0,0 +1,107 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fft_tuning.h"
+
+void flint_mpz_mul(mpz_ptr z, mpz_srcptr x, mpz_srcptr y)
+{
+    mp_size_t xn = x->_mp_size, yn = y->_mp_size, zn;
+    int neg = (xn ^ yn) < 0;
+    mp_ptr zd;
+
+    xn = FLINT_ABS(xn);
+    yn = FLINT_ABS(yn);
+
+    if (xn < yn)
+    {
+        mpz_srcptr t = x;
+        mp_size_t tn = xn;
+        x = y; xn = yn;
+        y = t; yn = tn;
+    }
+
+    zn = xn + yn;
+
+    if (xn <= 2 && yn != 0)  /* the product is computed in registers */
+    {
+        mp_limb_t p[4];
+
+        zn = flint_mpz_mul_2x2(p, x, y);
+        zd = (z->_mp_alloc < 4) ? _mpz_realloc(z, 4) : z->_mp_d;
+
+        zd[0] = p[0];
+        zd[1] = p[1];
+        zd[2] = p[2];
+        zd[3] = p[3];
+        z->_mp_size = zn;
+        return;
+    }
+
+    if (yn < FLINT_MIN(FFT_MUL_CUTOFF, FFT_SQR_CUTOFF))
+    {
+        /* skip the mpz layer if the product fits without reallocation */
+        if (z != x && z != y && zn <= z->_mp_alloc && yn != 0)
+        {
+            zd = z->_mp_d;
+
+            if (x == y)
+                mpn_sqr(zd, x->_mp_d, xn);
+            else
+                mpn_mul(zd, x->_mp_d, xn, y->_mp_d, yn);
+
+            zn -= (zd[zn - 1] == 0);
+            z->_mp_size = neg ? -zn : zn;
+        }
+        else
+            mpz_mul(z, x, y);
+
+        return;
+    }
+
+    /* the FFT does not allow the output to overlap the inputs */
+    if (z == x || z == y)
+        zd = flint_malloc(zn*sizeof(mp_limb_t));
+    else
+        zd = _mpz_realloc(z, zn);
+    
+    if (x == y)
+        flint_mpn_sqr(zd, x->_mp_d, xn);
+    else
+        flint_mpn_mul(zd, x->_mp_d, xn, y->_mp_d, yn);
+
+    if (z == x || z == y)
+    {
+        mp_ptr t = _mpz_realloc(z, zn);
+        flint_mpn_copyi(t, zd, zn);
+        flint_free(zd);
+        zd = t;
+    }
+
+    zn -= (zd[zn - 1] == 0);
+    z->_mp_size = neg ? -zn : zn;
+}
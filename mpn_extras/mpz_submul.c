@@ -0,0 +1,57 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fft_tuning.h"
+
+void flint_mpz_submul(mpz_ptr z, mpz_srcptr x, mpz_srcptr y)
+{
+    mp_size_t xn = FLINT_ABS(x->_mp_size), yn = FLINT_ABS(y->_mp_size);
+
+    if (xn <= 2 && yn <= 2 && xn != 0 && yn != 0)
+    {
+        mp_limb_t p[4];
+        __mpz_struct t;
+
+        t._mp_size = flint_mpz_mul_2x2(p, x, y);
+        t._mp_d = p;
+        t._mp_alloc = 4;
+
+        mpz_sub(z, z, &t);
+    }
+    else if (FLINT_MIN(xn, yn) < FLINT_MIN(FFT_MUL_CUTOFF, FFT_SQR_CUTOFF))
+        mpz_submul(z, x, y);
+    else
+    {
+        mpz_t t;
+
+        mpz_init(t);
+        flint_mpz_mul(t, x, y);
+        mpz_sub(z, z, t);
+        mpz_clear(t);
+    }
+}
@@ -0,0 +1,41 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "fft.h"
+#include "fft_tuning.h"
+
+mp_limb_t flint_mpn_mul(mp_ptr z, mp_srcptr x, mp_size_t xn, 
+                                               mp_srcptr y, mp_size_t yn)
+{
+    if (yn < FFT_MUL_CUTOFF)
+        return mpn_mul(z, x, xn, y, yn);
+
+    flint_mpn_mul_fft_main(z, (mp_ptr) x, xn, (mp_ptr) y, yn);
+
+    return z[xn + yn - 1];
+}
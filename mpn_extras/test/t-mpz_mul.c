@@ -0,0 +1,117 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "ulong_extras.h"
+#include "fft_tuning.h"
+
+int main(void)
+{
+    int i, result;
+    mpz_t a, b, c, d;
+    flint_rand_t state;
+    
+    printf("mpz_mul....");
+    fflush(stdout);
+
+    flint_randinit(state);
+    _flint_rand_init_gmp(state);
+
+    mpz_init(a);
+    mpz_init(b);
+    mpz_init(c);
+    mpz_init(d);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        mp_bitcnt_t bits = FLINT_BITS*FLINT_MAX(FFT_MUL_CUTOFF, FFT_SQR_CUTOFF);
+        int alias = n_randint(state, 4);
+
+        /* also exercise the paths for operands of a few limbs */
+        if (n_randint(state, 2))
+            bits = 3 * FLINT_BITS;
+
+        mpz_rrandomb(a, state->gmp_state, n_randint(state, 2*bits) + 1);
+        mpz_rrandomb(b, state->gmp_state, n_randint(state, 2*bits) + 1);
+        mpz_rrandomb(c, state->gmp_state, n_randint(state, 2*bits) + 1);
+        if (n_randint(state, 2))
+            mpz_neg(a, a);
+        if (n_randint(state, 2))
+            mpz_neg(b, b);
+        if (n_randint(state, 10) == 0)
+            mpz_set_ui(b, 0);
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                if (alias == 0)
+                {
+                    mpz_mul(d, a, a);
+                    flint_mpz_mul(c, a, a);
+                } else if (alias == 1)
+                {
+                    mpz_mul(d, a, b);
+                    flint_mpz_mul(a, a, b);
+                    mpz_swap(a, c);
+                } else
+                {
+                    mpz_mul(d, a, b);
+                    flint_mpz_mul(c, a, b);
+                }
+                break;
+            case 1:
+                mpz_set(d, c);
+                mpz_addmul(d, a, b);
+                flint_mpz_addmul(c, a, b);
+                break;
+            default:
+                mpz_set(d, c);
+                mpz_submul(d, a, b);
+                flint_mpz_submul(c, a, b);
+        }
+
+        result = (mpz_cmp(c, d) == 0);
+        if (!result)
+        {
+            printf("FAIL:\n");
+            gmp_printf("a = %Zd\nb = %Zd\n", a, b);
+            abort();
+        }
+    }
+
+    mpz_clear(a);
+    mpz_clear(b);
+    mpz_clear(c);
+    mpz_clear(d);
+
+    flint_randclear(state);
+
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "ulong_extras.h"
+#include "fft_tuning.h"
+
+int main(void)
+{
+    int i, result;
+    flint_rand_t state;
+    
+    printf("mul....");
+    fflush(stdout);
+
+    flint_randinit(state);
+    _flint_rand_init_gmp(state);
+
+    /* compare flint_mpn_mul and flint_mpn_mul_n with mpn_mul */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        mp_size_t xn, yn, j;
+        mp_limb_t top1, top2;
+        mp_ptr x, y, z1, z2;
+
+        if (n_randint(state, 4) == 0)
+            yn = n_randint(state, 100) + 1;
+        else
+            yn = FFT_MUL_CUTOFF + n_randint(state, FFT_MUL_CUTOFF) - 100;
+        xn = yn + n_randint(state, 2*yn);
+        if (n_randint(state, 4) == 0)
+            xn = yn;
+
+        x = flint_malloc(xn*sizeof(mp_limb_t));
+        y = flint_malloc(yn*sizeof(mp_limb_t));
+        z1 = flint_malloc((xn + yn)*sizeof(mp_limb_t));
+        z2 = flint_malloc((xn + yn)*sizeof(mp_limb_t));
+
+        flint_mpn_rrandom(x, state->gmp_state, xn);
+        flint_mpn_rrandom(y, state->gmp_state, yn);
+
+        top1 = mpn_mul(z1, x, xn, y, yn);
+
+        if (xn == yn && n_randint(state, 2))
+        {
+            flint_mpn_mul_n(z2, x, y, xn);
+            top2 = z2[xn + yn - 1];
+        }
+        else
+            top2 = flint_mpn_mul(z2, x, xn, y, yn);
+
+        result = (top1 == top2);
+        for (j = 0; j < xn + yn; j++)
+            result &= (z1[j] == z2[j]);
+
+        if (!result)
+        {
+            printf("FAIL:\n");
+            printf("xn = %ld, yn = %ld\n", xn, yn);
+            abort();
+        }
+
+        flint_free(x);
+        flint_free(y);
+        flint_free(z1);
+        flint_free(z2);
+    }
+
+    flint_randclear(state);
+
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,89 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpn_extras.h"
+#include "ulong_extras.h"
+#include "fft_tuning.h"
+
+int main(void)
+{
+    int i, result;
+    flint_rand_t state;
+    
+    printf("sqr....");
+    fflush(stdout);
+
+    flint_randinit(state);
+    _flint_rand_init_gmp(state);
+
+    /* compare flint_mpn_sqr and flint_mpn_mul_n with mpn_sqr */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        mp_size_t n, j;
+        mp_ptr x, z1, z2;
+
+        if (n_randint(state, 4) == 0)
+            n = n_randint(state, 100) + 1;
+        else
+            n = FFT_SQR_CUTOFF + n_randint(state, FFT_SQR_CUTOFF) - 100;
+
+        x = flint_malloc(n*sizeof(mp_limb_t));
+        z1 = flint_malloc(2*n*sizeof(mp_limb_t));
+        z2 = flint_malloc(2*n*sizeof(mp_limb_t));
+
+        flint_mpn_rrandom(x, state->gmp_state, n);
+
+        mpn_sqr(z1, x, n);
+
+        if (n_randint(state, 2))
+            flint_mpn_sqr(z2, x, n);
+        else
+            flint_mpn_mul_n(z2, x, x, n);
+
+        result = 1;
+        for (j = 0; j < 2*n; j++)
+            result &= (z1[j] == z2[j]);
+
+        if (!result)
+        {
+            printf("FAIL:\n");
+            printf("n = %ld\n", n);
+            abort();
+        }
+
+        flint_free(x);
+        flint_free(z1);
+        flint_free(z2);
+    }
+
+    flint_randclear(state);
+
+    printf("PASS\n");
+    return 0;
+}
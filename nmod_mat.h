@@ -125,11 +125,19 @@ void nmod_mat_scalar_mul(nmod_mat_t B, const nmod_mat_t A, mp_limb_t c);
 void nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
 void nmod_mat_mul_classical(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
 void nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
+int nmod_mat_mul_blas(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
+
+int _nmod_mat_mul_use_classical(long m, long k, long n, nmod_t mod);
+
+long _nmod_mat_mul_optimal_modulus_bits(long m, long k, long n);
 
 void
 _nmod_mat_mul_classical(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B, int op);
 
+void _nmod_mat_mul_blocked(mp_ptr * D, mp_ptr * const C, mp_ptr * const A,
+    mp_ptr * const B, long m, long k, long n, int op, nmod_t mod, int nlimbs);
+
 void nmod_mat_addmul(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B);
 
@@ -188,8 +196,16 @@ long nmod_mat_nullspace(nmod_mat_t X, const nmod_mat_t A);
 /* Size at which pre-transposing becomes faster in classical multiplication */
 #define NMOD_MAT_MUL_TRANSPOSE_CUTOFF 20
 
+/* Size at which the cache blocked classical multiplication is used */
+#define NMOD_MAT_MUL_BLOCKED_CUTOFF 16
+
+/* Multiplication via a floating point BLAS, if configured */
+#define NMOD_MAT_MUL_BLAS_CUTOFF 800    /* minimum dimension */
+#define NMOD_MAT_MUL_BLAS_MAX_BITS 24   /* maximum bits of the modulus */
+
 /* Strassen multiplication */
 #define NMOD_MAT_MUL_STRASSEN_CUTOFF 256
+#define NMOD_MAT_MUL_STRASSEN_SMALL_CUTOFF 1024  /* for n <= 2^(FLINT_BITS/2) */
 
 /* Cutoff between classical and recursive triangular solving */
 #define NMOD_MAT_SOLVE_TRI_ROWS_CUTOFF 64
@@ -207,6 +223,13 @@ long nmod_mat_nullspace(nmod_mat_t X, const nmod_mat_t A);
  */
 #define NMOD_MAT_OPTIMAL_MODULUS_BITS (FLINT_BITS-5)
 
+/*
+   Modulus size giving the most bits per cycle when the SIMD micro-kernels 
+   of the blocked classical multiplication are available. Products of 
+   entries then fit in a double limb accumulated in 32 bit halves.
+ */
+#define NMOD_MAT_SIMD_MODULUS_BITS 26
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,6 +29,64 @@
 #include "nmod_mat.h"
 #include "nmod_vec.h"
 
+static __inline__ int
+_nmod_mat_mul_use_blas(long m, long k, long n, nmod_t mod)
+{
+#if HAVE_BLAS
+    return m >= NMOD_MAT_MUL_BLAS_CUTOFF && n >= NMOD_MAT_MUL_BLAS_CUTOFF
+        && k >= NMOD_MAT_MUL_BLAS_CUTOFF
+        && FLINT_BIT_COUNT(mod.n) <= NMOD_MAT_MUL_BLAS_MAX_BITS;
+#else
+    return 0;
+#endif
+}
+
+/*
+   Returns 1 if nmod_mat_mul would use classical multiplication, in which 
+   case addmul and submul can fuse the addition into the multiplication.
+*/
+int
+_nmod_mat_mul_use_classical(long m, long k, long n, nmod_t mod)
+{
+    long cutoff;
+
+    if (_nmod_mat_mul_use_blas(m, k, n, mod))
+        return 0;
+
+    /* the blocked classical kernels are much faster for half limb moduli */
+    if (mod.n <= (1UL << (FLINT_BITS / 2)))
+        cutoff = NMOD_MAT_MUL_STRASSEN_SMALL_CUTOFF;
+    else
+        cutoff = NMOD_MAT_MUL_STRASSEN_CUTOFF;
+
+    return m < cutoff || n < cutoff || k < cutoff;
+}
+
+/*
+   Returns the number of bits b such that multimodular algorithms should 
+   use primes just above 2^b for products of an m x k by a k x n matrix, 
+   taking into account which algorithm nmod_mat_mul will select.
+*/
+long
+_nmod_mat_mul_optimal_modulus_bits(long m, long k, long n)
+{
+    nmod_t mod;
+
+    nmod_init(&mod, 1UL << (NMOD_MAT_MUL_BLAS_MAX_BITS - 1));
+
+    if (_nmod_mat_mul_use_blas(m, k, n, mod))
+        return NMOD_MAT_MUL_BLAS_MAX_BITS - 1;
+
+#if NMOD_VEC_SIMD
+    if (_nmod_vec_simd_level() != NMOD_VEC_SIMD_NONE
+        && m >= NMOD_MAT_MUL_BLOCKED_CUTOFF && n >= NMOD_MAT_MUL_BLOCKED_CUTOFF
+        && k >= NMOD_MAT_MUL_BLOCKED_CUTOFF)
+        return NMOD_MAT_SIMD_MODULUS_BITS;
+#endif
+
+    return NMOD_MAT_OPTIMAL_MODULUS_BITS;
+}
+
 void
 nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
 {
@@ -38,9 +96,10 @@ nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
     k = A->c;
     n = B->c;
 
-    if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        n < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        k < NMOD_MAT_MUL_STRASSEN_CUTOFF)
+    if (_nmod_mat_mul_use_blas(m, k, n, A->mod) && nmod_mat_mul_blas(C, A, B))
+        return;
+
+    if (_nmod_mat_mul_use_classical(m, k, n, A->mod))
     {
         nmod_mat_mul_classical(C, A, B);
     }
@@ -0,0 +1,153 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_vec.h"
+
+#if HAVE_BLAS
+
+#include <cblas.h>
+
+/* 2^53, all integers of absolute value up to this are exact doubles */
+#define MAT_DOUBLE_EXACT 9007199254740992.0
+
+/* sets x to the representative of a modulo n in [-n/2, n/2] */
+static __inline__ double
+_mat_balance(mp_limb_t a, mp_limb_t n)
+{
+    return (a > n/2) ? -((double) (n - a)) : (double) a;
+}
+
+/* 1.5 * 2^52, adding and subtracting this rounds doubles below 2^51 */
+#define MAT_DOUBLE_ROUND 6755399441055744.0
+
+/*
+   Reduces x with |x| < 2^53 to an integer of absolute value at most 
+   about n/2. The quotient is off by at most one, so that the result is 
+   certainly less than n in absolute value. Both q*n and x - q*n are 
+   exact as they are integers less than 2^53 in absolute value.
+*/
+static __inline__ double
+_mat_reduce_double(double x, double n, double ninv)
+{
+    double q = (x*ninv + MAT_DOUBLE_ROUND) - MAT_DOUBLE_ROUND;
+
+    return x - q*n;
+}
+
+int
+nmod_mat_mul_blas(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
+{
+    long m, k, n, i, j, kb, pc;
+    double * Ad, * Bd, * Cd;
+    double nd, ninv, half;
+    mp_limb_t p = A->mod.n;
+
+    m = A->r;
+    k = A->c;
+    n = B->c;
+
+    if (FLINT_BIT_COUNT(p) > NMOD_MAT_MUL_BLAS_MAX_BITS)
+        return 0;
+
+    if (m == 0 || n == 0)
+        return 1;
+
+    if (k == 0)
+    {
+        nmod_mat_zero(C);
+        return 1;
+    }
+
+    nd = (double) p;
+    ninv = 1.0/nd;
+    half = (double) (p/2);
+
+    /*
+       The accumulated entries of C stay below n in absolute value, so 
+       each block of kb products can be added without losing exactness 
+       as long as kb (n/2)^2 + n <= 2^53.
+    */
+    kb = (long) ((MAT_DOUBLE_EXACT - nd)/(half*half + 1.0));
+    kb = FLINT_MAX(FLINT_MIN(kb, k), 1);
+
+    Ad = flint_malloc(m*k*sizeof(double));
+    Bd = flint_malloc(k*n*sizeof(double));
+    Cd = flint_calloc(m*n, sizeof(double));
+
+    for (i = 0; i < m; i++)
+        for (j = 0; j < k; j++)
+            Ad[i*k + j] = _mat_balance(A->rows[i][j], p);
+
+    for (i = 0; i < k; i++)
+        for (j = 0; j < n; j++)
+            Bd[i*n + j] = _mat_balance(B->rows[i][j], p);
+
+    for (pc = 0; pc < k; pc += kb)
+    {
+        long w = FLINT_MIN(kb, k - pc);
+
+        cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, w, 
+                    1.0, Ad + pc, k, Bd + pc*n, n, 1.0, Cd, n);
+
+        if (pc + w < k)
+        {
+            for (i = 0; i < m*n; i++)
+                Cd[i] = _mat_reduce_double(Cd[i], nd, ninv);
+        }
+    }
+
+    for (i = 0; i < m; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            double x = _mat_reduce_double(Cd[i*n + j], nd, ninv);
+
+            if (x < 0)
+                x += nd;
+
+            C->rows[i][j] = (mp_limb_t) x;
+        }
+    }
+
+    flint_free(Ad);
+    flint_free(Bd);
+    flint_free(Cd);
+
+    return 1;
+}
+
+#else
+
+int
+nmod_mat_mul_blas(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,514 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_SIMD
+#include <immintrin.h>
+#endif
+
+/*
+   Cache blocked matrix multiplication in the style of GotoBLAS. Panels of 
+   B (kc x NR) and A (MR x kc) are packed into contiguous buffers and an 
+   MR x NR micro-kernel accumulates unreduced products over each panel.
+   The unreduced sums of one MC x NC block of the output are kept in a 
+   buffer T holding one MR x NR tile after another, and are reduced and 
+   added into D after each k-block, so that T is bounded by the block 
+   sizes rather than by the size of D.
+
+   Each accumulator consists of w planes, i.e. limb l of entry (i, j) of 
+   a tile is t[l*MR*NR + i*NR + j]. The planes are interpreted as
+      w = 1: a single limb sum,
+      w = 2: a two limb sum (lo, hi), or for the split kernels, the sums 
+             of the low and the high 32 bits of the products,
+      w = 3: a three limb sum.
+*/
+
+#define MAT_KC 256     /* depth of the packed panels */
+#define MAT_MC 64      /* rows of A packed at once, a multiple of each MR */
+#define MAT_NC 2048    /* columns of B packed at once, a multiple of each NR */
+
+typedef void (*_mat_kernel_func)(long kc, mp_srcptr a, mp_srcptr b, mp_ptr t);
+
+typedef struct
+{
+   _mat_kernel_func fn;
+   int mr;
+   int nr;
+   int w;
+   int split;
+} _mat_kernel_t;
+
+/* Scalar kernels ************************************************************/
+
+/* single limb sums, 4 x 4 */
+static void
+_mat_kernel_1(long kc, mp_srcptr a, mp_srcptr b, mp_ptr t)
+{
+   mp_limb_t s[16];
+   long i, j, kk;
+
+   for (i = 0; i < 16; i++)
+      s[i] = t[i];
+
+   for (kk = 0; kk < kc; kk++, a += 4, b += 4)
+      for (i = 0; i < 4; i++)
+         for (j = 0; j < 4; j++)
+            s[4*i + j] += a[i]*b[j];
+
+   for (i = 0; i < 16; i++)
+      t[i] = s[i];
+}
+
+/* two limb sums, 2 x 2 */
+static void
+_mat_kernel_2(long kc, mp_srcptr a, mp_srcptr b, mp_ptr t)
+{
+   mp_limb_t l00 = t[0], l01 = t[1], l10 = t[2], l11 = t[3];
+   mp_limb_t h00 = t[4], h01 = t[5], h10 = t[6], h11 = t[7];
+   mp_limb_t p1, p0;
+   long kk;
+
+   for (kk = 0; kk < kc; kk++, a += 2, b += 2)
+   {
+      umul_ppmm(p1, p0, a[0], b[0]);
+      add_ssaaaa(h00, l00, h00, l00, p1, p0);
+      umul_ppmm(p1, p0, a[0], b[1]);
+      add_ssaaaa(h01, l01, h01, l01, p1, p0);
+      umul_ppmm(p1, p0, a[1], b[0]);
+      add_ssaaaa(h10, l10, h10, l10, p1, p0);
+      umul_ppmm(p1, p0, a[1], b[1]);
+      add_ssaaaa(h11, l11, h11, l11, p1, p0);
+   }
+
+   t[0] = l00; t[1] = l01; t[2] = l10; t[3] = l11;
+   t[4] = h00; t[5] = h01; t[6] = h10; t[7] = h11;
+}
+
+/* three limb sums, 2 x 2 */
+static void
+_mat_kernel_3(long kc, mp_srcptr a, mp_srcptr b, mp_ptr t)
+{
+   mp_limb_t l00 = t[0], l01 = t[1], l10 = t[2], l11 = t[3];
+   mp_limb_t m00 = t[4], m01 = t[5], m10 = t[6], m11 = t[7];
+   mp_limb_t h00 = t[8], h01 = t[9], h10 = t[10], h11 = t[11];
+   mp_limb_t p1, p0;
+   long kk;
+
+   for (kk = 0; kk < kc; kk++, a += 2, b += 2)
+   {
+      umul_ppmm(p1, p0, a[0], b[0]);
+      add_sssaaaaaa(h00, m00, l00, h00, m00, l00, 0, p1, p0);
+      umul_ppmm(p1, p0, a[0], b[1]);
+      add_sssaaaaaa(h01, m01, l01, h01, m01, l01, 0, p1, p0);
+      umul_ppmm(p1, p0, a[1], b[0]);
+      add_sssaaaaaa(h10, m10, l10, h10, m10, l10, 0, p1, p0);
+      umul_ppmm(p1, p0, a[1], b[1]);
+      add_sssaaaaaa(h11, m11, l11, h11, m11, l11, 0, p1, p0);
+   }
+
+   t[0] = l00; t[1] = l01; t[2] = l10; t[3] = l11;
+   t[4] = m00; t[5] = m01; t[6] = m10; t[7] = m11;
+   t[8] = h00; t[9] = h01; t[10] = h10; t[11] = h11;
+}
+
+/* SIMD kernels **************************************************************/
+
+/*
+   These require entries below 2^32 so that each product fits in a 
+   64-bit lane.
+*/
+
+#if NMOD_VEC_SIMD
+
+#define AVX2 __attribute__((target("avx2")))
+#define AVX512 __attribute__((target("avx512f")))
+
+#define LOAD256(p) _mm256_loadu_si256((const __m256i *) (p))
+#define STORE256(p, x) _mm256_storeu_si256((__m256i *) (p), (x))
+
+/* single limb sums, 4 x 8 */
+static AVX2 void
+_mat_kernel_avx2_1(long kc, mp_srcptr a, mp_srcptr b, mp_ptr t)
+{
+   __m256i s00 = LOAD256(t + 0), s01 = LOAD256(t + 4);
+   __m256i s10 = LOAD256(t + 8), s11 = LOAD256(t + 12);
+   __m256i s20 = LOAD256(t + 16), s21 = LOAD256(t + 20);
+   __m256i s30 = LOAD256(t + 24), s31 = LOAD256(t + 28);
+   __m256i b0, b1, x;
+   long kk;
+
+   for (kk = 0; kk < kc; kk++, a += 4, b += 8)
+   {
+      b0 = LOAD256(b);
+      b1 = LOAD256(b + 4);
+
+      x = _mm256_set1_epi64x(a[0]);
+      s00 = _mm256_add_epi64(s00, _mm256_mul_epu32(x, b0));
+      s01 = _mm256_add_epi64(s01, _mm256_mul_epu32(x, b1));
+      x = _mm256_set1_epi64x(a[1]);
+      s10 = _mm256_add_epi64(s10, _mm256_mul_epu32(x, b0));
+      s11 = _mm256_add_epi64(s11, _mm256_mul_epu32(x, b1));
+      x = _mm256_set1_epi64x(a[2]);
+      s20 = _mm256_add_epi64(s20, _mm256_mul_epu32(x, b0));
+      s21 = _mm256_add_epi64(s21, _mm256_mul_epu32(x, b1));
+      x = _mm256_set1_epi64x(a[3]);
+      s30 = _mm256_add_epi64(s30, _mm256_mul_epu32(x, b0));
+      s31 = _mm256_add_epi64(s31, _mm256_mul_epu32(x, b1));
+   }
+
+   STORE256(t + 0, s00); STORE256(t + 4, s01);
+   STORE256(t + 8, s10); STORE256(t + 12, s11);
+   STORE256(t + 16, s20); STORE256(t + 20, s21);
+   STORE256(t + 24, s30); STORE256(t + 28, s31);
+}
+
+/* split sums of the low and high halves of the products, 2 x 8 */
+static AVX2 void
+_mat_kernel_avx2_split(long kc, mp_srcptr a, mp_srcptr b, mp_ptr t)
+{
+   const __m256i mask = _mm256_set1_epi64x(0xffffffffL);
+   __m256i l00 = LOAD256(t + 0), l01 = LOAD256(t + 4);
+   __m256i l10 = LOAD256(t + 8), l11 = LOAD256(t + 12);
+   __m256i h00 = LOAD256(t + 16), h01 = LOAD256(t + 20);
+   __m256i h10 = LOAD256(t + 24), h11 = LOAD256(t + 28);
+   __m256i b0, b1, x, p;
+   long kk;
+
+   for (kk = 0; kk < kc; kk++, a += 2, b += 8)
+   {
+      b0 = LOAD256(b);
+      b1 = LOAD256(b + 4);
+
+      x = _mm256_set1_epi64x(a[0]);
+      p = _mm256_mul_epu32(x, b0);
+      l00 = _mm256_add_epi64(l00, _mm256_and_si256(p, mask));
+      h00 = _mm256_add_epi64(h00, _mm256_srli_epi64(p, 32));
+      p = _mm256_mul_epu32(x, b1);
+      l01 = _mm256_add_epi64(l01, _mm256_and_si256(p, mask));
+      h01 = _mm256_add_epi64(h01, _mm256_srli_epi64(p, 32));
+      x = _mm256_set1_epi64x(a[1]);
+      p = _mm256_mul_epu32(x, b0);
+      l10 = _mm256_add_epi64(l10, _mm256_and_si256(p, mask));
+      h10 = _mm256_add_epi64(h10, _mm256_srli_epi64(p, 32));
+      p = _mm256_mul_epu32(x, b1);
+      l11 = _mm256_add_epi64(l11, _mm256_and_si256(p, mask));
+      h11 = _mm256_add_epi64(h11, _mm256_srli_epi64(p, 32));
+   }
+
+   STORE256(t + 0, l00); STORE256(t + 4, l01);
+   STORE256(t + 8, l10); STORE256(t + 12, l11);
+   STORE256(t + 16, h00); STORE256(t + 20, h01);
+   STORE256(t + 24, h10); STORE256(t + 28, h11);
+}
+
+/* single limb sums, 4 x 16 */
+static AVX512 void
+_mat_kernel_avx512_1(long kc, mp_srcptr a, mp_srcptr b, mp_ptr t)
+{
+   __m512i s00 = _mm512_loadu_si512(t + 0), s01 = _mm512_loadu_si512(t + 8);
+   __m512i s10 = _mm512_loadu_si512(t + 16), s11 = _mm512_loadu_si512(t + 24);
+   __m512i s20 = _mm512_loadu_si512(t + 32), s21 = _mm512_loadu_si512(t + 40);
+   __m512i s30 = _mm512_loadu_si512(t + 48), s31 = _mm512_loadu_si512(t + 56);
+   __m512i b0, b1, x;
+   long kk;
+
+   for (kk = 0; kk < kc; kk++, a += 4, b += 16)
+   {
+      b0 = _mm512_loadu_si512(b);
+      b1 = _mm512_loadu_si512(b + 8);
+
+      x = _mm512_set1_epi64(a[0]);
+      s00 = _mm512_add_epi64(s00, _mm512_mul_epu32(x, b0));
+      s01 = _mm512_add_epi64(s01, _mm512_mul_epu32(x, b1));
+      x = _mm512_set1_epi64(a[1]);
+      s10 = _mm512_add_epi64(s10, _mm512_mul_epu32(x, b0));
+      s11 = _mm512_add_epi64(s11, _mm512_mul_epu32(x, b1));
+      x = _mm512_set1_epi64(a[2]);
+      s20 = _mm512_add_epi64(s20, _mm512_mul_epu32(x, b0));
+      s21 = _mm512_add_epi64(s21, _mm512_mul_epu32(x, b1));
+      x = _mm512_set1_epi64(a[3]);
+      s30 = _mm512_add_epi64(s30, _mm512_mul_epu32(x, b0));
+      s31 = _mm512_add_epi64(s31, _mm512_mul_epu32(x, b1));
+   }
+
+   _mm512_storeu_si512(t + 0, s00); _mm512_storeu_si512(t + 8, s01);
+   _mm512_storeu_si512(t + 16, s10); _mm512_storeu_si512(t + 24, s11);
+   _mm512_storeu_si512(t + 32, s20); _mm512_storeu_si512(t + 40, s21);
+   _mm512_storeu_si512(t + 48, s30); _mm512_storeu_si512(t + 56, s31);
+}
+
+/* split sums of the low and high halves of the products, 4 x 16 */
+static AVX512 void
+_mat_kernel_avx512_split(long kc, mp_srcptr a, mp_srcptr b, mp_ptr t)
+{
+   const __m512i mask = _mm512_set1_epi64(0xffffffffL);
+   __m512i l[8], h[8], b0, b1, x, p;
+   long i, kk;
+
+   for (i = 0; i < 8; i++)
+   {
+      l[i] = _mm512_loadu_si512(t + 8*i);
+      h[i] = _mm512_loadu_si512(t + 64 + 8*i);
+   }
+
+   for (kk = 0; kk < kc; kk++, a += 4, b += 16)
+   {
+      b0 = _mm512_loadu_si512(b);
+      b1 = _mm512_loadu_si512(b + 8);
+
+      for (i = 0; i < 4; i++)
+      {
+         x = _mm512_set1_epi64(a[i]);
+         p = _mm512_mul_epu32(x, b0);
+         l[2*i] = _mm512_add_epi64(l[2*i], _mm512_and_si512(p, mask));
+         h[2*i] = _mm512_add_epi64(h[2*i], _mm512_srli_epi64(p, 32));
+         p = _mm512_mul_epu32(x, b1);
+         l[2*i + 1] = _mm512_add_epi64(l[2*i + 1], _mm512_and_si512(p, mask));
+         h[2*i + 1] = _mm512_add_epi64(h[2*i + 1], _mm512_srli_epi64(p, 32));
+      }
+   }
+
+   for (i = 0; i < 8; i++)
+   {
+      _mm512_storeu_si512(t + 8*i, l[i]);
+      _mm512_storeu_si512(t + 64 + 8*i, h[i]);
+   }
+}
+
+#endif
+
+/* Driver ********************************************************************/
+
+static void
+_mat_kernel_select(_mat_kernel_t * ker, nmod_t mod, int nlimbs)
+{
+   ker->split = 0;
+
+#if NMOD_VEC_SIMD
+   if (mod.n <= (1UL << 32))
+   {
+      int level = _nmod_vec_simd_level();
+
+      if (level == NMOD_VEC_SIMD_AVX512)
+      {
+         ker->mr = 4;
+         ker->nr = 16;
+
+         if (nlimbs <= 1)
+         {
+            ker->fn = _mat_kernel_avx512_1;
+            ker->w = 1;
+         } else
+         {
+            ker->fn = _mat_kernel_avx512_split;
+            ker->w = 2;
+            ker->split = 1;
+         }
+
+         return;
+      } else if (level == NMOD_VEC_SIMD_AVX2)
+      {
+         ker->nr = 8;
+
+         if (nlimbs <= 1)
+         {
+            ker->fn = _mat_kernel_avx2_1;
+            ker->mr = 4;
+            ker->w = 1;
+         } else
+         {
+            ker->fn = _mat_kernel_avx2_split;
+            ker->mr = 2;
+            ker->w = 2;
+            ker->split = 1;
+         }
+
+         return;
+      }
+   }
+#endif
+
+   if (nlimbs <= 1)
+   {
+      ker->fn = _mat_kernel_1;
+      ker->mr = ker->nr = 4;
+      ker->w = 1;
+   } else
+   {
+      ker->fn = (nlimbs == 2) ? _mat_kernel_2 : _mat_kernel_3;
+      ker->mr = ker->nr = 2;
+      ker->w = nlimbs;
+   }
+}
+
+/* reduces the accumulator at t, whose planes are step limbs apart */
+static __inline__ mp_limb_t
+_mat_reduce(mp_srcptr t, long step, const _mat_kernel_t * ker, nmod_t mod)
+{
+   mp_limb_t r, s0, s1, s2;
+
+   if (ker->w == 1)
+   {
+      NMOD_RED(r, t[0], mod);
+   } else if (ker->split)
+   {
+      s1 = t[step] >> 32;
+      s0 = t[step] << 32;
+      add_ssaaaa(s1, s0, s1, s0, 0, t[0]);
+      NMOD2_RED2(r, s1, s0, mod);
+   } else if (ker->w == 2)
+   {
+      NMOD2_RED2(r, t[step], t[0], mod);
+   } else
+   {
+      NMOD_RED(s2, t[2*step], mod);
+      NMOD_RED3(r, s2, t[step], t[0], mod);
+   }
+
+   return r;
+}
+
+void
+_nmod_mat_mul_blocked(mp_ptr * D, mp_ptr * const C, mp_ptr * const A,
+    mp_ptr * const B, long m, long k, long n, int op, nmod_t mod, int nlimbs)
+{
+   _mat_kernel_t ker;
+   long mr, nr, tile, mt, nt, ic, jc, pc, ir, jr, i, j, kk, mb, nb, kb;
+   mp_ptr T, Ap, Bp, d;
+   mp_srcptr t;
+   mp_limb_t c;
+
+   _mat_kernel_select(&ker, mod, nlimbs);
+
+   mr = ker.mr;
+   nr = ker.nr;
+   tile = mr*nr*ker.w;
+   mt = (FLINT_MIN(MAT_MC, m) + mr - 1)/mr;
+   nt = (FLINT_MIN(MAT_NC, n) + nr - 1)/nr;
+
+   T = flint_malloc(mt*nt*tile*sizeof(mp_limb_t));
+   Ap = flint_malloc(mt*mr*FLINT_MIN(MAT_KC, k)*sizeof(mp_limb_t));
+   Bp = flint_malloc(nt*nr*FLINT_MIN(MAT_KC, k)*sizeof(mp_limb_t));
+
+   for (jc = 0; jc < n; jc += MAT_NC)
+   {
+      nb = FLINT_MIN(MAT_NC, n - jc);
+
+      for (pc = 0; pc < k; pc += MAT_KC)
+      {
+         kb = FLINT_MIN(MAT_KC, k - pc);
+
+         /* pack B[pc : pc + kb, jc : jc + nb] in panels of nr columns */
+         for (jr = 0; jr < nb; jr += nr)
+         {
+            mp_ptr b = Bp + jr*kb;
+            long w = FLINT_MIN(nr, nb - jr);
+
+            for (kk = 0; kk < kb; kk++, b += nr)
+            {
+               mp_srcptr row = B[pc + kk] + jc + jr;
+
+               for (j = 0; j < w; j++)
+                  b[j] = row[j];
+               for ( ; j < nr; j++)
+                  b[j] = 0;
+            }
+         }
+
+         for (ic = 0; ic < m; ic += MAT_MC)
+         {
+            mb = FLINT_MIN(MAT_MC, m - ic);
+
+            /* pack A[ic : ic + mb, pc : pc + kb] in panels of mr rows */
+            for (ir = 0; ir < mb; ir += mr)
+            {
+               mp_ptr a = Ap + ir*kb;
+
+               for (i = 0; i < mr; i++)
+               {
+                  if (ir + i < mb)
+                  {
+                     mp_srcptr row = A[ic + ir + i] + pc;
+
+                     for (kk = 0; kk < kb; kk++)
+                        a[kk*mr + i] = row[kk];
+                  } else
+                  {
+                     for (kk = 0; kk < kb; kk++)
+                        a[kk*mr + i] = 0;
+                  }
+               }
+            }
+
+            flint_mpn_zero(T, ((mb + mr - 1)/mr)*nt*tile);
+
+            for (jr = 0; jr < nb; jr += nr)
+               for (ir = 0; ir < mb; ir += mr)
+                  ker.fn(kb, Ap + ir*kb, Bp + jr*kb, 
+                                        T + ((ir/mr)*nt + jr/nr)*tile);
+
+            /* 
+               reduce the block into D, taking C into account on the 
+               first k-block only
+            */
+            for (i = 0; i < mb; i++)
+            {
+               t = T + (i/mr)*nt*tile + (i % mr)*nr;
+               d = D[ic + i] + jc;
+
+               for (jr = 0; jr < nb; jr += nr, t += tile)
+               {
+                  for (j = jr; j < FLINT_MIN(jr + nr, nb); j++)
+                  {
+                     c = _mat_reduce(t + j - jr, mr*nr, &ker, mod);
+
+                     if (pc == 0)
+                     {
+                        if (op == 1)
+                           c = nmod_add(C[ic + i][jc + j], c, mod);
+                        else if (op == -1)
+                           c = nmod_sub(C[ic + i][jc + j], c, mod);
+                     } else if (op == -1)
+                        c = nmod_sub(d[j], c, mod);
+                     else
+                        c = nmod_add(d[j], c, mod);
+
+                     d[j] = c;
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   flint_free(T);
+   flint_free(Ap);
+   flint_free(Bp);
+}
@@ -65,8 +65,10 @@ _nmod_mat_addmul_transpose(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
     mp_ptr tmp;
     mp_limb_t c;
     long i, j;
+    TMP_INIT;
 
-    tmp = flint_malloc(sizeof(mp_limb_t) * k * n);
+    TMP_START;
+    tmp = TMP_ALLOC(sizeof(mp_limb_t) * k * n);
 
     for (i = 0; i < k; i++)
         for (j = 0; j < n; j++)
@@ -87,7 +89,7 @@ _nmod_mat_addmul_transpose(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
         }
     }
 
-    flint_free(tmp);
+    TMP_END;
 }
 
 /* requires nlimbs = 1 */
@@ -101,6 +103,7 @@ _nmod_mat_addmul_packed(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
     mp_limb_t c, d, mask;
     mp_ptr tmp;
     mp_ptr Aptr, Tptr;
+    TMP_INIT;
 
     /* bound unreduced entry */
     c = N * (mod.n-1) * (mod.n-1);
@@ -113,7 +116,8 @@ _nmod_mat_addmul_packed(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
     else
         mask = (1UL << pack_bits) - 1;
 
-    tmp = _nmod_vec_init(Kpack * N);
+    TMP_START;
+    tmp = TMP_ALLOC(sizeof(mp_limb_t) * Kpack * N);
 
     /* pack and transpose B */
     for (i = 0; i < Kpack; i++)
@@ -167,7 +171,7 @@ _nmod_mat_addmul_packed(mp_ptr * D, const mp_ptr * C, const mp_ptr * A,
         }
     }
 
-    _nmod_vec_clear(tmp);
+    TMP_END;
 }
 
 
@@ -196,7 +200,13 @@ _nmod_mat_mul_classical(nmod_mat_t D, const nmod_mat_t C,
 
     nlimbs = _nmod_vec_dot_bound_limbs(k, mod);
 
-    if (nlimbs == 1 && m > 10 && k > 10 && n > 10)
+    if (m >= NMOD_MAT_MUL_BLOCKED_CUTOFF && k >= NMOD_MAT_MUL_BLOCKED_CUTOFF
+        && n >= NMOD_MAT_MUL_BLOCKED_CUTOFF)
+    {
+        _nmod_mat_mul_blocked(D->rows, (op == 0) ? NULL : C->rows,
+            A->rows, B->rows, m, k, n, op, D->mod, nlimbs);
+    }
+    else if (nlimbs == 1 && m > 10 && k > 10 && n > 10)
     {
         _nmod_mat_addmul_packed(D->rows, (op == 0) ? NULL : C->rows,
             A->rows, B->rows, m, k, n, op, D->mod, nlimbs);
@@ -39,9 +39,7 @@ nmod_mat_submul(nmod_mat_t D, const nmod_mat_t C,
     k = A->c;
     n = B->c;
 
-    if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        n < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        k < NMOD_MAT_MUL_STRASSEN_CUTOFF)
+    if (_nmod_mat_mul_use_classical(m, k, n, A->mod))
     {
         _nmod_mat_mul_classical(D, C, A, B, -1);
     }
@@ -49,7 +47,7 @@ nmod_mat_submul(nmod_mat_t D, const nmod_mat_t C,
     {
         nmod_mat_t tmp;
         nmod_mat_init(tmp, m, n, A->mod.n);
-        nmod_mat_mul_strassen(tmp, A, B);
+        nmod_mat_mul(tmp, A, B);
         nmod_mat_sub(D, C, tmp);
         nmod_mat_clear(tmp);
     }
@@ -0,0 +1,121 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    long i;
+    flint_rand_t state;
+    flint_randinit(state);
+
+    printf("mul_blas....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B, C, D;
+        mp_limb_t mod;
+        long m, k, n;
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+
+        /* long inner dimensions need several blocks for large moduli */
+        if (n_randint(state, 4) == 0)
+            k = n_randint(state, 2000);
+        else
+            k = n_randint(state, 50);
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                mod = n_randtest_not_zero(state);
+                break;
+            case 1:
+                mod = (1UL << NMOD_MAT_MUL_BLAS_MAX_BITS) 
+                    - n_randint(state, 16) - 1;
+                break;
+            case 2:
+                mod = n_randbits(state, NMOD_MAT_MUL_BLAS_MAX_BITS) + 1;
+                break;
+            default:
+                mod = n_randint(state, 16) + 1;
+        }
+
+        nmod_mat_init(A, m, k, mod);
+        nmod_mat_init(B, k, n, mod);
+        nmod_mat_init(C, m, n, mod);
+        nmod_mat_init(D, m, n, mod);
+
+        if (n_randint(state, 2))
+            nmod_mat_randtest(A, state);
+        else
+            nmod_mat_randfull(A, state);
+
+        if (n_randint(state, 2))
+            nmod_mat_randtest(B, state);
+        else
+            nmod_mat_randfull(B, state);
+
+        nmod_mat_randtest(C, state);
+
+        if (nmod_mat_mul_blas(C, A, B))
+        {
+            nmod_mat_mul_classical(D, A, B);
+
+            if (!nmod_mat_equal(C, D))
+            {
+                printf("FAIL: results not equal\n");
+                printf("m = %ld, k = %ld, n = %ld, mod = %lu\n", 
+                       m, k, n, mod);
+                abort();
+            }
+        }
+        else if (HAVE_BLAS && FLINT_BIT_COUNT(mod) 
+                                <= NMOD_MAT_MUL_BLAS_MAX_BITS)
+        {
+            printf("FAIL: nmod_mat_mul_blas failed for a small modulus\n");
+            printf("mod = %lu\n", mod);
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(D);
+    }
+
+    flint_randclear(state);
+
+    printf("PASS\n");
+    return 0;
+}
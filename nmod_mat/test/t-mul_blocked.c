@@ -0,0 +1,167 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+
+void
+nmod_mat_mul_check(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
+{
+    long i, j, k;
+
+    mp_limb_t s0, s1, s2;
+    mp_limb_t t0, t1;
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (j = 0; j < B->c; j++)
+        {
+            s0 = s1 = s2 = 0UL;
+
+            for (k = 0; k < A->c; k++)
+            {
+                umul_ppmm(t1, t0, A->rows[i][k], B->rows[k][j]);
+                add_sssaaaaaa(s2, s1, s0, s2, s1, s0, 0, t1, t0);
+            }
+
+            NMOD_RED(s2, s2, C->mod);
+            NMOD_RED3(s0, s2, s1, s0, C->mod);
+            C->rows[i][j] = s0;
+        }
+    }
+}
+
+int
+main(void)
+{
+    long i;
+    int level, max_level;
+    flint_rand_t state;
+    flint_randinit(state);
+
+    printf("mul_blocked....");
+    fflush(stdout);
+
+    max_level = _nmod_vec_simd_level();
+
+    /* Check each micro-kernel, with op = 0, 1, -1 */
+    for (level = NMOD_VEC_SIMD_NONE; level <= max_level; level++)
+    {
+        _nmod_vec_simd_set_level(level);
+
+        for (i = 0; i < 100 * flint_test_multiplier(); i++)
+        {
+            nmod_mat_t A, B, C, D, T;
+            mp_limb_t mod;
+            long m, k, n;
+            int op, nlimbs;
+
+            m = n_randint(state, 80) + 1;
+            n = n_randint(state, 80) + 1;
+
+            /* cross the packing depth sometimes */
+            if (n_randint(state, 8) == 0)
+                k = n_randint(state, 600) + 1;
+            else
+                k = n_randint(state, 80) + 1;
+
+            switch (n_randint(state, 5))
+            {
+                case 0:
+                    mod = n_randtest_not_zero(state);
+                    break;
+                case 1:
+                    mod = ULONG_MAX/2 + 1 - n_randbits(state, 4);
+                    break;
+                case 2:
+                    mod = ULONG_MAX - n_randbits(state, 4);
+                    break;
+                case 3:
+                    mod = (1UL << (FLINT_BITS / 2)) - n_randbits(state, 4);
+                    break;
+                default:
+                    mod = n_randbits(state, 4) + 2;
+            }
+
+            op = (int) n_randint(state, 3) - 1;
+
+            nmod_mat_init(A, m, k, mod);
+            nmod_mat_init(B, k, n, mod);
+            nmod_mat_init(C, m, n, mod);
+            nmod_mat_init(D, m, n, mod);
+            nmod_mat_init(T, m, n, mod);
+
+            if (n_randint(state, 2))
+                nmod_mat_randtest(A, state);
+            else
+                nmod_mat_randfull(A, state);
+
+            if (n_randint(state, 2))
+                nmod_mat_randtest(B, state);
+            else
+                nmod_mat_randfull(B, state);
+
+            nmod_mat_randtest(C, state);
+            nmod_mat_randtest(D, state);
+
+            nlimbs = _nmod_vec_dot_bound_limbs(k, A->mod);
+            _nmod_mat_mul_blocked(D->rows, C->rows, A->rows, B->rows, 
+                                  m, k, n, op, A->mod, nlimbs);
+
+            nmod_mat_mul_check(T, A, B);
+            if (op == 1)
+                nmod_mat_add(T, C, T);
+            else if (op == -1)
+                nmod_mat_sub(T, C, T);
+
+            if (!nmod_mat_equal(D, T))
+            {
+                printf("FAIL: results not equal\n");
+                printf("level = %d, op = %d, m = %ld, k = %ld, n = %ld, "
+                       "mod = %lu\n", level, op, m, k, n, mod);
+                abort();
+            }
+
+            nmod_mat_clear(A);
+            nmod_mat_clear(B);
+            nmod_mat_clear(C);
+            nmod_mat_clear(D);
+            nmod_mat_clear(T);
+        }
+    }
+
+    _nmod_vec_simd_set_level(max_level);
+
+    flint_randclear(state);
+
+    printf("PASS\n");
+    return 0;
+}
@@ -49,6 +49,21 @@
 #define NMOD_POLY_GCD_CUTOFF  340       /* GCD:  Euclidean -> HGCD          */
 #define NMOD_POLY_SMALL_GCD_CUTOFF 200  /* GCD (small n): Euclidean -> HGCD */
 
+#define NMOD_POLY_NTT_CUTOFF 1500       /* Multiplication: KS -> NTT        */
+#define NMOD_POLY_NTT_MIN_BITS 40       /* NTT: min. product bits per prime */
+
+/* 
+   Each NTT prime exceeds 2^NMOD_POLY_NTT_PRIME_BITS, and products of 
+   length at most NMOD_POLY_NTT_MAX_LEN can be done with them
+*/
+#if FLINT64
+#define NMOD_POLY_NTT_PRIME_BITS 61
+#define NMOD_POLY_NTT_MAX_LEN (1L << 50)
+#else
+#define NMOD_POLY_NTT_PRIME_BITS 29
+#define NMOD_POLY_NTT_MAX_LEN (1L << 20)
+#endif
+
 static __inline__
 long NMOD_DIVREM_BC_ITCH(long lenA, long lenB, nmod_t mod)
 {
@@ -394,6 +409,24 @@ void _nmod_poly_mullow_KS(mp_ptr out, mp_srcptr in1, long len1,
 void nmod_poly_mullow_KS(nmod_poly_t res, const nmod_poly_t poly1, 
                             const nmod_poly_t poly2, mp_bitcnt_t bits, long n);
 
+void _nmod_poly_mul_NTT(mp_ptr res, mp_srcptr poly1, long len1, 
+                                       mp_srcptr poly2, long len2, nmod_t mod);
+
+void nmod_poly_mul_NTT(nmod_poly_t res, 
+                             const nmod_poly_t poly1, const nmod_poly_t poly2);
+
+void _nmod_poly_mullow_NTT(mp_ptr res, mp_srcptr poly1, long len1, 
+                               mp_srcptr poly2, long len2, long n, nmod_t mod);
+
+long _nmod_poly_NTT_num_primes(long len1, long len2, nmod_t mod);
+
+int _nmod_poly_NTT_profitable(long len1, long len2, nmod_t mod);
+
+void _nmod_poly_NTT_cleanup(void);
+
+void nmod_poly_mullow_NTT(nmod_poly_t res, const nmod_poly_t poly1, 
+                                         const nmod_poly_t poly2, long trunc);
+
 void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, long len1, 
                                        mp_srcptr poly2, long len2, nmod_t mod);
 
@@ -45,6 +45,8 @@ void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, long len1,
 
     if (2 * bits + bits2 <= FLINT_BITS && len1 + len2 < 16)
         _nmod_poly_mul_classical(res, poly1, len1, poly2, len2, mod);
+    else if (_nmod_poly_NTT_profitable(len1, len2, mod))
+        _nmod_poly_mul_NTT(res, poly1, len1, poly2, len2, mod);
     else
         _nmod_poly_mul_KS(res, poly1, len1, poly2, len2, 0, mod);
 }
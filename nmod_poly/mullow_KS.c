@@ -29,6 +29,7 @@
 #include "flint.h"
 #include "nmod_vec.h"
 #include "nmod_poly.h"
+#include "mpn_extras.h"
 
 void
 _nmod_poly_mullow_KS(mp_ptr out, mp_srcptr in1, long len1,
@@ -60,9 +61,9 @@ _nmod_poly_mullow_KS(mp_ptr out, mp_srcptr in1, long len1,
     res = (mp_ptr) flint_malloc(sizeof(mp_limb_t) * (limbs1 + limbs2));
 
     if (in1 != in2)
-        mpn_mul(res, mpn1, limbs1, mpn2, limbs2);
+        flint_mpn_mul(res, mpn1, limbs1, mpn2, limbs2);
     else
-        mpn_mul_n(res, mpn1, mpn1, limbs1);
+        flint_mpn_sqr(res, mpn1, limbs1);
 
     _nmod_poly_bit_unpack(out, n, res, bits, mod);
     
@@ -0,0 +1,706 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdlib.h>
+#undef ulong /* prevent clash with standard library */
+#include <pthread.h>
+#define ulong unsigned long
+#include <gmp.h>
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+   Primes p = c*2^k + 1 with 4p < 2^FLINT_BITS, so that values may be kept 
+   in [0, 2p) between butterflies and in [0, 4p) inside them. Each prime 
+   exceeds 2^NMOD_POLY_NTT_PRIME_BITS and supports transforms of length up 
+   to NMOD_POLY_NTT_MAX_LEN.
+*/
+#if FLINT64
+static const mp_limb_t _ntt_primes[3] = 
+    { 4601552919265804289UL, 4546383823830515713UL, 4522739925786820609UL };
+#else
+static const mp_limb_t _ntt_primes[3] = 
+    { 1053818881UL, 1051721729UL, 1045430273UL };
+#endif
+
+/* transforms of at most this length are done layer by layer */
+#define NTT_ITER_LEN 1024
+
+/* tables for transforms of length above 2^NTT_CACHE_DEPTH are not kept */
+#define NTT_CACHE_DEPTH 16
+
+#if HAVE_TLS
+#define TLS_PREFIX __thread
+#else
+#define TLS_PREFIX
+#endif
+
+typedef struct
+{
+    mp_limb_t p;
+    mp_limb_t p2;    /* 2p */
+    mp_ptr w;        /* w[h + i] = z^i where z is a primitive 2h-th root */
+    mp_ptr wp;       /* Shoup quotients floor(w[j]*2^FLINT_BITS/p) */
+    mp_ptr owned;    /* tables built for this call only, or NULL */
+} ntt_ctx_struct;
+
+/* 
+   Twiddle tables for each prime, kept between calls and only ever grown 
+   up to depth NTT_CACHE_DEPTH, as building them costs a noticeable 
+   fraction of a short transform. Longer transforms build their own 
+   tables, which are then a small part of the work, so that one large 
+   product does not leave its tables resident in the thread. The cached 
+   tables are freed by _nmod_poly_NTT_cleanup, or by a thread specific 
+   key destructor when the thread exits.
+*/
+typedef struct
+{
+    mp_ptr tables[3];
+    long depths[3];
+    int registered;
+} ntt_cache_struct;
+
+static pthread_key_t _ntt_key;
+
+static pthread_once_t _ntt_key_once = PTHREAD_ONCE_INIT;
+
+static void _ntt_cache_clear(ntt_cache_struct * cache)
+{
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        flint_free(cache->tables[i]);
+        cache->tables[i] = NULL;
+        cache->depths[i] = 0;
+    }
+}
+
+static void _ntt_destructor(void * cache)
+{
+    _ntt_cache_clear(cache);
+#if !HAVE_TLS
+    flint_free(cache);
+#endif
+}
+
+static void _ntt_key_create(void)
+{
+    pthread_key_create(&_ntt_key, _ntt_destructor);
+}
+
+#if HAVE_TLS
+
+static TLS_PREFIX ntt_cache_struct _ntt_cache;
+
+static __inline__ ntt_cache_struct * _ntt_get_cache(void)
+{
+    return &_ntt_cache;
+}
+
+#else
+
+static ntt_cache_struct * _ntt_get_cache(void)
+{
+    ntt_cache_struct * cache;
+
+    pthread_once(&_ntt_key_once, _ntt_key_create);
+
+    cache = pthread_getspecific(_ntt_key);
+
+    if (cache == NULL)
+    {
+        cache = flint_calloc(1, sizeof(ntt_cache_struct));
+        cache->registered = 1;
+        pthread_setspecific(_ntt_key, cache);
+    }
+
+    return cache;
+}
+
+#endif
+
+void _nmod_poly_NTT_cleanup(void)
+{
+    _ntt_cache_clear(_ntt_get_cache());
+}
+
+/* r = a*w mod p, in [0, 2p), for any limb a */
+#define NTT_MULMOD_SHOUP(r, a, w, wp, p)            \
+    do {                                            \
+        mp_limb_t __qh, __ql;                       \
+        umul_ppmm(__qh, __ql, (a), (wp));           \
+        (r) = (a)*(w) - __qh*(p);                   \
+    } while (0)
+
+/* subtracts m from a if a >= m, without branching */
+#define NTT_REDUCE(a, m)                            \
+    do {                                            \
+        (a) -= (m) & (-(mp_limb_t) ((a) >= (m)));   \
+    } while (0)
+
+static __inline__ mp_limb_t
+_ntt_shoup_quotient(mp_limb_t w, mp_limb_t p, mp_limb_t pinv)
+{
+    mp_limb_t q, r;
+    unsigned int norm;
+
+    count_leading_zeros(norm, p);
+    udiv_qrnnd_preinv(q, r, w << norm, 0, p << norm, pinv);
+    (void) r; /* only the quotient is needed */
+
+    return q;
+}
+
+/* 
+   Fills in the tables for transforms of length up to 2^depth, level by 
+   level: the even entries of a level are the entries of the level below 
+   and the odd ones are those times a primitive root of the right order.
+*/
+static void
+_ntt_tables_init(mp_ptr w, mp_ptr wp, mp_limb_t p, long depth)
+{
+    mp_limb_t pinv = n_preinvert_limb(p), g, z, zp, * roots;
+    long h, i, k;
+
+    if (depth == 0)
+        return;
+
+    for (g = 2; n_powmod2_preinv(g, (p - 1)/2, p, pinv) != p - 1; g++) ;
+
+    /* roots[k] is a primitive 2^k-th root of unity */
+    roots = flint_malloc((depth + 1)*sizeof(mp_limb_t));
+    roots[depth] = n_powmod2_preinv(g, (p - 1) >> depth, p, pinv);
+    for (k = depth; k > 0; k--)
+        roots[k - 1] = n_mulmod2_preinv(roots[k], roots[k], p, pinv);
+
+    w[1] = 1;
+    wp[1] = _ntt_shoup_quotient(1, p, pinv);
+
+    for (h = 2, k = 2; k <= depth; h *= 2, k++)
+    {
+        z = roots[k];
+        zp = _ntt_shoup_quotient(z, p, pinv);
+
+        for (i = 0; i < h/2; i++)
+        {
+            w[h + 2*i] = w[h/2 + i];
+            wp[h + 2*i] = wp[h/2 + i];
+
+            NTT_MULMOD_SHOUP(w[h + 2*i + 1], w[h/2 + i], z, zp, p);
+            NTT_REDUCE(w[h + 2*i + 1], p);
+            wp[h + 2*i + 1] = _ntt_shoup_quotient(w[h + 2*i + 1], p, pinv);
+        }
+    }
+
+    flint_free(roots);
+}
+
+static void
+_ntt_ctx_init(ntt_ctx_struct * ctx, int i, long depth)
+{
+    long N = (1L << depth);
+    ntt_cache_struct * cache;
+
+    ctx->p = _ntt_primes[i];
+    ctx->p2 = 2*ctx->p;
+
+    if (depth > NTT_CACHE_DEPTH)
+    {
+        ctx->owned = flint_malloc(2*N*sizeof(mp_limb_t));
+        _ntt_tables_init(ctx->owned, ctx->owned + N, ctx->p, depth);
+        ctx->w = ctx->owned;
+        ctx->wp = ctx->owned + N;
+        return;
+    }
+
+    ctx->owned = NULL;
+    cache = _ntt_get_cache();
+
+    if (!cache->registered)
+    {
+        pthread_once(&_ntt_key_once, _ntt_key_create);
+        pthread_setspecific(_ntt_key, cache);
+        cache->registered = 1;
+    }
+
+    if (cache->tables[i] == NULL || cache->depths[i] < depth)
+    {
+        flint_free(cache->tables[i]);
+        cache->tables[i] = flint_malloc(2*N*sizeof(mp_limb_t));
+        _ntt_tables_init(cache->tables[i], cache->tables[i] + N, ctx->p, depth);
+        cache->depths[i] = depth;
+    }
+
+    ctx->w = cache->tables[i];
+    ctx->wp = cache->tables[i] + (1L << cache->depths[i]);
+}
+
+static __inline__ void
+_ntt_ctx_clear(ntt_ctx_struct * ctx)
+{
+    flint_free(ctx->owned);
+}
+
+/* 
+   Decimation in frequency butterfly on entries in [0, 2p):
+   (a, b) -> (a + b, (a - b)*w)
+*/
+#define NTT_BUTTERFLY(x, y, w, wp, ctx)             \
+    do {                                            \
+        mp_limb_t __a = (x), __b = (y), __s;        \
+        __s = __a + __b;                            \
+        NTT_REDUCE(__s, (ctx)->p2);                 \
+        (x) = __s;                                  \
+        __s = __a - __b + (ctx)->p2;                \
+        NTT_MULMOD_SHOUP((y), __s, w, wp, (ctx)->p);\
+    } while (0)
+
+/* 
+   Decimation in time butterfly on entries in [0, 2p), inverting the one
+   above up to a factor of 2: (u, v) -> (u + v/w, u - v/w). With w the 
+   i-th power of a primitive 2h-th root z, we have 1/w = -z^(h - i), 
+   so it is called with that twiddle and the outputs are swapped.
+*/
+#define NTT_IBUTTERFLY(x, y, w, wp, ctx)            \
+    do {                                            \
+        mp_limb_t __u = (x), __v, __s;              \
+        NTT_MULMOD_SHOUP(__v, (y), w, wp, (ctx)->p);\
+        __s = __u + __v;                            \
+        NTT_REDUCE(__s, (ctx)->p2);                 \
+        (y) = __s;                                  \
+        __s = __u - __v + (ctx)->p2;                \
+        NTT_REDUCE(__s, (ctx)->p2);                 \
+        (x) = __s;                                  \
+    } while (0)
+
+/* as above for i = 0 */
+#define NTT_IBUTTERFLY0(x, y, ctx)                  \
+    do {                                            \
+        mp_limb_t __u = (x), __v = (y), __s;        \
+        __s = __u + __v;                            \
+        NTT_REDUCE(__s, (ctx)->p2);                 \
+        (x) = __s;                                  \
+        __s = __u - __v + (ctx)->p2;                \
+        NTT_REDUCE(__s, (ctx)->p2);                 \
+        (y) = __s;                                  \
+    } while (0)
+
+/* halves a value in [0, 2p), giving a value in [0, p) */
+#define NTT_HALVE(a, ctx)                           \
+    do {                                            \
+        NTT_REDUCE((a), (ctx)->p);                  \
+        (a) = ((a) >> 1) + (((ctx)->p >> 1) + 1)*((a) & 1); \
+    } while (0)
+
+/* 
+   Length N transform, output in bit reversed order. The two halves of 
+   the output are the transforms of (x_i + x_{i+N/2}) and of 
+   (x_i - x_{i+N/2})*z^i where z is a primitive N-th root of unity.
+*/
+static void
+_ntt_fft(mp_ptr x, long N, const ntt_ctx_struct * ctx)
+{
+    long h, i, s;
+
+    if (N <= NTT_ITER_LEN)
+    {
+        for (h = N/2; h >= 1; h /= 2)
+            for (s = 0; s < N; s += 2*h)
+                for (i = 0; i < h; i++)
+                    NTT_BUTTERFLY(x[s + i], x[s + h + i], 
+                                  ctx->w[h + i], ctx->wp[h + i], ctx);
+        return;
+    }
+
+    h = N/2;
+    for (i = 0; i < h; i++)
+        NTT_BUTTERFLY(x[i], x[h + i], ctx->w[h + i], ctx->wp[h + i], ctx);
+
+    _ntt_fft(x, h, ctx);
+    _ntt_fft(x + h, h, ctx);
+}
+
+static __inline__ void
+_ntt_ifft_layer(mp_ptr x, long h, const ntt_ctx_struct * ctx)
+{
+    long i;
+
+    NTT_IBUTTERFLY0(x[0], x[h], ctx);
+    for (i = 1; i < h; i++)
+        NTT_IBUTTERFLY(x[i], x[h + i], 
+                       ctx->w[2*h - i], ctx->wp[2*h - i], ctx);
+}
+
+/* inverse of _ntt_fft, up to a factor of N */
+static void
+_ntt_ifft(mp_ptr x, long N, const ntt_ctx_struct * ctx)
+{
+    long h, s;
+
+    if (N <= NTT_ITER_LEN)
+    {
+        for (h = 1; h < N; h *= 2)
+            for (s = 0; s < N; s += 2*h)
+                _ntt_ifft_layer(x + s, h, ctx);
+        return;
+    }
+
+    h = N/2;
+    _ntt_ifft(x, h, ctx);
+    _ntt_ifft(x + h, h, ctx);
+    _ntt_ifft_layer(x, h, ctx);
+}
+
+/*
+   Truncated transform: sets x_0, ..., x_{n-1} to the first n entries of 
+   _ntt_fft(x, N), given that only x_0, ..., x_{len-1} may be nonzero. 
+   Requires 1 <= n <= N.
+*/
+static void
+_ntt_tft(mp_ptr x, long N, long n, long len, const ntt_ctx_struct * ctx)
+{
+    long h = N/2, i;
+
+    if (n == N)
+    {
+        _ntt_fft(x, N, ctx);
+        return;
+    }
+
+    if (n <= h)
+    {
+        for (i = 0; i < len - h; i++)
+        {
+            x[i] += x[h + i];
+            NTT_REDUCE(x[i], ctx->p2);
+        }
+
+        _ntt_tft(x, h, n, FLINT_MIN(len, h), ctx);
+    } else
+    {
+        for (i = 0; i < len - h; i++)
+            NTT_BUTTERFLY(x[i], x[h + i], ctx->w[h + i], ctx->wp[h + i], ctx);
+        for ( ; i < h; i++)
+            NTT_MULMOD_SHOUP(x[h + i], x[i], ctx->w[h + i], ctx->wp[h + i], ctx->p);
+
+        _ntt_fft(x, h, ctx);
+        _ntt_tft(x + h, h, n - h, FLINT_MIN(len, h), ctx);
+    }
+}
+
+/*
+   Inverse truncated transform. On entry x_0, ..., x_{n-1} are the first n
+   entries of the transform of some vector a and x_n, ..., x_{N-1} are the
+   corresponding entries of a itself. On exit x_0, ..., x_{n-1} are the 
+   first n entries of a. Requires 0 <= n <= N.
+*/
+static void
+_ntt_itft(mp_ptr x, long N, long n, const ntt_ctx_struct * ctx)
+{
+    long h = N/2, m, i;
+    mp_limb_t a, t, c, cp, pinv = n_preinvert_limb(ctx->p);
+
+    if (n == 0)
+        return;
+
+    if (n == N)
+    {
+        _ntt_ifft(x, N, ctx);
+
+        c = n_invmod(N % ctx->p, ctx->p);
+        cp = _ntt_shoup_quotient(c, ctx->p, pinv);
+        for (i = 0; i < N; i++)
+            NTT_MULMOD_SHOUP(x[i], x[i], c, cp, ctx->p);
+
+        return;
+    }
+
+    if (n >= h)
+    {
+        m = n - h;
+
+        /* first half: all of h*(x_i + x_{i+h}) */
+        _ntt_ifft(x, h, ctx);
+        c = n_invmod(h % ctx->p, ctx->p);
+        cp = _ntt_shoup_quotient(c, ctx->p, pinv);
+
+        /* where x_{i+h} is known, recover x_i and (x_i - x_{i+h})*z^i */
+        for (i = m; i < h; i++)
+        {
+            NTT_MULMOD_SHOUP(a, x[i], c, cp, ctx->p);
+            t = x[h + i];
+            a = a - t + ctx->p2;
+            NTT_REDUCE(a, ctx->p2);
+            x[i] = a;
+
+            if (m != 0)
+            {
+                a = a - t + ctx->p2;
+                NTT_MULMOD_SHOUP(x[h + i], a, 
+                                 ctx->w[h + i], ctx->wp[h + i], ctx->p);
+            }
+        }
+
+        if (m != 0)
+        {
+            _ntt_itft(x + h, h, m, ctx);
+
+            /* x_i, x_{i+h} = (u +- v/z^i)/2 with u, v the half transforms */
+            for (i = 0; i < m; i++)
+            {
+                NTT_MULMOD_SHOUP(x[i], x[i], c, cp, ctx->p);
+
+                if (i == 0)
+                    NTT_IBUTTERFLY0(x[i], x[h + i], ctx);
+                else
+                    NTT_IBUTTERFLY(x[i], x[h + i], 
+                                   ctx->w[2*h - i], ctx->wp[2*h - i], ctx);
+
+                NTT_HALVE(x[i], ctx);
+                NTT_HALVE(x[h + i], ctx);
+            }
+        }
+    } else
+    {
+        /* x_i + x_{i+h} is known for i >= n */
+        for (i = n; i < h; i++)
+        {
+            x[i] += x[h + i];
+            NTT_REDUCE(x[i], ctx->p2);
+        }
+
+        _ntt_itft(x, h, n, ctx);
+
+        for (i = 0; i < n; i++)
+        {
+            x[i] = x[i] - x[h + i] + ctx->p2;
+            NTT_REDUCE(x[i], ctx->p2);
+        }
+    }
+}
+
+static void
+_ntt_load(mp_ptr x, mp_srcptr poly, long len, long N, 
+          nmod_t pmod, nmod_t mod)
+{
+    long i;
+
+    if (mod.n <= pmod.n)
+        flint_mpn_copyi(x, poly, len);
+    else
+        for (i = 0; i < len; i++)
+            NMOD_RED(x[i], poly[i], pmod);
+
+    flint_mpn_zero(x + len, N - len);
+}
+
+/*
+   Sets r to the first n coefficients of the product modulo the prime of
+   ctx, using truncated transforms of length L = len1 + len2 - 1.
+*/
+static void
+_ntt_mullow_prime(mp_ptr r, mp_srcptr poly1, long len1, mp_srcptr poly2, 
+                  long len2, long n, long N, ntt_ctx_struct * ctx, 
+                  mp_ptr A, mp_ptr B, nmod_t mod)
+{
+    long L = len1 + len2 - 1, i;
+    mp_limb_t p = ctx->p, a, b;
+    nmod_t pmod;
+
+    nmod_init(&pmod, p);
+
+    _ntt_load(A, poly1, len1, N, pmod, mod);
+    _ntt_tft(A, N, L, len1, ctx);
+
+    if (poly1 == poly2 && len1 == len2)
+        B = A;
+    else
+    {
+        _ntt_load(B, poly2, len2, N, pmod, mod);
+        _ntt_tft(B, N, L, len2, ctx);
+    }
+
+    for (i = 0; i < L; i++)
+    {
+        a = A[i];
+        b = B[i];
+        NTT_REDUCE(a, p);
+        NTT_REDUCE(b, p);
+        A[i] = n_mulmod2_preinv(a, b, p, pmod.ninv);
+    }
+
+    flint_mpn_zero(A + L, N - L);
+    _ntt_itft(A, N, L, ctx);
+
+    for (i = 0; i < n; i++)
+    {
+        a = A[i];
+        NTT_REDUCE(a, p);
+        r[i] = a;
+    }
+}
+
+long
+_nmod_poly_NTT_num_primes(long len1, long len2, nmod_t mod)
+{
+    /* each coefficient of the product over Z is below len*(mod.n - 1)^2 */
+    long bits = 2*FLINT_BIT_COUNT(mod.n - 1) 
+              + FLINT_BIT_COUNT(FLINT_MIN(len1, len2));
+    
+    return FLINT_MAX((bits + NMOD_POLY_NTT_PRIME_BITS - 1)
+                                         / NMOD_POLY_NTT_PRIME_BITS, 1);
+}
+
+void
+_nmod_poly_mullow_NTT(mp_ptr res, mp_srcptr poly1, long len1, 
+                      mp_srcptr poly2, long len2, long n, nmod_t mod)
+{
+    long L, N, depth, i, k;
+    mp_ptr A, B, R;
+    ntt_ctx_struct ctx;
+    nmod_t p1, p2, p3;
+    mp_limb_t c1, c12, inv12, inv13, inv23, y1, y2, y3, r;
+
+    len1 = FLINT_MIN(len1, n);
+    len2 = FLINT_MIN(len2, n);
+    L = len1 + len2 - 1;
+
+    k = _nmod_poly_NTT_num_primes(len1, len2, mod);
+
+    FLINT_ASSERT(k <= 3);
+    FLINT_ASSERT(L <= NMOD_POLY_NTT_MAX_LEN);
+
+    for (depth = 0, N = 1; N < L; depth++, N *= 2) ;
+
+    A = flint_malloc((2*N + k*n)*sizeof(mp_limb_t));
+    B = A + N;
+    R = B + N;
+
+    for (i = 0; i < k; i++)
+    {
+        _ntt_ctx_init(&ctx, i, depth);
+        _ntt_mullow_prime(R + i*n, poly1, len1, poly2, len2, 
+                          n, N, &ctx, A, B, mod);
+        _ntt_ctx_clear(&ctx);
+    }
+
+    /* Garner's algorithm, then reduction mod n of the mixed radix form */
+    if (k == 1)
+    {
+        for (i = 0; i < n; i++)
+            NMOD_RED(res[i], R[i], mod);
+    } else
+    {
+        nmod_init(&p1, _ntt_primes[0]);
+        nmod_init(&p2, _ntt_primes[1]);
+        nmod_init(&p3, _ntt_primes[2]);
+
+        inv12 = n_invmod(p1.n % p2.n, p2.n);
+        inv13 = n_invmod(p1.n % p3.n, p3.n);
+        inv23 = n_invmod(p2.n % p3.n, p3.n);
+
+        NMOD_RED(c1, p1.n, mod);
+        NMOD_RED(c12, p2.n, mod);
+        c12 = nmod_mul(c1, c12, mod);
+
+        for (i = 0; i < n; i++)
+        {
+            y1 = R[i];
+            NMOD_RED(r, y1, p2);
+            y2 = nmod_mul(nmod_sub(R[n + i], r, p2), inv12, p2);
+            
+            NMOD_RED(r, y1, mod);
+            NMOD_ADDMUL(r, y2, c1, mod);
+
+            if (k == 3)
+            {
+                NMOD_RED(y3, y1, p3);
+                y3 = nmod_mul(nmod_sub(R[2*n + i], y3, p3), inv13, p3);
+                NMOD_RED(y1, y2, p3);
+                y3 = nmod_mul(nmod_sub(y3, y1, p3), inv23, p3);
+
+                NMOD_ADDMUL(r, y3, c12, mod);
+            }
+
+            res[i] = r;
+        }
+    }
+
+    flint_free(A);
+}
+
+void
+nmod_poly_mullow_NTT(nmod_poly_t res, const nmod_poly_t poly1, 
+                     const nmod_poly_t poly2, long trunc)
+{
+    long len1, len2, len_out;
+    
+    len1 = poly1->length;
+    len2 = poly2->length;
+
+    len_out = len1 + len2 - 1;
+    if (trunc > len_out)
+        trunc = len_out;
+    
+    if (len1 <= 0 || len2 <= 0 || trunc <= 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    if (res == poly1 || res == poly2)
+    {
+        nmod_poly_t temp;
+
+        nmod_poly_init2(temp, poly1->mod.n, trunc);
+
+        if (len1 >= len2)
+            _nmod_poly_mullow_NTT(temp->coeffs, poly1->coeffs, len1,
+                           poly2->coeffs, len2, trunc, poly1->mod);
+        else
+            _nmod_poly_mullow_NTT(temp->coeffs, poly2->coeffs, len2,
+                           poly1->coeffs, len1, trunc, poly1->mod);
+        
+        nmod_poly_swap(temp, res);
+        nmod_poly_clear(temp);
+    } else
+    {
+        nmod_poly_fit_length(res, trunc);
+        
+        if (len1 >= len2)
+            _nmod_poly_mullow_NTT(res->coeffs, poly1->coeffs, len1,
+                           poly2->coeffs, len2, trunc, poly1->mod);
+        else
+            _nmod_poly_mullow_NTT(res->coeffs, poly2->coeffs, len2,
+                           poly1->coeffs, len1, trunc, poly1->mod);
+    }
+
+    res->length = trunc;
+    _nmod_poly_normalise(res);
+}
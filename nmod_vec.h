@@ -300,6 +300,69 @@ mp_limb_t _nmod_vec_dot(mp_srcptr vec1, mp_srcptr vec2,
 mp_limb_t _nmod_vec_dot_ptr(mp_srcptr vec1, mp_ptr * const vec2, long offset,
     long len, nmod_t mod, int nlimbs);
 
+/*  SIMD kernels  ************************************************************/
+
+/*
+   Vectorised versions of the basic kernels are compiled on x86-64 with 
+   compilers supporting per function target attributes and are selected 
+   at runtime according to the instruction sets the processor supports.
+*/
+
+#if defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__)) \
+    && defined(__x86_64__) && FLINT64
+#define NMOD_VEC_SIMD 1
+#else
+#define NMOD_VEC_SIMD 0
+#endif
+
+#define NMOD_VEC_SIMD_NONE 0
+#define NMOD_VEC_SIMD_AVX2 1
+#define NMOD_VEC_SIMD_AVX512 2
+
+#define NMOD_VEC_SIMD_CUTOFF 8  /* minimum length for the SIMD kernels */
+
+int _nmod_vec_simd_level(void);
+
+int _nmod_vec_simd_set_level(int level);
+
+#if NMOD_VEC_SIMD
+
+void _nmod_vec_add_avx2(mp_ptr res, mp_srcptr vec1, 
+                        mp_srcptr vec2, long len, nmod_t mod);
+
+void _nmod_vec_sub_avx2(mp_ptr res, mp_srcptr vec1, 
+                        mp_srcptr vec2, long len, nmod_t mod);
+
+void _nmod_vec_neg_avx2(mp_ptr res, mp_srcptr vec, long len, nmod_t mod);
+
+void _nmod_vec_scalar_mul_nmod_avx2(mp_ptr res, mp_srcptr vec, 
+                            long len, mp_limb_t c, nmod_t mod);
+
+void _nmod_vec_scalar_addmul_nmod_avx2(mp_ptr res, mp_srcptr vec, 
+                            long len, mp_limb_t c, nmod_t mod);
+
+mp_limb_t _nmod_vec_dot_avx2(mp_srcptr vec1, mp_srcptr vec2,
+    long len, nmod_t mod, int nlimbs);
+
+void _nmod_vec_add_avx512(mp_ptr res, mp_srcptr vec1, 
+                        mp_srcptr vec2, long len, nmod_t mod);
+
+void _nmod_vec_sub_avx512(mp_ptr res, mp_srcptr vec1, 
+                        mp_srcptr vec2, long len, nmod_t mod);
+
+void _nmod_vec_neg_avx512(mp_ptr res, mp_srcptr vec, long len, nmod_t mod);
+
+void _nmod_vec_scalar_mul_nmod_avx512(mp_ptr res, mp_srcptr vec, 
+                            long len, mp_limb_t c, nmod_t mod);
+
+void _nmod_vec_scalar_addmul_nmod_avx512(mp_ptr res, mp_srcptr vec, 
+                            long len, mp_limb_t c, nmod_t mod);
+
+mp_limb_t _nmod_vec_dot_avx512(mp_srcptr vec1, mp_srcptr vec2,
+    long len, nmod_t mod, int nlimbs);
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
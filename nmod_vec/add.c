@@ -36,6 +36,23 @@ void _nmod_vec_add(mp_ptr res, mp_srcptr vec1,
 
    if (mod.norm)
    {
+#if NMOD_VEC_SIMD
+      if (len >= NMOD_VEC_SIMD_CUTOFF)
+      {
+         int level = _nmod_vec_simd_level();
+
+         if (level == NMOD_VEC_SIMD_AVX512)
+         {
+            _nmod_vec_add_avx512(res, vec1, vec2, len, mod);
+            return;
+         } else if (level == NMOD_VEC_SIMD_AVX2)
+         {
+            _nmod_vec_add_avx2(res, vec1, vec2, len, mod);
+            return;
+         }
+      }
+#endif
+
 	  for (i = 0 ; i < len; i++)
          res[i] = _nmod_add(vec1[i], vec2[i], mod);
    } else
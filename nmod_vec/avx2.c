@@ -0,0 +1,311 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_SIMD
+
+#include <immintrin.h>
+
+#define AVX2 __attribute__((target("avx2,fma")))
+
+/*
+   Integers 0 <= x < 2^52 are converted to and from doubles by adding 
+   2^52, which places x in the mantissa.
+*/
+#define MAGIC 4503599627370496.0
+
+#define TO_DOUBLE(x) \
+   _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256((x), \
+                 _mm256_castpd_si256(_mm256_set1_pd(MAGIC)))), \
+                 _mm256_set1_pd(MAGIC))
+
+#define FROM_DOUBLE(d) \
+   _mm256_xor_si256(_mm256_castpd_si256(_mm256_add_pd((d), \
+                    _mm256_set1_pd(MAGIC))), \
+                    _mm256_castpd_si256(_mm256_set1_pd(MAGIC)))
+
+/* returns r - n if r >= n, otherwise r, comparing as unsigned */
+static __inline__ AVX2 __m256i
+_avx2_red(__m256i r, __m256i n)
+{
+   const __m256i s = _mm256_set1_epi64x((long) (1UL << (FLINT_BITS - 1)));
+   __m256i m = _mm256_cmpgt_epi64(_mm256_xor_si256(n, s), _mm256_xor_si256(r, s));
+
+   return _mm256_sub_epi64(r, _mm256_andnot_si256(m, n));
+}
+
+/*
+   Shoup multiplication for n < 2^32: returns a*c mod n in [0, n) given 
+   a, c < n and cp = floor(c*2^32/n).
+*/
+static __inline__ AVX2 __m256i
+_avx2_mulmod_shoup(__m256i a, __m256i c, __m256i cp, __m256i n)
+{
+   __m256i q = _mm256_srli_epi64(_mm256_mul_epu32(a, cp), 32);
+   __m256i r = _mm256_sub_epi64(_mm256_mul_epu32(a, c), _mm256_mul_epu32(q, n));
+
+   return _avx2_red(r, n);
+}
+
+/*
+   Floating point multiplication for n < 2^50: returns a*c mod n in 
+   (-n, n) given a, c < n and ninv = 1/n. The product is split exactly 
+   as h + l with an FMA and the quotient is rounded to nearest, so that 
+   |h - q*n| <= 3n/4 and |l| <= n/8.
+*/
+static __inline__ AVX2 __m256d
+_avx2_mulmod_d(__m256d a, __m256d c, __m256d n, __m256d ninv)
+{
+   __m256d h = _mm256_mul_pd(a, c);
+   __m256d l = _mm256_fmsub_pd(a, c, h);
+   __m256d q = _mm256_round_pd(_mm256_mul_pd(h, ninv), 
+                               _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+   return _mm256_add_pd(_mm256_fnmadd_pd(q, n, h), l);
+}
+
+/* returns r + n if r < 0, otherwise r */
+static __inline__ AVX2 __m256d
+_avx2_red_d(__m256d r, __m256d n)
+{
+   __m256d m = _mm256_cmp_pd(r, _mm256_setzero_pd(), _CMP_LT_OQ);
+
+   return _mm256_add_pd(r, _mm256_and_pd(m, n));
+}
+
+AVX2 void _nmod_vec_add_avx2(mp_ptr res, mp_srcptr vec1, 
+                        mp_srcptr vec2, long len, nmod_t mod)
+{
+   const __m256i n = _mm256_set1_epi64x(mod.n);
+   long i;
+
+   for (i = 0; i + 4 <= len; i += 4)
+   {
+      __m256i a = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+      __m256i b = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+      
+      _mm256_storeu_si256((__m256i *) (res + i), 
+                          _avx2_red(_mm256_add_epi64(a, b), n));
+   }
+
+   for ( ; i < len; i++)
+      res[i] = _nmod_add(vec1[i], vec2[i], mod);
+}
+
+AVX2 void _nmod_vec_sub_avx2(mp_ptr res, mp_srcptr vec1, 
+                        mp_srcptr vec2, long len, nmod_t mod)
+{
+   const __m256i n = _mm256_set1_epi64x(mod.n);
+   long i;
+
+   for (i = 0; i + 4 <= len; i += 4)
+   {
+      __m256i a = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+      __m256i b = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+      __m256i m = _mm256_cmpgt_epi64(b, a);
+      
+      _mm256_storeu_si256((__m256i *) (res + i), 
+         _mm256_add_epi64(_mm256_sub_epi64(a, b), _mm256_and_si256(m, n)));
+   }
+
+   for ( ; i < len; i++)
+      res[i] = _nmod_sub(vec1[i], vec2[i], mod);
+}
+
+AVX2 void _nmod_vec_neg_avx2(mp_ptr res, mp_srcptr vec, long len, nmod_t mod)
+{
+   const __m256i n = _mm256_set1_epi64x(mod.n);
+   const __m256i zero = _mm256_setzero_si256();
+   long i;
+
+   for (i = 0; i + 4 <= len; i += 4)
+   {
+      __m256i a = _mm256_loadu_si256((const __m256i *) (vec + i));
+      __m256i m = _mm256_cmpeq_epi64(a, zero);
+      
+      _mm256_storeu_si256((__m256i *) (res + i), 
+         _mm256_andnot_si256(m, _mm256_sub_epi64(n, a)));
+   }
+
+   for ( ; i < len; i++)
+      res[i] = nmod_neg(vec[i], mod);
+}
+
+AVX2 void _nmod_vec_scalar_mul_nmod_avx2(mp_ptr res, mp_srcptr vec, 
+                            long len, mp_limb_t c, nmod_t mod)
+{
+   long i;
+
+   if (mod.norm >= FLINT_BITS/2)
+   {
+      const __m256i n = _mm256_set1_epi64x(mod.n);
+      const __m256i cc = _mm256_set1_epi64x(c);
+      const __m256i cp = _mm256_set1_epi64x((c << (FLINT_BITS/2))/mod.n);
+
+      for (i = 0; i + 4 <= len; i += 4)
+      {
+         __m256i a = _mm256_loadu_si256((const __m256i *) (vec + i));
+      
+         _mm256_storeu_si256((__m256i *) (res + i), 
+                             _avx2_mulmod_shoup(a, cc, cp, n));
+      }
+   } else
+   {
+      const __m256d n = _mm256_set1_pd((double) mod.n);
+      const __m256d ninv = _mm256_set1_pd(1.0/((double) mod.n));
+      const __m256d cc = _mm256_set1_pd((double) c);
+
+      for (i = 0; i + 4 <= len; i += 4)
+      {
+         __m256d a = TO_DOUBLE(_mm256_loadu_si256((const __m256i *) (vec + i)));
+         __m256d r = _avx2_red_d(_avx2_mulmod_d(a, cc, n, ninv), n);
+      
+         _mm256_storeu_si256((__m256i *) (res + i), FROM_DOUBLE(r));
+      }
+   }
+
+   for ( ; i < len; i++)
+      res[i] = n_mulmod2_preinv(vec[i], c, mod.n, mod.ninv);
+}
+
+AVX2 void _nmod_vec_scalar_addmul_nmod_avx2(mp_ptr res, mp_srcptr vec, 
+                            long len, mp_limb_t c, nmod_t mod)
+{
+   long i;
+
+   if (mod.norm >= FLINT_BITS/2)
+   {
+      const __m256i n = _mm256_set1_epi64x(mod.n);
+      const __m256i cc = _mm256_set1_epi64x(c);
+      const __m256i cp = _mm256_set1_epi64x((c << (FLINT_BITS/2))/mod.n);
+
+      for (i = 0; i + 4 <= len; i += 4)
+      {
+         __m256i a = _mm256_loadu_si256((const __m256i *) (vec + i));
+         __m256i b = _mm256_loadu_si256((const __m256i *) (res + i));
+         __m256i r = _avx2_mulmod_shoup(a, cc, cp, n);
+      
+         _mm256_storeu_si256((__m256i *) (res + i), 
+                             _avx2_red(_mm256_add_epi64(r, b), n));
+      }
+   } else
+   {
+      const __m256d n = _mm256_set1_pd((double) mod.n);
+      const __m256d ninv = _mm256_set1_pd(1.0/((double) mod.n));
+      const __m256d cc = _mm256_set1_pd((double) c);
+
+      for (i = 0; i + 4 <= len; i += 4)
+      {
+         __m256d a = TO_DOUBLE(_mm256_loadu_si256((const __m256i *) (vec + i)));
+         __m256d b = TO_DOUBLE(_mm256_loadu_si256((const __m256i *) (res + i)));
+         __m256d r = _mm256_add_pd(_avx2_mulmod_d(a, cc, n, ninv), b);
+         __m256d m = _mm256_cmp_pd(r, n, _CMP_GE_OQ);
+      
+         /* r lies in (-n, 2n) */
+         r = _avx2_red_d(_mm256_sub_pd(r, _mm256_and_pd(m, n)), n);
+
+         _mm256_storeu_si256((__m256i *) (res + i), FROM_DOUBLE(r));
+      }
+   }
+
+   for ( ; i < len; i++)
+      NMOD_ADDMUL(res[i], vec[i], c, mod);
+}
+
+/*
+   Assumes mod.n <= 2^32, so that each product fits in a limb. When the 
+   sum may overflow a limb, the low and high halves of the products are 
+   accumulated separately.
+*/
+AVX2 mp_limb_t _nmod_vec_dot_avx2(mp_srcptr vec1, mp_srcptr vec2,
+    long len, nmod_t mod, int nlimbs)
+{
+   mp_limb_t s[4], s0, s1, t0, t1, hi, lo;
+   long i;
+
+   if (nlimbs == 1)
+   {
+      __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+
+      for (i = 0; i + 8 <= len; i += 8)
+      {
+         __m256i a0 = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+         __m256i b0 = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+         __m256i a1 = _mm256_loadu_si256((const __m256i *) (vec1 + i + 4));
+         __m256i b1 = _mm256_loadu_si256((const __m256i *) (vec2 + i + 4));
+
+         acc0 = _mm256_add_epi64(acc0, _mm256_mul_epu32(a0, b0));
+         acc1 = _mm256_add_epi64(acc1, _mm256_mul_epu32(a1, b1));
+      }
+
+      _mm256_storeu_si256((__m256i *) s, _mm256_add_epi64(acc0, acc1));
+      s0 = s[0] + s[1] + s[2] + s[3];
+
+      for ( ; i < len; i++)
+         s0 += vec1[i] * vec2[i];
+
+      NMOD_RED(s0, s0, mod);
+   } else
+   {
+      const __m256i mask = _mm256_set1_epi64x(0xffffffffUL);
+      __m256i acc_lo = _mm256_setzero_si256(), acc_hi = _mm256_setzero_si256();
+
+      for (i = 0; i + 4 <= len; i += 4)
+      {
+         __m256i a = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+         __m256i b = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+         __m256i p = _mm256_mul_epu32(a, b);
+
+         acc_lo = _mm256_add_epi64(acc_lo, _mm256_and_si256(p, mask));
+         acc_hi = _mm256_add_epi64(acc_hi, _mm256_srli_epi64(p, 32));
+      }
+
+      _mm256_storeu_si256((__m256i *) s, acc_hi);
+      hi = s[0] + s[1] + s[2] + s[3];
+      _mm256_storeu_si256((__m256i *) s, acc_lo);
+      lo = s[0] + s[1] + s[2] + s[3];
+
+      s1 = hi >> 32;
+      s0 = hi << 32;
+      add_ssaaaa(s1, s0, s1, s0, 0, lo);
+
+      for ( ; i < len; i++)
+      {
+         umul_ppmm(t1, t0, vec1[i], vec2[i]);
+         add_ssaaaa(s1, s0, s1, s0, t1, t0);
+      }
+
+      NMOD2_RED2(s0, s1, s0, mod);
+   }
+
+   return s0;
+}
+
+#endif
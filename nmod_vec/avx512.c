@@ -0,0 +1,271 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_SIMD
+
+#include <immintrin.h>
+
+#define AVX512 __attribute__((target("avx512f,avx512dq")))
+
+/*
+   See avx2.c for the reduction strategies, which are the same here. 
+   Unsigned minima take care of the conditional subtractions.
+*/
+
+static __inline__ AVX512 __m512i
+_avx512_red(__m512i r, __m512i n)
+{
+   return _mm512_min_epu64(r, _mm512_sub_epi64(r, n));
+}
+
+static __inline__ AVX512 __m512i
+_avx512_mulmod_shoup(__m512i a, __m512i c, __m512i cp, __m512i n)
+{
+   __m512i q = _mm512_srli_epi64(_mm512_mul_epu32(a, cp), 32);
+   __m512i r = _mm512_sub_epi64(_mm512_mul_epu32(a, c), _mm512_mul_epu32(q, n));
+
+   return _avx512_red(r, n);
+}
+
+static __inline__ AVX512 __m512d
+_avx512_mulmod_d(__m512d a, __m512d c, __m512d n, __m512d ninv)
+{
+   __m512d h = _mm512_mul_pd(a, c);
+   __m512d l = _mm512_fmsub_pd(a, c, h);
+   __m512d q = _mm512_roundscale_pd(_mm512_mul_pd(h, ninv), 
+                               _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+   return _mm512_add_pd(_mm512_fnmadd_pd(q, n, h), l);
+}
+
+static __inline__ AVX512 __m512d
+_avx512_red_d(__m512d r, __m512d n)
+{
+   __mmask8 m = _mm512_cmp_pd_mask(r, _mm512_setzero_pd(), _CMP_LT_OQ);
+
+   return _mm512_mask_add_pd(r, m, r, n);
+}
+
+AVX512 void _nmod_vec_add_avx512(mp_ptr res, mp_srcptr vec1, 
+                        mp_srcptr vec2, long len, nmod_t mod)
+{
+   const __m512i n = _mm512_set1_epi64(mod.n);
+   long i;
+
+   for (i = 0; i + 8 <= len; i += 8)
+   {
+      __m512i a = _mm512_loadu_si512(vec1 + i);
+      __m512i b = _mm512_loadu_si512(vec2 + i);
+      
+      _mm512_storeu_si512(res + i, _avx512_red(_mm512_add_epi64(a, b), n));
+   }
+
+   for ( ; i < len; i++)
+      res[i] = _nmod_add(vec1[i], vec2[i], mod);
+}
+
+AVX512 void _nmod_vec_sub_avx512(mp_ptr res, mp_srcptr vec1, 
+                        mp_srcptr vec2, long len, nmod_t mod)
+{
+   const __m512i n = _mm512_set1_epi64(mod.n);
+   long i;
+
+   for (i = 0; i + 8 <= len; i += 8)
+   {
+      __m512i a = _mm512_loadu_si512(vec1 + i);
+      __m512i b = _mm512_loadu_si512(vec2 + i);
+      __m512i d = _mm512_sub_epi64(a, b);
+      
+      _mm512_storeu_si512(res + i, _mm512_min_epu64(d, _mm512_add_epi64(d, n)));
+   }
+
+   for ( ; i < len; i++)
+      res[i] = _nmod_sub(vec1[i], vec2[i], mod);
+}
+
+AVX512 void _nmod_vec_neg_avx512(mp_ptr res, mp_srcptr vec, long len, nmod_t mod)
+{
+   const __m512i n = _mm512_set1_epi64(mod.n);
+   long i;
+
+   for (i = 0; i + 8 <= len; i += 8)
+   {
+      __m512i a = _mm512_loadu_si512(vec + i);
+      __mmask8 m = _mm512_test_epi64_mask(a, a);
+      
+      _mm512_storeu_si512(res + i, _mm512_maskz_sub_epi64(m, n, a));
+   }
+
+   for ( ; i < len; i++)
+      res[i] = nmod_neg(vec[i], mod);
+}
+
+AVX512 void _nmod_vec_scalar_mul_nmod_avx512(mp_ptr res, mp_srcptr vec, 
+                            long len, mp_limb_t c, nmod_t mod)
+{
+   long i;
+
+   if (mod.norm >= FLINT_BITS/2)
+   {
+      const __m512i n = _mm512_set1_epi64(mod.n);
+      const __m512i cc = _mm512_set1_epi64(c);
+      const __m512i cp = _mm512_set1_epi64((c << (FLINT_BITS/2))/mod.n);
+
+      for (i = 0; i + 8 <= len; i += 8)
+      {
+         __m512i a = _mm512_loadu_si512(vec + i);
+      
+         _mm512_storeu_si512(res + i, _avx512_mulmod_shoup(a, cc, cp, n));
+      }
+   } else
+   {
+      const __m512d n = _mm512_set1_pd((double) mod.n);
+      const __m512d ninv = _mm512_set1_pd(1.0/((double) mod.n));
+      const __m512d cc = _mm512_set1_pd((double) c);
+
+      for (i = 0; i + 8 <= len; i += 8)
+      {
+         __m512d a = _mm512_cvtepu64_pd(_mm512_loadu_si512(vec + i));
+         __m512d r = _avx512_red_d(_avx512_mulmod_d(a, cc, n, ninv), n);
+      
+         _mm512_storeu_si512(res + i, _mm512_cvtpd_epu64(r));
+      }
+   }
+
+   for ( ; i < len; i++)
+      res[i] = n_mulmod2_preinv(vec[i], c, mod.n, mod.ninv);
+}
+
+AVX512 void _nmod_vec_scalar_addmul_nmod_avx512(mp_ptr res, mp_srcptr vec, 
+                            long len, mp_limb_t c, nmod_t mod)
+{
+   long i;
+
+   if (mod.norm >= FLINT_BITS/2)
+   {
+      const __m512i n = _mm512_set1_epi64(mod.n);
+      const __m512i cc = _mm512_set1_epi64(c);
+      const __m512i cp = _mm512_set1_epi64((c << (FLINT_BITS/2))/mod.n);
+
+      for (i = 0; i + 8 <= len; i += 8)
+      {
+         __m512i a = _mm512_loadu_si512(vec + i);
+         __m512i b = _mm512_loadu_si512(res + i);
+         __m512i r = _avx512_mulmod_shoup(a, cc, cp, n);
+      
+         _mm512_storeu_si512(res + i, _avx512_red(_mm512_add_epi64(r, b), n));
+      }
+   } else
+   {
+      const __m512d n = _mm512_set1_pd((double) mod.n);
+      const __m512d ninv = _mm512_set1_pd(1.0/((double) mod.n));
+      const __m512d cc = _mm512_set1_pd((double) c);
+
+      for (i = 0; i + 8 <= len; i += 8)
+      {
+         __m512d a = _mm512_cvtepu64_pd(_mm512_loadu_si512(vec + i));
+         __m512d b = _mm512_cvtepu64_pd(_mm512_loadu_si512(res + i));
+         __m512d r = _mm512_add_pd(_avx512_mulmod_d(a, cc, n, ninv), b);
+         __mmask8 m = _mm512_cmp_pd_mask(r, n, _CMP_GE_OQ);
+      
+         /* r lies in (-n, 2n) */
+         r = _avx512_red_d(_mm512_mask_sub_pd(r, m, r, n), n);
+
+         _mm512_storeu_si512(res + i, _mm512_cvtpd_epu64(r));
+      }
+   }
+
+   for ( ; i < len; i++)
+      NMOD_ADDMUL(res[i], vec[i], c, mod);
+}
+
+AVX512 mp_limb_t _nmod_vec_dot_avx512(mp_srcptr vec1, mp_srcptr vec2,
+    long len, nmod_t mod, int nlimbs)
+{
+   mp_limb_t s0, s1, t0, t1, hi, lo;
+   long i;
+
+   if (nlimbs == 1)
+   {
+      __m512i acc0 = _mm512_setzero_si512(), acc1 = _mm512_setzero_si512();
+
+      for (i = 0; i + 16 <= len; i += 16)
+      {
+         __m512i a0 = _mm512_loadu_si512(vec1 + i);
+         __m512i b0 = _mm512_loadu_si512(vec2 + i);
+         __m512i a1 = _mm512_loadu_si512(vec1 + i + 8);
+         __m512i b1 = _mm512_loadu_si512(vec2 + i + 8);
+
+         acc0 = _mm512_add_epi64(acc0, _mm512_mul_epu32(a0, b0));
+         acc1 = _mm512_add_epi64(acc1, _mm512_mul_epu32(a1, b1));
+      }
+
+      s0 = _mm512_reduce_add_epi64(_mm512_add_epi64(acc0, acc1));
+
+      for ( ; i < len; i++)
+         s0 += vec1[i] * vec2[i];
+
+      NMOD_RED(s0, s0, mod);
+   } else
+   {
+      const __m512i mask = _mm512_set1_epi64(0xffffffffUL);
+      __m512i acc_lo = _mm512_setzero_si512(), acc_hi = _mm512_setzero_si512();
+
+      for (i = 0; i + 8 <= len; i += 8)
+      {
+         __m512i a = _mm512_loadu_si512(vec1 + i);
+         __m512i b = _mm512_loadu_si512(vec2 + i);
+         __m512i p = _mm512_mul_epu32(a, b);
+
+         acc_lo = _mm512_add_epi64(acc_lo, _mm512_and_si512(p, mask));
+         acc_hi = _mm512_add_epi64(acc_hi, _mm512_srli_epi64(p, 32));
+      }
+
+      hi = _mm512_reduce_add_epi64(acc_hi);
+      lo = _mm512_reduce_add_epi64(acc_lo);
+
+      s1 = hi >> 32;
+      s0 = hi << 32;
+      add_ssaaaa(s1, s0, s1, s0, 0, lo);
+
+      for ( ; i < len; i++)
+      {
+         umul_ppmm(t1, t0, vec1[i], vec2[i]);
+         add_ssaaaa(s1, s0, s1, s0, t1, t0);
+      }
+
+      NMOD2_RED2(s0, s1, s0, mod);
+   }
+
+   return s0;
+}
+
+#endif
@@ -0,0 +1,152 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+#define LEN 1000
+
+typedef struct
+{
+   mp_bitcnt_t bits;
+   int type;
+   int level;
+} info_t;
+
+static const char * names[] = { "add", "sub", "neg", "scalar_mul", 
+                                 "scalar_addmul", "dot" };
+
+static const char * levels[] = { "scalar", "avx2", "avx512" };
+
+void sample(void * arg, ulong count)
+{
+   mp_limb_t n, c, r = 0;
+   nmod_t mod;
+   info_t * info = (info_t *) arg;
+   mp_bitcnt_t bits = info->bits;
+   int type = info->type, nlimbs;
+   mp_size_t j;
+   long i;
+   mp_ptr vec1, vec2, res;
+   flint_rand_t state;
+   flint_randinit(state);
+   
+   n = n_randbits(state, bits);
+   if (n == 0UL) n++;
+   c = n_randint(state, n);
+      
+   nmod_init(&mod, n);
+   nlimbs = _nmod_vec_dot_bound_limbs(LEN, mod);
+
+   vec1 = _nmod_vec_init(LEN);
+   vec2 = _nmod_vec_init(LEN);
+   res = _nmod_vec_init(LEN);
+     
+   for (j = 0; j < LEN; j++)
+   {
+      vec1[j] = n_randint(state, n);
+      vec2[j] = n_randint(state, n);
+      res[j] = 0;
+   }
+
+   _nmod_vec_simd_set_level(info->level);
+
+   prof_start();
+   for (i = 0; i < count; i++)
+   {
+      switch (type)
+      {
+      case 0:
+         _nmod_vec_add(res, vec1, vec2, LEN, mod);
+         break;
+      case 1:
+         _nmod_vec_sub(res, vec1, vec2, LEN, mod);
+         break;
+      case 2:
+         _nmod_vec_neg(res, vec1, LEN, mod);
+         break;
+      case 3:
+         _nmod_vec_scalar_mul_nmod(res, vec1, LEN, c, mod);
+         break;
+      case 4:
+         _nmod_vec_scalar_addmul_nmod(res, vec1, LEN, c, mod);
+         break;
+      case 5:
+         r += _nmod_vec_dot(vec1, vec2, LEN, mod, nlimbs);
+         break;
+      }
+   }
+   prof_stop();
+
+   if (r == 1UL) /* keep the dot products from being optimised away */
+      printf("\r");
+
+   flint_randclear(state);
+   _nmod_vec_clear(vec1);
+   _nmod_vec_clear(vec2);
+   _nmod_vec_clear(res);
+}
+
+int main(void)
+{
+   double min, max;
+   info_t info;
+   int type, level, max_level = _nmod_vec_simd_level();
+   mp_bitcnt_t bits[] = { 8, 20, 31, 40, 50, 63 };
+   long i;
+
+   printf("cycles per limb, length %d:\n", LEN);
+
+   for (i = 0; i < 6; i++)
+   {
+      info.bits = bits[i];
+
+      for (type = 0; type < 6; type++)
+      {
+         info.type = type;
+
+         printf("bits %ld, %s:", bits[i], names[type]);
+
+         for (level = NMOD_VEC_SIMD_NONE; level <= max_level; level++)
+         {
+            info.level = level;
+            prof_repeat(&min, &max, sample, (void *) &info);
+
+            printf(" %s %.2lf", levels[level], 
+                               (min/(double)FLINT_CLOCK_SCALE_FACTOR)/LEN);
+         }
+
+         printf("\n");
+      }
+   }
+
+   _nmod_vec_simd_set_level(max_level);
+
+   return 0;
+}
@@ -32,6 +32,26 @@
 void _nmod_vec_scalar_mul_nmod(mp_ptr res, mp_srcptr vec, 
 				                  long len, mp_limb_t c, nmod_t mod)
 {
+#if NMOD_VEC_SIMD
+   /* the SIMD kernels handle moduli up to 50 bits */
+   if (len >= NMOD_VEC_SIMD_CUTOFF && mod.norm >= FLINT_BITS - 50)
+   {
+      int level = _nmod_vec_simd_level();
+
+      if (level != NMOD_VEC_SIMD_NONE)
+      {
+         if (c >= mod.n)
+            NMOD_RED(c, c, mod);
+
+         if (level == NMOD_VEC_SIMD_AVX512)
+            _nmod_vec_scalar_mul_nmod_avx512(res, vec, len, c, mod);
+         else
+            _nmod_vec_scalar_mul_nmod_avx2(res, vec, len, c, mod);
+         return;
+      }
+   }
+#endif
+
    if (mod.norm >= FLINT_BITS/2) /* products will fit in a limb */
    {
       mpn_mul_1(res, vec, len, c);
@@ -0,0 +1,71 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+static int _nmod_vec_simd_max = -1;
+static int _nmod_vec_simd = -1;
+
+static int
+_nmod_vec_simd_detect(void)
+{
+#if NMOD_VEC_SIMD
+    __builtin_cpu_init();
+
+    /* __builtin_cpu_supports also checks that the OS saves the registers */
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+        return NMOD_VEC_SIMD_AVX512;
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return NMOD_VEC_SIMD_AVX2;
+#endif
+
+    return NMOD_VEC_SIMD_NONE;
+}
+
+int _nmod_vec_simd_level(void)
+{
+    if (_nmod_vec_simd < 0)
+    {
+        _nmod_vec_simd_max = _nmod_vec_simd_detect();
+        _nmod_vec_simd = _nmod_vec_simd_max;
+    }
+
+    return _nmod_vec_simd;
+}
+
+int _nmod_vec_simd_set_level(int level)
+{
+    _nmod_vec_simd_level();
+
+    _nmod_vec_simd = FLINT_MAX(FLINT_MIN(level, _nmod_vec_simd_max), 
+                                                      NMOD_VEC_SIMD_NONE);
+
+    return _nmod_vec_simd;
+}
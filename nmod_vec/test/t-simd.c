@@ -0,0 +1,146 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "ulong_extras.h"
+
+/* moduli near the boundaries between the various code paths */
+mp_limb_t random_modulus(flint_rand_t state)
+{
+    mp_bitcnt_t bits;
+
+    switch (n_randint(state, 4))
+    {
+        case 0:
+            return n_randtest_not_zero(state);
+        case 1:
+            bits = 32 - n_randint(state, 2);
+            break;
+        case 2:
+            bits = 50 - n_randint(state, 2);
+            break;
+        default:
+            bits = n_randint(state, FLINT_BITS) + 1;
+    }
+
+    if (n_randint(state, 2))
+        return (bits == FLINT_BITS) ? -1UL : (1UL << bits) - 1;
+    else
+        return n_randbits(state, bits);
+}
+
+int
+main(void)
+{
+    int i, level, max_level, result;
+    flint_rand_t state;
+    flint_randinit(state);
+
+    printf("simd....");
+    fflush(stdout);
+
+    max_level = _nmod_vec_simd_level();
+
+    /* Check each SIMD level against elementwise arithmetic */
+    for (level = NMOD_VEC_SIMD_NONE; level <= max_level; level++)
+    {
+        _nmod_vec_simd_set_level(level);
+
+        for (i = 0; i < 2000 * flint_test_multiplier(); i++)
+        {
+            long j, len = n_randint(state, 100) + 1;
+            mp_limb_t n = random_modulus(state);
+            mp_limb_t c = n_randint(state, n), d1, d2;
+            int nlimbs;
+            nmod_t mod;
+
+            mp_ptr a = _nmod_vec_init(len);
+            mp_ptr b = _nmod_vec_init(len);
+            mp_ptr r1 = _nmod_vec_init(len);
+            mp_ptr r2 = _nmod_vec_init(len);
+
+            nmod_init(&mod, n);
+
+            _nmod_vec_randtest(a, state, len, mod);
+            _nmod_vec_randtest(b, state, len, mod);
+
+            _nmod_vec_add(r1, a, b, len, mod);
+            for (j = 0; j < len; j++)
+                r2[j] = nmod_add(a[j], b[j], mod);
+            result = _nmod_vec_equal(r1, r2, len);
+
+            _nmod_vec_sub(r1, a, b, len, mod);
+            for (j = 0; j < len; j++)
+                r2[j] = nmod_sub(a[j], b[j], mod);
+            result &= _nmod_vec_equal(r1, r2, len);
+
+            _nmod_vec_neg(r1, a, len, mod);
+            for (j = 0; j < len; j++)
+                r2[j] = nmod_neg(a[j], mod);
+            result &= _nmod_vec_equal(r1, r2, len);
+
+            _nmod_vec_scalar_mul_nmod(r1, a, len, c, mod);
+            for (j = 0; j < len; j++)
+                r2[j] = nmod_mul(a[j], c, mod);
+            result &= _nmod_vec_equal(r1, r2, len);
+
+            _nmod_vec_set(r1, b, len);
+            _nmod_vec_scalar_addmul_nmod(r1, a, len, c, mod);
+            for (j = 0; j < len; j++)
+                r2[j] = nmod_add(b[j], nmod_mul(a[j], c, mod), mod);
+            result &= _nmod_vec_equal(r1, r2, len);
+
+            nlimbs = _nmod_vec_dot_bound_limbs(len, mod);
+            d1 = _nmod_vec_dot(a, b, len, mod, nlimbs);
+            d2 = 0;
+            for (j = 0; j < len; j++)
+                d2 = nmod_add(d2, nmod_mul(a[j], b[j], mod), mod);
+            result &= (d1 == d2);
+
+            if (!result)
+            {
+                printf("FAIL:\n");
+                printf("level = %d, len = %ld, n = %lu\n", level, len, n);
+                abort();
+            }
+
+            _nmod_vec_clear(a);
+            _nmod_vec_clear(b);
+            _nmod_vec_clear(r1);
+            _nmod_vec_clear(r2);
+        }
+    }
+
+    _nmod_vec_simd_set_level(max_level);
+
+    flint_randclear(state);
+
+    printf("PASS\n");
+    return 0;
+}
@@ -74,6 +74,7 @@ typedef struct {
     double pinv;
 
     fmpz *pow;
+    fmpz_preinvn_struct *powinv;
     long min;
     long max;
 
@@ -122,6 +123,29 @@ int _padic_ctx_pow_ui(fmpz_t rop, ulong e, const padic_ctx_t ctx)
     }
 }
 
+static __inline__ 
+void _padic_ctx_mod_pow_ui(fmpz_t rop, const fmpz_t op, ulong e, 
+                           const padic_ctx_t ctx)
+{
+    if (ctx->min <= e && e < ctx->max)
+    {
+        fmpz_mod_preinvn(rop, op, ctx->pow + (e - ctx->min), 
+                                  ctx->powinv + (e - ctx->min));
+    }
+    else
+    {
+        fmpz_t pow;
+
+        fmpz_init(pow);
+        fmpz_pow_ui(pow, ctx->p, e);
+        fmpz_mod(rop, op, pow);
+        fmpz_clear(pow);
+    }
+}
+
+void _padic_ctx_vec_mod_pow_ui(fmpz *rop, const fmpz *op, long len, 
+                               ulong e, const padic_ctx_t ctx);
+
 
 /* Memory management *********************************************************/
 
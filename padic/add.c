@@ -112,10 +112,15 @@ void padic_add(padic_t rop, const padic_t op1, const padic_t op2,
                     fmpz_sub(padic_unit(rop), padic_unit(rop), pow);
 
             }
-            else
+            else if (alloc)  /* pow is not cached, so no preinverse */
             {
                 fmpz_mod(padic_unit(rop), padic_unit(rop), pow);
             }
+            else
+            {
+                _padic_ctx_mod_pow_ui(padic_unit(rop), padic_unit(rop), 
+                                      padic_prec(rop) - padic_val(rop), ctx);
+            }
 
             if (fmpz_is_zero(padic_unit(rop)))
                 padic_val(rop) = 0;
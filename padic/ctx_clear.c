@@ -31,6 +31,12 @@ void padic_ctx_clear(padic_ctx_t ctx)
 
     if (ctx->pow)
     {
+        long i;
+
+        for (i = 0; i < ctx->max - ctx->min; i++)
+            fmpz_preinvn_clear(ctx->powinv + i);
+        flint_free(ctx->powinv);
+
         _fmpz_vec_clear(ctx->pow, ctx->max - ctx->min);
     }
 }
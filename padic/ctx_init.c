@@ -50,12 +50,17 @@ void padic_ctx_init(padic_ctx_t ctx, const fmpz_t p, long min, long max,
         fmpz_pow_ui(ctx->pow, p, ctx->min);
         for (i = 1; i < len; i++)
             fmpz_mul(ctx->pow + i, ctx->pow + (i - 1), p);
+
+        ctx->powinv = flint_malloc(len * sizeof(fmpz_preinvn_struct));
+        for (i = 0; i < len; i++)
+            fmpz_preinvn_init(ctx->powinv + i, ctx->pow + i);
     }
     else
     {
         ctx->min = 0;
         ctx->max = 0;
         ctx->pow = NULL;
+        ctx->powinv = NULL;
     }
 
     ctx->mode = mode;
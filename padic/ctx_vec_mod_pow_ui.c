@@ -0,0 +1,51 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include "padic.h"
+
+void _padic_ctx_vec_mod_pow_ui(fmpz *rop, const fmpz *op, long len, 
+                               ulong e, const padic_ctx_t ctx)
+{
+    long i;
+
+    if (ctx->min <= e && e < ctx->max)
+    {
+        const fmpz *pow = ctx->pow + (e - ctx->min);
+        const fmpz_preinvn_struct *inv = ctx->powinv + (e - ctx->min);
+
+        for (i = 0; i < len; i++)
+            fmpz_mod_preinvn(rop + i, op + i, pow, inv);
+    }
+    else
+    {
+        fmpz_t pow;
+
+        fmpz_init(pow);
+        fmpz_pow_ui(pow, ctx->p, e);
+        _fmpz_vec_scalar_mod_fmpz(rop, op, len, pow);
+        fmpz_clear(pow);
+    }
+}
+
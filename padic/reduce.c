@@ -31,13 +31,8 @@ void _padic_reduce(padic_t rop, const padic_ctx_t ctx)
     {
         if (padic_val(rop) < padic_prec(rop))
         {
-            int c;
-            fmpz_t pow;
-
-            c = _padic_ctx_pow_ui(pow, padic_prec(rop) - padic_val(rop), ctx);
-            fmpz_mod(padic_unit(rop), padic_unit(rop), pow);
-            if (c)
-                fmpz_clear(pow);
+            _padic_ctx_mod_pow_ui(padic_unit(rop), padic_unit(rop), 
+                                  padic_prec(rop) - padic_val(rop), ctx);
         }
         else
         {
@@ -110,10 +110,15 @@ void padic_sub(padic_t rop, const padic_t op1, const padic_t op2,
                 if (fmpz_sgn(padic_unit(rop)) < 0)
                     fmpz_add(padic_unit(rop), padic_unit(rop), pow);
             }
-            else
+            else if (alloc)  /* pow is not cached, so no preinverse */
             {
                 fmpz_mod(padic_unit(rop), padic_unit(rop), pow);
             }
+            else
+            {
+                _padic_ctx_mod_pow_ui(padic_unit(rop), padic_unit(rop), 
+                                      padic_prec(rop) - padic_val(rop), ctx);
+            }
 
             if (fmpz_is_zero(padic_unit(rop)))
                 padic_val(rop) = 0;
@@ -36,17 +36,10 @@ void _padic_mat_reduce(padic_mat_t mat, const padic_ctx_t ctx)
         }
         else
         {
-            long i;
-            fmpz_t pow;
-
-            fmpz_init(pow);
-            fmpz_pow_ui(pow, ctx->p, ctx->N - mat->val);
-            for (i = 0; i < padic_mat(mat)->r * padic_mat(mat)->c; i++)
-            {
-                fmpz_mod(padic_mat(mat)->entries + i, 
-                         padic_mat(mat)->entries + i, pow);
-            }
-            fmpz_clear(pow);
+            _padic_ctx_vec_mod_pow_ui(padic_mat(mat)->entries, 
+                                      padic_mat(mat)->entries, 
+                                      padic_mat(mat)->r * padic_mat(mat)->c, 
+                                      ctx->N - mat->val, ctx);
 
             if (padic_mat_is_zero(mat))
             {
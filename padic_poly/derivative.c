@@ -30,20 +30,12 @@ void _padic_poly_derivative(fmpz *rop, long *rval,
                             const fmpz *op, long val, long len, 
                             const padic_ctx_t ctx)
 {
-    fmpz_t pow;
-    int alloc;
-
     _fmpz_poly_derivative(rop, op, len);
     *rval = val;
 
     _padic_poly_canonicalise(rop, rval, len - 1, ctx->p);
 
-    alloc = _padic_ctx_pow_ui(pow, ctx->N - *rval, ctx);
-
-    _fmpz_vec_scalar_mod_fmpz(rop, rop, len - 1, pow);
-
-    if (alloc)
-        fmpz_clear(pow);
+    _padic_ctx_vec_mod_pow_ui(rop, rop, len - 1, ctx->N - *rval, ctx);
 }
 
 void padic_poly_derivative(padic_poly_t rop, 
@@ -30,18 +30,10 @@ void _padic_poly_mul(fmpz *rop, long *rval,
                      const fmpz *op2, long val2, long len2, 
                      const padic_ctx_t ctx)
 {
-    fmpz_t pow;
-    int alloc;
-
     *rval = val1 + val2;
 
-    alloc = _padic_ctx_pow_ui(pow, ctx->N - *rval, ctx);
-
     _fmpz_poly_mul(rop, op1, len1, op2, len2);
-    _fmpz_vec_scalar_mod_fmpz(rop, rop, len1 + len2 - 1, pow);
-
-    if (alloc)
-        fmpz_clear(pow);
+    _padic_ctx_vec_mod_pow_ui(rop, rop, len1 + len2 - 1, ctx->N - *rval, ctx);
 }
 
 void padic_poly_mul(padic_poly_t f, 
@@ -38,15 +38,8 @@ void padic_poly_reduce(padic_poly_t poly, const padic_ctx_t ctx)
         }
         else
         {
-            fmpz_t pow;
-            int alloc;
-
-            alloc = _padic_ctx_pow_ui(pow, ctx->N - poly->val, ctx);
-
-            _fmpz_vec_scalar_mod_fmpz(poly->coeffs, poly->coeffs, poly->length, pow);
-
-            if (alloc)
-                fmpz_clear(pow);
+            _padic_ctx_vec_mod_pow_ui(poly->coeffs, poly->coeffs, poly->length, 
+                                      ctx->N - poly->val, ctx);
 
             _padic_poly_normalise(poly);
 
@@ -36,19 +36,11 @@ void _padic_poly_scalar_mul_padic(fmpz *rop, long *rval,
     }
     else
     {
-        fmpz_t pow;
-        int alloc;
-
         *rval = val + padic_val(c);
 
-        alloc = _padic_ctx_pow_ui(pow, ctx->N - *rval, ctx);
-
         _fmpz_vec_scalar_mul_fmpz(rop, op, len, padic_unit(c));
 
-        _fmpz_vec_scalar_mod_fmpz(rop, rop, len, pow);
-
-        if (alloc)
-            fmpz_clear(pow);    
+        _padic_ctx_vec_mod_pow_ui(rop, rop, len, ctx->N - *rval, ctx);
     }
 }
 
@@ -63,6 +63,10 @@ qadic_ctx_struct;
 
 typedef qadic_ctx_struct qadic_ctx_t[1];
 
+int _qadic_ctx_init_conway(qadic_ctx_t ctx,
+                           const fmpz_t p, long d, long N, const char *var,
+                           enum padic_print_mode mode);
+
 void qadic_ctx_init_conway(qadic_ctx_t ctx, 
                            const fmpz_t p, long d, long N, const char *var, 
                            enum padic_print_mode mode);
@@ -173,18 +177,13 @@ static __inline__ void qadic_reduce(qadic_t x, const qadic_ctx_t ctx)
     }
     else
     {
-        fmpz_t pow;
-        int alloc;
-
-        alloc = _padic_ctx_pow_ui(pow, (&ctx->pctx)->N - x->val, &ctx->pctx);
-
-        _fmpz_mod_poly_reduce(x->coeffs, x->length, ctx->a, ctx->j, ctx->len, pow);
+        if (x->length > d)
+            _fmpz_poly_reduce(x->coeffs, x->length, ctx->a, ctx->j, ctx->len);
         _padic_poly_set_length(x, FLINT_MIN(x->length, d));
+        _padic_ctx_vec_mod_pow_ui(x->coeffs, x->coeffs, x->length, 
+                                  N - x->val, &ctx->pctx);
         _padic_poly_normalise(x);
         padic_poly_canonicalise(x, (&ctx->pctx)->p);
-
-        if (alloc)
-            fmpz_clear(pow);
     }
 }
 
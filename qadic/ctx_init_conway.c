@@ -29,105 +29,65 @@
 #include "fmpz_vec.h"
 #include "padic.h"
 #include "qadic.h"
+#include "fq.h"
 
-#ifndef FLINT_CPIMPORT
-#define FLINT_CPIMPORT "/home/user/FLINT/flint-2/fq/CP.txt"
-#endif
-
-void qadic_ctx_init_conway(qadic_ctx_t ctx,
-                           const fmpz_t p, long d, long N, const char *var, 
+int _qadic_ctx_init_conway(qadic_ctx_t ctx,
+                           const fmpz_t p, long d, long N, const char *var,
                            enum padic_print_mode mode)
 {
-    char *buf;
-    FILE *file;
+    long i, j;
+    mp_ptr c;
 
-    if (fmpz_cmp_ui(p, 109987) > 0)
-    {
-        printf("Exception (qadic_ctx_init_conway).  Conway polynomials \n");
-        printf("are only available for primes up to 109987.\n");
-        abort();
-    }
+    if (!fmpz_abs_fits_ui(p) || fmpz_sgn(p) <= 0)
+        return 0;
 
-    buf  = flint_malloc(832);
-    file = fopen(FLINT_CPIMPORT, "r");
+    c = flint_malloc((d + 1) * sizeof(mp_limb_t));
 
-    if (!file)
+    if (!_fq_conway_polynomial(c, fmpz_get_ui(p), d))
     {
-        printf("Exception (qadic_ctx_init_conway).  File loading.\n");
-        abort();
+        flint_free(c);
+        return 0;
     }
 
-    while (fgets(buf, 832, file))
-    {
-        char *tmp = buf;
-
-        /* Different prime? */
-        if (fmpz_cmp_ui(p, atoi(tmp)))
-            continue;
+    /* Find number of non-zero coefficients */
+    ctx->len = 1;
+    for (i = 0; i < d; i++)
+        if (c[i])
+            ctx->len ++;
 
-        while (*tmp++ != ' ') ;
+    ctx->a = _fmpz_vec_init(ctx->len);
+    ctx->j = flint_malloc(ctx->len * sizeof(long));
 
-        /* Same degree? */
-        if (d == atoi(tmp))
+    /* Copy the polynomial */
+    for (i = 0, j = 0; i <= d; i++)
+    {
+        if (c[i])
         {
-            long i, j;
-            char *ptr;
-
-            /* Find number of non-zero coefficients */
-            ctx->len = 1;
-            ptr = tmp;
-
-            for (i = 0; i < d; i++)
-            {
-                while (*ptr++ != ' ') ;
-
-                if (atoi(ptr))
-                    ctx->len ++;
-            }
-
-            ctx->a = _fmpz_vec_init(ctx->len);
-            ctx->j = flint_malloc(ctx->len * sizeof(long));
-
-            /* Copy the polynomial */
-            j = 0;
-            ptr = tmp;
-
-            for (i = 0; i < d; i++)
-            {
-                int coeff;
-
-                while (*ptr++ != ' ') ;
-
-                coeff = atoi(ptr);
-
-                if (coeff)
-                {
-                    fmpz_set_ui(ctx->a + j, coeff);
-                    ctx->j[j] = i;
-                    j++;
-                }
-            }
-
-            fmpz_set_ui(ctx->a + j, 1);
-            ctx->j[j] = d;
-
-            /* Complete the initialisation of the context */
-            padic_ctx_init(&ctx->pctx, p, N, mode);
-
-            ctx->var = flint_malloc(strlen(var) + 1);
-            strcpy(ctx->var, var);
-
-            fclose(file);
-            flint_free(buf);
-            return;
+            fmpz_set_ui(ctx->a + j, c[i]);
+            ctx->j[j] = i;
+            j++;
         }
     }
 
-    fclose(file);
-    flint_free(buf);
+    /* Complete the initialisation of the context */
+    padic_ctx_init(&ctx->pctx, p, N, mode);
+
+    ctx->var = flint_malloc(strlen(var) + 1);
+    strcpy(ctx->var, var);
 
-    printf("Exception (qadic_ctx_init_conway).  The polynomial for \n");
-    printf("(p,d) = (%ld,%ld) is not present in the database.\n", *p, d);
-    abort();
+    flint_free(c);
+    return 1;
 }
 
+void qadic_ctx_init_conway(qadic_ctx_t ctx,
+                           const fmpz_t p, long d, long N, const char *var,
+                           enum padic_print_mode mode)
+{
+    if (!_qadic_ctx_init_conway(ctx, p, d, N, var, mode))
+    {
+        printf("Exception (qadic_ctx_init_conway).  The polynomial for \n");
+        printf("(p,d) = ("), fmpz_print(p);
+        printf(",%ld) is not present in the database.\n", d);
+        abort();
+    }
+}
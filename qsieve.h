@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2006, 2011 William Hart
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
@@ -30,6 +31,10 @@
 #include "flint.h"
 #include "fmpz.h"
 
+#undef ulong /* prevent clash with standard library */
+#include <pthread.h>
+#define ulong unsigned long
+
 #ifdef __cplusplus
  extern "C" {
 #endif
@@ -78,10 +83,56 @@ typedef struct la_col_t /* matrix column */
 	long orig;         /* Original relation number */
 } la_col_t;
 
+/*
+   Polynomial data and scratch space for a single sieving thread. Each
+   thread takes A coeffs of its own and sieves with all the polynomials
+   belonging to them, passing relations to the shared qs_s.
+*/
+typedef struct qs_poly_s
+{
+   fmpz_t A; /* coefficient A */
+   fmpz_t B; /* coefficient B */
+   fmpz_t C; /* coefficient C */
+
+   mp_limb_t * A_ind; /* indices of factor base primes dividing A */
+   mp_limb_t * A_modp; /* (A/p) mod p for each prime p dividing A */
+
+   fmpz * B_terms; /* 
+                      Let A_i = (A/p) mod p where p is the i-th prime
+                      which is a factor of A, then B_terms[i] is
+                      {p^(1/2) / A_i} mod p * (A/p) where we take 
+                      the smaller square root of p
+                   */
+ 
+   mp_limb_t * A_inv; /* A^(-1) mod p */
+
+   mp_limb_t ** A_inv2B; /* A_inv[j][i] = 2*B_terms[j]*A^(-1) mod p */
+
+   mp_limb_t * soln1; /* first root of poly */
+   mp_limb_t * soln2; /* second root of poly */
+
+   unsigned char * sieve; /* sieve array */
+
+   fac_t * factor; /* factors for a relation */
+   long num_factors; /* number of factors found in a relation */
+
+   int done; /* set once enough relations have been found */
+
+#if (QS_DEBUG & 16)
+   long * sieve_tally; /* statistics for sieve contents */
+#endif
+} qs_poly_s;
+
+typedef qs_poly_s qs_poly_t[1];
+
+/*
+   The factor base consists of -1 (stored as 1) at index 0, 2 at index 1
+   and then the odd primes p such that kn is a square mod p, including
+   those dividing the multiplier k, in increasing order.
+*/
 typedef struct qs_s
 {
-   mp_limb_t hi; /* Number to factor */
-   mp_limb_t lo;
+   fmpz_t n; /* Number to factor */
 
    mp_bitcnt_t bits; /* Number of bits of n */
    
@@ -90,7 +141,7 @@ typedef struct qs_s
    mp_limb_t k; /* Multiplier */
    fmpz_t kn; /* kn as a multiprecision integer */
 
-   long num_primes; /* number of factor base primes including k and 2 */
+   long num_primes; /* number of factor base primes including -1 and 2 */
    long small_primes; /* number of primes to not sieve with */
    long sieve_size; /* size of sieve to use */
 
@@ -98,43 +149,28 @@ typedef struct qs_s
 
    int * sqrts; /* square roots of kn mod factor base primes */
 
-   char sieve_bits; /* number of bits to exceed in sieve */
+   unsigned char sieve_bits; /* number of bits to exceed in sieve */
 
    /******************
      Polynomial data
    ******************/
 
-   mp_limb_t A; /* coefficient A */
-   mp_limb_t B; /* coefficient B */
-   fmpz_t C; /* coefficient C */
+   fmpz_t target_A; /* approximate target value for A coeff of poly */
 
-   mp_limb_t * A_ind; /* indices of factor base primes dividing A */
-   mp_limb_t * A_modp; /* (A/p) mod p for each prime p dividing A */
-   mp_limb_t * inv_p2; /* newton inverse of p^2 for each factor p of A */
-
-   mp_limb_t * B_terms; /* 
-                           Let A_i = (A/p) mod p where p is the i-th prime
-                           which is a factor of A, then B_terms[i] is
-                           {p^(1/2) / A_i} mod p * (A/p) where we take 
-                           the smaller square root of p
-                        */
- 
-   mp_limb_t * A_inv; /* A^(-1) mod p */
-
-   mp_limb_t ** A_inv2B; /* A_inv[j][i] = 2*B_terms[j]*A^(-1) mod p */
+   long s; /* number of prime factors of A coeff */
+   long low; /* index of first FB prime the factors of A are drawn from */
+   long span; /* number of FB primes the factors of A are drawn from */
 
-   mp_limb_t * soln1; /* first root of poly */
-   mp_limb_t * soln2; /* second root of poly */
+   mp_limb_t * A_used; /* low limbs of the A coeffs used so far */
+   long num_A; /* number of A coeffs used so far */
+   long alloc_A; /* space allocated for A_used */
 
-   mp_limb_t target_A; /* approximate target value for A coeff of poly */
+   flint_rand_t state; /* random state for choosing the factors of A */
 
-   long s; /* number of prime factors of A coeff */
-   long min; /* minimum FB prime that can appear as factor of A */
-   long span; /* size of set of possible prime factors of A */
-   long fact; /* middle of set of possible prime factors of A */
-   long mid; /* start of range for middle factor */
-   long high; /* end of range for middle factor */
+   qs_poly_s * poly; /* polynomial data for each sieving thread */
+   long num_handles; /* number of sieving threads */
 
+   pthread_mutex_t mutex; /* protects the A coeffs and relations in use */
 
    /*********************
      Relations data
@@ -144,16 +180,32 @@ typedef struct qs_s
    long extra_rels; /* number of extra relations beyond num_primes */
    long max_factors; /* maximum number of factors a relation can have */
 
-   long * small; /* exponents of small prime factors in relations */
-   fac_t * factor; /* factors for a relation */
    fmpz * Y_arr; /* array of Y's corresponding to relations */
    long * curr_rel; /* current relation in array of relations */
    long * relation; /* relation array */
 
    long buffer_size; /* size of buffer of relations */
    long num_relations; /* number of relations so far */
+   int failed; /* set if no new A coeff could be found */
 
-   long num_factors; /* number of factors found in a relation */
+   /*********************
+     Large prime data
+   **********************/
+
+   mp_limb_t large_prime; /* bound on the large prime of a partial relation */
+
+   long * lp_table; /* first partial relation for each hash of a large prime */
+   long lp_table_size; /* size of lp_table, a power of 2 */
+   long * lp_next; /* next partial relation with the same hash */
+   mp_limb_t * lp_prime; /* large prime of each partial relation */
+   fmpz * lp_Y; /* Y of each partial relation */
+   long * lp_off; /* start of the factors of each partial relation in lp_fac */
+   int * lp_fac; /* factors of partial relations, in the format of relation */
+   long lp_fac_len; /* number of entries of lp_fac in use */
+   long lp_fac_alloc; /* space allocated for lp_fac */
+   long num_partials; /* number of partial relations */
+   long alloc_partials; /* space allocated for partial relations */
+   long num_combined; /* number of relations obtained from partials */
 
    /*********************
      Linear algebra data
@@ -172,76 +224,114 @@ typedef struct qs_s
 
    long * prime_count; /* counts of the exponents of primes appearing in the square */
 
-   /*********************
-     Statistics
-   **********************/
-
-#if (QS_DEBUG & 16)
-   long * sieve_tally;
-#endif
-
 } qs_s;
 
 typedef qs_s qs_t[1];
 
 /*
-   Tuning parameters { bits, ks_primes, fb_primes, small_primes } 
-   for qsieve_ll_factor where:
-     * bits is the number of bits of n
+   Tuning parameters { bits, ks_primes, fb_primes, small_primes, sieve_size } 
+   for qsieve_factor where:
+     * bits is the number of bits of kn
      * ks_primes is the max number of primes to try in Knuth-Schroeppel algo
-     * fb_primes is the number of factor base primes to use (including k and 2)
-     * small_primes is the number of small primes to not factor with (including k and 2)
+       and the number of relations to accumulate before sorting
+     * fb_primes is the number of factor base primes to use (including -1 and 2)
+     * small_primes is the number of small primes to not factor with (including -1 and 2)
      * sieve_size is the size of the sieve to use
 */
-static const mp_limb_t qsieve_ll_tune[][5] =
+static const mp_limb_t qsieve_tune[][5] =
 {
-    {0, 50, 80, 2, 14000 },
-    {30, 50, 80, 2, 16000 },
-    {40, 50, 100, 3, 18000 },
-    {50, 50, 120, 3, 20000 },
-    {60, 50, 140, 4, 22000 },
-    {70, 50, 160, 4, 24000 },
-    {80, 100, 180, 5, 26000 },
-    {90, 100, 200, 5, 28000 },
-    {100, 100, 250, 6, 30000 },
-    {110, 100, 300, 6, 34000 },
-    {120, 100, 500, 7, 40000 },
-    {130, 100, 550, 7, 60000 }
+    {0, 50, 80, 3, 14000 },
+    {30, 50, 80, 3, 16000 },
+    {40, 50, 100, 4, 18000 },
+    {50, 50, 120, 4, 20000 },
+    {60, 50, 140, 5, 22000 },
+    {70, 50, 160, 5, 24000 },
+    {80, 100, 180, 6, 26000 },
+    {90, 100, 200, 6, 28000 },
+    {100, 100, 250, 7, 30000 },
+    {110, 100, 300, 7, 34000 },
+    {120, 100, 500, 8, 40000 },
+    {130, 100, 550, 8, 60000 },
+    {140, 100, 650, 8, 60000 },
+    {150, 100, 800, 9, 60000 },
+    {160, 150, 1000, 9, 65536 },
+    {170, 150, 1200, 10, 65536 },
+    {180, 150, 1500, 10, 65536 },
+    {190, 150, 1800, 11, 65536 },
+    {200, 200, 2200, 11, 65536 },
+    {210, 200, 2800, 12, 98304 },
+    {220, 200, 3500, 12, 98304 },
+    {230, 300, 4200, 13, 98304 },
+    {240, 300, 5000, 13, 131072 },
+    {250, 300, 6000, 14, 131072 },
+    {260, 400, 7500, 14, 131072 },
+    {270, 400, 9000, 15, 131072 },
+    {280, 500, 11000, 15, 196608 },
+    {290, 500, 14000, 16, 196608 },
+    {300, 600, 17000, 16, 196608 },
+    {310, 600, 21000, 17, 262144 },
+    {320, 700, 26000, 17, 262144 },
+    {330, 800, 32000, 18, 262144 },
+    {340, 900, 40000, 18, 262144 }
 };
 
 /* number of entries in the tuning table */
-#define QS_LL_TUNE_SIZE (sizeof(qsieve_ll_tune)/(5*sizeof(mp_limb_t)))
+#define QS_TUNE_SIZE (sizeof(qsieve_tune)/(5*sizeof(mp_limb_t)))
+
+#define QS_A_PRIME_BITS 11 /* preferred size of the prime factors of A */
+
+#define QS_LARGE_PRIME_MULT 40 /* large prime bound as a multiple of the largest FB prime */
+
+#define QS_THREAD_CUTOFF 150 /* minimum number of bits of kn to sieve with several threads */
+
+void qsieve_init(qs_t qs_inf, const fmpz_t n);
 
-#define P_GOODNESS 100 /* within what factor of target_A must A be */
-#define P_GOODNESS2 200 /* within what factor of target_A must A be when s = 2 */
+void qsieve_clear(qs_t qs_inf);
 
-#define BITS_ADJUST 10 /* no. bits less than f(X) to qualify for trial division */
+mp_limb_t qsieve_knuth_schroeppel(qs_t qs_inf);
 
-void qsieve_ll_init(qs_t qs_inf, mp_limb_t hi, mp_limb_t lo);
+mp_limb_t qsieve_primes_init(qs_t qs_inf);
 
-void qsieve_ll_clear(qs_t qs_inf);
+void qsieve_poly_init(qs_t qs_inf);
 
-mp_limb_t qsieve_ll_knuth_schroeppel(qs_t qs_inf);
+void qsieve_linalg_init(qs_t qs_inf);
 
-mp_limb_t qsieve_ll_primes_init(qs_t qs_inf);
+int qsieve_compute_A(qs_t qs_inf, qs_poly_t poly);
 
-mp_limb_t qsieve_ll_poly_init(qs_t qs_inf);
+void qsieve_compute_B_terms(qs_t qs_inf, qs_poly_t poly);
 
-void qsieve_ll_linalg_init(qs_t qs_inf);
+void qsieve_compute_off_adj(qs_t qs_inf, qs_poly_t poly);
 
-void qsieve_ll_compute_poly_data(qs_t qs_inf);
+int qsieve_compute_poly_data(qs_t qs_inf, qs_poly_t poly);
 
-void qsieve_ll_compute_A_factor_offsets(qs_t qs_inf);
+void qsieve_compute_A_factor_offsets(qs_t qs_inf, qs_poly_t poly);
 
-void qsieve_ll_compute_C(qs_t qs_inf);
+void qsieve_compute_C(qs_t qs_inf, qs_poly_t poly);
 
-long qsieve_ll_collect_relations(qs_t qs_inf, char * sieve);
+void qsieve_do_sieving(qs_t qs_inf, qs_poly_t poly);
 
-long qsieve_ll_merge_sort(qs_t qs_inf);
+long qsieve_evaluate_candidate(qs_t qs_inf, qs_poly_t poly, long i);
+
+long qsieve_evaluate_sieve(qs_t qs_inf, qs_poly_t poly);
+
+void qsieve_update_offsets(int poly_add, mp_limb_t * poly_corr, 
+                                             qs_t qs_inf, qs_poly_t poly);
+
+long qsieve_collect_relations(qs_t qs_inf, qs_poly_t poly);
+
+int qsieve_find_relations(qs_t qs_inf);
+
+long qsieve_merge_sort(qs_t qs_inf);
       
-long qsieve_ll_merge_relations(qs_t qs_inf);
+long qsieve_merge_relations(qs_t qs_inf);
+
+long qsieve_insert_relation(qs_t qs_inf, 
+                               fac_t * factor, long num_factors, fmpz_t Y);
+
+long qsieve_add_partial(qs_t qs_inf, 
+                fac_t * factor, long num_factors, mp_limb_t L, fmpz_t Y);
 
-long qsieve_ll_insert_relation(qs_t qs_inf, fmpz_t Y);
+int qsieve_factor(fmpz_t factor, const fmpz_t n);
 
 mp_limb_t qsieve_ll_factor(mp_limb_t hi, mp_limb_t lo);
 
@@ -299,7 +389,7 @@ void reduce_matrix(qs_t qs_inf, long * nrows, long * ncols, la_col_t * cols);
 uint64_t * block_lanczos(flint_rand_t state, long nrows, long dense_rows, 
                                                        long ncols, la_col_t *B);
 
-void qsieve_ll_square_root(fmpz_t X, fmpz_t Y, qs_t qs_inf,
+void qsieve_square_root(fmpz_t X, fmpz_t Y, qs_t qs_inf,
                              uint64_t * nullrows, long ncols, long l, fmpz_t N);
 
 #ifdef __cplusplus
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2006, 2011 William Hart
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
@@ -28,32 +29,51 @@
 #include "ulong_extras.h"
 #include "qsieve.h"
 #include "fmpz.h"
+#include "fmpz_vec.h"
 
-void qsieve_ll_clear(qs_t qs_inf)
+void qsieve_clear(qs_t qs_inf)
 {
     long i;
     
+    fmpz_clear(qs_inf->n);
     fmpz_clear(qs_inf->kn);
-    fmpz_clear(qs_inf->C);
+    fmpz_clear(qs_inf->target_A);
    
     flint_free(qs_inf->factor_base);
     flint_free(qs_inf->sqrts);
-    flint_free(qs_inf->B_terms);
-    flint_free(qs_inf->A_inv);
-    
-    if (qs_inf->A_inv2B != NULL)
-        flint_free(qs_inf->A_inv2B[0]);
+    flint_free(qs_inf->A_used);
+
+    if (qs_inf->poly != NULL)
+    {
+        for (i = 0; i < qs_inf->num_handles; i++)
+        {
+            qs_poly_s * poly = qs_inf->poly + i;
+
+            fmpz_clear(poly->A);
+            fmpz_clear(poly->B);
+            fmpz_clear(poly->C);
+
+            _fmpz_vec_clear(poly->B_terms, qs_inf->s);
+            flint_free(poly->A_ind);
+            flint_free(poly->A_inv);
+            flint_free(poly->A_inv2B[0]);
+            flint_free(poly->A_inv2B);
+            flint_free(poly->sieve);
+            flint_free(poly->factor);
+
+#if (QS_DEBUG & 16)
+            flint_free(poly->sieve_tally);
+#endif
+        }
 
-    flint_free(qs_inf->A_inv2B);
+        flint_free(qs_inf->poly);
+    }
     
     qs_inf->factor_base = NULL;
     qs_inf->sqrts       = NULL;
-    qs_inf->B_terms     = NULL;
-    qs_inf->A_inv       = NULL;
-    qs_inf->A_inv2B     = NULL;
+    qs_inf->A_used      = NULL;
+    qs_inf->poly        = NULL;
 
-    flint_free(qs_inf->small);
-    flint_free(qs_inf->factor);
     flint_free(qs_inf->relation);
     flint_free(qs_inf->qsort_arr);
     
@@ -70,27 +90,34 @@ void qsieve_ll_clear(qs_t qs_inf)
     }
     
     if (qs_inf->Y_arr != NULL)
-    {
-        for (i = 0; i < qs_inf->buffer_size; i++)
-            fmpz_clear(qs_inf->Y_arr + i);    
-        flint_free(qs_inf->Y_arr);
-    }
+        _fmpz_vec_clear(qs_inf->Y_arr, qs_inf->buffer_size);
+
+    flint_free(qs_inf->lp_table);
+    flint_free(qs_inf->lp_next);
+    flint_free(qs_inf->lp_prime);
+    flint_free(qs_inf->lp_off);
+    flint_free(qs_inf->lp_fac);
+
+    if (qs_inf->lp_Y != NULL)
+        _fmpz_vec_clear(qs_inf->lp_Y, qs_inf->alloc_partials);
 
     flint_free(qs_inf->prime_count);
      
-    qs_inf->small       = NULL;
-    qs_inf->factor      = NULL;
     qs_inf->matrix      = NULL;
     qs_inf->Y_arr       = NULL;
     qs_inf->relation    = NULL;
     qs_inf->qsort_arr   = NULL;
+
+    qs_inf->lp_table    = NULL;
+    qs_inf->lp_next     = NULL;
+    qs_inf->lp_prime    = NULL;
+    qs_inf->lp_Y        = NULL;
+    qs_inf->lp_off      = NULL;
+    qs_inf->lp_fac      = NULL;
     
     qs_inf->prime_count = NULL;
 
-    qs_inf->A = 0;
+    flint_randclear(qs_inf->state);
 
-#if (QS_DEBUG & 16)
-    flint_free(qs_inf->sieve_tally);
-    qs_inf->sieve_tally = NULL;
-#endif
+    pthread_mutex_destroy(&qs_inf->mutex);
 }
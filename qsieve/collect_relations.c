@@ -0,0 +1,423 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2006, 2011 William Hart
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong /* avoid clash with stdlib */
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#define ulong unsigned long 
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz.h"
+
+void qsieve_do_sieving(qs_t qs_inf, qs_poly_t poly)
+{
+   unsigned char * sieve = poly->sieve;
+   long num_primes = qs_inf->num_primes;
+   mp_limb_t * soln1 = poly->soln1;
+   mp_limb_t * soln2 = poly->soln2;
+   prime_t * factor_base = qs_inf->factor_base;
+   mp_limb_t p;
+   unsigned char * end = sieve + qs_inf->sieve_size;
+   register unsigned char * pos1;
+   register unsigned char * pos2;
+   register unsigned char * bound;  
+   long size;
+   long diff;
+   long pind;
+   
+   memset(sieve, 0, qs_inf->sieve_size + sizeof(ulong));
+   *end = (unsigned char) 255;
+   
+   for (pind = qs_inf->small_primes; pind < num_primes; pind++) 
+   {
+      if (soln2[pind] == -1) continue; /* don't sieve with A factors */
+      
+      p = factor_base[pind].p;
+      size = factor_base[pind].size;
+      pos1 = sieve + soln1[pind];
+      pos2 = sieve + soln2[pind];
+      diff = pos2 - pos1;
+      bound = end - 2*p;
+        
+      while (bound - pos1 > 0)  
+      {  
+         (*pos1) += size, (*(pos1 + diff)) += size, pos1 += p;
+         (*pos1) += size, (*(pos1 + diff)) += size, pos1 += p;
+      }
+
+      while ((end - pos1 > 0) && (end - pos1 - diff > 0))
+      { 
+         (*pos1) += size, (*(pos1 + diff)) += size, pos1 += p;
+      }
+      
+      pos2 = pos1 + diff;
+      
+      if (end - pos2 > 0)
+      { 
+         (*pos2) += size;
+      }
+      
+      if (end - pos1 > 0)
+      { 
+         (*pos1) += size;
+      } 
+   }
+}
+
+long qsieve_evaluate_candidate(qs_t qs_inf, qs_poly_t poly, long i)
+{
+   unsigned char * sieve = poly->sieve;
+   long exp, k;
+   mp_limb_t modp, prime;
+   long num_primes = qs_inf->num_primes;
+   prime_t * factor_base = qs_inf->factor_base;
+   fac_t * factor = poly->factor;
+   mp_limb_t * soln1 = poly->soln1;
+   mp_limb_t * soln2 = poly->soln2;
+   mp_limb_t * A_ind = poly->A_ind;
+   long max_factors = qs_inf->max_factors - qs_inf->s;
+   mp_limb_t pinv;
+   unsigned char sieved = 0; /* sieve contributions accounted for so far */
+   long num_factors = 0;
+   long relations = 0;
+   long j;
+   
+   fmpz_t X, Y, res, p;
+   fmpz_init(X); 
+   fmpz_init(Y); 
+   fmpz_init(res); 
+   fmpz_init(p); 
+    
+   fmpz_set_ui(X, i);
+   fmpz_sub_ui(X, X, qs_inf->sieve_size/2); /* X */
+     
+#if (QS_DEBUG & 32)
+   printf("i = "); fmpz_print(X); printf("\n");
+#endif
+
+   fmpz_mul(Y, X, poly->A);
+   fmpz_add(Y, Y, poly->B); /* Y = AX + B */
+   fmpz_add(res, Y, poly->B);
+   fmpz_mul(res, res, X);  
+   fmpz_add(res, res, poly->C); /* res = AX^2 + 2BX + C */
+   
+   if (fmpz_sgn(res) < 0) /* -1 is stored at index 0 */
+   {
+      fmpz_neg(res, res);
+      factor[num_factors].ind = 0;
+      factor[num_factors++].exp = 1;
+   }
+
+   fmpz_set_ui(p, 2); /* divide out by powers of 2 */
+   exp = fmpz_remove(res, res, p);
+   if (exp)
+   {
+      factor[num_factors].ind = 1;
+      factor[num_factors++].exp = exp;
+
+#if (QS_DEBUG & 8)
+      printf("2^%ld ", exp);
+#endif
+   }
+     
+   for (j = 2; j < qs_inf->small_primes; j++) /* pull out small primes */
+   {
+      prime = factor_base[j].p;
+      pinv = factor_base[j].pinv;
+      modp = n_mod2_preinv(i, prime, pinv);
+      if ((modp == soln1[j]) || (modp == soln2[j]))
+      {
+         fmpz_set_ui(p, prime);
+         exp = fmpz_remove(res, res, p);
+         if (exp)
+         {
+            factor[num_factors].ind = j;
+            factor[num_factors++].exp = exp;
+
+#if (QS_DEBUG & 8)
+            printf("%ld^%ld ", prime, exp); 
+#endif
+         }
+      }
+   }
+   
+   /* 
+      pull out remaining primes, stopping as soon as all the primes which 
+      contributed to the sieve entry have been found
+   */
+   for (j = qs_inf->small_primes, k = 0; 
+        j < num_primes && sieved != sieve[i]; j++) 
+   {
+      prime = factor_base[j].p;
+
+      if (soln2[j] == -1) /* factor of A */
+      {
+         fmpz_set_ui(p, prime);
+         exp = fmpz_remove(res, res, p);
+         factor[num_factors].ind = j;
+         factor[num_factors++].exp = exp + 1; 
+         k++;
+      } else
+      {
+         if (prime > qs_inf->sieve_size)
+            modp = i;
+         else
+            modp = n_mod2_preinv(i, prime, factor_base[j].pinv);
+
+         if ((modp == soln1[j]) || (modp == soln2[j]))
+         {
+            if (modp == soln1[j]) sieved += factor_base[j].size;
+            if (modp == soln2[j]) sieved += factor_base[j].size;
+
+            fmpz_set_ui(p, prime);
+            exp = fmpz_remove(res, res, p);
+            if (exp) 
+            {
+               factor[num_factors].ind = j;
+               factor[num_factors++].exp = exp; 
+
+#if (QS_DEBUG & 8)
+               printf("%ld^%ld ", prime, exp); 
+#endif
+            }
+         }
+      }
+
+      if (num_factors >= max_factors) /* too many factors to store */
+         goto cleanup;
+   }
+
+   for ( ; k < qs_inf->s; k++) /* commit any outstanding A factors */
+   {
+      if (A_ind[k] >= j)
+      {
+         fmpz_set_ui(p, factor_base[A_ind[k]].p);
+         exp = fmpz_remove(res, res, p);
+         factor[num_factors].ind = A_ind[k];
+         factor[num_factors++].exp = exp + 1; 
+      }
+   }
+
+   poly->num_factors = num_factors;
+
+   if (fmpz_is_one(res) || fmpz_cmp_ui(res, qs_inf->large_prime) < 0)
+   {
+      pthread_mutex_lock(&qs_inf->mutex);
+
+      if (qs_inf->columns + qs_inf->num_unmerged >= 
+          qs_inf->num_primes + qs_inf->extra_rels) /* enough, barring duplicates */
+         poly->done = 1;
+      else if (fmpz_is_one(res)) /* we've found a relation */
+         relations += qsieve_insert_relation(qs_inf, factor, num_factors, Y);
+      else /* partial relation */
+         relations += qsieve_add_partial(qs_inf, factor, num_factors, 
+                                                         fmpz_get_ui(res), Y);
+
+      if (qs_inf->num_relations >= qs_inf->buffer_size)
+      {
+         printf("Error: too many duplicate relations!\n");
+         printf("s = %ld, bits = %ld\n", qs_inf->s, qs_inf->bits);
+         abort();
+      }
+
+      pthread_mutex_unlock(&qs_inf->mutex);
+   }
+
+#if (QS_DEBUG & 8)
+   printf("\n");
+#endif
+  
+cleanup:
+   fmpz_clear(X);
+   fmpz_clear(Y);
+   fmpz_clear(res);
+   fmpz_clear(p);
+      
+   return relations;
+}
+
+long qsieve_evaluate_sieve(qs_t qs_inf, qs_poly_t poly)
+{
+   unsigned char * sieve = poly->sieve;
+   long i = 0, j = 0;
+   ulong * sieve2 = (ulong *) sieve;
+   unsigned char bits = qs_inf->sieve_bits;
+   long rels = 0;
+   ulong mask;
+
+#if (QS_DEBUG & 16)
+   long stats_limit;
+   for (i = 0; i < 256; i++)
+       poly->sieve_tally[i] = 0;
+#endif
+
+#if (QS_DEBUG & 4)
+   fmpz_print(poly->A); printf("X^2+2*"); 
+   fmpz_print(poly->B); printf("X+");
+   fmpz_print(poly->C); printf("\n");
+#endif
+
+   /* 
+      entries exceeding bits have at least the top bit of bits set, 
+      so test all the bytes of a word for one of those bits at once
+   */
+   mask = (0xFFUL << (FLINT_BIT_COUNT(bits) - 1)) & 0xFFUL;
+   mask *= (-1UL/0xFFUL);
+
+   while (j < qs_inf->sieve_size/sizeof(ulong))
+   {
+       while ((sieve2[j] & mask) == 0) 
+       {
+#if (QS_DEBUG & 16)
+           for (i = j*sizeof(ulong); i < (j+1)*sizeof(ulong) && i < qs_inf->sieve_size; i++)
+               poly->sieve_tally[sieve[i]]++;
+#endif
+           j++;
+       }
+
+       i = j*sizeof(ulong);
+
+       while (i < (j+1)*sizeof(ulong) && i < qs_inf->sieve_size)
+       {
+#if (QS_DEBUG & 16)
+           poly->sieve_tally[sieve[i]]++;
+#endif
+           if (sieve[i] > bits) 
+               rels += qsieve_evaluate_candidate(qs_inf, poly, i);
+
+           i++;
+       }
+       j++;
+
+       if (poly->done) /* we already have enough relations */
+          break;
+   }
+
+#if (QS_DEBUG & 16)
+   for (stats_limit = 255; stats_limit >= 0; stats_limit--)
+       if (poly->sieve_tally[stats_limit] != 0)
+           break;
+   
+   for (i = 0; i <= stats_limit; i++)
+   {
+       if ((i % 16) == 0)
+           printf("|%ld:", i);
+       printf(" %ld", poly->sieve_tally[i]);
+   }
+   printf("|\n");
+   printf("Total of %ld relations for this sieve interval\n", rels);
+#endif
+ 
+   return rels;
+}
+
+void qsieve_update_offsets(int poly_add, mp_limb_t * poly_corr, 
+                                             qs_t qs_inf, qs_poly_t poly)
+{
+   long num_primes = qs_inf->num_primes;
+   mp_limb_t * soln1 = poly->soln1;
+   mp_limb_t * soln2 = poly->soln2;
+   prime_t * factor_base = qs_inf->factor_base;
+   mp_limb_t p, correction;
+   long pind;
+
+   for (pind = 2; pind < num_primes; pind++) 
+   {
+      p = factor_base[pind].p;
+      correction = (poly_add ? p - poly_corr[pind] : poly_corr[pind]);
+      soln1[pind] += correction;
+      if (soln1[pind] >= p) soln1[pind] -= p;
+      if (soln2[pind] == -1) continue;
+      soln2[pind] += correction;
+      if (soln2[pind] >= p) soln2[pind] -= p; 
+   }
+}  
+
+/*
+   Sieve with all 2^(s - 1) polynomials for a new A coeff, switching
+   between them in Gray code order. Returns the number of new relations
+   merged into the matrix, or -1 if no new A coeff could be found.
+*/
+long qsieve_collect_relations(qs_t qs_inf, qs_poly_t poly)
+{
+   long s = qs_inf->s;
+   mp_limb_t ** A_inv2B = poly->A_inv2B;
+   long target = qs_inf->num_primes + qs_inf->extra_rels;
+   mp_limb_t * poly_corr;
+   long relations = 0;
+   long poly_index, j;
+   int poly_add;
+   
+   if (!qsieve_compute_poly_data(qs_inf, poly))
+      return -1;
+   
+   for (poly_index = 1; ; poly_index++)
+   {
+      qsieve_do_sieving(qs_inf, poly);
+      
+      relations += qsieve_evaluate_sieve(qs_inf, poly);
+
+      if (poly->done)
+      {
+         pthread_mutex_lock(&qs_inf->mutex);
+
+         relations += qsieve_merge_relations(qs_inf);
+         poly->done = (qs_inf->columns >= target);
+
+         pthread_mutex_unlock(&qs_inf->mutex);
+
+         if (poly->done)
+            break;
+      }
+
+      if (poly_index == (1L<<(s - 1)))
+         break;
+      
+      for (j = 0; j < s; j++)
+         if (((poly_index >> j) & 1UL) != 0UL) break;
+      
+      poly_add = ((poly_index >> j) & 2);
+      
+      poly_corr = A_inv2B[j];
+      
+      qsieve_update_offsets(poly_add, poly_corr, qs_inf, poly);
+      
+      if (poly_add) 
+         fmpz_addmul_ui(poly->B, poly->B_terms + j, 2); 
+      else 
+         fmpz_submul_ui(poly->B, poly->B_terms + j, 2); 
+      
+      qsieve_compute_C(qs_inf, poly);          
+      
+      qsieve_compute_A_factor_offsets(qs_inf, poly);    
+   }
+   
+   return relations;
+}
@@ -0,0 +1,325 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2006, 2011 William Hart
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong /* avoid clash with stdlib */
+#include <stdlib.h>
+#include <stdio.h>
+#define ulong unsigned long
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz.h"
+
+/* 
+   Returns 1 if the factor base prime of index j may be used as the i-th 
+   factor of A, given the factors A_ind[0], ..., A_ind[i - 1] 
+*/
+static int qsieve_A_factor_ok(qs_t qs_inf, qs_poly_t poly, long j, long i)
+{
+   long l;
+
+   if (j < qs_inf->small_primes || j >= qs_inf->num_primes 
+                                || qs_inf->sqrts[j] == 0)
+      return 0;
+
+   for (l = 0; l < i; l++)
+      if (poly->A_ind[l] == j)
+         return 0;
+
+   return 1;
+}
+
+/*
+   Choose a new A coeff. The first s - 1 factors are chosen at random 
+   from the range of the factor base given by low and span, and the last
+   one is the factor base prime which brings A closest to target_A. 
+   A coeff is never used twice, and if no new one turns up the range is 
+   widened. Returns 0 if no new A coeff could be found. The A coeffs are
+   shared by all sieving threads, so this is done under the lock.
+*/
+int qsieve_compute_A(qs_t qs_inf, qs_poly_t poly)
+{
+   long s = qs_inf->s;
+   mp_limb_t * A_ind = poly->A_ind;
+   prime_t * factor_base = qs_inf->factor_base;
+   long num_primes = qs_inf->num_primes;
+   long i, j = 0, lo, hi, mid, tries;
+   mp_limb_t q, low_limb = 0;
+   fmpz_t temp;
+
+   fmpz_init(temp);
+
+   pthread_mutex_lock(&qs_inf->mutex);
+
+   for (tries = 0; ; tries++)
+   {
+      if (tries > 0 && (tries % 64) == 0) /* widen the range */
+      {
+         if (qs_inf->low > qs_inf->small_primes)
+         {
+            qs_inf->low--;
+            qs_inf->span++;
+         }
+
+         if (qs_inf->low + qs_inf->span < num_primes)
+            qs_inf->span++;
+         else if (tries > 100000)
+         {
+            pthread_mutex_unlock(&qs_inf->mutex);
+            fmpz_clear(temp);
+            return 0;
+         }
+      }
+
+      fmpz_one(poly->A);
+
+      for (i = 0; i < s - 1; i++)
+      {
+         do
+         {
+            j = qs_inf->low + n_randint(qs_inf->state, qs_inf->span);
+         } while (!qsieve_A_factor_ok(qs_inf, poly, j, i));
+
+         A_ind[i] = j;
+         fmpz_mul_ui(poly->A, poly->A, factor_base[j].p);
+      }
+
+      if (s == 1)
+      {
+         do
+         {
+            j = qs_inf->low + n_randint(qs_inf->state, qs_inf->span);
+         } while (!qsieve_A_factor_ok(qs_inf, poly, j, 0));
+      } else
+      {
+         /* find the factor base prime closest to target_A/A */
+         fmpz_tdiv_q(temp, qs_inf->target_A, poly->A);
+         q = fmpz_abs_fits_ui(temp) ? fmpz_get_ui(temp) : -1UL;
+
+         lo = qs_inf->small_primes;
+         hi = num_primes - 1;
+         while (lo < hi)
+         {
+            mid = (lo + hi)/2;
+            if (factor_base[mid].p < q)
+               lo = mid + 1;
+            else
+               hi = mid;
+         }
+
+         if (lo > qs_inf->small_primes 
+            && q - factor_base[lo - 1].p < factor_base[lo].p - q)
+            lo--;
+
+         /* nearest one which may be used */
+         for (mid = 0; mid < 2*num_primes; mid++)
+         {
+            j = lo + ((mid & 1) ? -(mid + 1)/2 : mid/2);
+            if (qsieve_A_factor_ok(qs_inf, poly, j, s - 1))
+               break;
+         }
+
+         if (mid == 2*num_primes)
+            continue;
+      }
+
+      A_ind[s - 1] = j;
+      fmpz_mul_ui(poly->A, poly->A, factor_base[j].p);
+
+      /* check that A is new */
+      low_limb = fmpz_fdiv_ui(poly->A, -1UL);
+      for (i = 0; i < qs_inf->num_A; i++)
+         if (qs_inf->A_used[i] == low_limb)
+            break;
+
+      if (i == qs_inf->num_A)
+         break;
+   }
+
+   if (qs_inf->num_A == qs_inf->alloc_A)
+   {
+      qs_inf->alloc_A *= 2;
+      qs_inf->A_used = flint_realloc(qs_inf->A_used, 
+                                     qs_inf->alloc_A*sizeof(mp_limb_t));
+   }
+   qs_inf->A_used[qs_inf->num_A++] = low_limb;
+
+   pthread_mutex_unlock(&qs_inf->mutex);
+
+   /* keep the factors sorted, as relations list their primes in order */
+   for (i = 1; i < s; i++)
+   {
+      mp_limb_t t = A_ind[i];
+      for (j = i; j > 0 && A_ind[j - 1] > t; j--)
+         A_ind[j] = A_ind[j - 1];
+      A_ind[j] = t;
+   }
+
+#if (QS_DEBUG & 2)
+   printf("A = "); fmpz_print(poly->A); 
+   printf(", target A = "); fmpz_print(qs_inf->target_A); printf("\n");
+#endif    
+
+   fmpz_clear(temp);
+
+   return 1;
+}
+
+void qsieve_compute_B_terms(qs_t qs_inf, qs_poly_t poly)
+{
+   long s = qs_inf->s;
+   mp_limb_t * A_ind = poly->A_ind;
+   mp_limb_t * A_modp = poly->A_modp;
+   fmpz * B_terms = poly->B_terms;
+   prime_t * factor_base = qs_inf->factor_base;
+   mp_limb_t p, temp2, pinv;
+   long i;
+   
+   fmpz_zero(poly->B);
+
+   for (i = 0; i < s; i++)
+   {
+      p = factor_base[A_ind[i]].p;
+      pinv = factor_base[A_ind[i]].pinv;
+      fmpz_divexact_ui(B_terms + i, poly->A, p);
+      A_modp[i] = (temp2 = fmpz_fdiv_ui(B_terms + i, p));
+      temp2 = n_invmod(temp2, p);
+      temp2 = n_mulmod2_preinv(temp2, qs_inf->sqrts[A_ind[i]], p, pinv);
+      if (temp2 > p/2) temp2 = p - temp2;
+      fmpz_mul_ui(B_terms + i, B_terms + i, temp2);
+      fmpz_add(poly->B, poly->B, B_terms + i);
+   }
+}
+
+void qsieve_compute_off_adj(qs_t qs_inf, qs_poly_t poly)
+{
+   long num_primes = qs_inf->num_primes;
+   mp_limb_t * A_inv = poly->A_inv;
+   mp_limb_t ** A_inv2B = poly->A_inv2B;
+   fmpz * B_terms = poly->B_terms;
+   mp_limb_t * soln1 = poly->soln1;
+   mp_limb_t * soln2 = poly->soln2;
+   int * sqrts = qs_inf->sqrts;
+   prime_t * factor_base = qs_inf->factor_base;
+   long s = qs_inf->s;
+   mp_limb_t p, temp, pinv, M;
+   long i, j;
+   
+   for (i = 2; i < num_primes; i++) /* skip -1 and 2 */
+   {
+      p = factor_base[i].p;
+      pinv = factor_base[i].pinv;
+      
+      temp = fmpz_fdiv_ui(poly->A, p);
+      if (temp == 0) /* p is a factor of A, see compute_A_factor_offsets */
+      {
+         A_inv[i] = 0;
+         for (j = 0; j < s; j++)
+            A_inv2B[j][i] = 0;
+         continue;
+      }
+
+      A_inv[i] = n_invmod(temp, p);
+             
+      for (j = 0; j < s; j++)
+      {
+         temp = fmpz_fdiv_ui(B_terms + j, p);
+         temp = n_mulmod2_preinv(temp, A_inv[i], p, pinv);
+         temp *= 2;
+         if (temp >= p) temp -= p;
+         A_inv2B[j][i] = temp;
+      }
+             
+      M = n_mod2_preinv(qs_inf->sieve_size/2, p, pinv);
+
+      temp = fmpz_fdiv_ui(poly->B, p);
+      temp = n_submod(sqrts[i], temp, p);
+      temp = n_mulmod2_preinv(temp, A_inv[i], p, pinv);
+      soln1[i] = n_addmod(temp, M, p);
+
+      temp = p - sqrts[i];
+      if (temp == p) temp -= p;
+      temp = n_mulmod2_preinv(temp, A_inv[i], p, pinv);
+      temp *= 2;
+      if (temp >= p) temp -= p;      
+      soln2[i] = temp + soln1[i];
+      if (soln2[i] >= p) soln2[i] -= p;
+   }  
+}
+
+void qsieve_compute_A_factor_offsets(qs_t qs_inf, qs_poly_t poly)
+{
+   long s = qs_inf->s;
+   mp_limb_t * A_ind = poly->A_ind;
+   mp_limb_t * soln1 = poly->soln1;
+   mp_limb_t * soln2 = poly->soln2;
+   prime_t * factor_base = qs_inf->factor_base;
+   mp_limb_t p, pinv, temp, temp2, index;
+   long j;
+   
+   /* 
+      for p dividing A the polynomial (Ax^2 + 2Bx + C) is linear mod p 
+      and has the single root -C/2B
+   */
+   for (j = 0; j < s; j++)
+   {
+      index = A_ind[j];
+      p = factor_base[index].p;
+      pinv = factor_base[index].pinv;
+
+      temp = fmpz_fdiv_ui(poly->B, p);
+      temp = n_addmod(temp, temp, p);
+      temp2 = n_invmod(temp, p);
+      temp = fmpz_fdiv_ui(poly->C, p);
+      temp = n_mulmod2_preinv(p - temp, temp2, p, pinv);
+      temp = n_addmod(temp, n_mod2_preinv(qs_inf->sieve_size/2, p, pinv), p);
+
+      soln1[index] = temp;
+      soln2[index] = -1;
+   }
+}          
+
+void qsieve_compute_C(qs_t qs_inf, qs_poly_t poly)
+{
+   fmpz_mul(poly->C, poly->B, poly->B);
+   fmpz_sub(poly->C, poly->C, qs_inf->kn);
+   fmpz_divexact(poly->C, poly->C, poly->A);
+} 
+
+int qsieve_compute_poly_data(qs_t qs_inf, qs_poly_t poly)
+{
+   if (!qsieve_compute_A(qs_inf, poly))
+      return 0;
+
+   qsieve_compute_B_terms(qs_inf, poly);
+   qsieve_compute_off_adj(qs_inf, poly);
+   qsieve_compute_C(qs_inf, poly);        
+   qsieve_compute_A_factor_offsets(qs_inf, poly);
+
+   return 1;
+}
@@ -0,0 +1,248 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2006, 2011 William Hart
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong /* avoid clash with stdlib */
+#include <stdio.h>
+#define ulong unsigned long 
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz.h"
+
+int qsieve_factor(fmpz_t factor, const fmpz_t n)
+{
+    qs_t qs_inf;
+    mp_limb_t small_factor;
+    long ncols, nrows, i, count;
+    uint64_t * nullrows;
+    uint64_t mask;
+    fmpz_t X, Y;
+    int found = 0;
+
+    /************************************************************************
+        INITIALISATION:
+          
+        Initialise the qs_t structure. 
+    ************************************************************************/
+#if QS_DEBUG
+    printf("\nStart:\n");
+#endif
+
+    qsieve_init(qs_inf, n);
+
+#if QS_DEBUG /* print some diagnostic information */
+    printf("Factoring "); fmpz_print(n); 
+    printf(" of %ld bits\n", qs_inf->bits);
+#endif
+
+    /************************************************************************
+        KNUTH SCHROEPPEL:
+        
+        Try to compute a multiplier k such that there are a lot of small primes
+        which are quadratic residues modulo kn. If a small factor of n is found
+        during this process it is returned.
+    ************************************************************************/
+#if QS_DEBUG
+    printf("\nKnuth-Schroeppel:\n");
+#endif
+
+    small_factor = qsieve_knuth_schroeppel(qs_inf); 
+    if (small_factor) 
+        goto small;
+
+    /* compute kn */
+    fmpz_mul_ui(qs_inf->kn, qs_inf->n, qs_inf->k);
+
+    /* refine qs_inf->bits */
+    qs_inf->bits = fmpz_bits(qs_inf->kn);
+
+    /************************************************************************
+        COMPUTE FACTOR BASE:
+        
+        Compute the factor base primes, the number of factors of the
+        A coeffs and the sieve parameters. If a small factor of n is found
+        during this process it is returned.
+    ************************************************************************/
+#if QS_DEBUG
+    printf("\nCompute factor base:\n");
+#endif
+
+    small_factor = qsieve_primes_init(qs_inf);
+    if (small_factor) 
+        goto small;
+    
+    /************************************************************************
+        INITIALISE RELATION/LINALG DATA:
+        
+        Create space for all the relations and matrix information
+    ************************************************************************/
+#if QS_DEBUG
+    printf("\nInitialise relations and linear algebra:\n");
+#endif
+
+    qsieve_linalg_init(qs_inf);
+
+    /************************************************************************
+        INITIALISE POLYNOMIAL DATA:
+        
+        Create space for all the polynomial information, for each of the
+        sieving threads. Without thread local storage the mpz cache is
+        shared, so only a single thread is used.
+    ************************************************************************/
+#if QS_DEBUG
+    printf("\nInitialise poly:\n");
+#endif
+
+    if (HAVE_TLS && qs_inf->bits >= QS_THREAD_CUTOFF)
+        qs_inf->num_handles = flint_get_num_threads();
+
+    qsieve_poly_init(qs_inf);
+
+    /************************************************************************
+        SIEVE:
+        
+        Sieve for relations
+    ************************************************************************/
+#if QS_DEBUG
+    printf("\nSieve:\n");
+#endif
+
+    if (!qsieve_find_relations(qs_inf)) /* we ran out of polynomials */
+        goto cleanup;
+
+    /************************************************************************
+        REDUCE MATRIX:
+        
+        Perform some light filtering on the matrix
+    ************************************************************************/
+
+    ncols = qs_inf->num_primes + qs_inf->extra_rels;
+    nrows = qs_inf->num_primes;
+
+#if QS_DEBUG
+    printf("Reduce matrix:\n");
+#endif
+
+    reduce_matrix(qs_inf, &nrows, &ncols, qs_inf->matrix); 
+ 
+    /************************************************************************
+        BLOCK LANCZOS:
+        
+        Find extra_rels nullspace vectors (if they exist)
+    ************************************************************************/
+
+#if QS_DEBUG
+    printf("Block lanczos:\n");
+#endif
+
+    do /* repeat block lanczos until it succeeds */
+    {
+        nullrows = block_lanczos(qs_inf->state, nrows, 0, ncols, qs_inf->matrix);
+    } while (nullrows == NULL); 
+        
+    for (i = 0, mask = 0; i < ncols; i++) /* create mask of nullspace vectors */
+        mask |= nullrows[i];
+
+#if QS_DEBUG
+    for (i = count = 0; i < 64; i++) /* count nullspace vectors found */
+    {
+        if (mask & ((uint64_t)(1) << i))
+            count++;
+    }
+
+    printf("%ld nullspace vectors found\n", count);
+#endif
+
+    /************************************************************************
+        SQUARE ROOT:
+        
+        Compute the square root and take the GCD of X-Y with N
+    ************************************************************************/
+
+#if QS_DEBUG
+    printf("Square root:\n");
+#endif
+	
+    fmpz_init(X);
+    fmpz_init(Y);
+
+    for (count = 0; count < 64; count++)
+    {
+        if (mask & ((uint64_t)(1) << count))
+        {
+            qsieve_square_root(X, Y, qs_inf, nullrows, ncols, count, qs_inf->n); 
+            fmpz_sub(X, X, Y);
+            fmpz_gcd(X, X, qs_inf->n);
+         
+            if (fmpz_cmp(X, qs_inf->n) != 0 && !fmpz_is_one(X)) /* have a factor */
+            {
+                fmpz_divexact(Y, qs_inf->n, X);
+                if (fmpz_cmp(Y, X) < 0) /* take smaller of two factors */
+                    fmpz_swap(X, Y);
+                fmpz_set(factor, X);
+                found = 1;
+                break;
+            }
+        }
+    }
+
+    fmpz_clear(X);
+    fmpz_clear(Y);
+    flint_free(nullrows);
+
+    /************************************************************************
+        CLEAN UP:
+        
+        Free all used memory
+    ************************************************************************/
+
+cleanup:
+
+#if QS_DEBUG
+    printf("\nClean up:\n");
+#endif
+
+    qsieve_clear(qs_inf);
+
+#if QS_DEBUG
+    printf("\nDone.\n");
+#endif
+
+    return found;
+
+small:
+
+#if QS_DEBUG
+    printf("Found small factor %ld\n", small_factor);
+#endif
+
+    fmpz_set_ui(factor, small_factor);
+    qsieve_clear(qs_inf);
+
+    return 1;
+}
@@ -0,0 +1,124 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong /* avoid clash with stdlib */
+#include <stdio.h>
+#include <pthread.h>
+#define ulong unsigned long 
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz.h"
+
+typedef struct
+{
+   qs_s * qs_inf;
+   qs_poly_s * poly;
+   int spawned; /* set if running in a thread of its own */
+} qsieve_find_relations_arg_t;
+
+/*
+   Collect relations with the polynomials of one A coeff after another,
+   until enough relations have been found by all threads together, or
+   the A coeffs run out. The mpz cache is thread local, so a thread 
+   spawned here has to empty its own cache before it exits.
+*/
+static void * 
+qsieve_find_relations_worker(void * arg_ptr)
+{
+   qsieve_find_relations_arg_t * arg = arg_ptr;
+   qs_s * qs_inf = arg->qs_inf;
+   qs_poly_s * poly = arg->poly;
+   int done;
+
+   while (1)
+   {
+      pthread_mutex_lock(&qs_inf->mutex);
+      done = qs_inf->failed 
+          || qs_inf->columns >= qs_inf->num_primes + qs_inf->extra_rels;
+      pthread_mutex_unlock(&qs_inf->mutex);
+
+      if (done)
+         break;
+
+      if (qsieve_collect_relations(qs_inf, poly) < 0)
+      {
+         pthread_mutex_lock(&qs_inf->mutex);
+         qs_inf->failed = 1;
+         pthread_mutex_unlock(&qs_inf->mutex);
+      }
+
+#if (QS_DEBUG & 128)
+      pthread_mutex_lock(&qs_inf->mutex);
+      printf("%ld/%ld relations, %ld partials, %ld combined.\n", 
+             qs_inf->columns, qs_inf->num_primes + qs_inf->extra_rels, 
+             qs_inf->num_partials, qs_inf->num_combined);
+      pthread_mutex_unlock(&qs_inf->mutex);
+#endif
+   }
+
+   if (arg->spawned)
+      _fmpz_cleanup();
+
+   return NULL;
+}
+
+int qsieve_find_relations(qs_t qs_inf)
+{
+   qsieve_find_relations_arg_t * args;
+   pthread_t * threads;
+   long j, k, num_threads = qs_inf->num_handles;
+
+   args = flint_malloc(num_threads*sizeof(qsieve_find_relations_arg_t));
+   threads = flint_malloc(num_threads*sizeof(pthread_t));
+
+   for (k = 0; k < num_threads; k++)
+   {
+      args[k].qs_inf = qs_inf;
+      args[k].poly = qs_inf->poly + k;
+      args[k].spawned = (k != 0);
+   }
+
+   /* 
+      every worker sieves until enough relations are found, so if a thread 
+      cannot be created the remaining workers simply take over its share
+   */
+   for (k = 1; k < num_threads; k++)
+      if (pthread_create(threads + k, NULL, 
+                         qsieve_find_relations_worker, args + k))
+         break;
+
+   qsieve_find_relations_worker(args);
+
+   for (j = 1; j < k; j++)
+      pthread_join(threads[j], NULL);
+
+   flint_free(threads);
+   flint_free(args);
+
+   return (qs_inf->columns >= qs_inf->num_primes + qs_inf->extra_rels);
+}
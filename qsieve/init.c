@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2006, 2011 William Hart
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
@@ -29,49 +30,59 @@
 #include "qsieve.h"
 #include "fmpz.h"
 
-void qsieve_ll_init(qs_t qs_inf, mp_limb_t hi, mp_limb_t lo)
+void qsieve_init(qs_t qs_inf, const fmpz_t n)
 {
     ulong i;
     
     /* store n in struct */
-    qs_inf->hi = hi;
-    qs_inf->lo = lo;
+    fmpz_init_set(qs_inf->n, n);
 
     /* determine the number of bits of n */
-    qs_inf->bits = (hi ? FLINT_BITS + FLINT_BIT_COUNT(hi) : FLINT_BIT_COUNT(lo));
+    qs_inf->bits = fmpz_bits(n);
 
     /* determine which index in the tuning table n corresponds to */
-    for (i = 1; i < QS_LL_TUNE_SIZE; i++)
+    for (i = 1; i < QS_TUNE_SIZE; i++)
     {
-        if (qsieve_ll_tune[i][0] > qs_inf->bits)
+        if (qsieve_tune[i][0] > qs_inf->bits)
             break;
     }
     i--;
     
-    qs_inf->ks_primes  = qsieve_ll_tune[i][1]; /* number of Knuth-Schroeppel primes */
-    qs_inf->num_primes = qsieve_ll_tune[i][2]; /* number of factor base primes */
+    qs_inf->ks_primes  = qsieve_tune[i][1]; /* number of Knuth-Schroeppel primes */
+    qs_inf->num_primes = qsieve_tune[i][2]; /* number of factor base primes */
 
     fmpz_init(qs_inf->kn); /* initialise kn */
-    fmpz_init(qs_inf->C); /* initialise C */
+
+    fmpz_init(qs_inf->target_A);
 
     qs_inf->factor_base = NULL;
     qs_inf->sqrts       = NULL;
-    qs_inf->B_terms     = NULL;
-    qs_inf->A_inv       = NULL;
-    qs_inf->A_inv2B     = NULL;
+    qs_inf->A_used      = NULL;
+    qs_inf->poly        = NULL;
 
-    qs_inf->small       = NULL;
-    qs_inf->factor      = NULL;
     qs_inf->matrix      = NULL;
     qs_inf->Y_arr       = NULL;
     qs_inf->relation    = NULL;
     qs_inf->qsort_arr   = NULL;
 
+    qs_inf->lp_table    = NULL;
+    qs_inf->lp_next     = NULL;
+    qs_inf->lp_prime    = NULL;
+    qs_inf->lp_Y        = NULL;
+    qs_inf->lp_off      = NULL;
+    qs_inf->lp_fac      = NULL;
+
     qs_inf->prime_count = NULL;
 
-    qs_inf->A = 0;
+    qs_inf->s = 0;
+    qs_inf->num_A = 0;
+    qs_inf->alloc_A = 0;
+    qs_inf->num_partials = 0;
+    qs_inf->alloc_partials = 0;
+    qs_inf->failed = 0;
+
+    qs_inf->num_handles = 1; /* sieve in a single thread by default */
+    pthread_mutex_init(&qs_inf->mutex, NULL);
 
-#if (QS_DEBUG & 16)
-    qs_inf->sieve_tally = flint_malloc(256*sizeof(long));
-#endif
+    flint_randinit(qs_inf->state);
 }
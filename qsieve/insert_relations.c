@@ -46,7 +46,7 @@
  
 ==========================================================================*/
 
-int qsieve_ll_relations_cmp(const void * a, const void * b)
+int qsieve_relations_cmp(const void * a, const void * b)
 {
   la_col_t * ra = *((la_col_t **) a);
   la_col_t * rb = *((la_col_t **) b);
@@ -69,7 +69,7 @@ int qsieve_ll_relations_cmp(const void * a, const void * b)
   return 0;
 }
 
-int qsieve_ll_relations_cmp2(const void * a, const void * b)
+int qsieve_relations_cmp2(const void * a, const void * b)
 {
   la_col_t * ra = (la_col_t *) a;
   la_col_t * rb = (la_col_t *) b;
@@ -101,7 +101,7 @@ int qsieve_ll_relations_cmp2(const void * a, const void * b)
    
 ===========================================================================*/
 
-long qsieve_ll_merge_sort(qs_t qs_inf)
+long qsieve_merge_sort(qs_t qs_inf)
 {
    la_col_t * matrix = qs_inf->matrix;
    long columns = qs_inf->columns;
@@ -116,7 +116,7 @@ long qsieve_ll_merge_sort(qs_t qs_inf)
       if (!columns) comp = -1;
       else if (!num_unmerged) comp = 1;
       else 
-         comp = qsieve_ll_relations_cmp2(matrix + columns - 1L, qsort_arr[num_unmerged - 1L]);
+         comp = qsieve_relations_cmp2(matrix + columns - 1L, qsort_arr[num_unmerged - 1L]);
       
       switch (comp)
       {
@@ -176,7 +176,7 @@ long qsieve_ll_merge_sort(qs_t qs_inf)
    
 ===========================================================================*/
 
-long qsieve_ll_merge_relations(qs_t qs_inf)
+long qsieve_merge_relations(qs_t qs_inf)
 {
    const long num_unmerged = qs_inf->num_unmerged;
    la_col_t * unmerged = qs_inf->unmerged;
@@ -189,9 +189,9 @@ long qsieve_ll_merge_relations(qs_t qs_inf)
       for (i = 0; i < num_unmerged; i++)
          qsort_arr[i] = unmerged + i;
       
-      qsort(qsort_arr, num_unmerged, sizeof(la_col_t *), qsieve_ll_relations_cmp);
+      qsort(qsort_arr, num_unmerged, sizeof(la_col_t *), qsieve_relations_cmp);
 
-      return qsieve_ll_merge_sort(qs_inf);
+      return qsieve_merge_sort(qs_inf);
    }
    
    return 0;
@@ -200,34 +200,22 @@ long qsieve_ll_merge_relations(qs_t qs_inf)
 /*==========================================================================
    Insert relation:
 
-   Function: Insert the relation into the matrix and store the Y value
+   Function: Insert the relation into the matrix and store the Y value.
+             The caller must hold the lock.
    
 ===========================================================================*/
 
-long qsieve_ll_insert_relation(qs_t qs_inf, fmpz_t Y)
+long qsieve_insert_relation(qs_t qs_inf, 
+                               fac_t * factor, long num_factors, fmpz_t Y)
 {
    la_col_t * unmerged = qs_inf->unmerged;
    long num_unmerged = qs_inf->num_unmerged;
-   long * small = qs_inf->small;
-   long num_factors = qs_inf->num_factors; 
-   fac_t * factor = qs_inf->factor; 
    long * curr_rel = qs_inf->curr_rel;
    long fac_num = 0; 
    long i;
 
    clear_col(unmerged + num_unmerged);
    
-   for (i = 0; i < qs_inf->small_primes; i++)
-   {
-       if (small[i] & 1) insert_col_entry(unmerged + num_unmerged, i);
-       if (small[i]) 
-       {
-          curr_rel[2*fac_num + 1] = i;
-          curr_rel[2*fac_num + 2] = small[i];
-          fac_num++;
-       }
-   }
-   
    for (i = 0; i < num_factors; i++)
    {
        if (factor[i].exp & 1) insert_col_entry(unmerged + num_unmerged, factor[i].ind);
@@ -247,7 +235,7 @@ long qsieve_ll_insert_relation(qs_t qs_inf, fmpz_t Y)
    qs_inf->num_relations++;
    
    if (qs_inf->num_unmerged == qs_inf->qsort_rels)
-      return qsieve_ll_merge_relations(qs_inf);
+      return qsieve_merge_relations(qs_inf);
    
    return 0;
 }
@@ -0,0 +1,174 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong /* avoid clash with stdlib */
+#include <stdlib.h>
+#include <stdio.h>
+#define ulong unsigned long 
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+/*
+   Store the partial relation with the given factors and large prime L.
+*/
+static void qsieve_store_partial(qs_t qs_inf, fac_t * factor, 
+                     long num_factors, mp_limb_t L, fmpz_t Y, long hash)
+{
+   long idx = qs_inf->num_partials;
+   int * fac;
+   long i;
+
+   if (idx == qs_inf->alloc_partials)
+   {
+      long alloc = 2*qs_inf->alloc_partials;
+
+      qs_inf->lp_next = flint_realloc(qs_inf->lp_next, alloc*sizeof(long));
+      qs_inf->lp_prime = flint_realloc(qs_inf->lp_prime, alloc*sizeof(mp_limb_t));
+      qs_inf->lp_off = flint_realloc(qs_inf->lp_off, alloc*sizeof(long));
+      qs_inf->lp_Y = flint_realloc(qs_inf->lp_Y, alloc*sizeof(fmpz));
+      for (i = qs_inf->alloc_partials; i < alloc; i++)
+         fmpz_init(qs_inf->lp_Y + i);
+
+      qs_inf->alloc_partials = alloc;
+   }
+
+   if (qs_inf->lp_fac_len + 2*num_factors + 1 > qs_inf->lp_fac_alloc)
+   {
+      qs_inf->lp_fac_alloc = 2*qs_inf->lp_fac_alloc + 2*num_factors + 1;
+      qs_inf->lp_fac = flint_realloc(qs_inf->lp_fac, 
+                                     qs_inf->lp_fac_alloc*sizeof(int));
+   }
+
+   qs_inf->lp_prime[idx] = L;
+   fmpz_set(qs_inf->lp_Y + idx, Y);
+   qs_inf->lp_off[idx] = qs_inf->lp_fac_len;
+
+   fac = qs_inf->lp_fac + qs_inf->lp_fac_len;
+   fac[0] = num_factors;
+   for (i = 0; i < num_factors; i++)
+   {
+      fac[2*i + 1] = factor[i].ind;
+      fac[2*i + 2] = factor[i].exp;
+   }
+   qs_inf->lp_fac_len += 2*num_factors + 1;
+
+   qs_inf->lp_next[idx] = qs_inf->lp_table[hash];
+   qs_inf->lp_table[hash] = idx;
+   qs_inf->num_partials++;
+}
+
+/*
+   Combine the partial relation with the given factors and Y with the 
+   stored partial relation idx having the same large prime L, and insert
+   the result as a full relation. Returns the number of relations merged
+   into the matrix.
+*/
+static long qsieve_combine_partials(qs_t qs_inf, fac_t * factor, 
+                     long num_factors, mp_limb_t L, fmpz_t Y, long idx)
+{
+   int * fac = qs_inf->lp_fac + qs_inf->lp_off[idx];
+   long len = fac[0];
+   fac_t * merged;
+   long i, j, k, rels = 0;
+   fmpz_t Y2, t;
+
+   merged = flint_malloc((num_factors + len)*sizeof(fac_t));
+
+   /* both lists of factors are sorted by index */
+   for (i = j = k = 0; i < num_factors || j < len; k++)
+   {
+      if (j == len || (i < num_factors && factor[i].ind < fac[2*j + 1]))
+      {
+         merged[k] = factor[i++];
+      } else if (i == num_factors || fac[2*j + 1] < factor[i].ind)
+      {
+         merged[k].ind = fac[2*j + 1];
+         merged[k].exp = fac[2*j + 2];
+         j++;
+      } else
+      {
+         merged[k].ind = factor[i].ind;
+         merged[k].exp = factor[i++].exp + fac[2*j + 2];
+         j++;
+      }
+   }
+
+   if (k < qs_inf->max_factors) /* the relation fits */
+   {
+      fmpz_init(Y2);
+      fmpz_init_set_ui(t, L);
+
+      /* Y = Y1*Y2/L, the large prime appears squared on the other side */
+      if (fmpz_invmod(t, t, qs_inf->n)) 
+      {
+         fmpz_mul(Y2, Y, qs_inf->lp_Y + idx);
+         fmpz_mul(Y2, Y2, t);
+         fmpz_mod(Y2, Y2, qs_inf->n);
+
+         qs_inf->num_combined++;
+
+         rels = qsieve_insert_relation(qs_inf, merged, k, Y2);
+      }
+
+      fmpz_clear(Y2);
+      fmpz_clear(t);
+   }
+
+   flint_free(merged);
+
+   return rels;
+}
+
+/*
+   The caller must hold the lock.
+*/
+long qsieve_add_partial(qs_t qs_inf, 
+                fac_t * factor, long num_factors, mp_limb_t L, fmpz_t Y)
+{
+   long hash = (L >> 1) & (qs_inf->lp_table_size - 1);
+   long idx;
+
+   for (idx = qs_inf->lp_table[hash]; idx != -1; idx = qs_inf->lp_next[idx])
+   {
+      if (qs_inf->lp_prime[idx] == L)
+         break;
+   }
+
+   if (idx == -1) /* first partial with this large prime */
+   {
+      qsieve_store_partial(qs_inf, factor, num_factors, L, Y, hash);
+      return 0;
+   }
+
+   if (fmpz_cmpabs(Y, qs_inf->lp_Y + idx) == 0) /* duplicate */
+      return 0;
+
+   return qsieve_combine_partials(qs_inf, factor, num_factors, L, Y, idx);
+}
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2006, 2011 William Hart
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
@@ -28,29 +29,27 @@
 #include "ulong_extras.h"
 #include "qsieve.h"
 #include "fmpz.h"
+#include "fmpz_vec.h"
 
-void qsieve_ll_linalg_init(qs_t qs_inf)
+void qsieve_linalg_init(qs_t qs_inf)
 {
     long i;
     
     qs_inf->extra_rels = 64; /* number of opportunities to factor n */
-    qs_inf->max_factors = 30; /* maximum number of factors a relation can have */
+    qs_inf->max_factors = 60; /* maximum number of factors a relation can have */
 
-    /* allow as many dups as relations */
-    qs_inf->buffer_size = 2*(qs_inf->num_primes + qs_inf->extra_rels + qs_inf->qsort_rels);
+    /* allow for duplicates */
+    qs_inf->buffer_size = 3*(qs_inf->num_primes + qs_inf->extra_rels + qs_inf->qsort_rels)/2;
 
-    qs_inf->small = flint_malloc(qs_inf->small_primes*sizeof(mp_limb_t));
-    qs_inf->factor = flint_malloc(qs_inf->max_factors*sizeof(fac_t));
     qs_inf->matrix = flint_malloc((qs_inf->buffer_size + qs_inf->qsort_rels)*sizeof(la_col_t));
     qs_inf->unmerged = qs_inf->matrix + qs_inf->buffer_size;
-    qs_inf->Y_arr = flint_malloc(qs_inf->buffer_size*sizeof(fmpz));
+    qs_inf->Y_arr = _fmpz_vec_init(qs_inf->buffer_size);
     qs_inf->curr_rel = qs_inf->relation
                      = flint_malloc(2*qs_inf->buffer_size*qs_inf->max_factors*sizeof(long));
     qs_inf->qsort_arr = flint_malloc(qs_inf->qsort_rels*sizeof(la_col_t *));
 
     for (i = 0; i < qs_inf->buffer_size; i++)
     {
-        fmpz_init(qs_inf->Y_arr + i);
         qs_inf->matrix[i].weight = 0;
         qs_inf->matrix[i].data = NULL;
     }
@@ -66,4 +65,26 @@ void qsieve_ll_linalg_init(qs_t qs_inf)
     qs_inf->num_unmerged = 0;
     qs_inf->columns = 0;
     qs_inf->num_relations = 0;
+
+    /* partial relations, hashed by their large prime */
+    for (qs_inf->lp_table_size = 1024; 
+         qs_inf->lp_table_size < 4*qs_inf->num_primes; )
+        qs_inf->lp_table_size *= 2;
+
+    qs_inf->lp_table = flint_malloc(qs_inf->lp_table_size*sizeof(long));
+    for (i = 0; i < qs_inf->lp_table_size; i++)
+        qs_inf->lp_table[i] = -1;
+
+    qs_inf->alloc_partials = 1024;
+    qs_inf->lp_next = flint_malloc(qs_inf->alloc_partials*sizeof(long));
+    qs_inf->lp_prime = flint_malloc(qs_inf->alloc_partials*sizeof(mp_limb_t));
+    qs_inf->lp_off = flint_malloc(qs_inf->alloc_partials*sizeof(long));
+    qs_inf->lp_Y = _fmpz_vec_init(qs_inf->alloc_partials);
+
+    qs_inf->lp_fac_alloc = 32*qs_inf->alloc_partials;
+    qs_inf->lp_fac = flint_malloc(qs_inf->lp_fac_alloc*sizeof(int));
+    qs_inf->lp_fac_len = 0;
+
+    qs_inf->num_partials = 0;
+    qs_inf->num_combined = 0;
 }
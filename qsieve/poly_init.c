@@ -0,0 +1,77 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2006, 2011 William Hart
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+#include "fmpz_vec.h"
+
+void qsieve_poly_init(qs_t qs_inf)
+{
+   ulong num_primes = qs_inf->num_primes;
+   ulong s = qs_inf->s; /* number of prime factors in A coeff */
+   long i, k; 
+   
+   qs_inf->poly = flint_malloc(qs_inf->num_handles*sizeof(qs_poly_s));
+
+   for (k = 0; k < qs_inf->num_handles; k++)
+   {
+      qs_poly_s * poly = qs_inf->poly + k;
+
+      fmpz_init(poly->A);
+      fmpz_init(poly->B);
+      fmpz_init(poly->C);
+
+      poly->B_terms = _fmpz_vec_init(s);
+
+      poly->A_ind = flint_malloc(2*s*sizeof(mp_limb_t));
+      poly->A_modp = poly->A_ind + s;  
+
+      poly->A_inv = flint_malloc(3*num_primes*sizeof(mp_limb_t));  
+      poly->soln1 = poly->A_inv + num_primes; 
+      poly->soln2 = poly->soln1 + num_primes; 
+   
+      poly->A_inv2B = flint_malloc(s*sizeof(mp_limb_t *));
+      poly->A_inv2B[0] = flint_malloc(num_primes*s*sizeof(mp_limb_t));
+      for (i = 1; i < s; i++)
+         poly->A_inv2B[i] = poly->A_inv2B[i - 1] + num_primes;
+
+      poly->sieve = flint_malloc(qs_inf->sieve_size + sizeof(ulong));
+
+      poly->factor = flint_malloc(qs_inf->max_factors*sizeof(fac_t));
+      poly->num_factors = 0;
+      poly->done = 0;
+
+#if (QS_DEBUG & 16)
+      poly->sieve_tally = flint_malloc(256*sizeof(long));
+#endif
+   }
+
+   qs_inf->alloc_A = 64;
+   qs_inf->A_used = flint_malloc(qs_inf->alloc_A*sizeof(mp_limb_t));
+   qs_inf->num_A = 0;
+}
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2006, 2011 William Hart
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
@@ -27,6 +28,7 @@
 #include "flint.h"
 #include "ulong_extras.h"
 #include "qsieve.h"
+#include "fmpz.h"
 
 prime_t * compute_factor_base(mp_limb_t * small_factor, qs_t qs_inf, long num_primes)
 {
@@ -56,7 +58,6 @@ prime_t * compute_factor_base(mp_limb_t * small_factor, qs_t qs_inf, long num_pr
 
     qs_inf->num_primes = num_primes;
 
-    /* compute the two limbs of kn */
     if (num == 0)
     {
         p = 2;
@@ -64,11 +65,11 @@ prime_t * compute_factor_base(mp_limb_t * small_factor, qs_t qs_inf, long num_pr
     } else
         p = factor_base[num - 1].p;
 
-    for (fb_prime = num; fb_prime < num_primes; ) /* leave space for k and 2 */
+    for (fb_prime = num; fb_prime < num_primes; ) /* leave space for -1 and 2 */
     {
         p = n_nextprime(p, 0);
         pinv = n_preinvert_limb(p);
-        nmod = n_ll_mod_preinv(qs_inf->hi, qs_inf->lo, p, pinv); /* n mod p */
+        nmod = fmpz_fdiv_ui(qs_inf->n, p); /* n mod p */
         if (nmod == 0) 
         {
             *small_factor = p;
@@ -76,8 +77,15 @@ prime_t * compute_factor_base(mp_limb_t * small_factor, qs_t qs_inf, long num_pr
         }
         
         nmod2 = n_mulmod2_preinv(nmod, k, p, pinv); /* kn mod p */
-        if (nmod2 == 0) /* don't sieve with factors of multiplier */
+        if (nmod2 == 0) /* p divides the multiplier, kn has a single root */
+        {
+            factor_base[fb_prime].p = p;
+            factor_base[fb_prime].pinv = pinv;
+            factor_base[fb_prime].size = FLINT_BIT_COUNT(p);
+            sqrts[fb_prime] = 0;
+            fb_prime++;
             continue;
+        }
         
         nmod = nmod2; /* save nmod2 */
 
@@ -103,95 +111,129 @@ prime_t * compute_factor_base(mp_limb_t * small_factor, qs_t qs_inf, long num_pr
     return factor_base;
 }
 
-mp_limb_t qsieve_ll_primes_init(qs_t qs_inf)
+mp_limb_t qsieve_primes_init(qs_t qs_inf)
 {
     long num_primes;
-    long i, s, min, fact, span;
-    mp_limb_t fact_approx;
+    long i, s, fact, span, low;
+    mp_limb_t fact_approx, pmax;
     fmpz_t temp;
-    mp_limb_t k = qs_inf->k;
     mp_limb_t small_factor = 0;
+    long qbits;
 
     prime_t * factor_base;
     
-    /* determine which index in the tuning table n corresponds to */
-    for (i = 1; i < QS_LL_TUNE_SIZE; i++)
+    /* determine which index in the tuning table kn corresponds to */
+    for (i = 1; i < QS_TUNE_SIZE; i++)
     {
-        if (qsieve_ll_tune[i][0] > qs_inf->bits)
+        if (qsieve_tune[i][0] > qs_inf->bits)
             break;
     }
     i--;
     
-    qs_inf->sieve_bits = 32; /* number of bits to exceed in evaluate_sieve */
-    qs_inf->sieve_size = qsieve_ll_tune[i][4]; /* size of sieve to use */
-    qs_inf->small_primes = qsieve_ll_tune[i][3]; /* number of primes to not sieve with */
-    num_primes = qsieve_ll_tune[i][2]; /* number of factor base primes */
-    qs_inf->qsort_rels = qsieve_ll_tune[i][1]; /* number of relations to accumulate before sorting */
+    qs_inf->sieve_size = qsieve_tune[i][4]; /* size of sieve to use */
+    qs_inf->small_primes = qsieve_tune[i][3]; /* number of primes to not sieve with */
+    num_primes = qsieve_tune[i][2]; /* number of factor base primes */
+    qs_inf->qsort_rels = qsieve_tune[i][1]; /* number of relations to accumulate before sorting */
     
     qs_inf->num_primes = 0; /* start with 0 primes */
     factor_base = compute_factor_base(&small_factor, qs_inf, num_primes); /* build up FB */
     if (small_factor)
         return small_factor;
 
-    /* figure out the number of factors of A and min, fact and span */
-    s = qs_inf->bits/28 + 1; /* number of prime factors in A coeff */
-   
+    /* 
+       A should be about sqrt(2kn)/M where M is half the sieve size, so 
+       that the values of the polynomials are as small as possible
+    */
     fmpz_init(temp);
     
     fmpz_mul_2exp(temp, qs_inf->kn, 1);
     fmpz_sqrt(temp, temp);
-    fmpz_tdiv_q_ui(temp, temp, qs_inf->sieve_size);
-    qs_inf->target_A = 2*fmpz_get_ui(temp);
-   
-    fmpz_root(temp, temp, s);
-    fact_approx = fmpz_get_ui(temp);
-   
-    fmpz_clear(temp);
+    fmpz_tdiv_q_ui(qs_inf->target_A, temp, qs_inf->sieve_size/2);
+    if (fmpz_is_zero(qs_inf->target_A))
+        fmpz_one(qs_inf->target_A);
+
+    /* 
+       figure out the number of factors of A, preferring factors of about
+       QS_A_PRIME_BITS bits, and the range of the factor base they are 
+       drawn from; if the factor base is too small for this, it is 
+       enlarged
+    */
+    s = (fmpz_bits(qs_inf->target_A) + QS_A_PRIME_BITS/2)/QS_A_PRIME_BITS;
+    if (s < 1) s = 1;
 
-    fact = 2; 
-    while (fact_approx >= factor_base[fact].p)
-        fact++;
-   
     while (1)
     {
-        span = num_primes/s/s/2;
-        if (span < 6*s) span = 6*s; /* make sure we have plenty of primes to choose from */
+        fmpz_root(temp, qs_inf->target_A, s);
+        fact_approx = fmpz_get_ui(temp);
 
-        min = fact - span/2;
-        if (min < qs_inf->small_primes) 
-            min = qs_inf->small_primes;
+        fact = qs_inf->small_primes; 
+        while (fact < num_primes && fact_approx > factor_base[fact].p)
+            fact++;
 
-        fact = min + span/2;
-        if (min + span <= num_primes - 2) /* we have enough primes */
+        span = 8*s + 16; /* make sure we have plenty of primes to choose from */
+        low = fact - span/2;
+        if (low < qs_inf->small_primes) 
+            low = qs_inf->small_primes;
+
+        if (low + span + 1 < num_primes) /* we have enough primes */
             break;
 
-        num_primes = (long) (1.1 * (double) num_primes);
+        if (num_primes > 8*qsieve_tune[i][2]) /* factors would be too large */
+        {
+            s++;
+            continue;
+        }
+
+        num_primes = (long) (1.1 * (double) num_primes) + 1;
         factor_base = compute_factor_base(&small_factor, qs_inf, num_primes); /* increase size of FB */
         if (small_factor)
+        {
+            fmpz_clear(temp);
             return small_factor;
+        }
     }
    
+    fmpz_clear(temp);
+
     qs_inf->s = s;
-    qs_inf->min = min;
-    qs_inf->fact = fact;
+    qs_inf->low = low;
     qs_inf->span = span;
 
-    /* these are used for the range of the middle factor of A when s is odd */
-    qs_inf->mid = qs_inf->min + ((s - 1) * qs_inf->span)/(2 * s);
-    qs_inf->high = qs_inf->mid + qs_inf->span / s;
+    /* consider -1 and 2 as factor base primes */
+    factor_base[0].p = 1;
+    factor_base[0].pinv = 0;
+    factor_base[0].size = 0;
+    factor_base[1].p = 2;
+    factor_base[1].pinv = n_preinvert_limb(2);
+    factor_base[1].size = 2;
+
+    /*
+       The largest value of the polynomials is about M*sqrt(kn/2). Sieve 
+       entries qualify for trial division if the sieved primes account
+       for all of it except possibly a large prime.
+    */
+    pmax = factor_base[num_primes - 1].p;
+    qs_inf->large_prime = pmax*FLINT_MIN(QS_LARGE_PRIME_MULT, pmax);
+
+    qbits = (qs_inf->bits + 1)/2 + FLINT_BIT_COUNT(qs_inf->sieve_size/2) - 1;
+    qbits -= FLINT_BIT_COUNT(qs_inf->large_prime) + 2;
+
+    /* 
+       for larger n trial division is cheap relative to sieving, so the 
+       threshold is lowered to let through more partial relations
+    */
+    if (qs_inf->bits > 140)
+       qbits -= (qs_inf->bits - 140)/5;
+
+    qs_inf->sieve_bits = FLINT_MAX(qbits, 10);
    
 #if (QS_DEBUG & 2)
     printf("Using %ld factor base primes\n", qs_inf->num_primes);
-    printf("min = FB[%ld], span = %ld, number of A factors = %ld, target A = %ld\n", 
-           min, span, s, qs_inf->target_A);
+    printf("low = FB[%ld], span = %ld, number of A factors = %ld, target A = ", 
+           low, span, s);
+    fmpz_print(qs_inf->target_A);
+    printf("\n");
 #endif
    
-    /* consider k and 2 as factor base primes */
-    factor_base[0].p = k;
-    factor_base[0].pinv = n_preinvert_limb(k);
-    factor_base[0].size = FLINT_BIT_COUNT(k);
-    factor_base[1].p = 2;
-    factor_base[0].size = 2;
-
     return 0;
 }
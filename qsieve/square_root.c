@@ -35,7 +35,7 @@
 #include "qsieve.h"
 #include "fmpz.h"
 
-void qsieve_ll_square_root(fmpz_t X, fmpz_t Y, qs_t qs_inf, 
+void qsieve_square_root(fmpz_t X, fmpz_t Y, qs_t qs_inf, 
    uint64_t * nullrows, long ncols, long l, fmpz_t N)
 {
    long position, i, j;
@@ -0,0 +1,139 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "qsieve.h"
+
+/* random prime of the given number of bits */
+static void _randprime(fmpz_t p, flint_rand_t state, mp_bitcnt_t bits)
+{
+   do
+   {
+      fmpz_randbits(p, state, bits);
+      fmpz_abs(p, p);
+   } while (fmpz_bits(p) < bits || !fmpz_is_probabprime(p));
+}
+
+int main(void)
+{
+   int i, result;
+   flint_rand_t state;
+   fmpz_t n, p, q, f;
+
+   printf("factor....");
+   fflush(stdout);
+ 
+   flint_randinit(state);
+
+   fmpz_init(n);
+   fmpz_init(p);
+   fmpz_init(q);
+   fmpz_init(f);
+
+   for (i = 0; i < 30; i++) /* Test semiprimes of up to 45 digits */
+   {
+      mp_bitcnt_t bits = n_randint(state, 120) + 30;
+
+      _randprime(p, state, bits/2);
+      do {
+         _randprime(q, state, bits - bits/2);
+      } while (fmpz_equal(p, q));
+
+      fmpz_mul(n, p, q);
+
+      result = qsieve_factor(f, n) && (fmpz_equal(f, p) || fmpz_equal(f, q));
+      if (!result)
+      {
+          printf("FAIL:\n");
+          fmpz_print(n); printf(" = "); fmpz_print(p); printf(" * ");
+          fmpz_print(q); printf("\n");
+          printf("f = "); fmpz_print(f); printf("\n");
+          abort();
+      }
+   }
+
+   for (i = 0; i < 30; i++) /* Test numbers with more than two factors */
+   {
+      mp_bitcnt_t bits = n_randint(state, 30) + 15;
+
+      _randprime(p, state, bits);
+      _randprime(q, state, bits + 1);
+      fmpz_mul(n, p, q);
+      _randprime(p, state, bits + 2);
+      fmpz_mul(n, n, p);
+
+      result = qsieve_factor(f, n) && !fmpz_is_one(f) 
+            && !fmpz_equal(f, n) && fmpz_divisible(n, f);
+      if (!result)
+      {
+          printf("FAIL:\n");
+          fmpz_print(n); printf("\n");
+          printf("f = "); fmpz_print(f); printf("\n");
+          abort();
+      }
+   }
+
+   for (i = 0; i < 3; i++) /* Test sieving with several threads */
+   {
+      mp_bitcnt_t bits = n_randint(state, 20) + QS_THREAD_CUTOFF;
+
+      _randprime(p, state, bits/2);
+      do {
+         _randprime(q, state, bits - bits/2);
+      } while (fmpz_equal(p, q));
+
+      fmpz_mul(n, p, q);
+
+      flint_set_num_threads(n_randint(state, 3) + 2);
+
+      result = qsieve_factor(f, n) && (fmpz_equal(f, p) || fmpz_equal(f, q));
+      if (!result)
+      {
+          printf("FAIL (threads):\n");
+          fmpz_print(n); printf(" = "); fmpz_print(p); printf(" * ");
+          fmpz_print(q); printf("\n");
+          printf("f = "); fmpz_print(f); printf("\n");
+          printf("num_threads = %d\n", flint_get_num_threads());
+          abort();
+      }
+
+      flint_set_num_threads(1);
+   }
+
+   fmpz_clear(n);
+   fmpz_clear(p);
+   fmpz_clear(q);
+   fmpz_clear(f);
+   
+   flint_randclear(state);
+   _fmpz_cleanup();
+   printf("PASS\n");
+   return 0;
+}
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2009, 2011 William Hart
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
@@ -28,39 +29,47 @@
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
+#include "fmpz.h"
 #include "qsieve.h"
 
 int main(void)
 {
    int i;
    flint_rand_t state;
+   fmpz_t n;
    
-   printf("ll_knuth_schroeppel....");
+   printf("knuth_schroeppel....");
    fflush(stdout);
  
    flint_randinit(state);
+   fmpz_init(n);
 
    for (i = 0; i < 10000; i++) /* Test random n */
    {
-      mp_limb_t hi = 0, lo;
       qs_t qs_inf;
-      mp_bitcnt_t bits;
+      mp_limb_t factor;
       
-      bits = n_randint(state, 2*FLINT_BITS) + 1;
-      if (bits > FLINT_BITS)
-      {
-          lo = n_randlimb(state);
-          hi = n_randbits(state, bits - FLINT_BITS);
-      } else
-          lo = n_randbits(state, bits);
+      fmpz_randtest_unsigned(n, state, n_randint(state, 400) + 1);
+      if (fmpz_is_zero(n))
+         fmpz_one(n);
+      
+      qsieve_init(qs_inf, n);
+      factor = qsieve_knuth_schroeppel(qs_inf);
       
-      qsieve_ll_init(qs_inf, hi, lo);
-      qsieve_ll_knuth_schroeppel(qs_inf);
-      qsieve_ll_clear(qs_inf);
+      if (factor != 0 && (factor == 1 || fmpz_fdiv_ui(n, factor) != 0))
+      {
+         printf("FAIL:\n");
+         printf("%lu is not a factor of ", factor); fmpz_print(n); printf("\n");
+         abort();
+      }
+
+      qsieve_clear(qs_inf);
    }
    
+   fmpz_clear(n);
    flint_randclear(state);
 
+   _fmpz_cleanup();
    printf("PASS\n");
    return 0;
 }
@@ -0,0 +1,150 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+
+static long num_allocs = 0;
+static long num_frees = 0;
+
+void * counting_malloc(size_t size)
+{
+    num_allocs++;
+    return malloc(size);
+}
+
+void * counting_calloc(size_t num, size_t size)
+{
+    num_allocs++;
+    return calloc(num, size);
+}
+
+void * counting_realloc(void * ptr, size_t size)
+{
+    if (ptr == NULL)
+        num_allocs++;
+    return realloc(ptr, size);
+}
+
+void counting_free(void * ptr)
+{
+    if (ptr != NULL)
+        num_frees++;
+    free(ptr);
+}
+
+int main(void)
+{
+    int i, result;
+    void * (*alloc_func)(size_t);
+    void * (*calloc_func)(size_t, size_t);
+    void * (*realloc_func)(void *, size_t);
+    void (*free_func)(void *);
+    flint_rand_t state;
+
+    /* must come before anything else allocates */
+    __flint_set_memory_functions(counting_malloc, counting_calloc,
+                                 counting_realloc, counting_free);
+
+    flint_randinit(state);
+
+    printf("memory_functions....");
+    fflush(stdout);
+
+    __flint_get_memory_functions(&alloc_func, &calloc_func,
+                                 &realloc_func, &free_func);
+
+    result = (alloc_func == counting_malloc && calloc_func == counting_calloc
+           && realloc_func == counting_realloc && free_func == counting_free);
+    if (!result)
+    {
+        printf("FAIL:\n");
+        printf("__flint_get_memory_functions\n");
+        abort();
+    }
+
+    /* GMP allocates through the same functions */
+    {
+        mpz_t x;
+        long before = num_allocs;
+
+        mpz_init_set_ui(x, 1);
+        mpz_mul_2exp(x, x, 10000);
+
+        result = (num_allocs > before);
+        mpz_clear(x);
+
+        if (!result || num_allocs != num_frees)
+        {
+            printf("FAIL:\n");
+            printf("mpz_t: %ld allocs, %ld frees\n", num_allocs, num_frees);
+            abort();
+        }
+    }
+
+    /* so do large fmpz's and temporary space, and all of it is returned */
+    for (i = 0; i < 100; i++)
+    {
+        fmpz_t a, b, c;
+        mp_limb_t * t;
+        TMP_INIT;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_init(c);
+
+        fmpz_randtest(a, state, 2000);
+        fmpz_randtest(b, state, 2000);
+        fmpz_mul(c, a, b);
+        fmpz_mul(c, c, c);
+
+        TMP_START;
+        t = TMP_ALLOC(n_randint(state, 100000) + 1);
+        t[0] = 0;
+        TMP_END;
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_clear(c);
+    }
+
+    _fmpz_cleanup();
+    flint_tmp_cleanup();
+    flint_randclear(state);
+
+    if (num_allocs == 0 || num_allocs != num_frees)
+    {
+        printf("FAIL:\n");
+        printf("%ld allocs, %ld frees\n", num_allocs, num_frees);
+        abort();
+    }
+
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,198 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#undef ulong /* prevent clash with standard library */
+#include <pthread.h>
+#define ulong unsigned long
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   fills nested scopes with random sizes, up to depth levels deep, and 
+   checks that no allocation is overwritten by a later one
+*/
+int check_scope(flint_rand_t state, int depth)
+{
+    mp_limb_t * ptr[10];
+    ulong size[10];
+    long i, j, num;
+    int result = 1;
+    TMP_INIT;
+
+    TMP_START;
+
+    num = n_randint(state, 10) + 1;
+
+    for (i = 0; i < num; i++)
+    {
+        if (n_randint(state, 10) == 0)
+            size[i] = n_randint(state, 20000) + 1;
+        else
+            size[i] = n_randint(state, 100) + 1;
+
+        ptr[i] = TMP_ALLOC(size[i] * sizeof(mp_limb_t));
+
+        if ((ulong) ptr[i] % (2 * sizeof(mp_limb_t)) != 0)
+            result = 0;
+
+        for (j = 0; j < size[i]; j++)
+            ptr[i][j] = depth + i + j;
+
+        if (depth > 0 && n_randint(state, 2))
+            result &= check_scope(state, depth - 1);
+    }
+
+    for (i = 0; i < num; i++)
+        for (j = 0; j < size[i]; j++)
+            if (ptr[i][j] != depth + i + j)
+                result = 0;
+
+    TMP_END;
+
+    return result;
+}
+
+long live_blocks = 0;
+
+void * count_malloc(size_t size)
+{
+    live_blocks++;
+    return malloc(size);
+}
+
+void * count_calloc(size_t num, size_t size)
+{
+    live_blocks++;
+    return calloc(num, size);
+}
+
+void * count_realloc(void * ptr, size_t size)
+{
+    if (ptr == NULL)
+        live_blocks++;
+    return realloc(ptr, size);
+}
+
+void count_free(void * ptr)
+{
+    if (ptr != NULL)
+        live_blocks--;
+    free(ptr);
+}
+
+void * worker(void * arg)
+{
+    flint_rand_t state;
+    long i;
+    int * result = arg;
+
+    flint_randinit(state);
+    for (i = 0; i < 200; i++)
+        *result &= check_scope(state, 3);
+    flint_randclear(state);
+
+    return NULL;
+}
+
+int main(void)
+{
+    int i, result;
+    pthread_t threads[3];
+    int res[3];
+    flint_rand_t state;
+    flint_randinit(state);
+
+    printf("tmp_alloc....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000; i++)
+    {
+        result = check_scope(state, 3);
+
+        if (!result)
+        {
+            printf("FAIL:\n");
+            printf("nested scopes, i = %d\n", i);
+            abort();
+        }
+    }
+
+    /* each thread has its own stack */
+    for (i = 0; i < 3; i++)
+    {
+        res[i] = 1;
+        pthread_create(threads + i, NULL, worker, res + i);
+    }
+
+    for (i = 0; i < 3; i++)
+    {
+        pthread_join(threads[i], NULL);
+
+        if (!res[i])
+        {
+            printf("FAIL:\n");
+            printf("thread %d\n", i);
+            abort();
+        }
+    }
+
+    flint_tmp_cleanup();
+
+    /* large blocks are not kept as a spare */
+    {
+        void * (* alloc_func)(size_t);
+        void * (* calloc_func)(size_t, size_t);
+        void * (* realloc_func)(void *, size_t);
+        void (* free_func)(void *);
+        TMP_INIT;
+
+        __flint_get_memory_functions(&alloc_func, &calloc_func, 
+                                     &realloc_func, &free_func);
+        __flint_set_memory_functions(count_malloc, count_calloc, 
+                                     count_realloc, count_free);
+
+        TMP_START;
+        TMP_ALLOC(1UL << 24);
+        TMP_END;
+
+        __flint_set_memory_functions(alloc_func, calloc_func, 
+                                     realloc_func, free_func);
+
+        if (live_blocks != 0)
+        {
+            printf("FAIL:\n");
+            printf("large block kept, %ld blocks live\n", live_blocks);
+            abort();
+        }
+    }
+
+    flint_randclear(state);
+
+    printf("PASS\n");
+    return 0;
+}
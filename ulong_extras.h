@@ -58,10 +58,36 @@ typedef struct {
 #define FLINT_FACTOR_SQUFOF_ITERS 50000
 #define FLINT_FACTOR_ONE_LINE_MAX (1UL<<39)
 #define FLINT_FACTOR_ONE_LINE_ITERS 40000
+#define FLINT_FACTOR_ECM_CURVES 100
+#define FLINT_FACTOR_ECM_B1 150
+#define FLINT_FACTOR_ECM_B2 3000
 
 #define FLINT_PRIME_PI_ODD_LOOKUP_CUTOFF 311
 
-#define FLINT_SIEVE_SIZE 65536
+/*
+   The prime sieve stores one bit for each number coprime to 30, i.e. 
+   one byte for each block of 30 numbers. Segments start with 
+   FLINT_SIEVE_MIN_SIZE bytes and double in size up to FLINT_SIEVE_SIZE 
+   bytes, to fit in L1 cache, or FLINT_SIEVE_SIZE_L2 bytes once the 
+   sieving primes exceed FLINT_SIEVE_L2_BOUND.
+*/
+#define FLINT_SIEVE_MIN_SIZE 64
+#define FLINT_SIEVE_SIZE 32768
+#define FLINT_SIEVE_SIZE_L2 262144
+#define FLINT_SIEVE_L2_BOUND 32768
+
+/* 
+   Sieving primes below this bound keep their offsets between segments, 
+   larger ones hit each segment only a few times and are located afresh
+*/
+#define FLINT_SIEVE_OFFSETS_BOUND (30 * FLINT_SIEVE_SIZE)
+
+/* Length of a range for which n_primes_count_range uses several threads */
+#define FLINT_PRIMES_COUNT_THREAD_CUTOFF 100000000UL
+
+/* Largest n for which n_prime_pi and n_nth_prime use flint_primes */
+#define FLINT_PRIME_PI_TABLE_CUTOFF 1048576UL
+#define FLINT_NTH_PRIME_TABLE_CUTOFF 65536UL
 
 #if FLINT64
 #define ULONG_MAX_PRIME 18446744073709551557UL
@@ -75,16 +101,31 @@ typedef struct
     long small_num;
     unsigned int * small_primes;
 
-    mp_limb_t sieve_a;
-    mp_limb_t sieve_b;
-    long sieve_i;
-    long sieve_num;
-    char * sieve;
+    mp_limb_t sieve_a;      /* start of the segment, a multiple of 30 */
+    mp_limb_t sieve_b;      /* last number in the segment */
+    long sieve_i;           /* index of the next byte of the segment */
+    long sieve_num;         /* number of bytes in the segment */
+    unsigned int sieve_word;    /* bits of the current byte not returned */
+    unsigned char * sieve;
+    long sieve_alloc;
+
+    /* 
+       For the i-th sieving prime p = small_primes[i + 3] and the j-th 
+       residue class modulo 30, the byte of the next multiple of p to 
+       cross off, relative to the start of the segment, for the primes 
+       below FLINT_SIEVE_OFFSETS_BOUND
+    */
+    mp_limb_t * sieve_offsets;
+    long sieve_offsets_num;
+    long sieve_offsets_alloc;
 }
 n_primes_struct;
 
 typedef n_primes_struct n_primes_t[1];
 
+/* the residues modulo 30 of the numbers represented by bits 0, ..., 7 */
+extern const unsigned char flint_primes_wheel30[8];
+
 void n_primes_init(n_primes_t iter);
 
 void n_primes_clear(n_primes_t iter);
@@ -93,8 +134,14 @@ void n_primes_extend_small(n_primes_t iter, mp_limb_t bound);
 
 void n_primes_sieve_range(n_primes_t iter, mp_limb_t a, mp_limb_t b);
 
+mp_limb_t _n_primes_segment_end(const n_primes_t iter, mp_limb_t a);
+
 void n_primes_jump_after(n_primes_t iter, mp_limb_t n);
 
+ulong n_primes_count_range(mp_limb_t a, mp_limb_t b);
+
+ulong _n_primes_segment_count(const n_primes_t iter);
+
 static __inline__ mp_limb_t
 n_primes_next(n_primes_t iter)
 {
@@ -103,9 +150,20 @@ n_primes_next(n_primes_t iter)
 
     for (;;)
     {
-        while (iter->sieve_i < iter->sieve_num)
-            if (iter->sieve[iter->sieve_i++] != 0)
-                return iter->sieve_a + 2 * (iter->sieve_i - 1);
+        if (iter->sieve_word != 0)
+        {
+            mp_limb_t t;
+            count_trailing_zeros(t, (mp_limb_t) iter->sieve_word);
+            iter->sieve_word &= (iter->sieve_word - 1);
+            return iter->sieve_a + 30 * (iter->sieve_i - 1) 
+                                 + flint_primes_wheel30[t];
+        }
+
+        if (iter->sieve_i < iter->sieve_num)
+        {
+            iter->sieve_word = iter->sieve[iter->sieve_i++];
+            continue;
+        }
 
         if (iter->sieve_b == 0)
             n_primes_jump_after(iter, iter->small_primes[iter->small_num-1]);
@@ -124,6 +182,18 @@ extern mp_limb_t flint_num_primes;
 
 extern mp_limb_t flint_primes_cutoff;
 
+/* 
+   Loads and stores of the table of primes, which is published to readers 
+   without a lock, see compute_primes.c
+*/
+#if defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7))
+#define PRIMES_LOAD(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define PRIMES_STORE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+#define PRIMES_LOAD(x) (x)
+#define PRIMES_STORE(x, v) ((x) = (v))
+#endif
+
 mp_limb_t n_randlimb(flint_rand_t state);
 
 mp_limb_t n_randint(flint_rand_t state, mp_limb_t limit);
@@ -301,6 +371,12 @@ int n_is_prime(mp_limb_t n);
 
 void n_compute_primes(ulong num_primes);
 
+const mp_limb_t * n_primes_arr_readonly(ulong num_primes);
+
+const double * n_prime_inverses_arr_readonly(ulong num_primes);
+
+void n_cleanup_primes(void);
+
 mp_limb_t n_nth_prime(ulong n);
 
 void n_nth_prime_bounds(mp_limb_t *lo, mp_limb_t *hi, ulong n);
@@ -345,6 +421,9 @@ void n_factor(n_factor_t * factors, mp_limb_t n, int proved);
 
 mp_limb_t n_factor_pp1(mp_limb_t n, ulong B1, ulong c);
 
+mp_limb_t n_factor_ecm(mp_limb_t n, ulong curves, ulong B1, ulong B2, 
+                       flint_rand_t state);
+
 int n_is_squarefree(mp_limb_t n);
 
 int n_moebius_mu(mp_limb_t n);
@@ -51,6 +51,19 @@ const unsigned int flint_primes_small[] =
     953,967,971,977,983,991,997,1009,1013,1019,1021
 };
 
+/*
+   The table of primes is published RCU style so that readers need no 
+   lock. A writer, holding flint_num_primes_mutex, fills a larger copy of 
+   the table and publishes the new arrays, then the new count, then the 
+   new cutoff, all with release semantics. A reader which sees a count 
+   of at least num with acquire semantics can therefore use whichever 
+   arrays it loads for the first num entries, and a reader which sees 
+   the new cutoff also sees the new count. Old arrays are retired rather than freed, as 
+   readers may still hold them, and are only released by 
+   n_cleanup_primes. As the table at least doubles each time, they take 
+   no more space than the current table.
+*/
+
 mp_limb_t * flint_primes;
 mp_limb_t flint_primes_cutoff = 0;
 
@@ -58,6 +71,10 @@ double * flint_prime_inverses;
 
 ulong flint_num_primes = 0;
 
+static mp_limb_t * _flint_primes_retired[FLINT_BITS];
+static double * _flint_prime_inverses_retired[FLINT_BITS];
+static int _flint_primes_num_retired = 0;
+
 #if defined (__WIN32)
 pthread_mutex_t flint_num_primes_mutex = PTHREAD_MUTEX_INITIALIZER;
 #else
@@ -67,41 +84,96 @@ pthread_mutex_t flint_num_primes_mutex;
 void n_compute_primes(ulong num)
 {
     n_primes_t iter;
-    long i;
+    mp_limb_t * primes;
+    double * inverses;
+    ulong i, old_num;
 
-    if (flint_num_primes >= num) return;
+    if (PRIMES_LOAD(flint_num_primes) >= num) return;
 
     pthread_mutex_lock(&flint_num_primes_mutex);
-    if (flint_num_primes >= num) /* someone may have changed this before we locked */
+
+    old_num = flint_num_primes;
+    if (old_num >= num) /* someone may have changed this before we locked */
     {
         pthread_mutex_unlock(&flint_num_primes_mutex);
         return; 
     }
 
-    num = FLINT_MAX(num, 2 * flint_num_primes);
+    num = FLINT_MAX(num, 2 * old_num);
     num = FLINT_MAX(num, 16384);
 
-    if (!flint_num_primes)
-    {
-        flint_primes = (mp_limb_t *) flint_malloc(sizeof(mp_limb_t) * num);
-        flint_prime_inverses = (double *) flint_malloc(sizeof(double) * num);
-    }
-    else
+    primes = (mp_limb_t *) flint_malloc(sizeof(mp_limb_t) * num);
+    inverses = (double *) flint_malloc(sizeof(double) * num);
+
+    /* the entries already computed never change */
+    for (i = 0; i < old_num; i++)
     {
-        flint_primes = flint_realloc(flint_primes, sizeof(mp_limb_t) * num);
-        flint_prime_inverses = flint_realloc(flint_prime_inverses, sizeof(double) * num);
+        primes[i] = flint_primes[i];
+        inverses[i] = flint_prime_inverses[i];
     }
 
     n_primes_init(iter);
-    for (i = 0; i < num; i++)
+    if (old_num != 0)
+        n_primes_jump_after(iter, primes[old_num - 1]);
+    for ( ; i < num; i++)
     {
-        flint_primes[i] = n_primes_next(iter);
-        flint_prime_inverses[i] = n_precompute_inverse(flint_primes[i]);
+        primes[i] = n_primes_next(iter);
+        inverses[i] = n_precompute_inverse(primes[i]);
     }
     n_primes_clear(iter);
 
-    flint_primes_cutoff = flint_primes[num - 1];
-    flint_num_primes = num;
+    if (old_num != 0)
+    {
+        _flint_primes_retired[_flint_primes_num_retired] = flint_primes;
+        _flint_prime_inverses_retired[_flint_primes_num_retired] = 
+                                                        flint_prime_inverses;
+        _flint_primes_num_retired++;
+    }
+
+    PRIMES_STORE(flint_primes, primes);
+    PRIMES_STORE(flint_prime_inverses, inverses);
+    PRIMES_STORE(flint_num_primes, num);
+    PRIMES_STORE(flint_primes_cutoff, primes[num - 1]);
+
+    pthread_mutex_unlock(&flint_num_primes_mutex);
+}
+
+const mp_limb_t * n_primes_arr_readonly(ulong num)
+{
+    n_compute_primes(num);
+
+    return PRIMES_LOAD(flint_primes);
+}
+
+const double * n_prime_inverses_arr_readonly(ulong num)
+{
+    n_compute_primes(num);
+
+    return PRIMES_LOAD(flint_prime_inverses);
+}
+
+void n_cleanup_primes(void)
+{
+    int i;
+
+    pthread_mutex_lock(&flint_num_primes_mutex);
+
+    for (i = 0; i < _flint_primes_num_retired; i++)
+    {
+        flint_free(_flint_primes_retired[i]);
+        flint_free(_flint_prime_inverses_retired[i]);
+    }
+    _flint_primes_num_retired = 0;
+
+    if (flint_num_primes != 0)
+    {
+        flint_free(flint_primes);
+        flint_free(flint_prime_inverses);
+        flint_primes = NULL;
+        flint_prime_inverses = NULL;
+        flint_primes_cutoff = 0;
+        flint_num_primes = 0;
+    }
 
     pthread_mutex_unlock(&flint_num_primes_mutex);
 }
@@ -43,6 +43,8 @@ void n_factor(n_factor_t * factors, mp_limb_t n, int proved)
    ulong factors_left;
    ulong exp;
    mp_limb_t cofactor, factor, cutoff;
+   flint_rand_t state;
+   int state_init = 0;
 
    cofactor = n_factor_trial(factors, n, FLINT_FACTOR_TRIAL_PRIMES);
    if (cofactor == 1UL) return;
@@ -56,7 +58,8 @@ void n_factor(n_factor_t * factors, mp_limb_t n, int proved)
    factors_left = 1;
    exp_arr[0] = 1;
 
-   cutoff = flint_primes[FLINT_FACTOR_TRIAL_PRIMES - 1]*flint_primes[FLINT_FACTOR_TRIAL_PRIMES - 1];
+   cutoff = n_primes_arr_readonly(FLINT_FACTOR_TRIAL_PRIMES)[FLINT_FACTOR_TRIAL_PRIMES - 1];
+   cutoff = cutoff*cutoff;
 
    while (factors_left > 0)
    {
@@ -72,12 +75,24 @@ void n_factor(n_factor_t * factors, mp_limb_t n, int proved)
            
          if ((factor >= cutoff) && !is_prime(factor, proved))
 		   {
-		      if ((
 #if FLINT64
-                 (factor < FLINT_FACTOR_ONE_LINE_MAX) &&
+            if (factor < FLINT_FACTOR_ONE_LINE_MAX)
+               cofactor = n_factor_one_line(factor, FLINT_FACTOR_ONE_LINE_ITERS);
+            else
+            {
+               if (!state_init)
+               {
+                  flint_randinit(state);
+                  state_init = 1;
+               }
+               cofactor = n_factor_ecm(factor, FLINT_FACTOR_ECM_CURVES,
+                             FLINT_FACTOR_ECM_B1, FLINT_FACTOR_ECM_B2, state);
+            }
+#else
+            cofactor = 0;
 #endif
-                 (cofactor = n_factor_one_line(factor, FLINT_FACTOR_ONE_LINE_ITERS))) 
-              || (cofactor = n_factor_SQUFOF(factor, FLINT_FACTOR_SQUFOF_ITERS)))
+		      if (cofactor || 
+               (cofactor = n_factor_SQUFOF(factor, FLINT_FACTOR_SQUFOF_ITERS)))
 				{
 					exp_arr[factors_left] = exp_arr[factors_left - 1];
                factor_arr[factors_left] = cofactor;
@@ -99,4 +114,7 @@ void n_factor(n_factor_t * factors, mp_limb_t n, int proved)
          factors_left--;
 		}
    } 
+
+   if (state_init)
+      flint_randclear(state);
 }
@@ -0,0 +1,286 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/*
+   Arithmetic on the Montgomery curve b y^2 = x^3 + a x^2 + x using 
+   the coordinates (x : z), with all residues shifted left by norm
+   bits, as are n and the constant a24 = (a + 2)/4.
+*/
+
+#define N_ECM_D 210 /* giant step of stage 2 */
+
+#define N_ECM_BABY 24 /* number of odd 0 < j < D/2 coprime to D */
+
+/* (x : z) = 2 (x0 : z0) */
+static void n_ecm_double(mp_limb_t * x, mp_limb_t * z, 
+                         mp_limb_t x0, mp_limb_t z0, mp_limb_t a24, 
+                         mp_limb_t n, mp_limb_t ninv, ulong norm)
+{
+   mp_limb_t u, v, w;
+
+   u = n_addmod(x0, z0, n);
+   u = n_mulmod_preinv(u, u, n, ninv, norm);
+   v = n_submod(x0, z0, n);
+   v = n_mulmod_preinv(v, v, n, ninv, norm);
+   (*x) = n_mulmod_preinv(u, v, n, ninv, norm);
+   w = n_submod(u, v, n);
+   u = n_mulmod_preinv(a24, w, n, ninv, norm);
+   u = n_addmod(u, v, n);
+   (*z) = n_mulmod_preinv(w, u, n, ninv, norm);
+}
+
+/* (x : z) = (x1 : z1) + (x2 : z2), given their difference (xd : zd) */
+static void n_ecm_add(mp_limb_t * x, mp_limb_t * z, 
+                      mp_limb_t x1, mp_limb_t z1, mp_limb_t x2, mp_limb_t z2,
+                      mp_limb_t xd, mp_limb_t zd, 
+                      mp_limb_t n, mp_limb_t ninv, ulong norm)
+{
+   mp_limb_t u, v, w;
+
+   u = n_mulmod_preinv(n_submod(x1, z1, n), n_addmod(x2, z2, n), n, ninv, norm);
+   v = n_mulmod_preinv(n_addmod(x1, z1, n), n_submod(x2, z2, n), n, ninv, norm);
+   w = n_addmod(u, v, n);
+   w = n_mulmod_preinv(w, w, n, ninv, norm);
+   u = n_submod(u, v, n);
+   u = n_mulmod_preinv(u, u, n, ninv, norm);
+   (*x) = n_mulmod_preinv(zd, w, n, ninv, norm);
+   (*z) = n_mulmod_preinv(xd, u, n, ninv, norm);
+}
+
+/* (x : z) = k (x : z) by the Montgomery ladder, k > 0 */
+static void n_ecm_mul(mp_limb_t * x, mp_limb_t * z, mp_limb_t k, 
+                      mp_limb_t a24, mp_limb_t n, mp_limb_t ninv, ulong norm)
+{
+   mp_limb_t x0 = *x, z0 = *z, x1, z1, x2, z2;
+   mp_limb_t bit = ((1UL << (FLINT_BIT_COUNT(k) - 1)) >> 1);
+
+   if (k == 1)
+      return;
+
+   x1 = x0, z1 = z0;
+   n_ecm_double(&x2, &z2, x0, z0, a24, n, ninv, norm);
+
+   for ( ; bit; bit >>= 1)
+   {
+      if (k & bit)
+      {
+         n_ecm_add(&x1, &z1, x1, z1, x2, z2, x0, z0, n, ninv, norm);
+         n_ecm_double(&x2, &z2, x2, z2, a24, n, ninv, norm);
+      } else
+      {
+         n_ecm_add(&x2, &z2, x1, z1, x2, z2, x0, z0, n, ninv, norm);
+         n_ecm_double(&x1, &z1, x1, z1, a24, n, ninv, norm);
+      }
+   }
+
+   (*x) = x1;
+   (*z) = z1;
+}
+
+/*
+   Selects a random curve and point using Suyama's parametrisation. 
+   Returns 1 if successful, otherwise gcd(d, n) for a denominator d 
+   which is not invertible.
+*/
+static mp_limb_t n_ecm_select_curve(mp_limb_t * x, mp_limb_t * z, 
+        mp_limb_t * a24, mp_limb_t n, flint_rand_t state)
+{
+   mp_limb_t ninv = n_preinvert_limb(n);
+   mp_limb_t sigma, u, v, t, w, g, inv;
+
+   sigma = n_randint(state, n - 6) + 6;
+
+   u = n_mulmod2_preinv(sigma, sigma, n, ninv);
+   u = n_submod(u, 5 % n, n);
+   v = n_mulmod2_preinv(sigma, 4, n, ninv);
+
+   t = n_mulmod2_preinv(u, u, n, ninv);
+   (*x) = n_mulmod2_preinv(t, u, n, ninv); /* u^3 */
+   t = n_mulmod2_preinv(v, v, n, ninv);
+   (*z) = n_mulmod2_preinv(t, v, n, ninv); /* v^3 */
+
+   /* a24 = (v - u)^3 (3u + v) / (16 u^3 v) */
+   w = n_mulmod2_preinv(*x, v, n, ninv);
+   w = n_mulmod2_preinv(w, 16, n, ninv);
+   if (w == 0)
+      return n;
+
+   g = n_gcdinv(&inv, w, n);
+   if (g != 1)
+      return g;
+
+   t = n_submod(v, u, n);
+   w = n_mulmod2_preinv(t, t, n, ninv);
+   w = n_mulmod2_preinv(w, t, n, ninv);
+   t = n_addmod(n_mulmod2_preinv(u, 3, n, ninv), v, n);
+   w = n_mulmod2_preinv(w, t, n, ninv);
+   (*a24) = n_mulmod2_preinv(w, inv, n, ninv);
+
+   return 1;
+}
+
+mp_limb_t n_factor_ecm(mp_limb_t n, ulong curves, ulong B1, ulong B2, 
+                       flint_rand_t state)
+{
+   mp_limb_t x, z, a24, ninv, nn, g, pe, k, p;
+   mp_limb_t xj[N_ECM_BABY], zj[N_ECM_BABY];
+   int jind[N_ECM_D/4 + 1]; /* position of j among the baby steps */
+   mp_limb_t xs, zs, xm, zm, xm1, zm1, xt, zt, acc;
+   long i, j, c, m;
+   ulong norm;
+   n_primes_t iter;
+
+   if ((n % 2) == 0)
+      return 2;
+
+   if (n < 9)
+      return 0;
+
+   /* stage 2 requires all primes up to D/2 to be done in stage 1 */
+   B1 = FLINT_MAX(B1, N_ECM_D/2);
+
+   count_leading_zeros(norm, n);
+   nn = (n << norm);
+   ninv = n_preinvert_limb(nn);
+
+   for (c = 0; c < curves; c++)
+   {
+      g = n_ecm_select_curve(&x, &z, &a24, n, state);
+      if (g == n)
+         continue;
+      if (g != 1)
+         return g;
+
+      x <<= norm;
+      z <<= norm;
+      a24 <<= norm;
+
+      /* stage 1: multiply by the prime powers up to B1, several at once */
+      n_primes_init(iter);
+
+      for (k = 1, p = n_primes_next(iter); p <= B1; p = n_primes_next(iter))
+      {
+         for (pe = p; pe <= B1/p; pe *= p) ;
+
+         if (k > (~0UL)/pe)
+         {
+            n_ecm_mul(&x, &z, k, a24, nn, ninv, norm);
+            k = 1;
+         }
+
+         k *= pe;
+      }
+
+      n_ecm_mul(&x, &z, k, a24, nn, ninv, norm);
+
+      g = n_gcd(n, z >> norm);
+      if (g != 1)
+      {
+         n_primes_clear(iter);
+         if (g == n)
+            continue;
+         return g;
+      }
+
+      /* stage 2: primes p = mD +/- j in (B1, B2], j < D/2 */
+      if (B2 <= B1)
+      {
+         n_primes_clear(iter);
+         continue;
+      }
+
+      /* baby steps j (x : z) for j odd and coprime to D */
+      n_ecm_double(&xt, &zt, x, z, a24, nn, ninv, norm); /* 2Q */
+      xs = x, zs = z; /* (j - 2) Q */
+      xm = x, zm = z; /* j Q */
+      for (i = 0, j = 1; j <= N_ECM_D/2; j += 2)
+      {
+         if (j > 1)
+         {
+            mp_limb_t x2, z2;
+            n_ecm_add(&x2, &z2, xm, zm, xt, zt, xs, zs, nn, ninv, norm);
+            xs = xm, zs = zm;
+            xm = x2, zm = z2;
+         }
+
+         if ((j % 3) != 0 && (j % 5) != 0 && (j % 7) != 0)
+         {
+            xj[i] = xm;
+            zj[i] = zm;
+            jind[j/2] = i++;
+         } else
+            jind[j/2] = -1;
+      }
+
+      /* giant steps (mD) Q, starting from m with mD - D/2 <= B1 */
+      m = (B1 + N_ECM_D/2)/N_ECM_D;
+      xs = x, zs = z;
+      n_ecm_mul(&xs, &zs, N_ECM_D, a24, nn, ninv, norm); /* D Q */
+      xm = xs, zm = zs;
+      if (m > 1) n_ecm_mul(&xm, &zm, m, a24, nn, ninv, norm); /* mD Q */
+      xm1 = xs, zm1 = zs;
+      if (m > 2) n_ecm_mul(&xm1, &zm1, m - 1, a24, nn, ninv, norm); /* (m - 1)D Q */
+      else if (m == 1)
+         xm1 = 0, zm1 = 0; /* never used as a difference */
+
+      acc = (1UL << norm);
+
+      for ( ; p <= B2; p = n_primes_next(iter))
+      {
+         while (p > (mp_limb_t) m*N_ECM_D + N_ECM_D/2) /* next giant step */
+         {
+            if (m == 1)
+               n_ecm_double(&xt, &zt, xm, zm, a24, nn, ninv, norm);
+            else
+               n_ecm_add(&xt, &zt, xm, zm, xs, zs, xm1, zm1, nn, ninv, norm);
+            xm1 = xm, zm1 = zm;
+            xm = xt, zm = zt;
+            m++;
+         }
+
+         j = (p > (mp_limb_t) m*N_ECM_D) ? p - m*N_ECM_D : m*N_ECM_D - p;
+
+         i = jind[j/2];
+         if (i < 0) /* p divides D */
+            continue;
+
+         xt = n_mulmod_preinv(xm, zj[i], nn, ninv, norm);
+         zt = n_mulmod_preinv(xj[i], zm, nn, ninv, norm);
+         acc = n_mulmod_preinv(acc, n_submod(xt, zt, nn), nn, ninv, norm);
+      }
+
+      n_primes_clear(iter);
+
+      g = n_gcd(n, acc >> norm);
+      if (g != 1 && g != n)
+         return g;
+   }
+
+   return 0;
+}
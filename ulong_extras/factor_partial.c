@@ -57,7 +57,8 @@ mp_limb_t n_factor_partial(n_factor_t * factors, mp_limb_t n, mp_limb_t limit, i
    factors_left = 1;
    exp_arr[0] = 1;
 
-   cutoff = flint_primes[FLINT_FACTOR_TRIAL_PRIMES - 1]*flint_primes[FLINT_FACTOR_TRIAL_PRIMES - 1];
+   cutoff = n_primes_arr_readonly(FLINT_FACTOR_TRIAL_PRIMES)[FLINT_FACTOR_TRIAL_PRIMES - 1];
+   cutoff = cutoff*cutoff;
 
    while (factors_left > 0 && prod <= limit)
    {
@@ -35,7 +35,7 @@ int
 n_is_prime_pocklington(mp_limb_t n, ulong iterations)
 {
     int i, j, pass;
-    mp_limb_t n1, cofactor, b, c = 0, ninv, limit;
+    mp_limb_t n1, cofactor, b, c = 0, ninv, limit, trial_limit;
     n_factor_t factors;
 
     if (n % 2 == 0)
@@ -52,9 +52,12 @@ n_is_prime_pocklington(mp_limb_t n, ulong iterations)
 
     if (cofactor != 1) /* check that cofactor is coprime to factors found */
     {
+        trial_limit = n_primes_arr_readonly(FLINT_FACTOR_TRIAL_PRIMES)
+                                                 [FLINT_FACTOR_TRIAL_PRIMES - 1];
+
         for (i = 0; i < factors.num; i++)
         {
-            if (factors.p[i] > flint_primes[FLINT_FACTOR_TRIAL_PRIMES - 1])
+            if (factors.p[i] > trial_limit)
             {
                 while (cofactor >= factors.p[i] && (cofactor % factors.p[i]) == 0)
                 {
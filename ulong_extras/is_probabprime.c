@@ -58,7 +58,7 @@ int n_is_probabprime(mp_limb_t n)
             return n_is_oddprime_small(n);
 
         n_compute_primes(74000);
-        if (n < flint_primes_cutoff)
+        if (n < PRIMES_LOAD(flint_primes_cutoff))
             return n_is_oddprime_binary(n);
       
         npre = n_precompute_inverse(n);
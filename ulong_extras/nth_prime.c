@@ -20,12 +20,14 @@
 /******************************************************************************
 
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
 #undef ulong /* prevent clash with standard library */
 #include <stdlib.h>
 #include <stdio.h>
+#include <math.h>
 #define ulong unsigned long
 #include "flint.h"
 #include "ulong_extras.h"
@@ -38,8 +40,43 @@ mp_limb_t n_nth_prime(ulong n)
         abort();
     }
 
-    if (n > flint_num_primes)
-        n_compute_primes(n+1);
+    if (n <= FLINT_NTH_PRIME_TABLE_CUTOFF || n <= PRIMES_LOAD(flint_num_primes))
+        return n_primes_arr_readonly(n)[n-1];
+    else
+    {
+        n_primes_t iter;
+        mp_limb_t lo, p = 0;
+        ulong count, c;
+        double ln = log((double) n);
+
+        /*
+           Count the primes up to a lower bound for p_n, using 
+           p_n > n (ln n + ln ln n - 1) for n >= 2 (Dusart), with some 
+           room for rounding errors, then sieve forward from there.
+        */
+        lo = (mp_limb_t) (n * (ln + log(ln) - 1.0) * 0.9999);
+        count = n_primes_count_range(0, lo);
+
+        while (count >= n)
+        {
+            lo /= 2;
+            count = n_primes_count_range(0, lo);
+        }
+
+        n_primes_init(iter);
+        n_primes_jump_after(iter, lo);
 
-    return flint_primes[n-1];
+        while (count + (c = _n_primes_segment_count(iter)) < n)
+        {
+            count += c;
+            n_primes_jump_after(iter, iter->sieve_b);
+        }
+
+        for ( ; count < n; count++)
+            p = n_primes_next(iter);
+
+        n_primes_clear(iter);
+
+        return p;
+    }
 }
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
@@ -41,6 +42,7 @@ const unsigned char FLINT_PRIME_PI_ODD_LOOKUP[] =
 ulong n_prime_pi(mp_limb_t n)
 {
     ulong low, mid, high;
+    const mp_limb_t * primes;
 
     if (n < FLINT_PRIME_PI_ODD_LOOKUP_CUTOFF)
     {
@@ -49,13 +51,16 @@ ulong n_prime_pi(mp_limb_t n)
         return FLINT_PRIME_PI_ODD_LOOKUP[(n-1)/2];
     }
 
+    if (n > FLINT_PRIME_PI_TABLE_CUTOFF)
+        return n_primes_count_range(0, n);
+
     n_prime_pi_bounds(&low, &high, n);
-    n_compute_primes(high+1);
+    primes = n_primes_arr_readonly(high+1);
 
     while (low < high)
     {
         mid = (low + high) / 2;
-        if (n < flint_primes[mid-1])
+        if (n < primes[mid-1])
             high = mid;
         else
             low = mid + 1;
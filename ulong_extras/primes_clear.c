@@ -34,4 +34,6 @@ n_primes_clear(n_primes_t iter)
 
     if (iter->sieve != NULL)
         flint_free(iter->sieve);
+    if (iter->sieve_offsets != NULL)
+        flint_free(iter->sieve_offsets);
 }
@@ -0,0 +1,162 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong /* prevent clash with standard library */
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#define ulong unsigned long
+#include "flint.h"
+#include "ulong_extras.h"
+
+#if defined(__GNUC__)
+#define popcount_limb(x) __builtin_popcountl(x)
+#else
+static __inline__ ulong
+popcount_limb(mp_limb_t x)
+{
+    ulong c = 0;
+
+    for ( ; x != 0; x &= x - 1)
+        c++;
+
+    return c;
+}
+#endif
+
+typedef struct
+{
+    mp_limb_t a;
+    mp_limb_t b;
+    ulong count;
+} primes_count_arg_t;
+
+/* Returns the number of primes in the current segment of the sieve */
+ulong
+_n_primes_segment_count(const n_primes_t iter)
+{
+    ulong count = 0;
+    mp_limb_t t;
+    long i;
+
+    for (i = 0; i + sizeof(mp_limb_t) <= iter->sieve_num; 
+         i += sizeof(mp_limb_t))
+    {
+        memcpy(&t, iter->sieve + i, sizeof(mp_limb_t));
+        count += popcount_limb(t);
+    }
+
+    for ( ; i < iter->sieve_num; i++)
+        count += popcount_limb((mp_limb_t) iter->sieve[i]);
+
+    return count;
+}
+
+/* Counts the primes in [a, b] for 7 <= a <= b, one segment at a time */
+static void *
+_n_primes_count_worker(void * arg_ptr)
+{
+    primes_count_arg_t * arg = arg_ptr;
+    n_primes_t iter;
+    mp_limb_t a = arg->a, b = arg->b, c;
+    ulong count = 0;
+
+    n_primes_init(iter);
+
+    for (;;)
+    {
+        c = FLINT_MIN(_n_primes_segment_end(iter, a), b);
+
+        n_primes_sieve_range(iter, a, c);
+        count += _n_primes_segment_count(iter);
+
+        if (c == b)
+            break;
+
+        a = c + 1;
+    }
+
+    n_primes_clear(iter);
+
+    arg->count = count;
+
+    return NULL;
+}
+
+ulong
+n_primes_count_range(mp_limb_t a, mp_limb_t b)
+{
+    primes_count_arg_t * args;
+    pthread_t * threads;
+    ulong count = 0;
+    long j, k;
+    int num_threads;
+
+    /* the primes below 7 are not represented in the sieve */
+    count += (a <= 2 && b >= 2) + (a <= 3 && b >= 3) + (a <= 5 && b >= 5);
+    a = FLINT_MAX(a, 7);
+
+    if (b < a)
+        return count;
+
+    num_threads = flint_get_num_threads();
+    if (b - a < FLINT_PRIMES_COUNT_THREAD_CUTOFF)
+        num_threads = 1;
+
+    args = flint_malloc(num_threads * sizeof(primes_count_arg_t));
+    threads = flint_malloc(num_threads * sizeof(pthread_t));
+
+    /* split at multiples of 30 so that each segment consists of full blocks */
+    for (k = 0; k < num_threads; k++)
+    {
+        mp_limb_t s = (b - a) / num_threads;
+
+        s -= s % 30;
+        args[k].a = (k == 0) ? a : args[k - 1].b + 1;
+        args[k].b = (k == num_threads - 1) ? b : a - a % 30 + (k + 1) * s - 1;
+    }
+
+    for (k = 1; k < num_threads; k++)
+        if (pthread_create(threads + k, NULL, 
+                           _n_primes_count_worker, args + k))
+            break;
+
+    _n_primes_count_worker(args);
+
+    /* the segments for which no thread could be created are done here */
+    for (j = k; j < num_threads; j++)
+        _n_primes_count_worker(args + j);
+
+    for (j = 1; j < k; j++)
+        pthread_join(threads[j], NULL);
+
+    for (k = 0; k < num_threads; k++)
+        count += args[k].count;
+
+    flint_free(threads);
+    flint_free(args);
+
+    return count;
+}
@@ -20,6 +20,7 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
@@ -28,10 +29,18 @@
 #include "flint.h"
 #include "ulong_extras.h"
 
+/* the small primes are stored as unsigned int */
+#if FLINT64
+#define UINT_MAX_PRIME 4294967291UL
+#else
+#define UINT_MAX_PRIME ULONG_MAX_PRIME
+#endif
+
 void
 n_primes_extend_small(n_primes_t iter, mp_limb_t bound)
 {
-    while (iter->small_primes[iter->small_num - 2] < bound)
+    while (iter->small_primes[iter->small_num - 2] < bound
+        && iter->small_primes[iter->small_num - 1] != UINT_MAX_PRIME)
     {
         n_primes_t iter2;
         long i, num;
@@ -46,7 +55,15 @@ n_primes_extend_small(n_primes_t iter, mp_limb_t bound)
 
         n_primes_init(iter2);
         for (i = 0; i < num; i++)
+        {
             iter->small_primes[i] = n_primes_next(iter2);
+
+            if (iter->small_primes[i] == UINT_MAX_PRIME)
+            {
+                num = i + 1;
+                break;
+            }
+        }
         n_primes_clear(iter2);
 
         iter->small_num = num;
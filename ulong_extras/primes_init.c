@@ -37,5 +37,11 @@ n_primes_init(n_primes_t iter)
     iter->sieve_num = 0;
     iter->sieve_a = 0;
     iter->sieve_b = 0;
+    iter->sieve_word = 0;
     iter->sieve = NULL;
+    iter->sieve_alloc = 0;
+
+    iter->sieve_offsets = NULL;
+    iter->sieve_offsets_num = 0;
+    iter->sieve_offsets_alloc = 0;
 }
@@ -20,9 +20,11 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
+#include <stdio.h>
 #include <stdlib.h>
 #include "ulong_extras.h"
 
@@ -33,11 +35,18 @@ n_primes_jump_after(n_primes_t iter, mp_limb_t n)
     {
         iter->small_i = n_prime_pi(n);
         iter->sieve_a = iter->sieve_b = iter->sieve_num = 0;
+        iter->sieve_i = 0;
+        iter->sieve_word = 0;
     }
     else
     {
+        if (n >= ULONG_MAX_PRIME)
+        {
+            printf("Exception (n_primes_next). No primes after %lu.\n", n);
+            abort();
+        }
+
         iter->small_i = iter->small_num;
-        n_primes_sieve_range(iter, n + 1,
-            n + 1 + FLINT_MIN(n, FLINT_SIEVE_SIZE) - 2);
+        n_primes_sieve_range(iter, n + 1, _n_primes_segment_end(iter, n + 1));
     }
 }
@@ -20,88 +20,193 @@
 /******************************************************************************
 
     Copyright (C) 2012 Fredrik Johansson
+    Copyright (C) 2013 The FLINT development team
 
 ******************************************************************************/
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "flint.h"
 #include "ulong_extras.h"
 
+const unsigned char flint_primes_wheel30[8] = { 1, 7, 11, 13, 17, 19, 23, 29 };
+
+/* the bit representing the residue r modulo 30, or -1 if gcd(r, 30) > 1 */
+static const signed char wheel30_bit[30] =
+{
+    -1, 0, -1, -1, -1, -1, -1, 1, -1, -1, -1, 2, -1, 3, -1,
+    -1, -1, 4, -1, 5, -1, -1, -1, 6, -1, -1, -1, -1, -1, 7
+};
+
+/* the gap from a unit modulo 30 to the next one */
+static const unsigned char wheel30_gap[30] =
+{
+    1, 6, 5, 4, 3, 2, 1, 4, 3, 2, 1, 2, 1, 4, 3,
+    2, 1, 2, 1, 4, 3, 2, 1, 6, 5, 4, 3, 2, 1, 2
+};
+
+/*
+   Sets the offsets of the sieving prime p for a segment starting at a, 
+   a multiple of 30. The multiples p m with m coprime to 30 fall into 
+   all eight residue classes as m runs through eight consecutive units, 
+   and in each class they are 30 p apart, i.e. p bytes.
+*/
 static void
-mark(char * sieve, mp_limb_t a, long len, mp_limb_t p)
+_offsets_init(mp_limb_t * off, mp_limb_t p, mp_limb_t a)
 {
-    mp_limb_t t;
+    mp_limb_t m, n;
+    int i;
 
-    t = p * p;
-    if (t >= a)
-    {
-        t = (t - a) / 2;
-    }
-    else
-    {
-        t = p - ((a - p) / 2) % p;
-        if (t == p)
-            t = 0;
-    }
+    n = FLINT_MAX(a, p * p);
+    m = n / p + (n % p != 0);
+    if (wheel30_bit[m % 30] < 0)
+        m += wheel30_gap[m % 30];
 
-    while (t < len)
+    for (i = 0; i < 8; i++)
     {
-        sieve[t] = 0;
-        t += p;
+        if (m > ~0UL / p)
+        {
+            off[wheel30_bit[(p % 30) * (m % 30) % 30]] = ~0UL;
+        }
+        else
+        {
+            n = p * m - a;
+            off[wheel30_bit[n % 30]] = n / 30;
+        }
+
+        m += wheel30_gap[m % 30];
     }
 }
 
-void
-n_sieve_odd(char * sieve, ulong n, mp_limb_t a,
-    unsigned int * sieve_primes, mp_limb_t bound)
+/* 
+   Returns the end of the segment which the iterator would sieve next if 
+   the current one ends just before a, or of the first one if not.
+*/
+mp_limb_t
+_n_primes_segment_end(const n_primes_t iter, mp_limb_t a)
 {
-    long i;
-    mp_limb_t p;
+    mp_limb_t a0, bytes, max_bytes;
 
-    for (i = 0; i < n / 2; i++)
-        sieve[i] = 1;
+    a0 = a - a % 30;
 
-    i = 0;
-    while (1)
-    {
-        i++;
-        p = sieve_primes[i];
-        if (p > bound)
-            break;
-        mark(sieve, a, n / 2, p);
-    }
+    if (iter->sieve_b != 0 && a == iter->sieve_b + 1 && a0 == a)
+        bytes = 2 * iter->sieve_num;
+    else
+        bytes = FLINT_SIEVE_MIN_SIZE;
+
+    if (a / FLINT_SIEVE_L2_BOUND >= FLINT_SIEVE_L2_BOUND)
+        max_bytes = FLINT_SIEVE_SIZE_L2;
+    else
+        max_bytes = FLINT_SIEVE_SIZE;
+
+    bytes = FLINT_MIN(bytes, max_bytes);
+
+    /* the last block may be incomplete */
+    if (bytes > (~0UL - a0) / 30)
+        return ~0UL;
+
+    return a0 + 30 * bytes - 1;
 }
 
 void
 n_primes_sieve_range(n_primes_t iter, mp_limb_t a, mp_limb_t b)
 {
-    mp_limb_t bound;
-    ulong len, odd_len;
+    mp_limb_t a0, bytes, bound, r, k, m, p;
+    mp_limb_t * off;
+    unsigned char * sieve, mask;
+    long i, j;
 
-    /* a and b must be odd */
-    a += (a % 2 == 0);
-    b -= (b % 2 == 0);
+    a0 = a - a % 30;
 
-    len = b - a + 2;
-    odd_len = len / 2;
-
-    if (a < 3 || b < a || len > FLINT_SIEVE_SIZE)
+    if (a < 7 || b < a || (b - a0) / 30 >= FLINT_SIEVE_SIZE_L2)
     {
         printf("invalid sieve range %lu,%lu!\n", a, b);
         abort();
     }
 
-    bound = n_sqrt(b) + 1;
+    bytes = (b - a0) / 30 + 1;
 
-    if (iter->sieve == NULL)
-        iter->sieve = flint_malloc(FLINT_SIEVE_SIZE / 2 * sizeof(char));
+    /* the offsets carry over if the segment continues the previous one */
+    if (iter->sieve_b == 0 || a != iter->sieve_b + 1 || a0 != a)
+        iter->sieve_offsets_num = 0;
 
+    if (iter->sieve_alloc < bytes)
+    {
+        iter->sieve = flint_realloc(iter->sieve, bytes);
+        iter->sieve_alloc = bytes;
+    }
+
+    sieve = iter->sieve;
+    memset(sieve, 0xff, bytes);
+
+    /* add the sieving primes up to sqrt(b) */
+    bound = n_sqrt(b);
     n_primes_extend_small(iter, bound);
-    n_sieve_odd(iter->sieve, len, a, iter->small_primes, bound);
+
+    for (i = iter->sieve_offsets_num; i + 3 < iter->small_num
+        && iter->small_primes[i + 3] <= bound
+        && iter->small_primes[i + 3] < FLINT_SIEVE_OFFSETS_BOUND; i++)
+    {
+        if (iter->sieve_offsets_alloc <= i)
+        {
+            iter->sieve_offsets_alloc = FLINT_MAX(64, 2 * (i + 1));
+            iter->sieve_offsets = flint_realloc(iter->sieve_offsets, 
+                8 * iter->sieve_offsets_alloc * sizeof(mp_limb_t));
+        }
+
+        _offsets_init(iter->sieve_offsets + 8 * i, iter->small_primes[i + 3],
+                      a0);
+    }
+
+    iter->sieve_offsets_num = i;
+
+    /* cross off */
+    for (i = 0; i < iter->sieve_offsets_num; i++)
+    {
+        p = iter->small_primes[i + 3];
+        off = iter->sieve_offsets + 8 * i;
+
+        for (j = 0; j < 8; j++)
+        {
+            mask = ~(1 << j);
+
+            for (k = off[j]; k < bytes; k += p)
+                sieve[k] &= mask;
+
+            off[j] = (k == ~0UL) ? k : k - bytes;
+        }
+    }
+
+    /* the larger sieving primes, walking through their multiples p m */
+    for (i += 3; i < iter->small_num && iter->small_primes[i] <= bound; i++)
+    {
+        p = iter->small_primes[i];
+
+        k = FLINT_MAX(a0, p * p);
+        m = k / p + (k % p != 0);
+        if (wheel30_bit[m % 30] < 0)
+            m += wheel30_gap[m % 30];
+
+        while (m <= ~0UL / p && (k = p * m - a0) / 30 < bytes)
+        {
+            sieve[k / 30] &= ~(1 << wheel30_bit[k % 30]);
+            m += wheel30_gap[m % 30];
+        }
+    }
+
+    /* remove the numbers before a and after b */
+    for (r = 0; r < 8; r++)
+    {
+        if (flint_primes_wheel30[r] < a - a0)
+            sieve[0] &= ~(1 << r);
+        if (flint_primes_wheel30[r] > b - (a0 + 30 * (bytes - 1)))
+            sieve[bytes - 1] &= ~(1 << r);
+    }
 
     iter->sieve_i = 0;
-    iter->sieve_num = odd_len;
-    iter->sieve_a = a;
+    iter->sieve_num = bytes;
+    iter->sieve_word = 0;
+    iter->sieve_a = a0;
     iter->sieve_b = b;
 }
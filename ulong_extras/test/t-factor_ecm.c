@@ -0,0 +1,79 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+   int i, result;
+   ulong count = 0UL;
+   flint_rand_t state;
+   flint_randinit(state);
+
+   printf("factor_ecm....");
+   fflush(stdout);
+
+   for (i = 0; i < 300 * flint_test_multiplier(); i++) /* Test random semiprimes */
+   {
+      mp_limb_t n, p, q, f;
+      ulong bits;
+
+      bits = n_randint(state, FLINT_BITS/2 - 2) + 3;
+
+      p = n_randprime(state, bits, 0);
+      q = n_randprime(state, FLINT_BITS - bits, 0);
+      n = p*q;
+
+      f = n_factor_ecm(n, 100, 150, 3000, state);
+
+      if (f)
+      {
+         count++;
+         result = ((f == p) || (f == q));
+         if (!result)
+         {
+            printf("FAIL:\n");
+            printf("n = %lu, p = %lu, q = %lu, f = %lu\n", n, p, q, f); 
+            abort();
+         }
+      }
+   }
+   
+   if (count < 290 * flint_test_multiplier())
+   {
+      printf("FAIL:\n");
+      printf("Only %lu numbers factored\n", count); 
+      abort();
+   }
+
+   flint_randclear(state);
+
+   printf("PASS\n");
+   return 0;
+}
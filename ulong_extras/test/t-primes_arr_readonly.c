@@ -0,0 +1,146 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#undef ulong /* prevent clash with standard library */
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#define ulong unsigned long
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+#define NUM_THREADS 4
+#define NUM_REF (1UL << 18)
+
+mp_limb_t * ref;
+
+typedef struct
+{
+    ulong seed;
+    int failed;
+} reader_arg_t;
+
+/* 
+   Requests tables of random sizes while other threads grow the table, 
+   and checks that arrays obtained earlier remain valid.
+*/
+void * reader(void * arg_ptr)
+{
+    reader_arg_t * arg = arg_ptr;
+    const mp_limb_t * old[64];
+    const double * old_inv[64];
+    ulong old_num[64];
+    flint_rand_t state;
+    long i, j;
+
+    flint_randinit(state);
+    state->__randval = arg->seed;
+    state->__randval2 = arg->seed ^ 0x12345UL;
+
+    for (i = 0; i < 64; i++)
+    {
+        ulong num = n_randint(state, 1UL << n_randint(state, 19)) + 1;
+
+        num = FLINT_MIN(num, NUM_REF);
+        old[i] = n_primes_arr_readonly(num);
+        old_inv[i] = n_prime_inverses_arr_readonly(num);
+        old_num[i] = num;
+
+        for (j = 0; j <= i; j++)
+        {
+            ulong k = n_randint(state, old_num[j]);
+
+            if (old[j][k] != ref[k] 
+                || old_inv[j][k] != n_precompute_inverse(ref[k]))
+                arg->failed = 1;
+        }
+    }
+
+    flint_randclear(state);
+
+    return NULL;
+}
+
+int main(void)
+{
+    pthread_t threads[NUM_THREADS];
+    reader_arg_t args[NUM_THREADS];
+    n_primes_t iter;
+    ulong i;
+    long k;
+
+    printf("primes_arr_readonly....");
+    fflush(stdout);
+
+    ref = flint_malloc(NUM_REF * sizeof(mp_limb_t));
+    n_primes_init(iter);
+    for (i = 0; i < NUM_REF; i++)
+        ref[i] = n_primes_next(iter);
+    n_primes_clear(iter);
+
+    for (k = 0; k < NUM_THREADS; k++)
+    {
+        args[k].seed = 1 + 1000 * k;
+        args[k].failed = 0;
+        pthread_create(threads + k, NULL, reader, args + k);
+    }
+
+    for (k = 0; k < NUM_THREADS; k++)
+        pthread_join(threads[k], NULL);
+
+    for (k = 0; k < NUM_THREADS; k++)
+    {
+        if (args[k].failed)
+        {
+            printf("FAIL:\n");
+            printf("thread %ld read a wrong entry\n", k);
+            abort();
+        }
+    }
+
+    if (n_nth_prime(NUM_REF) != ref[NUM_REF - 1] 
+        || n_prime_pi(ref[NUM_REF - 1]) != NUM_REF)
+    {
+        printf("FAIL:\n");
+        printf("n_nth_prime or n_prime_pi inconsistent with table\n");
+        abort();
+    }
+
+    n_cleanup_primes();
+
+    if (n_primes_arr_readonly(100)[99] != ref[99])
+    {
+        printf("FAIL:\n");
+        printf("table not recomputed after cleanup\n");
+        abort();
+    }
+
+    n_cleanup_primes();
+    flint_free(ref);
+
+    printf("PASS\n");
+    return 0;
+}
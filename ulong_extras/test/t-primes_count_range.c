@@ -0,0 +1,137 @@
+/*=============================================================================
+
+    This file is part of FLINT.
+
+    FLINT is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    FLINT is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with FLINT; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301 USA
+
+=============================================================================*/
+/******************************************************************************
+
+    Copyright (C) 2013 The FLINT development team
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/* reference count using the prime iterator */
+static ulong
+count_primes_iter(mp_limb_t a, mp_limb_t b)
+{
+    n_primes_t iter;
+    ulong count = 0;
+    mp_limb_t p;
+
+    n_primes_init(iter);
+
+    if (a > 0)
+        n_primes_jump_after(iter, a - 1);
+
+    while ((p = n_primes_next(iter)) <= b)
+        count++;
+
+    n_primes_clear(iter);
+
+    return count;
+}
+
+int main(void)
+{
+    flint_rand_t state;
+    long i;
+
+    printf("primes_count_range....");
+    fflush(stdout);
+
+    flint_randinit(state);
+
+    /* small ranges, checked against n_is_prime */
+    for (i = 0; i < 1000; i++)
+    {
+        mp_limb_t a, b, n;
+        ulong c1, c2 = 0;
+
+        if (n_randint(state, 2))
+            a = n_randtest(state) % 100000000UL;
+        else
+            a = n_randint(state, 1000000000000UL);
+        b = a + n_randint(state, 1000);
+
+        c1 = n_primes_count_range(a, b);
+
+        for (n = a; ; n++)
+        {
+            c2 += (n > 1 && n_is_prime(n));
+            if (n == b)
+                break;
+        }
+
+        if (c1 != c2)
+        {
+            printf("FAIL (small range):\n");
+            printf("a = %lu, b = %lu, c1 = %lu, c2 = %lu\n", a, b, c1, c2);
+            abort();
+        }
+    }
+
+    /* larger ranges, checked against the iterator */
+    for (i = 0; i < 20; i++)
+    {
+        mp_limb_t a, b;
+        ulong c1, c2;
+
+        a = n_randtest(state) % 1000000000000UL;
+        b = a + n_randint(state, 10000000);
+
+        c1 = n_primes_count_range(a, b);
+        c2 = count_primes_iter(a, b);
+
+        if (c1 != c2)
+        {
+            printf("FAIL (large range):\n");
+            printf("a = %lu, b = %lu, c1 = %lu, c2 = %lu\n", a, b, c1, c2);
+            abort();
+        }
+    }
+
+    /* splitting between threads, and known values of pi(n) */
+    {
+        ulong c1, c2;
+
+        flint_set_num_threads(3);
+
+        c1 = n_primes_count_range(0, 200000000UL);
+        c2 = n_primes_count_range(123456789UL, 123456789UL + 150000000UL);
+
+        flint_set_num_threads(1);
+
+        if (c1 != 11078937UL
+            || c2 != n_primes_count_range(123456789UL, 123456789UL + 150000000UL)
+            || n_prime_pi(100000000UL) != 5761455UL
+            || n_nth_prime(5761455UL) != 99999989UL)
+        {
+            printf("FAIL (threaded):\n");
+            printf("c1 = %lu, c2 = %lu\n", c1, c2);
+            abort();
+        }
+    }
+
+    flint_randclear(state);
+    printf("PASS\n");
+    return 0;
+}